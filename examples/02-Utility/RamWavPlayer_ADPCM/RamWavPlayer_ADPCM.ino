@@ -0,0 +1,89 @@
+/*
+ * RamWavPlayer_ADPCM  (aka, AudioPlayMemoryI16_F32 with IMA-ADPCM samples)
+ *
+ * Created: OpenAudio, Oct 2026
+ *
+ * Purpose: Plays two audio samples stored in memory as IMA-ADPCM, which takes a quarter of the
+ *    memory of the plain int16 samples used by the RamWavPlayer example.  The samples are
+ *    decoded one sample at a time as they play, so no decoding buffer is needed.
+ *
+ *    To make your own samples, use the "wav2adpcm.py" script that is in this example's folder.
+ *    It reads a WAV file and writes a *.h file like the ones here:
+ *
+ *        python wav2adpcm.py myAudio.wav -o sample_myAudio.h
+ *
+ */
+
+#include <Tympan_Library.h>  //includes "AudioPlayMemoryI16_F32, which is the item being demonstrated here
+
+//include the audio samples (made by wav2adpcm.py)
+#include "sample_YES_adpcm.h"
+#include "sample_NO_adpcm.h"
+
+//set the sample rate and block size
+const float sample_rate_Hz = (int)(44100);  //choose a sample rate (anything up to 96000)
+const int audio_block_samples = 128;        //do not make bigger than AUDIO_BLOCK_SAMPLES from AudioStream.h (which is 128)
+AudioSettings_F32 audio_settings(sample_rate_Hz, audio_block_samples);
+
+//create audio objects
+Tympan                   myTympan(TympanRev::F, audio_settings);   //do TympanRev::D or E or F
+AudioPlayMemoryI16_F32   audioPlayMemory(audio_settings);
+AudioOutputI2S_F32       audioOutput(audio_settings);
+
+//create audio connections
+AudioConnection_F32      patchCord1(audioPlayMemory, 0, audioOutput, 0);
+AudioConnection_F32      patchCord2(audioPlayMemory, 0, audioOutput, 1);
+
+
+void setup() {
+  myTympan.beginBothSerial(); delay(1200);
+  myTympan.print("RamWavPlayer_ADPCM"); myTympan.println(": setup():...");
+  myTympan.print("Sample Rate (Hz): "); myTympan.println(audio_settings.sample_rate_Hz);
+  myTympan.print("Audio Block Size (samples): "); myTympan.println(audio_settings.audio_block_samples);
+
+  // Audio connections require memory to work.
+  AudioMemory_F32(20, audio_settings);
+
+  // Start the Tympan
+  myTympan.enable();
+  myTympan.volume(0.5);  //any value 0 to 1.0??
+
+  //finish setup
+  delay(2000);  //stall a second
+  Serial.println("Setup complete.");
+}
+
+int which_sound = 0, n_sounds = 3; //variables to keep track of which audio samples to play
+void loop() {
+
+  //start an audio sample?
+  if (audioPlayMemory.isPlaying() == false) { //is any audio playing already?
+
+    //start the new audio
+    switch (which_sound) {
+      case 0:
+        Serial.println("Starting sample 'YES'...len = " + String(sample_YES_adpcm_len) + " samples in " + String(sizeof(sample_YES_adpcm)) + " bytes");
+        audioPlayMemory.play(sample_YES_adpcm, sample_YES_adpcm_len, sample_YES_adpcm_sample_rate_Hz, sample_YES_adpcm_block_bytes); //will automatically upsample
+        break;
+      case 1:
+        Serial.println("Starting sample 'NO'...len = " + String(sample_NO_adpcm_len) + " samples in " + String(sizeof(sample_NO_adpcm)) + " bytes");
+        audioPlayMemory.play(sample_NO_adpcm, sample_NO_adpcm_len, sample_NO_adpcm_sample_rate_Hz, sample_NO_adpcm_block_bytes);
+        break;
+      case 2:
+        {
+        Serial.println("Starting combination of 'YES'/'NO' using a queue...");
+        AudioPlayMemoryQueue queue;
+        queue.addSample(sample_YES_adpcm, sample_YES_adpcm_len, sample_YES_adpcm_sample_rate_Hz, sample_YES_adpcm_block_bytes);
+        queue.addSample(sample_NO_adpcm, sample_NO_adpcm_len, sample_NO_adpcm_sample_rate_Hz, sample_NO_adpcm_block_bytes);
+        audioPlayMemory.play(queue);
+        }
+        break;
+    }
+    which_sound = (which_sound+1) % n_sounds; //increment to the next sound
+
+    delay(1500); //stall a bit so that there is some space between the samples
+  }
+
+  //stall, just to be nice?
+  delay(5);
+}
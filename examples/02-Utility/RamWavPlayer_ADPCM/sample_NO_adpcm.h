@@ -0,0 +1,393 @@
+
+// Made by wav2adpcm.py from "NO.wav".
+// IMA-ADPCM, mono, 4 bits per sample, in 256-byte blocks: 12000 samples in 6084 bytes (rather than 24000 bytes as int16).
+// To play it: audioPlayMemory.play(sample_NO_adpcm, sample_NO_adpcm_len, sample_NO_adpcm_sample_rate_Hz, sample_NO_adpcm_block_bytes);
+
+#define SAMPLE_NO_ADPCM_LEN 12000  //number of samples (not bytes)
+const uint32_t sample_NO_adpcm_len = SAMPLE_NO_ADPCM_LEN;
+const float sample_NO_adpcm_sample_rate_Hz = 24000;
+const uint16_t sample_NO_adpcm_block_bytes = 256;
+PROGMEM
+const uint8_t sample_NO_adpcm[6084] = {
+  0xFF, 0xFF, 0x00, 0x00, 0x91, 0x20, 0x99, 0x00, 0x19, 0x19, 0x00, 0x19, 0x19, 0x00, 0x10, 0x91,
+  0x90, 0x90, 0x01, 0x91, 0x91, 0x19, 0x91, 0x00, 0x91, 0xA1, 0x92, 0x91, 0x91, 0x29, 0x99, 0x90,
+  0x90, 0x11, 0x10, 0x19, 0x01, 0xA9, 0x92, 0x00, 0x20, 0x2A, 0x1B, 0x01, 0x09, 0x00, 0x00, 0x90,
+  0x11, 0x19, 0x01, 0xA9, 0x11, 0x29, 0x09, 0x1A, 0x10, 0x00, 0x90, 0x01, 0x00, 0x90, 0x01, 0x00,
+  0x90, 0x11, 0x99, 0x31, 0x0B, 0x91, 0x19, 0x91, 0x90, 0x91, 0x01, 0x90, 0x19, 0x10, 0x91, 0x19,
+  0x90, 0x19, 0x11, 0x19, 0x19, 0x09, 0x00, 0x19, 0x90, 0xA2, 0x91, 0x01, 0x10, 0x91, 0x90, 0x11,
+  0xA0, 0x11, 0xA9, 0x30, 0x91, 0x09, 0x91, 0x99, 0x01, 0x11, 0x19, 0x90, 0x09, 0xA1, 0xA1, 0x12,
+  0x91, 0x11, 0x99, 0x01, 0x91, 0x00, 0x91, 0x90, 0x91, 0x10, 0x91, 0x19, 0x09, 0x91, 0x19, 0x91,
+  0x11, 0x01, 0x1A, 0x10, 0x01, 0x19, 0x91, 0x99, 0x3A, 0x91, 0x99, 0x11, 0xA0, 0x39, 0x00, 0x90,
+  0x00, 0x91, 0x99, 0x29, 0x2A, 0x09, 0x01, 0x99, 0x30, 0x01, 0xAA, 0x23, 0x99, 0x19, 0xA2, 0x99,
+  0x31, 0x9A, 0x91, 0x11, 0x0A, 0x91, 0x90, 0x11, 0x99, 0x93, 0x99, 0x11, 0x19, 0x10, 0x99, 0x19,
+  0x1B, 0x92, 0x0B, 0x00, 0xB1, 0x11, 0xA9, 0x91, 0x90, 0x90, 0x19, 0x02, 0x99, 0x10, 0xA2, 0x91,
+  0x39, 0x99, 0x31, 0x92, 0xA9, 0x23, 0x99, 0x21, 0x12, 0x19, 0x10, 0x10, 0x13, 0x21, 0x10, 0x11,
+  0x1B, 0x12, 0x19, 0xA9, 0x91, 0x99, 0x91, 0x1B, 0x11, 0x9B, 0x00, 0x09, 0x9A, 0xA0, 0x0B, 0xB9,
+  0x99, 0x10, 0xBC, 0x92, 0x9B, 0x09, 0x91, 0x1A, 0x11, 0x99, 0x10, 0x91, 0x11, 0x3A, 0x2A, 0x00,
+  0x39, 0x11, 0x09, 0x13, 0x23, 0x02, 0x11, 0x39, 0x53, 0x29, 0x42, 0x8B, 0x30, 0x91, 0x1A, 0x21,
+  0x1E, 0x00, 0x00, 0x00, 0x09, 0x11, 0x0B, 0xA9, 0xAB, 0x9B, 0xCB, 0x0A, 0x9D, 0x99, 0x90, 0x1A,
+  0xBA, 0x0C, 0xB9, 0x9B, 0xB3, 0x1A, 0xD2, 0x01, 0x15, 0x0A, 0x32, 0xD0, 0x59, 0x82, 0x19, 0x04,
+  0x08, 0x43, 0x18, 0x91, 0xC0, 0x21, 0x42, 0x31, 0x05, 0x9A, 0x12, 0x2B, 0x43, 0xB8, 0xFB, 0x99,
+  0x29, 0x22, 0x11, 0xCB, 0xD8, 0x90, 0x21, 0x91, 0xB9, 0x3C, 0x50, 0x43, 0x12, 0x91, 0xAA, 0x31,
+  0x42, 0x43, 0xB0, 0x10, 0x23, 0x51, 0x14, 0xDB, 0xB9, 0xAA, 0x29, 0x22, 0xBB, 0xF9, 0xA9, 0x01,
+  0xAB, 0xE9, 0xAC, 0x99, 0x10, 0x43, 0x10, 0xB9, 0xC8, 0xCB, 0xA9, 0x99, 0x99, 0x91, 0xB2, 0xB9,
+  0xBB, 0x90, 0xCA, 0xDE, 0xCB, 0xAB, 0x28, 0x54, 0x13, 0xA0, 0xBD, 0x9A, 0x31, 0x36, 0x02, 0xAB,
+  0x9A, 0x30, 0x57, 0x92, 0xDB, 0xBD, 0xAB, 0x09, 0x98, 0xDA, 0xBD, 0xBD, 0x9A, 0x99, 0xBA, 0xCC,
+  0xAB, 0x10, 0x44, 0x43, 0x22, 0x23, 0x45, 0x44, 0x34, 0x43, 0x33, 0x44, 0x33, 0x24, 0x33, 0x32,
+  0x22, 0x33, 0x34, 0x32, 0x12, 0x80, 0xA9, 0xCC, 0xBD, 0xCD, 0xBB, 0xBC, 0xBC, 0xCB, 0xCB, 0xBC,
+  0xBC, 0xCB, 0xBA, 0xBB, 0xAC, 0xAB, 0xAB, 0xAB, 0xAA, 0xBB, 0xBB, 0xAA, 0x28, 0x35, 0x45, 0x23,
+  0x24, 0x33, 0x35, 0x33, 0x25, 0x33, 0x45, 0x43, 0x33, 0x24, 0x12, 0x11, 0x21, 0x43, 0x34, 0x23,
+  0x22, 0x33, 0x34, 0x01, 0xCA, 0xBC, 0x08, 0x00, 0xB9, 0xCE, 0xBC, 0xBA, 0xEB, 0xCD, 0xCD, 0xBC,
+  0x9A, 0x08, 0x80, 0xDA, 0xBD, 0x99, 0x21, 0x32, 0x00, 0x99, 0x62, 0x56, 0x34, 0x23, 0x01, 0x00,
+  0x52, 0x34, 0x14, 0x01, 0x08, 0x31, 0x43, 0x02, 0xA9, 0xCD, 0xAA, 0x88, 0x01, 0x98, 0xCD, 0xCB,
+  0x99, 0xA9, 0xEB, 0xBC, 0xAB, 0xAA, 0x98, 0x99, 0xBA, 0xCD, 0xBB, 0xAA, 0x99, 0x99, 0xAB, 0x18,
+  0xCA, 0xF1, 0x1D, 0x00, 0x46, 0x22, 0x80, 0x99, 0xA9, 0x28, 0x54, 0x34, 0x23, 0x12, 0x53, 0x43,
+  0x12, 0x80, 0x08, 0x42, 0x46, 0x43, 0x23, 0x02, 0x80, 0x08, 0x11, 0x81, 0xBA, 0x9B, 0x51, 0x34,
+  0x01, 0xDA, 0xDD, 0xCB, 0x8A, 0x10, 0x13, 0xA0, 0x9A, 0x31, 0x25, 0xA0, 0xAB, 0x30, 0x47, 0x33,
+  0x43, 0x34, 0x33, 0x02, 0xA8, 0xFD, 0xBD, 0x9C, 0x28, 0x22, 0xC8, 0xCE, 0x9B, 0x28, 0x12, 0x90,
+  0xBB, 0x29, 0x66, 0x44, 0x33, 0x01, 0x88, 0x28, 0x45, 0x24, 0x00, 0x89, 0x20, 0x53, 0x02, 0xA9,
+  0xCC, 0xBA, 0x9A, 0x08, 0x80, 0xCA, 0xAE, 0x9B, 0x99, 0xDA, 0xBD, 0xAD, 0x99, 0x88, 0x99, 0x99,
+  0xBA, 0xCC, 0xBB, 0xAA, 0x98, 0xBA, 0x9B, 0x51, 0x45, 0x12, 0x81, 0x88, 0x08, 0x20, 0x55, 0x43,
+  0x32, 0x22, 0x53, 0x24, 0x13, 0x01, 0x10, 0x43, 0x45, 0x43, 0x23, 0x12, 0x80, 0x11, 0x21, 0x91,
+  0xB9, 0x8A, 0x32, 0x34, 0x12, 0xE9, 0xDE, 0xCB, 0x9A, 0x18, 0x01, 0xB9, 0xBC, 0x89, 0x11, 0xB8,
+  0xDC, 0x9A, 0x18, 0x32, 0x63, 0x33, 0x23, 0x80, 0xA9, 0xFB, 0xDF, 0xBC, 0x9A, 0x21, 0x02, 0xFC,
+  0xBB, 0x8B, 0x18, 0x02, 0xA8, 0x99, 0x48, 0x56, 0x44, 0x23, 0x01, 0x88, 0x30, 0x37, 0x23, 0x00,
+  0x08, 0x41, 0x33, 0x02, 0xB9, 0xCD, 0xBB, 0x9A, 0x10, 0x01, 0xDA, 0xCD, 0xAA, 0x98, 0xC9, 0xCC,
+  0xAC, 0x9A, 0x89, 0x89, 0x88, 0xDA, 0xCC, 0xAB, 0x89, 0x88, 0xA9, 0xAA, 0x20, 0x54, 0x23, 0x02,
+  0x90, 0x9A, 0x30, 0x77, 0x32, 0x11, 0x00, 0x41, 0x34, 0x33, 0x02, 0x00, 0x31, 0x56, 0x43, 0x22,
+  0x80, 0x88, 0x30, 0x25, 0x00, 0xAA, 0xAA, 0x89, 0x20, 0x03, 0xFB, 0xCF, 0x9A, 0x09, 0x10, 0x98,
+  0xDC, 0xBB, 0x89, 0x10, 0xA9, 0xCB, 0x9A, 0x31, 0x35, 0x24, 0x22, 0x98, 0x19, 0x47, 0x13, 0xD9,
+  0x1A, 0x00, 0x2A, 0x00, 0xAF, 0x38, 0x47, 0x91, 0xDD, 0x9B, 0x10, 0x12, 0x80, 0x89, 0x89, 0x10,
+  0x34, 0x35, 0x02, 0xA8, 0x0A, 0x66, 0x34, 0x02, 0xA9, 0x8A, 0x31, 0x14, 0xC9, 0xAC, 0x8A, 0x90,
+  0x80, 0x21, 0xB8, 0xFF, 0xAA, 0x18, 0x22, 0x90, 0xBC, 0x8A, 0x21, 0x81, 0xCB, 0xBC, 0xBB, 0x89,
+  0x54, 0x13, 0xB8, 0xBC, 0x0A, 0x31, 0x25, 0x23, 0x80, 0x28, 0x56, 0x23, 0x90, 0xBA, 0x1A, 0x55,
+  0x34, 0x12, 0x00, 0x99, 0x09, 0x52, 0x12, 0xB8, 0x89, 0x43, 0x03, 0xC9, 0xCD, 0xCC, 0xAB, 0x08,
+  0x00, 0xC9, 0xAD, 0x89, 0x88, 0xA9, 0x19, 0x43, 0x13, 0x99, 0x41, 0x35, 0x01, 0x51, 0x46, 0x23,
+  0x01, 0x90, 0xCB, 0xBB, 0x9A, 0x80, 0xFD, 0xFF, 0xAB, 0x31, 0x27, 0x81, 0xDB, 0x9A, 0x32, 0x24,
+  0x81, 0x89, 0x41, 0x24, 0x01, 0x98, 0x88, 0xB9, 0xBB, 0x38, 0x45, 0xA1, 0xCF, 0xBB, 0x18, 0x11,
+  0xB9, 0x9D, 0x28, 0x33, 0x81, 0x9A, 0x18, 0x80, 0x88, 0x74, 0x36, 0x12, 0xB9, 0x9B, 0x30, 0x02,
+  0xEB, 0xAB, 0x28, 0x02, 0xE9, 0xCB, 0x9A, 0xAA, 0x9B, 0x51, 0x34, 0x11, 0x00, 0x20, 0x32, 0x25,
+  0x33, 0x44, 0x43, 0x02, 0x81, 0xA0, 0xCC, 0xAB, 0x09, 0xA9, 0x9B, 0xDA, 0xCD, 0xBB, 0x98, 0x88,
+  0x11, 0x23, 0x11, 0x21, 0xC1, 0xAF, 0x40, 0x46, 0x22, 0x00, 0x18, 0x22, 0x82, 0xCA, 0xAB, 0x10,
+  0x02, 0xEB, 0xAB, 0x88, 0xB9, 0xAE, 0x29, 0x35, 0x81, 0xCA, 0xBC, 0xAB, 0x8A, 0xFB, 0xFF, 0x9E,
+  0x31, 0x35, 0x81, 0xCA, 0x9B, 0x31, 0x25, 0x81, 0x08, 0x41, 0x23, 0x91, 0xA9, 0xBA, 0xCB, 0xBB,
+  0x09, 0x53, 0x82, 0xDE, 0xAC, 0x0A, 0x21, 0x80, 0x98, 0x21, 0x45, 0x02, 0x90, 0x88, 0x88, 0x88,
+  0x41, 0x46, 0x12, 0xD9, 0xAC, 0x0A, 0x80, 0xA8, 0xBB, 0x18, 0x32, 0xA0, 0xCD, 0xBB, 0xAD, 0x29,
+  0x0D, 0xCD, 0x3A, 0x00, 0x67, 0x02, 0x00, 0x89, 0x88, 0x11, 0x12, 0x10, 0x32, 0x13, 0x88, 0xC8,
+  0xEF, 0xAB, 0x09, 0x01, 0x01, 0x01, 0xB9, 0xAC, 0x08, 0x08, 0x32, 0x25, 0x11, 0x34, 0x13, 0xEC,
+  0xBB, 0x19, 0x63, 0x13, 0x81, 0x08, 0x01, 0xC8, 0xBC, 0x88, 0x21, 0x91, 0xBC, 0x2A, 0x45, 0x92,
+  0xCB, 0x29, 0x56, 0x12, 0x99, 0xCB, 0x9A, 0x99, 0xFC, 0xCF, 0x9A, 0x61, 0x34, 0x91, 0xCB, 0x8B,
+  0x40, 0x23, 0x81, 0x00, 0x43, 0x14, 0x80, 0xAA, 0x9A, 0xCB, 0xBB, 0x1A, 0x34, 0x83, 0xEE, 0xCB,
+  0x89, 0x11, 0x01, 0x88, 0x31, 0x44, 0x23, 0x80, 0x99, 0x98, 0x99, 0x40, 0x56, 0x13, 0xB9, 0xBE,
+  0x99, 0x88, 0xA8, 0xAB, 0x09, 0x32, 0x02, 0xDB, 0xAB, 0xDB, 0xBC, 0x78, 0x46, 0x12, 0x90, 0x98,
+  0x98, 0x00, 0x12, 0x00, 0x18, 0x43, 0x80, 0xAA, 0xFC, 0xCC, 0x99, 0x11, 0x02, 0x10, 0x80, 0xAB,
+  0x0A, 0x21, 0x11, 0x21, 0x35, 0x33, 0x23, 0xD9, 0xCC, 0x19, 0x23, 0x02, 0x42, 0x34, 0xA2, 0xCF,
+  0xAA, 0x09, 0x12, 0x90, 0x89, 0x52, 0x15, 0xB8, 0xAB, 0x40, 0x36, 0x23, 0x81, 0x9A, 0xCA, 0xCD,
+  0xCB, 0xDC, 0xBD, 0x1A, 0x65, 0x23, 0xB8, 0xBD, 0x09, 0x43, 0x12, 0x80, 0x20, 0x44, 0x02, 0x99,
+  0x9A, 0xA8, 0xCC, 0xBB, 0x28, 0x35, 0xA0, 0xCE, 0xAB, 0x18, 0x02, 0x90, 0x18, 0x54, 0x33, 0x02,
+  0x80, 0x08, 0x98, 0xCB, 0x38, 0x47, 0x02, 0xCA, 0xBC, 0x89, 0x80, 0xCA, 0xBB, 0x28, 0x43, 0x81,
+  0x8A, 0x18, 0x90, 0xCC, 0x39, 0x77, 0x23, 0x01, 0x98, 0x88, 0x88, 0x99, 0x8A, 0x21, 0x25, 0x90,
+  0xBB, 0xCB, 0xCE, 0xAC, 0x09, 0x21, 0x12, 0x12, 0x01, 0x12, 0x91, 0xCB, 0x19, 0x45, 0x13, 0x90,
+  0x09, 0x42, 0x02, 0xDC, 0xAB, 0x30, 0x25, 0x80, 0xAB, 0x8A, 0x90, 0xFB, 0x9A, 0x41, 0x35, 0x80,
+  0x65, 0x03, 0x36, 0x00, 0x8A, 0x62, 0x34, 0x03, 0xA8, 0x9A, 0xA8, 0xDC, 0xCC, 0xDD, 0xCC, 0x09,
+  0x54, 0x23, 0xB0, 0xCC, 0x0A, 0x33, 0x24, 0x88, 0x18, 0x44, 0x13, 0x90, 0x9A, 0xAB, 0xDC, 0xBB,
+  0x19, 0x32, 0x92, 0xCF, 0xAB, 0x18, 0x22, 0x88, 0x09, 0x62, 0x35, 0x23, 0x01, 0x08, 0x99, 0xBA,
+  0x0A, 0x52, 0x03, 0xFA, 0xAC, 0x8A, 0x00, 0xDA, 0xBC, 0x89, 0x22, 0x23, 0x10, 0x20, 0x23, 0xA0,
+  0x2A, 0x77, 0x24, 0x00, 0x98, 0x00, 0x81, 0xA9, 0xBD, 0x8B, 0x11, 0x90, 0xAA, 0x08, 0xFA, 0xBC,
+  0x88, 0x21, 0x22, 0x33, 0x42, 0x45, 0x13, 0xA8, 0x8A, 0x80, 0xEA, 0xAC, 0x0A, 0x42, 0x23, 0xA0,
+  0x8A, 0x20, 0x82, 0xEB, 0xAB, 0x18, 0x11, 0x80, 0x28, 0x57, 0x13, 0xB8, 0xBC, 0x30, 0x45, 0x43,
+  0x32, 0x14, 0x80, 0xDA, 0xBD, 0xBC, 0xDC, 0xCD, 0x9B, 0x52, 0x35, 0x81, 0xCB, 0x9B, 0x31, 0x25,
+  0x81, 0x08, 0x53, 0x24, 0x81, 0xA8, 0xA9, 0xDB, 0xBC, 0xAA, 0x10, 0x12, 0xD9, 0xAC, 0x0A, 0x22,
+  0x81, 0x99, 0x30, 0x57, 0x33, 0x23, 0x02, 0x81, 0xBA, 0xAD, 0x0A, 0x00, 0xC8, 0xBD, 0x9B, 0x18,
+  0x90, 0xDE, 0xAB, 0x09, 0x31, 0x32, 0x43, 0x44, 0x02, 0x00, 0x10, 0x33, 0x02, 0xCA, 0x8A, 0x62,
+  0x12, 0xCA, 0xBD, 0x9A, 0x89, 0x98, 0x09, 0x10, 0x02, 0x98, 0x08, 0x22, 0x23, 0x11, 0x64, 0x45,
+  0x34, 0x03, 0xCA, 0xCD, 0xCB, 0xAA, 0x10, 0x34, 0x23, 0x12, 0x11, 0x11, 0x91, 0xDD, 0xBC, 0x09,
+  0x32, 0x34, 0x22, 0x33, 0x91, 0xCD, 0x9C, 0x18, 0x42, 0x43, 0x12, 0x12, 0x21, 0xFA, 0xCE, 0xBB,
+  0xDB, 0xCD, 0xAA, 0x42, 0x36, 0x82, 0xCA, 0x9A, 0x41, 0x24, 0x80, 0x88, 0x52, 0x24, 0x01, 0xA8,
+  0xAA, 0xEA, 0xCB, 0xAB, 0x09, 0x12, 0xA8, 0x9C, 0x18, 0x34, 0x02, 0xAA, 0x18, 0x56, 0x34, 0x23,
+  0xB8, 0x55, 0x44, 0x00, 0x11, 0xA0, 0xDB, 0xBB, 0x9A, 0xA9, 0xCD, 0x9B, 0x18, 0x22, 0xC8, 0xBD,
+  0x9C, 0x10, 0x23, 0x32, 0x45, 0x43, 0x12, 0x00, 0x08, 0x90, 0xDA, 0xAB, 0x29, 0x34, 0x81, 0xDB,
+  0xAA, 0x88, 0xA9, 0xAC, 0x19, 0x52, 0x12, 0x22, 0x43, 0x03, 0xDC, 0xAC, 0x10, 0x34, 0x02, 0xB9,
+  0x8A, 0x80, 0xFA, 0x9C, 0x28, 0x53, 0x12, 0x21, 0x53, 0x33, 0xD8, 0xCD, 0x9B, 0x09, 0x00, 0x10,
+  0x52, 0x43, 0x01, 0xA9, 0xBB, 0x09, 0x10, 0x32, 0x44, 0x44, 0x23, 0x90, 0xDC, 0xCD, 0xBB, 0xDC,
+  0xBC, 0x0B, 0x64, 0x33, 0x90, 0xBB, 0x09, 0x45, 0x03, 0xA8, 0x19, 0x55, 0x13, 0x81, 0xA9, 0xBA,
+  0xCC, 0xCC, 0x9A, 0x08, 0x01, 0x98, 0x09, 0x43, 0x25, 0x91, 0xA9, 0x19, 0x73, 0x43, 0x22, 0x10,
+  0x80, 0xA8, 0xDB, 0xCB, 0xBB, 0xBC, 0xBB, 0x09, 0x53, 0x03, 0xB8, 0xAC, 0x18, 0x43, 0x22, 0x21,
+  0x55, 0x43, 0x11, 0x00, 0x80, 0xCA, 0xBD, 0xAA, 0x10, 0x01, 0xA9, 0x9A, 0x41, 0x23, 0xC9, 0xAD,
+  0x18, 0x21, 0x42, 0x33, 0x34, 0x81, 0xCB, 0xAA, 0x21, 0xB1, 0xCF, 0x9A, 0x10, 0x81, 0x89, 0x62,
+  0x44, 0x11, 0x80, 0x22, 0x24, 0xD9, 0xBE, 0x9B, 0x10, 0x00, 0x98, 0x08, 0x44, 0x14, 0x90, 0x89,
+  0x41, 0x33, 0x02, 0x99, 0x61, 0x13, 0xB0, 0xFD, 0xBB, 0xBC, 0xCC, 0xCF, 0xAB, 0x31, 0x46, 0x01,
+  0xA9, 0x89, 0x42, 0x25, 0x80, 0x99, 0x21, 0x35, 0x02, 0x98, 0xAA, 0xDC, 0xDB, 0xAB, 0x99, 0x80,
+  0x88, 0x89, 0x42, 0x45, 0x12, 0x98, 0x99, 0x31, 0x54, 0x23, 0x12, 0x81, 0x90, 0xBA, 0xCD, 0xBC,
+  0xCC, 0xBA, 0x99, 0x20, 0x43, 0x81, 0xA9, 0x08, 0x42, 0x24, 0x01, 0x22, 0x54, 0x33, 0x32, 0x80,
+  0xDC, 0xBC, 0xAA, 0x88, 0x80, 0xB9, 0x8C, 0x62, 0x23, 0x80, 0x89, 0x88, 0x20, 0x43, 0x80, 0x0A,
+  0xE4, 0x05, 0x31, 0x00, 0x91, 0xBC, 0x28, 0x83, 0xEE, 0xBB, 0x0A, 0x41, 0x33, 0x11, 0x64, 0x34,
+  0x03, 0x99, 0x8A, 0x88, 0xFB, 0xBC, 0x9B, 0x08, 0x90, 0xAB, 0x28, 0x56, 0x13, 0x01, 0x20, 0x44,
+  0x13, 0x80, 0xBB, 0x8B, 0x22, 0x01, 0xFA, 0xBF, 0xBC, 0xCB, 0xDD, 0xBD, 0x19, 0x73, 0x22, 0x90,
+  0x8A, 0x30, 0x27, 0x82, 0x99, 0x09, 0x53, 0x13, 0x88, 0xAA, 0xBB, 0xCD, 0xBD, 0xAA, 0x88, 0x80,
+  0x99, 0x10, 0x46, 0x24, 0x81, 0x98, 0x18, 0x43, 0x23, 0x01, 0x00, 0x01, 0xA8, 0xCE, 0xBC, 0xBB,
+  0xCC, 0xAC, 0x08, 0x31, 0x13, 0x80, 0x18, 0x44, 0x33, 0x01, 0x08, 0x32, 0x34, 0x33, 0x34, 0x91,
+  0xDD, 0xBD, 0x9B, 0x89, 0xB8, 0xBC, 0x1A, 0x45, 0x33, 0x11, 0x80, 0x09, 0x00, 0x01, 0x21, 0x43,
+  0xA1, 0xAC, 0x20, 0x03, 0xFC, 0xBE, 0x9A, 0x11, 0x12, 0x00, 0x41, 0x35, 0x13, 0x00, 0x10, 0x02,
+  0xFA, 0xBE, 0x9B, 0x00, 0x90, 0xBB, 0x28, 0x57, 0x13, 0x01, 0x88, 0x10, 0x02, 0xB8, 0xBB, 0x48,
+  0x26, 0x81, 0xBA, 0xCD, 0xBB, 0xCD, 0xDC, 0xBE, 0x9B, 0x51, 0x34, 0x02, 0x99, 0x19, 0x54, 0x23,
+  0x98, 0x9A, 0x41, 0x24, 0x02, 0x99, 0xBA, 0xDC, 0xBC, 0xAD, 0x99, 0x88, 0x99, 0x19, 0x62, 0x34,
+  0x22, 0x80, 0x88, 0x20, 0x24, 0x12, 0x00, 0x80, 0x90, 0xB9, 0xCC, 0xCD, 0xBD, 0xBC, 0x9A, 0x10,
+  0x21, 0x01, 0x28, 0x73, 0x34, 0x12, 0x80, 0x08, 0x80, 0x00, 0x11, 0x02, 0xFA, 0xAE, 0x8A, 0x00,
+  0x90, 0xCB, 0xAC, 0x48, 0x35, 0x02, 0x10, 0x22, 0x13, 0x22, 0x81, 0xDE, 0x9C, 0xAA, 0x89, 0x21,
+  0x02, 0xBA, 0x38, 0x16, 0x90, 0x9A, 0x10, 0x73, 0x33, 0x22, 0x53, 0x24, 0xC8, 0xCD, 0xAB, 0xAA,
+  0xAA, 0xAB, 0x28, 0x56, 0x24, 0x12, 0x10, 0x10, 0x80, 0xB9, 0xAC, 0x0A, 0x41, 0x13, 0xB8, 0xBB,
+  0x6F, 0x09, 0x31, 0x00, 0xEB, 0xCC, 0xEB, 0xCC, 0xBD, 0x8A, 0x63, 0x43, 0x01, 0x99, 0x28, 0x45,
+  0x12, 0xA8, 0x9A, 0x31, 0x34, 0x81, 0xA9, 0xCB, 0xCC, 0xBC, 0xBC, 0x99, 0x99, 0xA9, 0x19, 0x55,
+  0x34, 0x12, 0x81, 0x18, 0x31, 0x23, 0x91, 0x9A, 0x8A, 0x89, 0x89, 0xBA, 0xDF, 0xBD, 0xAD, 0x9A,
+  0x00, 0x81, 0x89, 0x38, 0x56, 0x33, 0x12, 0x88, 0x89, 0x00, 0x08, 0x80, 0xC9, 0xCC, 0x0A, 0x32,
+  0x14, 0xB8, 0xCF, 0xAB, 0x21, 0x33, 0x21, 0x32, 0x43, 0x54, 0x23, 0xB8, 0xBF, 0xAA, 0xAB, 0x89,
+  0x10, 0x10, 0x21, 0x25, 0x23, 0x22, 0xA0, 0xAB, 0x60, 0x35, 0x24, 0x12, 0x01, 0xBA, 0xCD, 0xCD,
+  0xCB, 0xBB, 0xAB, 0x18, 0x64, 0x33, 0x33, 0x21, 0x23, 0x12, 0xA0, 0xDC, 0xCB, 0x99, 0x18, 0x32,
+  0x82, 0xAA, 0xAA, 0xDB, 0xDD, 0xCD, 0xCE, 0xAB, 0x18, 0x45, 0x23, 0x80, 0x89, 0x52, 0x34, 0x82,
+  0xBA, 0x8A, 0x42, 0x22, 0x91, 0xBA, 0xBC, 0xCC, 0xCC, 0xAA, 0xAA, 0xAA, 0xBB, 0x30, 0x57, 0x33,
+  0x12, 0x00, 0x10, 0x32, 0x03, 0xB8, 0xBC, 0x0A, 0x41, 0x23, 0xA1, 0xDD, 0xBD, 0xAC, 0x99, 0x99,
+  0xBA, 0x9A, 0x41, 0x36, 0x25, 0x12, 0x00, 0x88, 0x88, 0x18, 0x11, 0x98, 0xBC, 0x8A, 0x73, 0x15,
+  0xB8, 0xBD, 0x9B, 0x09, 0x10, 0x02, 0x10, 0x55, 0x34, 0x11, 0x01, 0xCA, 0xBE, 0x9B, 0x09, 0x10,
+  0x11, 0x00, 0x42, 0x36, 0x01, 0x9A, 0x88, 0x80, 0x00, 0x12, 0x22, 0x34, 0xB2, 0xFF, 0xBA, 0xCA,
+  0xCC, 0x9A, 0x18, 0x53, 0x53, 0x22, 0x23, 0x22, 0x12, 0xB9, 0xBE, 0xAC, 0x9A, 0x88, 0x80, 0x21,
+  0x23, 0x11, 0xB8, 0xCF, 0xCC, 0xDB, 0xCC, 0x9C, 0x20, 0x45, 0x12, 0x80, 0x00, 0x53, 0x24, 0x90,
+  0xBB, 0x8A, 0x42, 0x12, 0x91, 0xA9, 0xAB, 0xDA, 0xCD, 0xAB, 0xBB, 0xDB, 0xAA, 0x18, 0x45, 0x34,
+  0xB6, 0xF9, 0x46, 0x00, 0x01, 0x10, 0x32, 0x33, 0x90, 0xCB, 0x9A, 0x20, 0x24, 0x82, 0xDB, 0xCD,
+  0xBB, 0xBB, 0xA9, 0xCB, 0xBC, 0x09, 0x62, 0x34, 0x22, 0x01, 0x11, 0x22, 0x32, 0x33, 0x83, 0xFB,
+  0x9C, 0x20, 0x24, 0xB8, 0xCE, 0xBB, 0x09, 0x32, 0xA0, 0x9B, 0x38, 0x54, 0x34, 0x23, 0xA8, 0xAB,
+  0xA9, 0x8A, 0x21, 0x91, 0xBE, 0x38, 0x45, 0x22, 0x01, 0xA9, 0xAB, 0x88, 0x88, 0x10, 0x82, 0xFD,
+  0xBC, 0x08, 0x90, 0xED, 0xBC, 0x8A, 0x42, 0x25, 0x22, 0x41, 0x44, 0x23, 0x01, 0xBA, 0xCD, 0xAB,
+  0xAA, 0x99, 0x88, 0x20, 0x43, 0x44, 0x02, 0xCA, 0xCD, 0xCA, 0xDB, 0xCB, 0x09, 0x73, 0x23, 0x01,
+  0x88, 0x30, 0x36, 0x83, 0xC9, 0x9A, 0x31, 0x24, 0x81, 0xA9, 0x99, 0xA8, 0xEC, 0xCC, 0xAB, 0xBA,
+  0xCB, 0x8A, 0x31, 0x36, 0x33, 0x22, 0x43, 0x44, 0x12, 0x90, 0xAA, 0x99, 0x80, 0x80, 0xA9, 0xAB,
+  0xDA, 0xCC, 0xBC, 0xCB, 0xCB, 0xCB, 0x8A, 0x21, 0x35, 0x43, 0x32, 0x33, 0x24, 0x12, 0x80, 0xA9,
+  0xAA, 0x09, 0x42, 0x33, 0xC8, 0xCE, 0xBB, 0xAB, 0xDB, 0xCB, 0xAA, 0x20, 0x54, 0x33, 0x23, 0x11,
+  0x08, 0x18, 0x21, 0x22, 0xA8, 0x9D, 0x30, 0x35, 0xB8, 0xCF, 0xBB, 0x99, 0x89, 0x89, 0x61, 0x34,
+  0x03, 0x99, 0x89, 0x21, 0xE9, 0xCE, 0x9A, 0x30, 0x34, 0x22, 0x31, 0x54, 0x14, 0x91, 0xBB, 0xAD,
+  0xBA, 0xCB, 0xBB, 0x08, 0x53, 0x24, 0x22, 0x22, 0x02, 0xD8, 0xDC, 0xCB, 0xBB, 0xBE, 0x9B, 0x50,
+  0x35, 0x12, 0x90, 0x08, 0x45, 0x33, 0xA0, 0xBA, 0x28, 0x45, 0x11, 0x98, 0xBA, 0xBB, 0xDC, 0xBC,
+  0xBB, 0xBB, 0xAC, 0x9B, 0x41, 0x35, 0x24, 0x12, 0x21, 0x53, 0x33, 0x02, 0x80, 0x88, 0x08, 0x99,
+  0xCA, 0xBD, 0xBD, 0xCC, 0xAA, 0x99, 0x98, 0xCB, 0xBB, 0x09, 0x53, 0x24, 0x32, 0x52, 0x44, 0x33,
+  0x7A, 0x24, 0x3E, 0x00, 0x23, 0x01, 0xA8, 0xCC, 0xAB, 0xBA, 0xCD, 0xBC, 0x89, 0x20, 0x12, 0xA0,
+  0xAA, 0x51, 0x35, 0x00, 0x00, 0x32, 0x44, 0x34, 0x82, 0x99, 0x99, 0xFB, 0xCB, 0xAA, 0xBB, 0x9C,
+  0x08, 0x42, 0x44, 0x34, 0x22, 0x21, 0x01, 0xC9, 0xCB, 0xBB, 0xAC, 0xAB, 0x99, 0x08, 0x52, 0x33,
+  0x33, 0x33, 0x24, 0x81, 0xCA, 0xBA, 0x9B, 0x00, 0xA0, 0x99, 0x74, 0x34, 0x02, 0xA8, 0xCC, 0xBB,
+  0xCC, 0xBD, 0xBD, 0xDC, 0xBC, 0x8B, 0x62, 0x43, 0x01, 0x08, 0x41, 0x45, 0x12, 0x90, 0x9A, 0x20,
+  0x32, 0x81, 0xBA, 0xBC, 0xBA, 0xEB, 0xCC, 0xDB, 0xBA, 0xBB, 0x9A, 0x20, 0x44, 0x34, 0x43, 0x32,
+  0x34, 0x24, 0x02, 0xA9, 0xBA, 0x89, 0x88, 0xB9, 0xCD, 0xBA, 0xBB, 0xBB, 0xDB, 0xCB, 0xBD, 0x9B,
+  0x18, 0x43, 0x33, 0x33, 0x55, 0x34, 0x24, 0x22, 0x01, 0x88, 0x9A, 0xBA, 0xCA, 0xCD, 0xBD, 0x9C,
+  0x18, 0x10, 0x80, 0x98, 0x00, 0x73, 0x33, 0x01, 0x01, 0x22, 0x33, 0x44, 0x82, 0xCB, 0xBC, 0xCA,
+  0xBA, 0xB9, 0xDB, 0xAA, 0x31, 0x45, 0x33, 0x24, 0x11, 0x11, 0x02, 0xB9, 0xBE, 0xBD, 0xCB, 0xAA,
+  0x88, 0x01, 0x11, 0x32, 0x46, 0x44, 0x23, 0x90, 0xA9, 0x9A, 0xA9, 0xBA, 0xCB, 0x8B, 0x61, 0x34,
+  0x13, 0x81, 0xDA, 0xDC, 0xBA, 0xAB, 0xCB, 0xCB, 0xBD, 0x8C, 0x61, 0x44, 0x02, 0x90, 0x89, 0x41,
+  0x34, 0x81, 0xBA, 0x19, 0x54, 0x33, 0x81, 0xC9, 0xBB, 0xBA, 0xBD, 0xBD, 0xBB, 0xAC, 0x99, 0x10,
+  0x54, 0x33, 0x12, 0x01, 0x21, 0x35, 0x14, 0x90, 0xAA, 0x09, 0x32, 0x13, 0xD9, 0xBD, 0xAB, 0xA9,
+  0xDB, 0xCB, 0xBC, 0xBB, 0x9A, 0x20, 0x44, 0x22, 0x22, 0x63, 0x45, 0x23, 0x13, 0x08, 0x89, 0x89,
+  0xB9, 0xED, 0xCB, 0xAB, 0x89, 0x10, 0x12, 0x01, 0x20, 0x44, 0x32, 0x11, 0x80, 0x9A, 0x41, 0x45,
+  0x0B, 0x0E, 0x34, 0x00, 0x32, 0x22, 0xB8, 0xCC, 0xDB, 0xCC, 0xCB, 0x9A, 0x09, 0x21, 0x44, 0x43,
+  0x33, 0x33, 0x81, 0xB9, 0xBD, 0xBD, 0xAC, 0x9A, 0x28, 0x43, 0x33, 0x24, 0x22, 0x22, 0xA8, 0xDD,
+  0xCB, 0xAA, 0x89, 0x88, 0x01, 0x53, 0x34, 0x34, 0x11, 0x98, 0xA9, 0xCB, 0xBD, 0xBC, 0xAA, 0x88,
+  0x98, 0xCA, 0xCC, 0xBB, 0x29, 0x45, 0x13, 0xA0, 0x19, 0x75, 0x35, 0x14, 0x00, 0x10, 0x42, 0x23,
+  0x91, 0xEB, 0xBB, 0xBA, 0xCA, 0xCC, 0xBB, 0xAB, 0x8A, 0x08, 0x32, 0x53, 0x42, 0x22, 0x34, 0x53,
+  0x22, 0x02, 0x01, 0x22, 0x24, 0x02, 0xDA, 0xCC, 0xBA, 0xCB, 0xDB, 0xBB, 0xBC, 0xAA, 0x88, 0x22,
+  0x24, 0x33, 0x53, 0x44, 0x33, 0x13, 0x80, 0x99, 0x89, 0x00, 0x88, 0xB9, 0xDC, 0xCB, 0xBB, 0xBC,
+  0xA9, 0xCA, 0x9C, 0x38, 0x46, 0x43, 0x43, 0x12, 0x32, 0x24, 0x81, 0xA9, 0xDB, 0xCC, 0xBB, 0xBB,
+  0xBB, 0x99, 0x80, 0x31, 0x45, 0x43, 0x22, 0x33, 0x33, 0x33, 0x23, 0x88, 0xAA, 0xDC, 0xCC, 0xBB,
+  0xBC, 0xAB, 0xAB, 0x9A, 0x31, 0x44, 0x12, 0x01, 0x28, 0x73, 0x22, 0x88, 0x08, 0x53, 0x24, 0x02,
+  0xDB, 0xBC, 0xBA, 0xCA, 0xCC, 0xCB, 0xAB, 0x19, 0x22, 0x91, 0xCF, 0xAC, 0x29, 0x45, 0x12, 0x99,
+  0x0A, 0x74, 0x34, 0x23, 0x11, 0x21, 0x44, 0x23, 0x90, 0xDB, 0xBC, 0xCB, 0xBB, 0xBC, 0xBC, 0xAA,
+  0x8A, 0x08, 0x31, 0x34, 0x24, 0x33, 0x44, 0x43, 0x23, 0x12, 0x10, 0x21, 0x22, 0x01, 0xCA, 0xCD,
+  0xBC, 0xBC, 0xBB, 0xCC, 0xCB, 0xAB, 0x9A, 0x20, 0x22, 0x21, 0x52, 0x44, 0x43, 0x22, 0x11, 0x01,
+  0x80, 0x00, 0x08, 0x98, 0xCA, 0x9B, 0x18, 0x42, 0x23, 0x90, 0x0A, 0x53, 0x13, 0x90, 0x88, 0x30,
+  0x47, 0x92, 0xDC, 0xAB, 0xCB, 0xCC, 0xBC, 0xBC, 0x8A, 0x20, 0x42, 0x54, 0x34, 0x34, 0x33, 0x23,
+  0xD2, 0x10, 0x2C, 0x00, 0x00, 0xBA, 0xCD, 0xBC, 0xCB, 0xBA, 0xAB, 0xA9, 0x08, 0x11, 0x11, 0x10,
+  0x11, 0x01, 0x00, 0x21, 0x44, 0x34, 0x46, 0x34, 0x25, 0x22, 0x01, 0x80, 0xA8, 0xEC, 0xBC, 0xAC,
+  0xAA, 0xA9, 0xA9, 0x08, 0x32, 0x14, 0xB8, 0xCE, 0xBB, 0x9B, 0x88, 0xA0, 0x89, 0x72, 0x77, 0x33,
+  0x34, 0x32, 0x43, 0x32, 0x13, 0x90, 0xDB, 0xCC, 0xCB, 0xCB, 0xCA, 0xAA, 0xAA, 0x99, 0x08, 0x00,
+  0x21, 0x33, 0x44, 0x43, 0x43, 0x43, 0x23, 0x22, 0x23, 0x33, 0x12, 0xB8, 0xCD, 0xBC, 0xBC, 0xCC,
+  0xBC, 0xCB, 0xBA, 0x9A, 0x99, 0x80, 0x11, 0x42, 0x44, 0x33, 0x34, 0x33, 0x43, 0x33, 0x24, 0x23,
+  0x22, 0x12, 0x81, 0xBA, 0xBD, 0xCC, 0xCB, 0xAC, 0xAB, 0xAA, 0x9A, 0x09, 0x32, 0x54, 0x32, 0x13,
+  0x11, 0x80, 0xCA, 0xCC, 0xBB, 0xBC, 0x08, 0x62, 0x44, 0x43, 0x33, 0x34, 0x33, 0x01, 0xCA, 0xCC,
+  0xDB, 0xBB, 0xDB, 0xBA, 0xAA, 0x89, 0x08, 0x20, 0x21, 0x22, 0x23, 0x33, 0x33, 0x34, 0x53, 0x43,
+  0x44, 0x54, 0x33, 0x33, 0x01, 0x98, 0xBA, 0xDD, 0xDC, 0xBB, 0xAC, 0x89, 0x08, 0x21, 0x42, 0x43,
+  0x32, 0x12, 0xB9, 0xDE, 0xBB, 0xAC, 0xA9, 0xA9, 0x18, 0x65, 0x35, 0x44, 0x32, 0x32, 0x24, 0x12,
+  0x80, 0xCA, 0xDB, 0xCB, 0xBB, 0xBC, 0xBB, 0xAB, 0x99, 0x88, 0x00, 0x11, 0x23, 0x34, 0x43, 0x33,
+  0x45, 0x33, 0x24, 0x24, 0x33, 0x33, 0x01, 0xA8, 0xCC, 0xDC, 0xDB, 0xCB, 0xBB, 0xBA, 0xAA, 0x8A,
+  0x10, 0x31, 0x44, 0x34, 0x43, 0x23, 0x22, 0x22, 0x32, 0x24, 0x32, 0x53, 0x43, 0x23, 0x12, 0x01,
+  0x98, 0xEA, 0xDB, 0xAC, 0xBB, 0xBB, 0xAB, 0xAA, 0x88, 0x08, 0x00, 0xA8, 0xDD, 0xCB, 0xAC, 0xBA,
+  0x9A, 0x20, 0x56, 0x45, 0x33, 0x34, 0x43, 0x12, 0x81, 0xBA, 0xCC, 0xBD, 0xCB, 0xCB, 0xAA, 0x99,
+  0xB3, 0xF5, 0x2B, 0x00, 0x00, 0x21, 0x43, 0x33, 0x33, 0x33, 0x13, 0x90, 0xAA, 0xAA, 0x99, 0x18,
+  0x73, 0x45, 0x43, 0x22, 0x12, 0x81, 0xB9, 0xDD, 0xDB, 0xAA, 0x9A, 0x08, 0x32, 0x44, 0x43, 0x22,
+  0x82, 0xD9, 0xCD, 0xBD, 0xCB, 0xAB, 0x9A, 0x99, 0x30, 0x55, 0x35, 0x44, 0x32, 0x33, 0x24, 0x22,
+  0x81, 0xA8, 0xBC, 0xBD, 0xBC, 0xBC, 0xBC, 0xBA, 0xAA, 0xAA, 0x99, 0x08, 0x21, 0x32, 0x35, 0x44,
+  0x43, 0x33, 0x43, 0x32, 0x32, 0x33, 0x12, 0x80, 0xAA, 0xCA, 0xCC, 0xDC, 0xCB, 0xBB, 0xBC, 0xBA,
+  0xBB, 0x9A, 0x08, 0x41, 0x44, 0x43, 0x34, 0x43, 0x32, 0x33, 0x33, 0x23, 0x02, 0x00, 0x08, 0x80,
+  0xA8, 0xCB, 0xDB, 0xAB, 0xBB, 0xDC, 0xDC, 0xDB, 0xBA, 0xAC, 0xBA, 0xAA, 0x9A, 0x08, 0x43, 0x44,
+  0x33, 0x43, 0x33, 0x33, 0x32, 0x32, 0x23, 0x02, 0x80, 0xB9, 0xCC, 0xCD, 0xBD, 0xBD, 0xBB, 0xAB,
+  0xBB, 0xAA, 0x89, 0x30, 0x46, 0x34, 0x25, 0x43, 0x32, 0x23, 0x01, 0xA9, 0xCC, 0xCB, 0xBB, 0xAC,
+  0x8A, 0x18, 0x63, 0x43, 0x43, 0x32, 0x23, 0x22, 0x01, 0x90, 0xBA, 0xCC, 0xCC, 0xBC, 0xBD, 0xBC,
+  0xCC, 0xCB, 0xBB, 0xAA, 0x98, 0x80, 0x10, 0x64, 0x45, 0x34, 0x43, 0x33, 0x34, 0x24, 0x12, 0x80,
+  0xA9, 0xDB, 0xCC, 0xBB, 0xAD, 0xBB, 0xAB, 0xAB, 0x9A, 0x88, 0x10, 0x21, 0x43, 0x44, 0x43, 0x33,
+  0x43, 0x33, 0x34, 0x24, 0x23, 0x23, 0x32, 0x11, 0x90, 0xDB, 0xCD, 0xCC, 0xBB, 0xBC, 0xAC, 0xAB,
+  0x9A, 0x99, 0x10, 0x31, 0x43, 0x43, 0x53, 0x32, 0x24, 0x43, 0x42, 0x32, 0x23, 0x33, 0x33, 0x12,
+  0x80, 0xDB, 0xBD, 0xCD, 0xCB, 0xDB, 0xBA, 0xBB, 0xAB, 0x99, 0x09, 0x21, 0x53, 0x53, 0x42, 0x22,
+  0x23, 0x23, 0x22, 0x12, 0x22, 0x23, 0x12, 0x90, 0xC9, 0xDB, 0xCC, 0xCC, 0xDB, 0xBA, 0xAB, 0xAB,
+  0xC7, 0xFC, 0x1C, 0x00, 0x09, 0x20, 0x34, 0x45, 0x43, 0x24, 0x22, 0x11, 0x88, 0xAA, 0xCB, 0xCB,
+  0xBB, 0x9A, 0x20, 0x54, 0x34, 0x34, 0x33, 0x33, 0x12, 0xA0, 0xCC, 0xCC, 0xBB, 0xBB, 0xCB, 0xBB,
+  0xCB, 0xBA, 0xBA, 0xDB, 0xCD, 0xDB, 0xAA, 0x0A, 0x20, 0x21, 0x31, 0x56, 0x45, 0x34, 0x33, 0x23,
+  0x33, 0x34, 0x12, 0xA8, 0xBD, 0xCC, 0xBA, 0xBC, 0xBC, 0xAC, 0xAB, 0x9A, 0x99, 0x89, 0x08, 0x00,
+  0x31, 0x44, 0x44, 0x34, 0x33, 0x34, 0x44, 0x43, 0x22, 0x12, 0x00, 0x80, 0x98, 0xDB, 0xBD, 0xCC,
+  0xAA, 0xAB, 0xCB, 0xBB, 0xAB, 0xAB, 0x9A, 0x08, 0x22, 0x43, 0x45, 0x53, 0x44, 0x33, 0x33, 0x24,
+  0x33, 0x33, 0x12, 0x80, 0xCA, 0xDB, 0xCB, 0xBC, 0xCC, 0xBB, 0xBB, 0xBB, 0xAB, 0x99, 0x09, 0x20,
+  0x44, 0x34, 0x34, 0x33, 0x53, 0x24, 0x33, 0x23, 0x22, 0x22, 0x12, 0x98, 0xDC, 0xBC, 0xCC, 0xCA,
+  0xAB, 0xBB, 0xAA, 0x9A, 0x08, 0x30, 0x34, 0x35, 0x22, 0x22, 0x42, 0x33, 0x12, 0xA0, 0x18, 0x73,
+  0x24, 0x12, 0x90, 0x10, 0x32, 0x02, 0xDB, 0xCD, 0xAA, 0xBB, 0xAA, 0xAB, 0x9A, 0x99, 0x0A, 0x55,
+  0x43, 0x14, 0x98, 0x9A, 0xBA, 0xFA, 0xCE, 0xCD, 0xBB, 0xAB, 0x08, 0x81, 0xAA, 0x2A, 0x57, 0x35,
+  0x24, 0x11, 0x32, 0x53, 0x33, 0x12, 0x90, 0x99, 0xAB, 0xCC, 0xCD, 0xDB, 0xAB, 0xBB, 0xBA, 0xAA,
+  0x99, 0x88, 0x11, 0x53, 0x34, 0x35, 0x33, 0x23, 0x34, 0x34, 0x25, 0x12, 0x10, 0x10, 0x22, 0x82,
+  0xDA, 0xCC, 0xBB, 0xCB, 0xDB, 0xDB, 0xBB, 0xBB, 0x9A, 0x9A, 0x89, 0x08, 0x43, 0x34, 0x45, 0x34,
+  0x24, 0x23, 0x43, 0x33, 0x33, 0x12, 0x98, 0xBA, 0xBC, 0xCC, 0xBD, 0xBC, 0xCB, 0xAA, 0x9A, 0x8A,
+  0x99, 0x08, 0x31, 0x35, 0x33, 0x33, 0x21, 0x35, 0x25, 0x21, 0x01, 0x21, 0x43, 0x22, 0x80, 0xCA,
+  0x89, 0x00, 0x0B, 0x00, 0xCC, 0xBB, 0xAB, 0xBB, 0xAB, 0xE9, 0x89, 0x43, 0x43, 0x24, 0x02, 0x10,
+  0x12, 0x23, 0xB8, 0xFF, 0xAB, 0x98, 0x00, 0xA8, 0x9A, 0x31, 0x74, 0x23, 0x01, 0x01, 0x18, 0x22,
+  0x81, 0xCA, 0xCB, 0xBC, 0x81, 0xA8, 0x98, 0x80, 0x64, 0x53, 0x24, 0x12, 0x00, 0xBA, 0xBC, 0xCF,
+  0xCD, 0xDC, 0xAA, 0x8A, 0x00, 0x80, 0x99, 0x61, 0x54, 0x33, 0x13, 0x21, 0x43, 0x34, 0x12, 0x88,
+  0xA8, 0x88, 0xBA, 0xBF, 0xBC, 0xAD, 0xBB, 0xBC, 0xAB, 0xAA, 0x89, 0x10, 0x41, 0x54, 0x53, 0x23,
+  0x23, 0x22, 0x33, 0x22, 0x81, 0xAA, 0xBC, 0xAA, 0xCB, 0xBC, 0xBD, 0xBA, 0xAA, 0xA9, 0x9A, 0xAA,
+  0xDB, 0xBA, 0xCA, 0xEB, 0xAB, 0xAC, 0x09, 0x23, 0x37, 0x45, 0x43, 0x34, 0x33, 0x33, 0x22, 0x11,
+  0xB9, 0xCC, 0xCC, 0xAC, 0xAC, 0xBB, 0xBB, 0xBB, 0x9A, 0x08, 0x20, 0x42, 0x73, 0x43, 0x42, 0x22,
+  0x22, 0x33, 0x11, 0x00, 0x89, 0xAA, 0xCB, 0xBD, 0xAC, 0x88, 0x88, 0xCB, 0xBC, 0xAA, 0x09, 0xA8,
+  0xDB, 0xA9, 0x51, 0x34, 0x33, 0x01, 0x41, 0x14, 0x13, 0xBA, 0x9C, 0x11, 0x35, 0x24, 0x31, 0x37,
+  0x12, 0x01, 0xCA, 0xBB, 0xBD, 0xCE, 0xBB, 0xA9, 0x89, 0x10, 0x01, 0x32, 0x45, 0x22, 0x33, 0x80,
+  0x22, 0x25, 0x33, 0x13, 0xAA, 0xDB, 0xAA, 0xBD, 0xAF, 0xAC, 0xAA, 0x08, 0x11, 0x33, 0x23, 0x12,
+  0x13, 0x51, 0x93, 0xDD, 0xCB, 0x9B, 0x20, 0x13, 0x52, 0x11, 0x32, 0x37, 0x42, 0x13, 0xA0, 0x30,
+  0x53, 0x32, 0x01, 0xC9, 0xAB, 0xDD, 0xCB, 0xBB, 0xAE, 0x9B, 0xAA, 0x19, 0x32, 0x35, 0x34, 0x33,
+  0x26, 0x23, 0x81, 0xAA, 0xA9, 0xAA, 0xBC, 0xBF, 0x9A, 0x98, 0x89, 0x80, 0x19, 0x52, 0x36, 0x23,
+  0x21, 0x32, 0x00, 0xDB, 0xBE, 0xBA, 0x9B, 0xBC, 0x9B, 0x21, 0x35, 0x44, 0x12, 0x21, 0x21, 0x90,
+  0x16, 0x00, 0x03, 0x00, 0xA9, 0xBC, 0x38, 0x35, 0x4A, 0x15, 0x12, 0x21, 0xC8, 0xAC, 0xDB, 0xB9,
+  0xBE, 0xBB, 0xAC, 0x28, 0x24, 0x11, 0x13, 0x52, 0x44, 0x13, 0x81, 0xA9, 0x8A, 0x90, 0xDA, 0xAD,
+  0xAA, 0x88, 0x15, 0x22, 0x61, 0x10, 0x20, 0x13, 0x02, 0xA3, 0xC0, 0xAB, 0x9D, 0x0A, 0xEA, 0xBD,
+  0xBA, 0x99, 0x10, 0x09, 0x29, 0x53, 0x22, 0x36, 0x22, 0x54, 0x11, 0x11, 0x01, 0x12, 0x81, 0xCD,
+  0xBD, 0xAA, 0x99, 0xEB, 0x9A, 0x09, 0x22, 0x35, 0x01, 0x02, 0x11, 0x03, 0xC1, 0x9B, 0xBC, 0x9C,
+  0x99, 0x31, 0x62, 0x23, 0x33, 0x31, 0x41, 0xA3, 0xBD, 0xBA, 0xBF, 0xB9, 0xBC, 0x19, 0x00, 0x38,
+  0x15, 0x42, 0x43, 0x23, 0x99, 0x99, 0xDD, 0x98, 0x92, 0xBA, 0x9A, 0xA1, 0x73, 0x14, 0x21, 0x12,
+  0x03, 0x11, 0x33, 0x13, 0xC9, 0xEC, 0xBB, 0x89, 0x89, 0xA9, 0x93, 0x43, 0x64, 0x22, 0x23, 0x03,
+  0xC9, 0xB9, 0x9E, 0xAA, 0xCB, 0xAD, 0x89, 0x20, 0x51, 0x02, 0x11, 0x31, 0x23, 0x33, 0x15, 0x30,
+  0xFA, 0x80, 0x01, 0x12, 0xA3, 0xAF, 0xA0, 0xB9, 0xB9, 0xED, 0x99, 0xC9, 0x08, 0x01, 0x31, 0x32,
+  0x23, 0x43, 0x15, 0x38, 0x20, 0xB8, 0x9E, 0x00, 0x01, 0x14, 0xB1, 0x22, 0x06, 0x31, 0x15, 0xAA,
+  0x9A, 0x9F, 0x9A, 0xEB, 0x9B, 0x99, 0x89, 0x81, 0x31, 0x64, 0x23, 0x42, 0x81, 0x01, 0x98, 0xAA,
+  0xCE, 0x8A, 0x09, 0x21, 0x63, 0x42, 0x33, 0x44, 0x10, 0x81, 0xCA, 0xCA, 0xAC, 0xAB, 0xCA, 0x0A,
+  0x89, 0x30, 0x23, 0x53, 0x25, 0x01, 0x08, 0x99, 0xA1, 0x13, 0xBC, 0x9D, 0x10, 0x12, 0x14, 0x91,
+  0x19, 0x35, 0x13, 0x31, 0xDB, 0x9D, 0xBA, 0xDB, 0xBB, 0xAC, 0x99, 0x99, 0x53, 0x33, 0x44, 0x14,
+  0x10, 0x33, 0xB3, 0x43, 0xB1, 0x2C, 0x92, 0xB9, 0x13, 0xBB, 0xBC, 0xBD, 0x99, 0x80, 0xCB, 0xBC,
+  0xD5, 0xFF, 0x03, 0x00, 0x09, 0x34, 0x91, 0x09, 0x99, 0x39, 0x96, 0x00, 0x10, 0x29, 0x13, 0xAA,
+  0x73, 0x01, 0x21, 0x92, 0x2A, 0x71, 0x11, 0x00, 0xA0, 0xC8, 0xA9, 0xAD, 0xDB, 0xAC, 0xBA, 0x0B,
+  0x11, 0x63, 0x14, 0x34, 0x12, 0x82, 0x01, 0x99, 0xBA, 0xAF, 0x0A, 0x29, 0x12, 0x15, 0x23, 0x21,
+  0x33, 0x11, 0xD9, 0x99, 0xBC, 0x1B, 0xBA, 0x1B, 0x93, 0x1B, 0x32, 0xA1, 0x40, 0x98, 0x0D, 0xA1,
+  0xAC, 0x03, 0xFB, 0x19, 0x09, 0x18, 0x14, 0x51, 0x31, 0x21, 0x03, 0x91, 0xA1, 0xD9, 0xBB, 0xDB,
+  0xBB, 0xCB, 0x00, 0x22, 0x03, 0x16, 0x11, 0x43, 0x43, 0x01, 0xAA, 0x19, 0xB9, 0xC9, 0xBB, 0xAD,
+  0x89, 0x19, 0x03, 0x86, 0x49, 0x11, 0x2A, 0x48, 0x01, 0x19, 0x9B, 0x31, 0x92, 0x21, 0xB9, 0xBB,
+  0x31, 0xDA, 0x9A, 0x89, 0x39, 0x95, 0xA8, 0x13, 0x21, 0x70, 0x93, 0x0B, 0x30, 0x89, 0x49, 0x03,
+  0x9E, 0x08, 0xB9, 0x59, 0xB0, 0x9D, 0x00, 0xB9, 0x52, 0x91, 0xAA, 0x53, 0xC9, 0x2C, 0x33, 0xCB,
+  0x42, 0xB3, 0x1A, 0x47, 0x80, 0x18, 0x90, 0xAB, 0x11, 0x0B, 0x43, 0xBC, 0x39, 0xA3, 0xBC, 0x72,
+  0xD2, 0x9D, 0x31, 0xEC, 0x39, 0x05, 0xCB, 0x50, 0x92, 0x0B, 0x24, 0xA8, 0x19, 0x13, 0x99, 0x8A,
+  0x30, 0xC2, 0x9F, 0x21, 0xA1, 0xAE, 0x41, 0xD1, 0x8B, 0x33, 0xE9, 0x29, 0x13, 0xBA, 0x60, 0x83,
+  0xAA, 0x41, 0x91, 0x8B, 0x31, 0xA8, 0x1B, 0x43, 0xA0, 0x0C, 0x33, 0xF0, 0x0B, 0x32, 0xD9, 0x29,
+  0x04, 0xBC, 0x30, 0xB2, 0x9E, 0x01, 0xB9, 0x08, 0x23, 0x12, 0x13, 0x38, 0x53, 0xA9, 0x49, 0x04,
+  0xBF, 0x51, 0x83, 0x1C, 0x44, 0xA8, 0x19, 0x82, 0xBD, 0x18, 0xBA, 0x9D, 0x89, 0x9A, 0x32, 0xB9,
+  0x5A, 0x13, 0x99, 0x57, 0x91, 0x8A, 0x43, 0xA0, 0x3A, 0x06, 0xBA, 0x40, 0x93, 0x8A, 0x11, 0xB9,
+  0x25, 0x00, 0x05, 0x00, 0x8A, 0xBC, 0xB9, 0xCF, 0x88, 0xC9, 0x8B, 0x41, 0x10, 0x0B, 0x16, 0x11,
+  0x42, 0x43, 0x80, 0x08, 0x24, 0xB9, 0x9C, 0x12, 0xDD, 0x19, 0x02, 0xBB, 0x32, 0xA5, 0x9B, 0x51,
+  0x98, 0x0A, 0x92, 0xAB, 0x01, 0x35, 0x10, 0x0A, 0x99, 0x63, 0xA2, 0x21, 0x92, 0x8E, 0x52, 0xA1,
+  0x2A, 0x92, 0xBB, 0x19, 0xDB, 0xCB, 0x80, 0xD0, 0x9C, 0x21, 0xC1, 0x2A, 0x16, 0xCA, 0x61, 0x12,
+  0x8A, 0x32, 0x91, 0x0B, 0x63, 0xC0, 0x19, 0x02, 0x9D, 0x29, 0xA1, 0x9B, 0x22, 0xAF, 0x19, 0xAA,
+  0x51, 0xB2, 0x0B, 0x44, 0xB0, 0x4A, 0x15, 0xBB, 0x48, 0xB2, 0xAC, 0x33, 0xD0, 0x8B, 0x03, 0xBB,
+  0x70, 0xA3, 0x8C, 0x33, 0x91, 0x31, 0x02, 0x18, 0x23, 0xB1, 0xAA, 0xB2, 0xAB, 0x53, 0xB9, 0x0B,
+  0x43, 0xBB, 0x13, 0xBB, 0xBE, 0x80, 0x2A, 0x9B, 0x29, 0x07, 0x00, 0x31, 0x26, 0xA1, 0x11, 0xA2,
+  0x1D, 0x18, 0x0A, 0xB8, 0x9B, 0x31, 0xB1, 0x51, 0xB0, 0x9D, 0x80, 0xEB, 0x00, 0xB9, 0x09, 0x1A,
+  0x53, 0x12, 0x12, 0x35, 0xA0, 0x53, 0x23, 0x89, 0x23, 0x39, 0xBB, 0x59, 0xB1, 0x9F, 0x81, 0xCB,
+  0x28, 0x82, 0x9B, 0xA2, 0x09, 0x24, 0xA8, 0xA1, 0x93, 0x9B, 0x22, 0x14, 0x0A, 0x33, 0x99, 0x01,
+  0x13, 0xE9, 0x09, 0xAA, 0x89, 0x9A, 0x9A, 0x33, 0xB2, 0x30, 0x95, 0x10, 0x25, 0xB9, 0x08, 0xA2,
+  0x30, 0x03, 0xB9, 0x99, 0x19, 0x24, 0xD8, 0x1A, 0x0A, 0x39, 0xB1, 0x19, 0x91, 0x20, 0x07, 0x8A,
+  0x28, 0x91, 0x29, 0x93, 0xFB, 0x00, 0x12, 0x18, 0x00, 0x11, 0x1C, 0x12, 0xFB, 0x08, 0x9A, 0xAB,
+  0xA2, 0xA0, 0x9A, 0x11, 0x90, 0x21, 0x12, 0x13, 0x24, 0x04, 0x22, 0x43, 0x29, 0x33, 0xBB, 0x0D,
+  0xC0, 0xBB, 0xA1, 0xC0, 0x19, 0xBA, 0x99, 0x13, 0x01, 0x19, 0x9A, 0xA0, 0x21, 0xA2, 0x19, 0x25,
+  0xFD, 0xFF, 0x03, 0x00, 0x38, 0x30, 0x01, 0x73, 0x89, 0x80, 0xA0, 0x8B, 0x03, 0xB9, 0x1A, 0xB4,
+  0x91, 0x94, 0x9B, 0x0B, 0xAD, 0x9A, 0x0C, 0x89, 0x00, 0x63, 0x01, 0x52, 0x23, 0x21, 0x33, 0x18,
+  0x19, 0x90, 0xFB, 0x88, 0x8A, 0x29, 0xCB, 0xA1, 0xB9, 0x11, 0x11, 0xA1, 0xB9, 0x09, 0xB2, 0x0A,
+  0x23, 0x10, 0x90, 0x39, 0x43, 0x10, 0x63, 0x90, 0x28, 0xA0, 0x9B, 0xB1, 0xAD, 0x90, 0xAB, 0x10,
+  0x10, 0x1A, 0xB9, 0xAB, 0x91, 0x2B, 0x91, 0xB9, 0x31, 0x33, 0x43, 0x13, 0x03, 0x63, 0x00, 0x01,
+  0x08, 0x13, 0xB9, 0xB1, 0xBB, 0x1C, 0xB8, 0xBB, 0xDB, 0x91, 0x98, 0x19, 0xB0, 0x0B, 0x09, 0x99,
+  0x31, 0x22, 0x73, 0x00, 0x20, 0x12, 0x11, 0x31, 0xB9, 0xB9, 0xBA, 0xA0, 0x09, 0xB9, 0x1A, 0x91,
+  0xA9, 0x92, 0x93, 0xBB, 0xBB, 0x39, 0x00, 0x01, 0x90, 0x21, 0x33, 0x21, 0x92, 0x9B, 0x11, 0xB1,
+  0x11, 0x10, 0x3B, 0x19, 0x13, 0x09, 0x92, 0x90, 0x9A, 0x19, 0x99, 0xAB, 0x99, 0x0B, 0x00, 0x00,
+  0x95, 0xA0, 0x91, 0x9B, 0x32, 0x99, 0x41, 0x92, 0x3B, 0x15, 0x09, 0x92, 0x0C, 0xB9, 0x91, 0x9A,
+  0x10, 0xA1, 0x93, 0x39, 0x9B, 0xB2, 0x91, 0xBB, 0xB9, 0xBB, 0x12, 0x99, 0x49, 0x91, 0x34, 0x15,
+  0x38, 0x11, 0xAB, 0xA2, 0x9B, 0x99, 0x1B, 0xCB, 0xB0, 0xA1, 0x91, 0x99, 0x19, 0x09, 0x1D, 0x01,
+  0x00, 0x21, 0x19, 0x29, 0x12, 0x99, 0x23, 0xB1, 0x53, 0x11, 0x09, 0x14, 0xB0, 0x9B, 0xE9, 0xA1,
+  0x89, 0x1A, 0x9B, 0x90, 0x19, 0x23, 0xAB, 0x03, 0x99, 0x39, 0xA3, 0x33, 0x99, 0x0B, 0x85, 0x99,
+  0x92, 0xDA, 0x11, 0x89, 0x9A, 0x24, 0x1A, 0x14, 0x9B, 0x21, 0x90, 0xB9, 0xBB, 0xD0, 0x19, 0x02,
+  0x90, 0x21, 0x12, 0x93, 0x92, 0x99, 0x00, 0x1B, 0x30, 0xA9, 0x10, 0x95, 0x39, 0x01, 0x91, 0xA0,
+  0x09, 0x00, 0x00, 0x00, 0x01, 0xB9, 0x10, 0xBA, 0x19, 0x19, 0xBA, 0x91, 0xB1, 0x3B, 0x93, 0x9A,
+  0x11, 0x02, 0xB2, 0x33, 0x93, 0x21, 0x33, 0x99, 0x31, 0xA0, 0x10, 0xB9, 0x9A, 0x9B, 0x9B, 0xB9,
+  0x9A, 0x11, 0x1A, 0x03, 0x99, 0x10, 0x93, 0x30, 0x93, 0x2A, 0x12, 0x29, 0x19, 0xB3, 0x09, 0x01,
+  0x29, 0xA9, 0x91, 0x2A, 0x11, 0xB9, 0x99, 0x90, 0xD9, 0x93, 0x89, 0x19, 0x11, 0x91, 0x93, 0x30,
+  0x90, 0x31, 0x02, 0x2A, 0x02, 0x91, 0x11, 0xB9, 0xA1, 0x2B, 0x9B, 0x19, 0x1B, 0x8C, 0x10, 0x99,
+  0x1B, 0x03, 0x39, 0x12, 0x11, 0x11, 0x31, 0x1B, 0x91, 0x0B, 0x29, 0xBB, 0x19, 0x92, 0x29, 0x92,
+  0x19, 0x30, 0x21, 0x2C, 0x2A, 0x11, 0x30, 0x09, 0xA2, 0x10, 0x21, 0x90, 0xB2, 0x91, 0x0C, 0x10,
+  0xBA, 0x3A, 0xB1, 0x21, 0x99, 0x09, 0x3A, 0x12, 0x29, 0x90, 0x9B, 0x33, 0xB0, 0x92, 0x9A, 0x19,
+  0xA2, 0xB9, 0x11, 0x0B, 0x93, 0x0B, 0x30, 0x91, 0x20, 0x01, 0x09, 0x92, 0x99, 0xA9, 0x09, 0xB1,
+  0x3B, 0x10, 0x19, 0x92, 0x39, 0x23, 0xB3, 0x30, 0x1D, 0x19, 0x19, 0x19, 0x09, 0x01, 0x1A, 0x21,
+  0xAB, 0x1A, 0xB3, 0x2B, 0x19, 0xB1, 0x10, 0x03, 0x19, 0x92, 0x31, 0x10, 0x91, 0x90, 0x90, 0x23,
+  0xB0, 0x2A, 0x91, 0x09, 0x02, 0x99, 0x93, 0x2B, 0x2B, 0xC0, 0x00, 0xA9, 0x9B, 0x01, 0x1D, 0x19,
+  0x90, 0x11, 0x23, 0x21, 0x03, 0x01, 0x13, 0x99, 0x11, 0xA9, 0x10, 0x99, 0x9B, 0x93, 0xB9, 0x39,
+  0x91, 0x90, 0xB2, 0x90, 0x19, 0xB0, 0x99, 0xB9, 0x03, 0x91, 0x19, 0x33, 0x1A, 0x33, 0xA9, 0x21,
+  0xA3, 0x90, 0x22, 0x9B, 0x1A, 0x2B, 0x99, 0x99, 0xB1, 0x09, 0x1B, 0x93, 0xB2, 0x92, 0x00, 0x09,
+  0x90, 0x31, 0x1B, 0x11, 0xB1, 0x23, 0x10, 0x1A, 0x01, 0x00, 0x99, 0x19, 0x91, 0x00, 0x10, 0x09,
+  0x00, 0x00, 0x00, 0x00, 0xA2, 0x99, 0x09, 0x99, 0x19, 0x19, 0x1A, 0x11, 0x92, 0x11, 0x92, 0x29,
+  0xA2, 0x11, 0xA9, 0x01, 0x19, 0x00, 0x10, 0xB9, 0x09, 0x91, 0xBB, 0x13, 0x09, 0x11, 0x01, 0x99,
+  0x32, 0x21, 0x11, 0x12, 0x0B, 0x02, 0x91, 0x99, 0x9A, 0xA9, 0x3A, 0xB9, 0x09, 0x02, 0x30, 0x11,
+  0x01, 0x93, 0x90, 0x11, 0xBB, 0x19, 0x99, 0xB9, 0x21, 0xA0, 0x31, 0xB0, 0x09, 0x11, 0x09, 0x93,
+  0x29, 0xB9, 0x11, 0xA2, 0x19, 0x91, 0x91, 0x01, 0x10, 0x29, 0x1B, 0x03, 0x11, 0x1B, 0x19, 0x00,
+  0x09, 0x99, 0x19, 0x00, 0x19, 0xB2, 0x11, 0x39, 0x39, 0xB9, 0x90, 0x90, 0xA0, 0xA3, 0xA9, 0x92,
+  0x10, 0x1A, 0x23, 0x2C, 0x01, 0x99, 0x13, 0xB9, 0x31, 0xA0, 0x91, 0x09, 0x1B, 0x19, 0x11, 0x1A,
+  0x91, 0x11, 0x29, 0xAB, 0x13, 0x19, 0x92, 0x00, 0x11, 0x90, 0xB9, 0x02, 0x9B, 0x21, 0x90, 0x10,
+  0x39, 0x99, 0x13, 0x19, 0x00, 0xB9, 0x1A, 0x00, 0x1B, 0x19, 0x01, 0x11, 0x30, 0x11, 0x99, 0x39,
+  0x0B, 0x99, 0xA9, 0x91, 0x90, 0x30, 0x90, 0x39, 0xB3, 0x30, 0x99, 0x20, 0x99, 0x0A, 0x91, 0x99,
+  0x99, 0x91, 0x91, 0x10, 0x10, 0x90, 0x11, 0x19, 0x99, 0xA9, 0x12, 0x99, 0x99, 0xB3, 0x93, 0x91,
+  0x91, 0x21, 0x00, 0x92, 0x01, 0x19, 0x00, 0x1A, 0x11, 0x90, 0x0A, 0x00, 0x0A, 0x92, 0x99, 0x20,
+  0x99, 0x00, 0x93, 0x1B, 0x11, 0x2A, 0x20, 0x91, 0x19, 0x91, 0x90, 0x21, 0x0B, 0x10, 0xA0, 0x09,
+  0x91, 0xA0, 0x91, 0x01, 0x91, 0x01, 0x91, 0x10, 0x11, 0x99, 0x92, 0x11, 0x90, 0x00, 0x90, 0x91,
+  0x99, 0x19, 0x11, 0x0B, 0x92, 0xA1, 0x11, 0x11, 0x19, 0x00, 0x10, 0x09, 0x91, 0x91, 0x09, 0x10,
+  0xB0, 0x93, 0xB1, 0x29, 0x91, 0x99, 0x21, 0x00, 0x09, 0x91, 0x91, 0x91, 0x01, 0x91, 0xA0, 0x11,
+  0x00, 0x00, 0x00, 0x00, 0x19, 0x19, 0x99, 0xA1, 0xA2, 0x01, 0x19, 0x91, 0x11, 0x10, 0x00, 0x01,
+  0x91, 0x91, 0x09, 0x90, 0x01, 0x09, 0x91, 0x11, 0x19, 0x19, 0xB1, 0x12, 0x00, 0x99, 0x01, 0x99,
+  0x11, 0xA0, 0x91, 0x11, 0x20, 0x09, 0x99, 0x11, 0x19, 0x00, 0x09, 0x99, 0x92, 0x99, 0x29, 0xA9,
+  0x11, 0x99, 0x01, 0x01, 0x19, 0x01, 0x09, 0x01, 0x11, 0x99, 0x91, 0x00, 0x00, 0x91, 0x09, 0x01,
+  0x00, 0x90, 0x91, 0x10, 0x99, 0x10, 0x91, 0x09, 0x00, 0x10, 0x10, 0x90, 0x19, 0x91, 0x19, 0x91,
+  0x01, 0x10, 0x09, 0x11, 0x90, 0x00, 0x10, 0xB1, 0x11, 0x09, 0x09, 0x39, 0x1A, 0x99, 0x91, 0x11,
+  0x09, 0x91, 0x10, 0x11, 0x90, 0x19, 0x91, 0x90, 0x11, 0x91, 0x19, 0x90, 0xA0, 0x11, 0x19, 0x09,
+  0x90, 0x11, 0x09, 0x19, 0x91, 0x91, 0x19, 0x91, 0x01, 0x91, 0x10, 0x00, 0x19, 0x19, 0x99, 0x11,
+  0x01, 0x99, 0x19, 0x01, 0x09, 0x00, 0x19, 0x99, 0x11, 0x19, 0x29, 0x1A, 0x91, 0x1A, 0xA2, 0x92,
+  0x00, 0x00, 0x19, 0x00, 0x00, 0x01, 0x91, 0x00, 0x19, 0x10, 0x91, 0x0B, 0x11, 0x90, 0x91, 0x92,
+  0x90, 0x90, 0x91, 0x11, 0x2B, 0x01, 0x91, 0x19, 0x19, 0x09, 0x19, 0x09, 0x01, 0x00, 0xA0, 0x21,
+  0x09, 0x10, 0x99, 0x19, 0x11, 0x99, 0x00, 0x99, 0x02, 0x91, 0x19, 0x91, 0x00, 0x00, 0x00, 0x91,
+  0x19, 0x20, 0x1B, 0x10, 0x99, 0x00, 0x01, 0x90, 0x30, 0x1B, 0x91, 0x00, 0x91, 0x91, 0x09, 0x01,
+  0x19, 0x19, 0x00, 0x90, 0x01, 0x91, 0x01, 0x09, 0x00, 0x90, 0xB2, 0x11, 0x90, 0x19, 0x01, 0x00,
+  0x19, 0x29, 0x99, 0x90, 0x01, 0x00, 0x91, 0x91, 0x90, 0x01, 0x10, 0x1A, 0x91, 0x11, 0x90, 0x19,
+  0x90, 0x19, 0x10, 0x3B, 0x10, 0x09, 0x00, 0x01, 0x19, 0x19, 0x91, 0x91, 0x09, 0x10, 0x09, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x99, 0x29, 0x19, 0x19, 0x09, 0x90, 0x91, 0x11, 0x19, 0x90, 0x91,
+  0x10, 0x91, 0x1A, 0x91, 0x11, 0x90, 0x09, 0x10, 0x90, 0x91, 0x91, 0x01, 0x91, 0x91, 0xB1, 0x21,
+  0x09, 0x91, 0x00, 0x91, 0x01, 0x09, 0x19, 0x01, 0x09, 0x19, 0x00, 0x19, 0x00, 0x91, 0x29, 0x99,
+  0x90, 0x91, 0x02, 0x99, 0x29, 0x09, 0x91, 0x91, 0xA1, 0x10, 0x01, 0x09, 0x99, 0x11, 0x00, 0x39,
+  0x2B, 0x99, 0x91, 0x19, 0x20, 0x99, 0x90, 0x00, 0x19, 0x09, 0x19, 0x92, 0x19, 0x3A, 0x09, 0x90,
+  0x92, 0x99, 0x91, 0x29, 0x2A, 0x1A, 0x91, 0x00, 0x01, 0x09, 0x19, 0x19, 0x29, 0x19, 0x99, 0x01,
+  0x09, 0x11, 0x99, 0xA0, 0x11, 0x10, 0x10, 0x19, 0x09, 0x91, 0x99, 0x11, 0x09, 0x10, 0x39, 0x0A,
+  0x09, 0x19, 0x01, 0x00, 0x90, 0x01, 0x90, 0x11, 0x19, 0x09, 0x09, 0x10, 0x19, 0x90, 0x19, 0x01,
+  0x00, 0x10, 0x09, 0x91, 0x90, 0x91, 0x91, 0x11, 0x09, 0x91, 0x09, 0x91, 0x11, 0x1A, 0x11, 0x91,
+  0x09, 0x10, 0xA1, 0x01, 0x90, 0x10, 0x91, 0x00, 0x10, 0x99, 0x19, 0x01, 0x19, 0x19, 0x19, 0x00,
+  0x19, 0xA1, 0x11, 0x10, 0x99, 0x93, 0x90, 0x09, 0x09, 0x91, 0x91, 0x10, 0x00, 0x91, 0x00, 0x10,
+  0xA0, 0xA2, 0x21, 0x2B, 0x09, 0x91, 0x10, 0x09, 0xA1, 0x29, 0x91, 0x19, 0x90, 0x91, 0x10, 0x90,
+  0x01, 0x99, 0x93, 0x99
+};
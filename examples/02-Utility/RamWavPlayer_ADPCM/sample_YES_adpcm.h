@@ -0,0 +1,393 @@
+
+// Made by wav2adpcm.py from "YES.wav".
+// IMA-ADPCM, mono, 4 bits per sample, in 256-byte blocks: 12000 samples in 6084 bytes (rather than 24000 bytes as int16).
+// To play it: audioPlayMemory.play(sample_YES_adpcm, sample_YES_adpcm_len, sample_YES_adpcm_sample_rate_Hz, sample_YES_adpcm_block_bytes);
+
+#define SAMPLE_YES_ADPCM_LEN 12000  //number of samples (not bytes)
+const uint32_t sample_YES_adpcm_len = SAMPLE_YES_ADPCM_LEN;
+const float sample_YES_adpcm_sample_rate_Hz = 24000;
+const uint16_t sample_YES_adpcm_block_bytes = 256;
+PROGMEM
+const uint8_t sample_YES_adpcm[6084] = {
+  0xFD, 0xFF, 0x00, 0x00, 0x11, 0x19, 0x00, 0x01, 0xA1, 0xA3, 0x01, 0x01, 0x90, 0x01, 0x19, 0x2B,
+  0x19, 0x91, 0x19, 0x09, 0x11, 0x19, 0x2A, 0x11, 0x1B, 0x00, 0x29, 0xA9, 0x92, 0x19, 0xB1, 0x13,
+  0x0B, 0x93, 0x91, 0x91, 0x09, 0x19, 0x90, 0x91, 0x39, 0x09, 0x99, 0x01, 0x09, 0x01, 0x91, 0x19,
+  0x09, 0x01, 0x91, 0x90, 0x11, 0x90, 0x91, 0x99, 0x11, 0x11, 0x0A, 0x01, 0x90, 0x01, 0x10, 0x19,
+  0x39, 0x1B, 0x09, 0x91, 0xA1, 0x11, 0x90, 0x11, 0x19, 0x09, 0xA1, 0x11, 0x10, 0x99, 0x12, 0x0A,
+  0x00, 0x91, 0x19, 0x00, 0x10, 0x09, 0x0A, 0x12, 0x1A, 0x00, 0x91, 0x91, 0x01, 0xB1, 0x93, 0xA2,
+  0x90, 0x39, 0x09, 0x2B, 0x09, 0xA2, 0x11, 0x19, 0x19, 0x1A, 0x11, 0x99, 0x91, 0x92, 0x09, 0x91,
+  0xA2, 0x91, 0x10, 0x90, 0x99, 0x92, 0x09, 0x01, 0x19, 0x91, 0x91, 0x09, 0xB2, 0x91, 0x92, 0x00,
+  0x91, 0x10, 0x99, 0x21, 0x01, 0xB9, 0x09, 0x13, 0x91, 0xA9, 0x01, 0x33, 0xB9, 0x0B, 0x09, 0x51,
+  0x09, 0xAB, 0x29, 0x22, 0xB9, 0x9C, 0x11, 0x2A, 0x87, 0x98, 0x3A, 0xA1, 0x13, 0xD9, 0x3B, 0x35,
+  0xB8, 0x9E, 0x19, 0x32, 0x02, 0xCB, 0x79, 0x13, 0xC9, 0xCB, 0x31, 0x52, 0xB1, 0xAC, 0x19, 0x10,
+  0xC0, 0xAD, 0x18, 0x52, 0xB3, 0xCF, 0x9A, 0x32, 0x82, 0xCA, 0x89, 0x43, 0xA0, 0xAC, 0xAA, 0x73,
+  0x14, 0x98, 0xA9, 0x89, 0x23, 0x11, 0x20, 0x41, 0x31, 0x02, 0xCC, 0x8D, 0x45, 0x22, 0x13, 0x88,
+  0x09, 0x42, 0x53, 0x23, 0x32, 0x47, 0x12, 0x99, 0x39, 0x45, 0x23, 0x80, 0x28, 0x32, 0x83, 0xAC,
+  0x31, 0x44, 0xA1, 0xBC, 0xAB, 0xFA, 0xAB, 0xBB, 0x9B, 0xDB, 0xBF, 0xBC, 0x8A, 0xBA, 0xBB, 0xAD,
+  0xAA, 0xBB, 0xDC, 0xCB, 0x9A, 0x08, 0xAA, 0xAA, 0xA9, 0xBD, 0x89, 0x22, 0x85, 0x89, 0x35, 0x33,
+  0x22, 0xFE, 0x0B, 0x00, 0x80, 0x21, 0x77, 0x34, 0x22, 0x80, 0x20, 0x43, 0x34, 0x32, 0x22, 0x64,
+  0x13, 0xD9, 0xAD, 0x28, 0x14, 0xB0, 0xCE, 0xAB, 0x08, 0xC9, 0xDF, 0x8A, 0x52, 0x92, 0xDD, 0x8B,
+  0x51, 0x12, 0xCA, 0x8A, 0x63, 0x03, 0xBA, 0x0C, 0x54, 0x13, 0xB8, 0x0A, 0x53, 0x03, 0xA8, 0x1A,
+  0x63, 0x12, 0xB8, 0xAB, 0x20, 0x15, 0xB8, 0xBB, 0x10, 0x91, 0xDD, 0x9C, 0x19, 0x10, 0xCA, 0xCB,
+  0x8A, 0x98, 0xCB, 0x9A, 0x00, 0x90, 0xDB, 0xAB, 0x99, 0x10, 0x22, 0x01, 0x22, 0x13, 0xA8, 0x38,
+  0x77, 0x25, 0x22, 0x11, 0x00, 0x10, 0x44, 0x32, 0x23, 0x33, 0x12, 0x98, 0x9B, 0x72, 0x24, 0x91,
+  0xBA, 0x9B, 0xBA, 0xBF, 0x9A, 0x21, 0xD0, 0xCD, 0xAB, 0x88, 0x98, 0xAA, 0x8A, 0x31, 0x93, 0xDE,
+  0x1A, 0x44, 0x23, 0x11, 0x32, 0x45, 0x22, 0x81, 0x18, 0x56, 0x23, 0x98, 0x8A, 0x21, 0xE9, 0xDE,
+  0x9B, 0x42, 0x24, 0xE9, 0xBD, 0x19, 0x33, 0xA2, 0xBC, 0x38, 0x37, 0xA1, 0xCB, 0x29, 0x37, 0x03,
+  0xB9, 0x19, 0x53, 0x82, 0xB9, 0x29, 0x45, 0x82, 0xCB, 0x8A, 0x20, 0x80, 0xBA, 0x0A, 0x01, 0xFA,
+  0xBC, 0x99, 0x80, 0xA8, 0x99, 0xA8, 0xEC, 0xBB, 0x8A, 0x88, 0xA9, 0x9A, 0x80, 0xFB, 0xBE, 0x89,
+  0x42, 0x02, 0x90, 0x08, 0x11, 0x01, 0x62, 0x45, 0x33, 0x22, 0x21, 0x11, 0x22, 0x55, 0x34, 0x12,
+  0x90, 0x00, 0x00, 0x88, 0x00, 0x12, 0xA1, 0xEE, 0xCB, 0x9A, 0x89, 0x99, 0xBA, 0xDC, 0xBB, 0x9A,
+  0xA9, 0xAA, 0x28, 0x25, 0xA8, 0xAD, 0x30, 0x47, 0x13, 0x01, 0x31, 0x35, 0x23, 0x80, 0x00, 0x54,
+  0x24, 0xA0, 0xAD, 0x19, 0x81, 0xFC, 0xAE, 0x08, 0x34, 0xA1, 0xDF, 0x0A, 0x31, 0x13, 0xDA, 0x8A,
+  0x52, 0x13, 0xC9, 0x9B, 0x63, 0x24, 0x98, 0x9B, 0x30, 0x24, 0x98, 0x9A, 0x40, 0x13, 0xB8, 0xAD,
+  0x6D, 0x0D, 0x36, 0x00, 0x00, 0x90, 0x99, 0x08, 0xB9, 0xBF, 0x9A, 0x10, 0xA8, 0xBC, 0x19, 0x33,
+  0xFA, 0xAF, 0x18, 0x22, 0x91, 0xCB, 0x0A, 0x12, 0xC8, 0xAE, 0x38, 0x25, 0x90, 0xAB, 0x08, 0x31,
+  0x42, 0x32, 0x42, 0x34, 0x02, 0x30, 0x44, 0x21, 0x73, 0x24, 0x98, 0x9B, 0x10, 0x12, 0x90, 0xAA,
+  0x9A, 0xC9, 0xDE, 0xAB, 0x08, 0x88, 0xBA, 0xBC, 0xCB, 0x9A, 0xA9, 0x99, 0x21, 0x12, 0xC9, 0xBC,
+  0x49, 0x57, 0x12, 0x00, 0x20, 0x44, 0x02, 0x01, 0x32, 0x35, 0x01, 0x18, 0x00, 0xA8, 0xAC, 0x89,
+  0xFD, 0xCD, 0xBB, 0x40, 0x25, 0xD8, 0xCD, 0x09, 0x32, 0x03, 0xDA, 0x0A, 0x62, 0x12, 0xBA, 0x0C,
+  0x62, 0x23, 0x98, 0xAA, 0x30, 0x33, 0x90, 0x9A, 0x42, 0x03, 0xB9, 0xAD, 0x99, 0xA8, 0x89, 0x11,
+  0xB1, 0xFF, 0xAC, 0x08, 0x11, 0xB8, 0xAB, 0x18, 0x81, 0xFB, 0x9C, 0x20, 0x33, 0x91, 0xAB, 0x8A,
+  0x80, 0x89, 0x52, 0x25, 0xA0, 0x19, 0x63, 0x12, 0xA9, 0x50, 0x46, 0x12, 0x90, 0x10, 0x33, 0x33,
+  0x22, 0x34, 0x92, 0xBB, 0x89, 0x90, 0xFC, 0x9B, 0x00, 0xC0, 0xDE, 0xAB, 0x09, 0x81, 0xBA, 0xAD,
+  0x18, 0x80, 0xA9, 0xAC, 0x30, 0x26, 0x01, 0xA9, 0x19, 0x45, 0x43, 0x02, 0x18, 0x63, 0x23, 0x92,
+  0x99, 0x31, 0x46, 0x02, 0xAA, 0x99, 0x89, 0x80, 0xCA, 0xDF, 0xAD, 0xAA, 0xA9, 0x19, 0x53, 0xB2,
+  0xFF, 0x9B, 0x30, 0x25, 0xA1, 0xAA, 0x30, 0x27, 0x90, 0xAA, 0x41, 0x26, 0x02, 0x9A, 0x89, 0x22,
+  0x11, 0x80, 0x00, 0x80, 0xBA, 0xBD, 0xAA, 0xCB, 0xAC, 0x09, 0x02, 0xFC, 0xBE, 0x8A, 0x21, 0x81,
+  0xBA, 0x9C, 0x21, 0x81, 0xBC, 0x1A, 0x55, 0x22, 0x90, 0x18, 0x10, 0x08, 0x40, 0x44, 0x22, 0x32,
+  0x02, 0xB9, 0xAD, 0x58, 0x45, 0x12, 0xB9, 0x9B, 0x08, 0x88, 0x98, 0x31, 0xA2, 0xDD, 0xCC, 0xBA,
+  0xB0, 0xF5, 0x34, 0x00, 0x08, 0x31, 0x12, 0xC9, 0xCD, 0x9A, 0x20, 0x43, 0x22, 0x00, 0x10, 0x21,
+  0x01, 0x08, 0x73, 0x37, 0x13, 0xDA, 0xAB, 0x20, 0x34, 0x82, 0x88, 0x99, 0x99, 0xCC, 0x9B, 0x41,
+  0x35, 0xA0, 0xBB, 0xAA, 0x09, 0xCA, 0x28, 0xF8, 0xDE, 0xCD, 0x0A, 0x63, 0x23, 0xE9, 0xBC, 0x19,
+  0x53, 0x02, 0xA9, 0x1A, 0x44, 0x13, 0xC9, 0x0A, 0x53, 0x24, 0x90, 0x99, 0x88, 0x80, 0x80, 0x21,
+  0x01, 0xEB, 0xBC, 0x8A, 0x80, 0xDC, 0xBB, 0x20, 0x14, 0xE9, 0xCC, 0x09, 0x31, 0x82, 0xA8, 0x08,
+  0x33, 0x80, 0x99, 0x63, 0x34, 0x13, 0x21, 0x34, 0xA0, 0xAC, 0x39, 0x36, 0x12, 0xA0, 0xEB, 0xBB,
+  0xAA, 0x10, 0x10, 0xA8, 0xBF, 0x9B, 0xA9, 0xCB, 0x19, 0x35, 0x01, 0x88, 0xBB, 0xAC, 0x50, 0x46,
+  0x33, 0x02, 0x98, 0x0A, 0x41, 0x23, 0x11, 0x32, 0x33, 0xB1, 0xDF, 0xBB, 0x0A, 0x43, 0xA2, 0xED,
+  0xAB, 0x8A, 0x80, 0x00, 0x11, 0x01, 0x90, 0xBA, 0x1A, 0x75, 0x25, 0x03, 0x11, 0x12, 0x01, 0x08,
+  0x10, 0x12, 0x02, 0xFF, 0xEF, 0x89, 0x42, 0x13, 0xE9, 0xBC, 0x19, 0x43, 0x02, 0xBA, 0x09, 0x44,
+  0x12, 0xB9, 0x89, 0x43, 0x34, 0x81, 0x88, 0x98, 0xBA, 0x8B, 0x54, 0x13, 0xEB, 0xAC, 0x09, 0x01,
+  0xCA, 0xAD, 0x18, 0x33, 0xB0, 0xBF, 0x89, 0x21, 0x11, 0x10, 0x32, 0x13, 0xB9, 0x1A, 0x47, 0x14,
+  0x80, 0x20, 0x34, 0x92, 0xCD, 0x8B, 0x31, 0x82, 0xCB, 0x8A, 0x98, 0xDE, 0x9A, 0x18, 0x00, 0x08,
+  0x00, 0x01, 0xB8, 0xBC, 0x72, 0x37, 0x01, 0x89, 0x10, 0x80, 0x18, 0x43, 0x24, 0x81, 0xA8, 0xBB,
+  0xAB, 0xCC, 0x8C, 0x42, 0x13, 0xFB, 0xAD, 0x09, 0x10, 0x01, 0x99, 0x09, 0x01, 0x99, 0x8B, 0x72,
+  0x36, 0x22, 0x00, 0x08, 0x00, 0x31, 0x53, 0x23, 0x81, 0x99, 0xA9, 0xDB, 0xBC, 0xBB, 0x9A, 0xA9,
+  0xFB, 0x03, 0x2B, 0x00, 0xFF, 0xFF, 0x1B, 0x53, 0x82, 0xDB, 0xAB, 0x30, 0x25, 0x81, 0x9A, 0x40,
+  0x24, 0x91, 0x9A, 0x28, 0x43, 0x02, 0x01, 0x10, 0xD9, 0xBD, 0x8B, 0x42, 0x82, 0xCC, 0xAC, 0x08,
+  0x80, 0xCA, 0xAB, 0x31, 0x24, 0xA0, 0xAC, 0x18, 0x23, 0x22, 0x73, 0x35, 0x02, 0xA9, 0x19, 0x44,
+  0x02, 0x98, 0x28, 0x33, 0xF8, 0xCC, 0x9B, 0x08, 0x80, 0xAA, 0xAB, 0xA9, 0xCC, 0x9A, 0x18, 0x23,
+  0x52, 0x34, 0x23, 0x11, 0x21, 0x54, 0x54, 0x32, 0x00, 0x98, 0x9A, 0x8A, 0x21, 0x82, 0xCA, 0xBC,
+  0xCC, 0xBD, 0xAD, 0x8A, 0x31, 0x02, 0xB8, 0xAD, 0x09, 0x10, 0x31, 0x45, 0x34, 0x12, 0x88, 0x18,
+  0x73, 0x33, 0x22, 0x81, 0x90, 0xCA, 0xAB, 0xAB, 0x09, 0xA9, 0xBA, 0xEF, 0xBD, 0xBC, 0x0A, 0x12,
+  0xD0, 0xEF, 0x9A, 0x42, 0x25, 0xA0, 0xBC, 0x0A, 0x54, 0x12, 0x90, 0x09, 0x42, 0x12, 0x99, 0x09,
+  0x21, 0x80, 0x9A, 0x20, 0x92, 0xFF, 0xAC, 0x09, 0x21, 0x90, 0xDB, 0x8A, 0x10, 0x80, 0xAA, 0x28,
+  0x54, 0x12, 0x00, 0x21, 0x24, 0x81, 0x10, 0x65, 0x33, 0xA1, 0xAC, 0x0A, 0x02, 0xB9, 0xBC, 0x89,
+  0xA0, 0xDE, 0xAC, 0x9A, 0xB9, 0x8B, 0x55, 0x03, 0xA9, 0x9B, 0x21, 0x54, 0x34, 0x12, 0x32, 0x82,
+  0xAA, 0x38, 0x23, 0xB9, 0x29, 0xC1, 0xDF, 0xCB, 0xAB, 0x8A, 0x11, 0x80, 0x89, 0xC9, 0xBE, 0x8A,
+  0x44, 0x34, 0x13, 0x08, 0x00, 0x12, 0x80, 0x20, 0x46, 0x24, 0x80, 0xBA, 0xAB, 0x89, 0x99, 0x08,
+  0x81, 0xEC, 0xBD, 0xAD, 0x99, 0x09, 0x21, 0x11, 0xB8, 0xCD, 0x8A, 0x52, 0x83, 0xDE, 0x8C, 0x72,
+  0x34, 0x90, 0xCC, 0x0A, 0x32, 0x24, 0x90, 0x89, 0x31, 0x02, 0xC9, 0x8A, 0x10, 0x90, 0xCB, 0x18,
+  0x14, 0xFA, 0xBE, 0x0A, 0x31, 0x12, 0xA9, 0x9B, 0x21, 0x03, 0xB9, 0x38, 0x57, 0x12, 0x80, 0x20,
+  0xA1, 0x25, 0x3F, 0x00, 0x02, 0xEB, 0x8B, 0x52, 0x23, 0xC8, 0xBC, 0x89, 0x99, 0xBB, 0x8A, 0x32,
+  0x91, 0xCE, 0x89, 0x11, 0xBA, 0x1B, 0x77, 0x23, 0x01, 0x88, 0x98, 0x20, 0x33, 0x53, 0x23, 0xB0,
+  0xCD, 0xAB, 0xAA, 0xBB, 0x9A, 0x98, 0xAA, 0xBC, 0xBC, 0xAA, 0x38, 0x67, 0x34, 0x02, 0x99, 0x89,
+  0x53, 0x24, 0x01, 0x10, 0x22, 0xB8, 0xCF, 0x9A, 0x08, 0x01, 0x98, 0x9A, 0x88, 0xDA, 0xCC, 0x8A,
+  0x32, 0x14, 0x90, 0x9A, 0xAA, 0x99, 0x72, 0x26, 0x02, 0xA0, 0x09, 0x22, 0xB1, 0xFF, 0xBF, 0x31,
+  0x45, 0x81, 0xDB, 0x9B, 0x20, 0x24, 0x81, 0x08, 0x31, 0x14, 0xA8, 0x99, 0x08, 0x90, 0xBB, 0x39,
+  0x37, 0xC1, 0xCF, 0xAA, 0x00, 0x12, 0x88, 0x99, 0x11, 0x12, 0xB9, 0x19, 0x64, 0x13, 0x81, 0x42,
+  0x35, 0x82, 0xEB, 0x9A, 0x21, 0x13, 0xB9, 0xAC, 0x99, 0xCA, 0xCC, 0x8A, 0x10, 0x80, 0x9B, 0x50,
+  0x14, 0xB8, 0x9C, 0x41, 0x36, 0x33, 0x12, 0x90, 0xA9, 0x9A, 0x39, 0x37, 0x92, 0xCB, 0xBA, 0xBB,
+  0xBD, 0xBB, 0xAA, 0x50, 0x43, 0x81, 0x98, 0xAA, 0x40, 0x45, 0x14, 0x11, 0x10, 0x11, 0x00, 0xAA,
+  0x19, 0x33, 0xE9, 0xBE, 0xAA, 0xA8, 0xCA, 0xAC, 0x09, 0x44, 0x03, 0xBA, 0xAB, 0x10, 0x23, 0x44,
+  0x13, 0x08, 0x30, 0x65, 0x23, 0x90, 0xDB, 0x8B, 0x42, 0xD0, 0xFF, 0xAC, 0x20, 0x35, 0x83, 0xDC,
+  0xAA, 0x21, 0x34, 0x01, 0x08, 0x21, 0x24, 0x98, 0x99, 0x80, 0xA8, 0xCD, 0x09, 0x22, 0xA1, 0xEF,
+  0xAB, 0x08, 0x12, 0x81, 0x89, 0x30, 0x33, 0x02, 0x10, 0x44, 0x23, 0x80, 0x50, 0x46, 0x82, 0xCA,
+  0xAC, 0x09, 0x01, 0xB9, 0xBC, 0x09, 0x90, 0xCB, 0x9B, 0x20, 0x02, 0x89, 0x74, 0x36, 0x82, 0xBB,
+  0x2A, 0x45, 0x13, 0x00, 0x89, 0xBA, 0x9A, 0x89, 0x21, 0xB1, 0xEF, 0x0A, 0x10, 0xB0, 0xAD, 0x0A,
+  0xCB, 0xD6, 0x3E, 0x00, 0x53, 0x12, 0x01, 0x00, 0x00, 0x01, 0x52, 0x22, 0x90, 0x9A, 0x10, 0x82,
+  0xDD, 0xBB, 0x9A, 0x90, 0xA9, 0x9A, 0xDA, 0xBC, 0x9C, 0x40, 0x46, 0x22, 0xA8, 0xAB, 0x10, 0x34,
+  0x82, 0xBA, 0x19, 0x64, 0x23, 0x80, 0xAA, 0x2A, 0x35, 0x92, 0xFB, 0xEE, 0xCE, 0xAA, 0x51, 0x34,
+  0x81, 0xCC, 0x9A, 0x41, 0x33, 0x80, 0x08, 0x42, 0x22, 0x90, 0xAA, 0xAB, 0xDA, 0xAB, 0x19, 0x33,
+  0xD8, 0xCF, 0xAB, 0x18, 0x23, 0x80, 0x88, 0x52, 0x34, 0x12, 0x88, 0x10, 0x02, 0x00, 0x41, 0x37,
+  0x91, 0xEC, 0xBB, 0x09, 0x80, 0xBA, 0x9B, 0x31, 0x24, 0xB9, 0xAB, 0x30, 0x23, 0x41, 0x67, 0x34,
+  0x82, 0xCA, 0xAA, 0x18, 0x32, 0x01, 0xB9, 0xBB, 0xAC, 0x9A, 0xA9, 0xAA, 0x1A, 0x74, 0x33, 0x02,
+  0xC9, 0xBB, 0x1A, 0x45, 0x35, 0x11, 0x98, 0xAB, 0x89, 0xA8, 0xBB, 0x3A, 0x77, 0x02, 0xB8, 0xAC,
+  0x89, 0x01, 0x80, 0x18, 0x22, 0xC0, 0xCF, 0x8A, 0x21, 0x23, 0x88, 0x41, 0x34, 0x03, 0xCA, 0x9A,
+  0x10, 0x42, 0x12, 0x00, 0x91, 0xAA, 0xCA, 0x48, 0xB3, 0xFF, 0xAE, 0xAA, 0xDC, 0xAC, 0x30, 0x47,
+  0x12, 0xBA, 0x9C, 0x30, 0x35, 0x81, 0x88, 0x21, 0x34, 0x90, 0xCB, 0xAB, 0xBA, 0xBC, 0x8B, 0x32,
+  0x14, 0xEC, 0xAC, 0x0A, 0x22, 0x13, 0x00, 0x52, 0x44, 0x12, 0x98, 0x89, 0x18, 0x08, 0x18, 0x43,
+  0x82, 0xFD, 0xBC, 0x8A, 0x00, 0x90, 0x99, 0x10, 0x33, 0x82, 0x99, 0x30, 0x35, 0x21, 0x53, 0x46,
+  0x12, 0xC8, 0xCB, 0x9A, 0x80, 0x10, 0x02, 0xB8, 0xCB, 0x89, 0x12, 0x11, 0x11, 0x61, 0x47, 0x02,
+  0x98, 0xAA, 0xBB, 0x9B, 0x51, 0x23, 0x80, 0xCD, 0xAA, 0x99, 0xAA, 0x19, 0x57, 0x24, 0x01, 0x80,
+  0x10, 0x90, 0xCD, 0x9A, 0x30, 0x02, 0xDB, 0x9C, 0x28, 0x01, 0xDA, 0x8A, 0x61, 0x34, 0x12, 0x81,
+  0x0D, 0x17, 0x3B, 0x00, 0x99, 0xAB, 0x9A, 0x10, 0x80, 0x9A, 0x18, 0x53, 0xA1, 0xFF, 0xAA, 0x89,
+  0x11, 0x98, 0xDE, 0xBD, 0x30, 0x47, 0x13, 0xB9, 0xAC, 0x18, 0x35, 0x02, 0x88, 0x08, 0x42, 0x02,
+  0xB8, 0xCC, 0xBB, 0xAC, 0x9A, 0x00, 0x22, 0xC8, 0xBD, 0x8A, 0x52, 0x13, 0x00, 0x20, 0x47, 0x24,
+  0x00, 0x98, 0x89, 0xB9, 0xBB, 0x29, 0x24, 0xD8, 0xCE, 0x8A, 0x08, 0x90, 0xBB, 0x09, 0x45, 0x23,
+  0x01, 0x21, 0x22, 0x81, 0x28, 0x65, 0x23, 0xA0, 0xCC, 0xAA, 0xA8, 0xCD, 0x8A, 0x11, 0x81, 0x08,
+  0x00, 0x90, 0x30, 0x44, 0x55, 0x13, 0x80, 0x09, 0x01, 0xD9, 0xAC, 0x88, 0x08, 0x90, 0xBA, 0x9A,
+  0xCC, 0xBB, 0x38, 0x77, 0x32, 0x11, 0x80, 0x88, 0xB9, 0xBC, 0xBB, 0x89, 0x80, 0x11, 0x22, 0x21,
+  0xB0, 0xBF, 0x09, 0x73, 0x27, 0x22, 0x80, 0xBA, 0xBB, 0xCB, 0xAB, 0xAC, 0x1A, 0x52, 0x34, 0x90,
+  0x9A, 0x9B, 0x50, 0x33, 0x43, 0x82, 0xA9, 0xFF, 0xBF, 0x0A, 0x54, 0x23, 0xA8, 0xBC, 0x29, 0x34,
+  0x02, 0xAA, 0x28, 0x36, 0x13, 0xB8, 0xBC, 0xBB, 0xCC, 0xAA, 0x28, 0x32, 0xA1, 0xBD, 0x8A, 0x42,
+  0x83, 0xA9, 0x58, 0x57, 0x23, 0x81, 0x99, 0x98, 0x99, 0xAC, 0x8A, 0x11, 0xB1, 0xCE, 0x9B, 0x89,
+  0xA8, 0xBC, 0x29, 0x46, 0x24, 0x02, 0x11, 0x22, 0x01, 0x9A, 0x29, 0x43, 0xA0, 0xDE, 0xAB, 0x99,
+  0xEB, 0xBC, 0x0A, 0x33, 0x24, 0x12, 0x11, 0x11, 0x43, 0x33, 0x52, 0x23, 0x10, 0x00, 0xB8, 0xFF,
+  0xBB, 0xAA, 0x89, 0x88, 0x80, 0x80, 0x20, 0x63, 0x43, 0x12, 0x10, 0x73, 0x24, 0x02, 0xB9, 0xBD,
+  0xBB, 0xBB, 0x9A, 0x20, 0x33, 0x01, 0xAA, 0x99, 0x20, 0x43, 0x44, 0x45, 0x33, 0x81, 0xDA, 0xCC,
+  0x9A, 0x00, 0x22, 0x13, 0x90, 0xBD, 0x8A, 0x00, 0x00, 0x31, 0x57, 0x34, 0x22, 0xD9, 0xDB, 0xBB,
+  0xD9, 0xE1, 0x3D, 0x00, 0xCF, 0x8B, 0x73, 0x24, 0x90, 0xBB, 0x0A, 0x62, 0x12, 0x98, 0x18, 0x52,
+  0x23, 0xA8, 0xDB, 0xAB, 0xAA, 0xAB, 0x09, 0x42, 0x02, 0xDB, 0x9B, 0x30, 0x34, 0x90, 0x09, 0x57,
+  0x34, 0x01, 0x98, 0x99, 0xA9, 0xCB, 0xBB, 0x08, 0x98, 0xDC, 0xAB, 0x19, 0x80, 0xBA, 0x1B, 0x67,
+  0x34, 0x12, 0x12, 0x01, 0x80, 0xBA, 0x9B, 0x88, 0xD9, 0xCC, 0xAA, 0x98, 0xDA, 0xCC, 0xAB, 0x28,
+  0x46, 0x32, 0x13, 0x02, 0x80, 0x31, 0x34, 0x01, 0xA0, 0xDB, 0x9A, 0xB8, 0xCF, 0xAD, 0x9A, 0x08,
+  0x21, 0x81, 0x08, 0x52, 0x34, 0x23, 0x22, 0x32, 0x32, 0xA0, 0xCC, 0xCB, 0xBC, 0xCD, 0xAB, 0x99,
+  0x11, 0x22, 0x11, 0x31, 0x36, 0x34, 0x11, 0x10, 0x21, 0x23, 0xC8, 0xCF, 0xCB, 0xAA, 0x89, 0x11,
+  0x11, 0x80, 0xBB, 0x8B, 0x21, 0x34, 0x66, 0x34, 0x24, 0x02, 0xA8, 0xA9, 0xDB, 0xBC, 0xCC, 0xCC,
+  0x9C, 0x40, 0x36, 0x02, 0xCA, 0x9B, 0x40, 0x34, 0x82, 0x99, 0x20, 0x34, 0x02, 0xDB, 0xCC, 0xAA,
+  0x99, 0x89, 0x18, 0x10, 0x90, 0x9A, 0x30, 0x45, 0x03, 0x8A, 0x70, 0x45, 0x23, 0x90, 0xAA, 0xA9,
+  0xBA, 0xCC, 0xAB, 0x99, 0xAA, 0xAA, 0x40, 0x34, 0x90, 0xBC, 0x38, 0x47, 0x33, 0x11, 0x21, 0x33,
+  0x91, 0xCD, 0x9C, 0x9A, 0xBA, 0xAA, 0x30, 0x15, 0xB8, 0xBE, 0xAB, 0x89, 0x72, 0x45, 0x12, 0x02,
+  0x81, 0x88, 0x89, 0xBA, 0xAB, 0x08, 0xB8, 0x9B, 0xEA, 0xCE, 0xAB, 0x8A, 0x20, 0x43, 0x34, 0x45,
+  0x33, 0x01, 0x80, 0x00, 0x80, 0xA9, 0xCC, 0xBC, 0xBD, 0xBD, 0x9A, 0x09, 0x11, 0x22, 0x22, 0x54,
+  0x33, 0x24, 0x12, 0x00, 0x10, 0x00, 0xB8, 0xDE, 0xDB, 0xAA, 0x8A, 0x89, 0x08, 0x10, 0x32, 0x34,
+  0x44, 0x22, 0x12, 0x21, 0x53, 0x24, 0x22, 0x12, 0xE9, 0xCE, 0xAB, 0xAA, 0xA8, 0xFB, 0xBE, 0x0B,
+  0x89, 0xAC, 0x44, 0x00, 0x47, 0x02, 0xA8, 0x9B, 0x30, 0x35, 0x82, 0xA9, 0x09, 0x44, 0x13, 0xB9,
+  0xBE, 0xAC, 0x9A, 0x88, 0x00, 0x00, 0x88, 0x88, 0x51, 0x43, 0x82, 0xBA, 0x38, 0x77, 0x22, 0x81,
+  0xA9, 0xAA, 0xAA, 0xBC, 0xAB, 0x9A, 0x88, 0x10, 0x52, 0x23, 0xA0, 0xCD, 0x19, 0x45, 0x24, 0x02,
+  0x01, 0x22, 0x81, 0xDB, 0xAC, 0x9A, 0x98, 0xAA, 0x89, 0x00, 0xEA, 0xCC, 0x0A, 0x42, 0x43, 0x23,
+  0x43, 0x22, 0x33, 0x02, 0xDA, 0xCB, 0x9B, 0x10, 0x91, 0xDC, 0xAC, 0xAA, 0xA9, 0x99, 0x9A, 0x29,
+  0x46, 0x45, 0x24, 0x81, 0x98, 0x00, 0x11, 0xB9, 0xDC, 0xAA, 0x98, 0xBA, 0xBC, 0x8A, 0x20, 0x33,
+  0x52, 0x45, 0x43, 0x22, 0x80, 0x08, 0x18, 0x98, 0xCC, 0xCC, 0xAA, 0x99, 0x99, 0x9A, 0x89, 0x10,
+  0x44, 0x44, 0x33, 0x34, 0x23, 0x32, 0x33, 0xB1, 0xBD, 0x9C, 0x99, 0xCA, 0xBE, 0xAA, 0x99, 0x98,
+  0xB9, 0xBC, 0xCD, 0xDD, 0xAC, 0x50, 0x46, 0x13, 0xA8, 0xAC, 0x10, 0x24, 0x81, 0xAB, 0x08, 0x45,
+  0x22, 0xB9, 0xCC, 0xAB, 0x99, 0x99, 0x9A, 0x88, 0x00, 0x21, 0x63, 0x23, 0x90, 0xBC, 0x48, 0x47,
+  0x22, 0x81, 0x08, 0x11, 0x90, 0xDC, 0xBB, 0xAA, 0x99, 0x08, 0x42, 0x13, 0xFA, 0xBB, 0x19, 0x43,
+  0x12, 0x00, 0x73, 0x34, 0x13, 0xB8, 0xCB, 0x9A, 0x99, 0x89, 0x08, 0x99, 0xBB, 0xAC, 0x88, 0xD9,
+  0xBD, 0x48, 0x36, 0x24, 0x13, 0x80, 0x08, 0x00, 0x99, 0xA9, 0xDC, 0x9C, 0x20, 0x90, 0xDB, 0xBD,
+  0xAC, 0x0A, 0x30, 0x45, 0x34, 0x12, 0x11, 0x22, 0x81, 0xD9, 0xBD, 0x9A, 0x09, 0x88, 0xBA, 0xAD,
+  0x8A, 0x10, 0x11, 0x52, 0x54, 0x34, 0x22, 0x01, 0x01, 0x01, 0xB8, 0xCD, 0xAB, 0x89, 0x99, 0xCA,
+  0xCC, 0xAA, 0x89, 0x18, 0x11, 0x22, 0x54, 0x55, 0x23, 0x22, 0x80, 0x88, 0x89, 0xCA, 0xCD, 0xBA,
+  0x14, 0xFC, 0x34, 0x00, 0x89, 0x18, 0x23, 0x80, 0xB9, 0xAC, 0x71, 0x36, 0x11, 0xCA, 0xCE, 0xAC,
+  0x09, 0x33, 0x23, 0xA8, 0x9C, 0x31, 0x35, 0x80, 0x09, 0x42, 0x64, 0x43, 0x11, 0xA8, 0xBD, 0x9B,
+  0x88, 0xA9, 0xBD, 0xAB, 0x18, 0x23, 0x82, 0xBB, 0x9A, 0x73, 0x37, 0x33, 0x13, 0x11, 0x23, 0x02,
+  0xEA, 0xCD, 0xAA, 0x8A, 0x08, 0x80, 0xA9, 0xCB, 0x9B, 0x19, 0x32, 0x23, 0x42, 0x65, 0x44, 0x12,
+  0x91, 0x9A, 0x99, 0x08, 0x88, 0xDB, 0xAC, 0xBA, 0xAB, 0xCA, 0xCC, 0xAB, 0x61, 0x44, 0x32, 0x13,
+  0x88, 0x10, 0x12, 0x00, 0x80, 0xCA, 0xAC, 0x11, 0xFA, 0xBC, 0xCC, 0x9B, 0x89, 0x11, 0x33, 0x35,
+  0x33, 0x53, 0x23, 0x22, 0x01, 0x88, 0x80, 0xFB, 0xCB, 0xAC, 0xAA, 0xBA, 0xBB, 0x19, 0x63, 0x43,
+  0x12, 0x11, 0x31, 0x53, 0x33, 0x03, 0x90, 0x88, 0x80, 0xEB, 0xDE, 0xBC, 0xAA, 0x89, 0x10, 0x02,
+  0x88, 0x88, 0x41, 0x34, 0x34, 0x23, 0x53, 0x44, 0x12, 0x98, 0xCD, 0xBC, 0x9A, 0x89, 0x10, 0x00,
+  0x88, 0x88, 0x11, 0x00, 0x98, 0x19, 0x66, 0x44, 0x33, 0x12, 0x00, 0x98, 0x89, 0xA9, 0xDE, 0xDC,
+  0xBB, 0xAB, 0x99, 0x98, 0x18, 0x45, 0x34, 0x35, 0x02, 0x10, 0x11, 0x33, 0x44, 0x24, 0xA0, 0xAB,
+  0xDC, 0xCB, 0xBB, 0xCB, 0x9A, 0x08, 0x12, 0x41, 0x33, 0x02, 0x88, 0x10, 0x44, 0x35, 0x13, 0x01,
+  0x99, 0xDB, 0xCB, 0xCC, 0xAB, 0x9B, 0x30, 0x54, 0x22, 0x00, 0x10, 0x12, 0x42, 0x12, 0x88, 0xD9,
+  0xCC, 0xBA, 0xBB, 0xDB, 0x9B, 0x10, 0x20, 0x12, 0x08, 0x54, 0x34, 0x44, 0x32, 0x34, 0x23, 0x01,
+  0xDA, 0xAB, 0xCB, 0xBB, 0xB9, 0xAB, 0xA9, 0xAA, 0x90, 0xAA, 0xCA, 0x9C, 0x74, 0x24, 0x22, 0x90,
+  0x89, 0x08, 0x52, 0x33, 0x32, 0xB1, 0xAF, 0xA8, 0xCA, 0xBC, 0xBB, 0x09, 0x41, 0x45, 0x22, 0x22,
+  0xB2, 0x01, 0x23, 0x00, 0x88, 0x32, 0x34, 0x90, 0xCD, 0xAB, 0xAA, 0x9A, 0xBB, 0xAC, 0xAA, 0x29,
+  0x55, 0x35, 0x02, 0x88, 0x11, 0x32, 0x34, 0x11, 0x98, 0x98, 0xAA, 0x88, 0xFA, 0xBD, 0xCC, 0xAB,
+  0x89, 0x08, 0x99, 0x38, 0x25, 0x64, 0x34, 0x21, 0x91, 0xCB, 0xB9, 0x9C, 0x80, 0xBA, 0x99, 0x28,
+  0x37, 0x02, 0x12, 0xEC, 0x9B, 0x88, 0x41, 0x03, 0x98, 0xCA, 0x38, 0x02, 0xBC, 0xCE, 0xAC, 0x18,
+  0x21, 0x23, 0x80, 0x09, 0x09, 0x65, 0x33, 0x21, 0x11, 0x21, 0x36, 0x22, 0x92, 0xEB, 0xBB, 0xBB,
+  0xCB, 0xCC, 0xBC, 0x9B, 0x28, 0x46, 0x33, 0x24, 0x80, 0x99, 0x8A, 0x20, 0x02, 0x20, 0x11, 0x73,
+  0x13, 0xA0, 0xDE, 0xAC, 0x8A, 0x08, 0x23, 0x22, 0x01, 0x08, 0x43, 0x23, 0x91, 0xDE, 0xAB, 0x08,
+  0x22, 0x91, 0xDA, 0xBB, 0x8A, 0x21, 0x13, 0xBA, 0xDF, 0x09, 0x44, 0x43, 0x02, 0x99, 0x9A, 0x89,
+  0x90, 0xCC, 0xBB, 0x9C, 0x40, 0x34, 0x23, 0xCA, 0xAD, 0xAA, 0x28, 0x23, 0x11, 0x12, 0x20, 0x15,
+  0x00, 0xAA, 0xAE, 0x88, 0x38, 0x47, 0x12, 0x91, 0xCD, 0xAB, 0x89, 0x11, 0x90, 0x28, 0x51, 0x55,
+  0x12, 0x11, 0xA8, 0x89, 0x88, 0x11, 0x01, 0xDC, 0xCB, 0x0A, 0x33, 0x36, 0x01, 0x88, 0x89, 0x09,
+  0x40, 0x22, 0xC0, 0x8C, 0x00, 0x41, 0x13, 0xEE, 0xAC, 0x89, 0x20, 0x24, 0x12, 0x89, 0x98, 0x31,
+  0x82, 0x18, 0xE8, 0x8C, 0x02, 0x30, 0x15, 0xBD, 0xBA, 0xBE, 0x10, 0x11, 0x02, 0xBB, 0x02, 0xAC,
+  0x57, 0x91, 0x00, 0xA8, 0x99, 0x09, 0xD0, 0x9C, 0x08, 0x09, 0x71, 0x03, 0x10, 0xA9, 0x9A, 0x90,
+  0x00, 0xCB, 0xAD, 0x00, 0x42, 0xA1, 0x09, 0xAE, 0x24, 0x0C, 0x27, 0x0A, 0x25, 0x9B, 0x22, 0xDB,
+  0x31, 0xB9, 0x14, 0xAE, 0x12, 0xAB, 0x25, 0xAA, 0x02, 0x29, 0xC3, 0x78, 0xC3, 0x2A, 0xA1, 0x3A,
+  0x53, 0x00, 0x14, 0x00, 0xA1, 0x54, 0xDB, 0x41, 0xA9, 0x19, 0x81, 0xAE, 0x33, 0xBD, 0x32, 0x99,
+  0x32, 0x9C, 0x15, 0xAD, 0x35, 0xCA, 0x51, 0xA8, 0x21, 0xA9, 0x12, 0xAD, 0x13, 0xBC, 0x20, 0xA1,
+  0x2C, 0x85, 0x8C, 0x93, 0x39, 0xD0, 0x58, 0xC1, 0x49, 0xA2, 0x3B, 0x96, 0x0B, 0xA3, 0x1D, 0xA2,
+  0x3B, 0xB4, 0x1D, 0x84, 0x1A, 0x82, 0x89, 0xA8, 0x60, 0xC1, 0x69, 0xC1, 0x28, 0xA0, 0x19, 0x91,
+  0x9B, 0x24, 0xBC, 0x42, 0xC8, 0x51, 0xD8, 0x48, 0xC1, 0x39, 0xA3, 0x0A, 0x13, 0xA9, 0x28, 0xA3,
+  0x0F, 0x93, 0x2C, 0xD2, 0x4A, 0xC2, 0x2B, 0x84, 0x8D, 0x22, 0x08, 0xCA, 0x74, 0xC9, 0x40, 0xB0,
+  0x19, 0x83, 0x8C, 0x13, 0x9A, 0x81, 0x80, 0x19, 0xE0, 0x68, 0xD0, 0x48, 0xB1, 0x3A, 0x93, 0x0D,
+  0x83, 0x2B, 0xE2, 0x68, 0xD0, 0x48, 0xB0, 0x4A, 0xB2, 0x19, 0x92, 0x1B, 0x83, 0x0C, 0x83, 0x19,
+  0xB8, 0x42, 0xC9, 0x20, 0xA0, 0x19, 0xB4, 0x4D, 0xA5, 0x1E, 0x85, 0x8C, 0x13, 0xAA, 0x30, 0xB1,
+  0x2C, 0x94, 0x1B, 0x92, 0x19, 0x98, 0x92, 0x4A, 0xD1, 0x48, 0xA1, 0x9B, 0x27, 0xDB, 0x42, 0xC8,
+  0x28, 0x92, 0x0B, 0x84, 0x1C, 0xA3, 0x1C, 0x85, 0x0D, 0x94, 0x1A, 0xB3, 0x3C, 0xA3, 0x0B, 0x13,
+  0x8C, 0x95, 0x2D, 0x95, 0x1D, 0x02, 0x8B, 0x11, 0x98, 0x81, 0x3A, 0xE3, 0x5A, 0xC1, 0x38, 0xB0,
+  0x28, 0x81, 0x0D, 0x96, 0x2C, 0xC4, 0x39, 0xB1, 0x4A, 0x90, 0x09, 0x82, 0x2A, 0xF2, 0x68, 0xC8,
+  0x40, 0xB8, 0x20, 0x88, 0x88, 0x00, 0x28, 0xF0, 0x58, 0xB0, 0x3A, 0x93, 0x9B, 0x33, 0xEA, 0x41,
+  0xBA, 0x43, 0xBB, 0x33, 0xAA, 0x10, 0x80, 0x90, 0x19, 0xA4, 0x4D, 0xC3, 0x2D, 0x96, 0x8C, 0x24,
+  0xAC, 0x32, 0xBA, 0x32, 0xBA, 0x52, 0xD9, 0x50, 0xB9, 0x41, 0xBA, 0x43, 0xAB, 0x22, 0xA9, 0x11,
+  0x4E, 0x00, 0x34, 0x00, 0x19, 0xA1, 0x5A, 0xC0, 0x50, 0xCA, 0x53, 0xDA, 0x41, 0xC8, 0x30, 0xC0,
+  0x38, 0xA8, 0x10, 0x88, 0x80, 0x08, 0x00, 0x90, 0x09, 0x14, 0x9E, 0x13, 0x1A, 0xF1, 0x60, 0xC8,
+  0x20, 0x19, 0xC0, 0x58, 0xC0, 0x20, 0x09, 0xA8, 0x33, 0x9F, 0x05, 0x8C, 0x04, 0x0C, 0x02, 0xAA,
+  0x53, 0xDB, 0x33, 0xDA, 0x31, 0xB9, 0x41, 0xC9, 0x42, 0xCA, 0x32, 0xCA, 0x31, 0xB8, 0x30, 0xD0,
+  0x48, 0xD1, 0x49, 0xB1, 0x29, 0x92, 0x1C, 0x94, 0x1C, 0x83, 0x0D, 0x83, 0x0B, 0x03, 0x8C, 0x04,
+  0x0D, 0x83, 0x0B, 0x03, 0x0C, 0x11, 0xA9, 0x31, 0xBA, 0x43, 0xAC, 0x14, 0x8C, 0x03, 0x0C, 0x03,
+  0x9D, 0x24, 0xCB, 0x42, 0xB9, 0x20, 0x80, 0x0A, 0x84, 0x0D, 0x84, 0x1C, 0xA3, 0x3A, 0xA8, 0x03,
+  0x0E, 0x95, 0x1B, 0x83, 0x8B, 0x23, 0xBC, 0x34, 0xAD, 0x15, 0x8D, 0x84, 0x0B, 0x84, 0x0B, 0x02,
+  0x99, 0x20, 0xC0, 0x31, 0xDA, 0x33, 0xBB, 0x02, 0x21, 0xBE, 0x26, 0xAC, 0x14, 0xAA, 0x32, 0xC9,
+  0x38, 0xA0, 0x28, 0x98, 0x08, 0x03, 0x8F, 0x85, 0x2B, 0xE2, 0x50, 0xC9, 0x21, 0xA0, 0x89, 0x43,
+  0xCC, 0x43, 0xBB, 0x33, 0xBA, 0x21, 0xA0, 0x29, 0x81, 0x99, 0x78, 0xE1, 0x59, 0xD1, 0x49, 0xB1,
+  0x3A, 0x93, 0x0E, 0x83, 0x89, 0x90, 0x23, 0xAE, 0x24, 0xAB, 0x12, 0x80, 0x8A, 0x02, 0x39, 0xF9,
+  0x70, 0xB9, 0x21, 0xA0, 0x18, 0x90, 0x00, 0x98, 0x32, 0xAE, 0x34, 0xDB, 0x31, 0xB1, 0x1C, 0x13,
+  0xB9, 0x4C, 0xA6, 0x1C, 0xA3, 0x10, 0xAB, 0x16, 0x9B, 0x21, 0xA1, 0x1C, 0xA5, 0x3A, 0xD1, 0x40,
+  0xB9, 0x41, 0xB8, 0x3A, 0x96, 0x0C, 0x03, 0xBA, 0x42, 0xD8, 0x40, 0xB8, 0x30, 0x8A, 0x81, 0x18,
+  0xA9, 0x05, 0x8D, 0x04, 0x9A, 0x38, 0xA4, 0x0E, 0x13, 0xAA, 0x49, 0xB3, 0x1D, 0x03, 0xAA, 0x40,
+  0xC3, 0x02, 0x35, 0x00, 0x8B, 0x83, 0x2D, 0xA3, 0x1D, 0x84, 0xAA, 0x32, 0xC0, 0x2A, 0x03, 0xAD,
+  0x24, 0xC9, 0x21, 0x98, 0x90, 0x69, 0xE1, 0x59, 0xC1, 0x39, 0xB1, 0x39, 0xA0, 0x28, 0xA2, 0x0E,
+  0x06, 0x0D, 0x83, 0x0B, 0x93, 0x2B, 0xB2, 0x20, 0xB8, 0x21, 0xA0, 0x0A, 0x13, 0x98, 0x9E, 0x27,
+  0xAD, 0x33, 0x9B, 0x81, 0x38, 0xE0, 0x38, 0xA1, 0x1A, 0x94, 0x1D, 0x95, 0x1B, 0x82, 0x99, 0x49,
+  0xF3, 0x49, 0xD1, 0x48, 0xB0, 0x5A, 0xB1, 0x3A, 0x93, 0x8D, 0x33, 0xDB, 0x50, 0xC0, 0x28, 0x80,
+  0x88, 0x10, 0x9A, 0x16, 0x8F, 0x13, 0xAB, 0x32, 0xB9, 0x38, 0xB3, 0x0C, 0x04, 0x8B, 0x12, 0x1B,
+  0xA2, 0x1A, 0x12, 0xE8, 0x7A, 0xC1, 0x49, 0xA0, 0x00, 0x19, 0x91, 0x0A, 0x32, 0xFB, 0x52, 0xDA,
+  0x13, 0x9A, 0x82, 0x00, 0x0B, 0xA6, 0x5B, 0xD1, 0x48, 0x98, 0x90, 0x50, 0xD9, 0x22, 0x9B, 0x85,
+  0x1C, 0xA3, 0x2A, 0x80, 0x80, 0x4B, 0xC2, 0x4A, 0xA1, 0x19, 0x81, 0x89, 0x13, 0xAE, 0x25, 0xBB,
+  0x42, 0xB9, 0x40, 0xB8, 0x69, 0xC1, 0x39, 0xC2, 0x39, 0xA0, 0x00, 0x08, 0x89, 0x14, 0x9F, 0x06,
+  0x8B, 0x82, 0x28, 0xCA, 0x24, 0x9C, 0x03, 0x1C, 0x93, 0x8B, 0x24, 0xEB, 0x52, 0xCA, 0x32, 0xC9,
+  0x11, 0xA1, 0x1A, 0x94, 0x1B, 0xA3, 0x39, 0xB8, 0x11, 0x08, 0x8B, 0x87, 0x2E, 0xB4, 0x4B, 0xC2,
+  0x18, 0x81, 0xB8, 0x52, 0xBB, 0x15, 0x0D, 0x93, 0x1A, 0xA1, 0x22, 0x9E, 0x24, 0xCB, 0x41, 0xA0,
+  0x0B, 0x16, 0x9C, 0x22, 0xAA, 0x83, 0x2A, 0xB1, 0x18, 0x48, 0xF1, 0x7A, 0xB0, 0x39, 0xA2, 0x8A,
+  0x23, 0xAC, 0x14, 0x0C, 0x83, 0x8C, 0x23, 0xBC, 0x72, 0xC9, 0x51, 0xC9, 0x31, 0xD8, 0x30, 0xB0,
+  0x29, 0x93, 0x0D, 0x04, 0x8D, 0x04, 0x9B, 0x04, 0x9A, 0x31, 0xD9, 0x41, 0xD8, 0x40, 0x99, 0x28,
+  0xD8, 0x02, 0x3E, 0x00, 0x98, 0x10, 0xB0, 0x21, 0x9A, 0x94, 0x3B, 0xB2, 0x29, 0x19, 0xD1, 0x68,
+  0xB9, 0x14, 0x0D, 0x03, 0x9C, 0x33, 0xF9, 0x68, 0xB8, 0x30, 0xA8, 0x18, 0x00, 0x9A, 0x04, 0x1C,
+  0xB3, 0x4A, 0xA0, 0x00, 0x28, 0xD9, 0x43, 0xAC, 0x05, 0x1C, 0xA2, 0x4A, 0xB1, 0x19, 0x83, 0x9D,
+  0x15, 0x9C, 0x13, 0x99, 0x88, 0x23, 0x8E, 0x83, 0x2B, 0xD3, 0x4A, 0xB2, 0x1A, 0x12, 0xCA, 0x52,
+  0xBA, 0x42, 0xBA, 0x22, 0x98, 0x8A, 0x16, 0x9C, 0x13, 0xAB, 0x24, 0xDB, 0x52, 0xD8, 0x38, 0xB2,
+  0x2C, 0x84, 0x0D, 0x13, 0xBC, 0x34, 0xDA, 0x50, 0xB8, 0x38, 0xA0, 0x28, 0x90, 0x0A, 0x15, 0xAD,
+  0x34, 0xBC, 0x33, 0xAA, 0x11, 0x8A, 0x84, 0x0C, 0x83, 0x1A, 0x98, 0x03, 0x1D, 0xB3, 0x7A, 0xC8,
+  0x41, 0xB9, 0x30, 0x98, 0x0A, 0x87, 0x8C, 0x05, 0x9B, 0x13, 0x9B, 0x23, 0x9D, 0x14, 0x9B, 0x21,
+  0xB0, 0x6B, 0xC2, 0x5A, 0xB0, 0x38, 0xA0, 0x08, 0x11, 0xBA, 0x53, 0xBB, 0x24, 0x9C, 0x14, 0x9C,
+  0x13, 0x99, 0x98, 0x34, 0xBE, 0x25, 0x9C, 0x13, 0x8C, 0x84, 0x1B, 0xA3, 0x2B, 0xA4, 0x3B, 0xC1,
+  0x31, 0xAC, 0x14, 0x1B, 0xC1, 0x31, 0x9B, 0xA3, 0x7A, 0xF1, 0x50, 0xC9, 0x31, 0xA9, 0x28, 0xA2,
+  0x2C, 0xA5, 0x1C, 0x84, 0x8C, 0x14, 0xBB, 0x34, 0xDB, 0x32, 0xD8, 0x48, 0xB1, 0x2A, 0xA4, 0x1B,
+  0x84, 0x8C, 0x04, 0x9B, 0x14, 0x9B, 0x22, 0xAA, 0x21, 0xA0, 0x1A, 0x96, 0x2C, 0xA2, 0x19, 0x80,
+  0x91, 0x2A, 0xA3, 0x98, 0x4F, 0xB6, 0x2D, 0xA5, 0x2A, 0x90, 0x10, 0x8A, 0x92, 0x48, 0xDA, 0x42,
+  0xAA, 0x11, 0x10, 0xCB, 0x63, 0xCA, 0x41, 0xB9, 0x41, 0xC8, 0x38, 0xB2, 0x2C, 0x84, 0x0D, 0x94,
+  0x1B, 0x95, 0x0B, 0x03, 0x9A, 0x20, 0xC1, 0x30, 0xCA, 0x52, 0xAA, 0x20, 0x91, 0x8B, 0x24, 0xAC,
+  0xC8, 0xFF, 0x30, 0x00, 0xA2, 0x4B, 0xC3, 0x4C, 0xA2, 0x1C, 0x03, 0xBA, 0x41, 0xA8, 0x01, 0x1D,
+  0x85, 0x0C, 0x82, 0x88, 0x08, 0x98, 0x14, 0x9D, 0x04, 0x8A, 0x00, 0xA4, 0x3E, 0xB5, 0x3D, 0xA3,
+  0x0C, 0x03, 0xBA, 0x43, 0xCA, 0x23, 0x9C, 0x23, 0xCA, 0x30, 0xB3, 0x0E, 0x14, 0xAC, 0x43, 0xBB,
+  0x24, 0xAC, 0x14, 0x9A, 0x11, 0xB1, 0x4C, 0xC4, 0x3A, 0xC2, 0x28, 0x90, 0x80, 0x18, 0x98, 0x10,
+  0x88, 0x98, 0x04, 0x0F, 0x04, 0x9C, 0x33, 0xE9, 0x48, 0xB0, 0x48, 0xA9, 0x22, 0x9B, 0x21, 0xA0,
+  0x1C, 0x06, 0x8D, 0x22, 0xBA, 0x42, 0xAB, 0x06, 0x8C, 0x84, 0x89, 0x08, 0x94, 0x1D, 0x94, 0x2B,
+  0xA1, 0x28, 0x90, 0xA9, 0x73, 0xD9, 0x40, 0xA8, 0x18, 0x80, 0x80, 0x08, 0xA1, 0x68, 0xE8, 0x50,
+  0xC8, 0x30, 0xA8, 0x10, 0x90, 0x2B, 0x96, 0x0D, 0x85, 0x0B, 0x82, 0x88, 0x80, 0x00, 0x08, 0xB0,
+  0x7B, 0xC3, 0x2B, 0x84, 0x8B, 0x21, 0xB0, 0x4A, 0xD1, 0x50, 0xB9, 0x50, 0xA8, 0x19, 0x83, 0x8C,
+  0x04, 0x0C, 0x94, 0x1B, 0xA4, 0x1A, 0x82, 0x9A, 0x61, 0xC9, 0x50, 0xC8, 0x40, 0xA9, 0x21, 0xB9,
+  0x32, 0xB9, 0x28, 0x93, 0x8D, 0x14, 0x8C, 0x93, 0x2C, 0x94, 0x0D, 0x13, 0x9B, 0x12, 0xAA, 0x05,
+  0x8C, 0x84, 0x1A, 0x90, 0x12, 0x8D, 0x95, 0x3B, 0xB1, 0x30, 0x8C, 0x85, 0x1D, 0xA3, 0x2A, 0x90,
+  0x11, 0x8C, 0x85, 0x1C, 0xA3, 0x4B, 0xD2, 0x59, 0xB8, 0x12, 0x9B, 0x87, 0x8B, 0x14, 0xCA, 0x60,
+  0xC0, 0x38, 0xD1, 0x38, 0xC0, 0x30, 0xA8, 0x29, 0x81, 0x99, 0x31, 0xD8, 0x38, 0xA1, 0x09, 0x38,
+  0xE0, 0x50, 0xBA, 0x34, 0xBC, 0x23, 0xA8, 0x1A, 0x05, 0x9C, 0x03, 0x98, 0x08, 0x92, 0x3B, 0xC3,
+  0x2D, 0x87, 0x8D, 0x14, 0x9C, 0x23, 0x8C, 0x02, 0x8B, 0x04, 0x8B, 0x02, 0x19, 0xA8, 0x30, 0x98,
+  0xB3, 0xFF, 0x25, 0x00, 0x18, 0xA3, 0x2D, 0xC2, 0x60, 0xD9, 0x51, 0xD9, 0x41, 0xC8, 0x48, 0xB0,
+  0x59, 0xD1, 0x49, 0xB1, 0x4A, 0xA1, 0x19, 0x91, 0x88, 0x11, 0x9A, 0x13, 0xAB, 0x83, 0x30, 0xDC,
+  0x24, 0x9C, 0x23, 0x9C, 0x22, 0xD8, 0x48, 0xC1, 0x5A, 0xC1, 0x49, 0xD2, 0x39, 0xC2, 0x4A, 0xB1,
+  0x39, 0xA1, 0x19, 0x92, 0x0C, 0x85, 0x0B, 0x82, 0x80, 0x8A, 0x85, 0x8A, 0x82, 0x90, 0x39, 0xE1,
+  0x68, 0xB8, 0x48, 0xB0, 0x28, 0x90, 0x28, 0xAA, 0x15, 0x8D, 0x85, 0x1C, 0xA4, 0x1B, 0x84, 0x8B,
+  0x32, 0xCA, 0x32, 0xAC, 0x34, 0xBC, 0x51, 0xD1, 0x29, 0x92, 0x1A, 0x90, 0x12, 0xAA, 0x00, 0x43,
+  0xDD, 0x42, 0xB8, 0x29, 0x83, 0x9C, 0x13, 0x0A, 0xC1, 0x68, 0xA8, 0x18, 0x39, 0xF3, 0x4B, 0xB4,
+  0x1A, 0x82, 0x19, 0xB8, 0x60, 0xB8, 0x20, 0x09, 0xC4, 0x6B, 0xB1, 0x28, 0x8A, 0x96, 0x2C, 0xA2,
+  0x18, 0x89, 0xB3, 0x79, 0xE8, 0x32, 0xBB, 0x33, 0x9B, 0x01, 0x90, 0x3A, 0xB5, 0x1D, 0x85, 0x8C,
+  0x14, 0x8D, 0x84, 0x1B, 0xA3, 0x3B, 0xA2, 0x99, 0x42, 0xD9, 0x21, 0x0A, 0xB4, 0x3D, 0xB4, 0x3A,
+  0xA0, 0x11, 0x9A, 0x28, 0x97, 0x0E, 0x85, 0x0C, 0x83, 0x0A, 0x92, 0x1A, 0x82, 0x1C, 0x02, 0x9A,
+  0x38, 0xA3, 0x8F, 0x14, 0xAA, 0x39, 0xA5, 0x1C, 0xA3, 0x6A, 0xD0, 0x38, 0xB2, 0x0C, 0x15, 0xBB,
+  0x24, 0x8B, 0x82, 0x8A, 0x32, 0xF9, 0x69, 0xC1, 0x39, 0xA1, 0x19, 0x91, 0x1A, 0x84, 0x8D, 0x05,
+  0x9B, 0x23, 0xBB, 0x24, 0xBB, 0x24, 0xAB, 0x23, 0xBA, 0x68, 0xC1, 0x5A, 0xB0, 0x30, 0xB9, 0x23,
+  0xAB, 0x11, 0x94, 0x1E, 0xB3, 0x69, 0xD8, 0x31, 0xAA, 0x12, 0x0A, 0x92, 0x0A, 0x02, 0x89, 0x80,
+  0x11, 0x8D, 0x97, 0x2C, 0xC3, 0x49, 0xB8, 0x23, 0x0E, 0xA3, 0x4A, 0xC0, 0x21, 0x0B, 0xA3, 0x4A,
+  0x25, 0x00, 0x24, 0x00, 0x4C, 0xC2, 0x29, 0xA1, 0x00, 0x89, 0x02, 0x98, 0x0C, 0x17, 0x9D, 0x14,
+  0xAB, 0x14, 0x8C, 0x13, 0x8D, 0x13, 0xCA, 0x51, 0xD0, 0x48, 0xB8, 0x31, 0xBA, 0x33, 0xBB, 0x21,
+  0xA2, 0x1F, 0x95, 0x1C, 0xA3, 0x4A, 0xC0, 0x30, 0xB0, 0x19, 0x11, 0xC0, 0x2A, 0x05, 0xAB, 0x30,
+  0x02, 0xBD, 0x34, 0x9A, 0x98, 0x41, 0xB9, 0x21, 0x2B, 0xF5, 0x59, 0xB0, 0x39, 0x92, 0xBB, 0x45,
+  0xCB, 0x33, 0x8D, 0x94, 0x1B, 0x84, 0x8B, 0x12, 0xB0, 0x18, 0x11, 0xC9, 0x20, 0x88, 0xA2, 0x2E,
+  0x85, 0x8D, 0x42, 0xE9, 0x58, 0xB0, 0x38, 0xB0, 0x48, 0xC8, 0x40, 0xC1, 0x3A, 0xB3, 0x2C, 0x92,
+  0x09, 0x91, 0x3A, 0xA4, 0x0D, 0x04, 0x9A, 0x01, 0x80, 0x08, 0xA9, 0x35, 0xBC, 0x42, 0x99, 0x08,
+  0x10, 0xB9, 0x43, 0xCC, 0x42, 0x99, 0x91, 0x3A, 0xA6, 0x0C, 0x03, 0x09, 0xA9, 0x61, 0xB0, 0x1A,
+  0x02, 0x89, 0x81, 0x8C, 0x27, 0x9E, 0x23, 0xAC, 0x04, 0x99, 0x21, 0xB9, 0x50, 0xC8, 0x50, 0xB9,
+  0x22, 0x99, 0x90, 0x61, 0xDA, 0x31, 0xA8, 0x80, 0x29, 0x94, 0x8C, 0x40, 0xA2, 0x8F, 0x15, 0xAB,
+  0x12, 0x09, 0x91, 0x1B, 0x14, 0xCB, 0x51, 0xD8, 0x40, 0xA8, 0x29, 0x01, 0x99, 0x19, 0x05, 0xCB,
+  0x42, 0xC0, 0x29, 0x91, 0x10, 0xCC, 0x45, 0xEA, 0x31, 0xA9, 0x01, 0x08, 0x00, 0x99, 0x48, 0xC2,
+  0x2B, 0x95, 0x8A, 0x21, 0xB8, 0x4A, 0x94, 0x8D, 0x13, 0x0B, 0xB2, 0x4D, 0x95, 0x8E, 0x14, 0xBA,
+  0x41, 0xA8, 0x10, 0x99, 0x23, 0xBC, 0x51, 0xB0, 0x3B, 0x95, 0x0B, 0x83, 0x19, 0xD0, 0x48, 0xA1,
+  0x1B, 0x32, 0xF9, 0x49, 0xA2, 0x8B, 0x33, 0xC8, 0x0A, 0x52, 0xD1, 0x2C, 0x04, 0xBA, 0x48, 0x82,
+  0xAB, 0x58, 0xA3, 0x0E, 0x12, 0xA0, 0x1C, 0x14, 0xCA, 0x38, 0xA4, 0x0D, 0x12, 0x98, 0x9A, 0x35,
+  0x76, 0x00, 0x24, 0x00, 0x9C, 0x43, 0xC9, 0x28, 0x82, 0xA9, 0x4A, 0x94, 0xAB, 0x43, 0xB8, 0x18,
+  0x08, 0xA4, 0x0F, 0x05, 0x8C, 0x22, 0xBA, 0x42, 0xBA, 0x42, 0xCA, 0x31, 0xB8, 0x48, 0xC1, 0x49,
+  0xA1, 0x1B, 0x05, 0x9C, 0x32, 0xAB, 0x83, 0x3A, 0xD2, 0x4A, 0x91, 0x99, 0x30, 0xB2, 0x8E, 0x63,
+  0xD8, 0x3A, 0x95, 0x9B, 0x23, 0x99, 0x98, 0x59, 0xB3, 0x0F, 0x04, 0xAA, 0x31, 0xA8, 0x20, 0x9B,
+  0x25, 0xAD, 0x42, 0xB8, 0x39, 0xA2, 0x1C, 0x93, 0x2A, 0xC2, 0x39, 0xB2, 0x88, 0x28, 0xB5, 0x2E,
+  0x84, 0x8C, 0x11, 0x88, 0x98, 0x38, 0x94, 0x9F, 0x34, 0xCA, 0x38, 0x91, 0x8B, 0x33, 0xD8, 0x28,
+  0x98, 0x07, 0x8F, 0x14, 0xBB, 0x51, 0xA0, 0x2B, 0x92, 0x38, 0xFA, 0x61, 0xC8, 0x38, 0xA1, 0x09,
+  0x00, 0x01, 0xBB, 0x62, 0xD1, 0x19, 0x83, 0x8A, 0x08, 0x13, 0xBD, 0x44, 0xCA, 0x31, 0xB8, 0x38,
+  0xB0, 0x50, 0xE0, 0x59, 0xC2, 0x2A, 0x93, 0x8B, 0x03, 0x89, 0x91, 0x2B, 0x06, 0xBC, 0x62, 0xB8,
+  0x29, 0x03, 0xAC, 0x22, 0x09, 0xA1, 0x3D, 0x96, 0x8C, 0x23, 0xBA, 0x28, 0x12, 0xBB, 0x41, 0x91,
+  0x9B, 0x22, 0x92, 0xCD, 0x71, 0xD2, 0x3B, 0xA6, 0x2B, 0xB4, 0x3A, 0xC3, 0x2A, 0x82, 0x8B, 0x04,
+  0xAB, 0x15, 0x9B, 0x22, 0xAA, 0x30, 0xA2, 0x8D, 0x14, 0x99, 0x1A, 0x85, 0x1C, 0xB1, 0x70, 0xC8,
+  0x48, 0xB1, 0x1A, 0x03, 0x8B, 0x92, 0x2B, 0x96, 0x8B, 0x23, 0xC8, 0x2A, 0x85, 0x9A, 0x29, 0x05,
+  0x9D, 0x22, 0x88, 0x9A, 0x62, 0xC9, 0x30, 0xC0, 0x11, 0xCB, 0x35, 0xCB, 0x31, 0xB1, 0x09, 0x02,
+  0x09, 0xB2, 0x1F, 0x04, 0xBB, 0x63, 0xD9, 0x31, 0xC9, 0x31, 0xA9, 0x20, 0xB0, 0x38, 0xC1, 0x58,
+  0xC8, 0x28, 0x84, 0xAC, 0x33, 0x9A, 0xB2, 0x5C, 0xA4, 0x0B, 0x02, 0x82, 0xAE, 0x34, 0xDA, 0x38,
+  0x5C, 0x00, 0x1B, 0x00, 0xCB, 0x31, 0x98, 0x90, 0x18, 0x03, 0xEB, 0x70, 0xC1, 0x4A, 0xB2, 0x3B,
+  0x92, 0x09, 0xA0, 0x21, 0xA8, 0x0B, 0x16, 0xAB, 0x31, 0xD3, 0x2C, 0x85, 0x8D, 0x13, 0xA9, 0x28,
+  0xB1, 0x30, 0xCA, 0x24, 0xAD, 0x31, 0x91, 0x0B, 0x23, 0x19, 0xD1, 0x38, 0x00, 0xDB, 0x70, 0xD8,
+  0x40, 0xD8, 0x40, 0xC0, 0x28, 0x91, 0x98, 0x38, 0xD2, 0x29, 0x91, 0x02, 0x9B, 0x03, 0x13, 0xBF,
+  0x05, 0x0A, 0xB1, 0x31, 0xAC, 0x84, 0x3A, 0xF8, 0x32, 0xDA, 0x22, 0xA8, 0x4A, 0xB3, 0x3C, 0xD2,
+  0x40, 0xC8, 0x11, 0x00, 0xD9, 0x31, 0xAA, 0x12, 0x0A, 0x01, 0xA0, 0x1E, 0x96, 0x1B, 0x94, 0x1B,
+  0x84, 0x9B, 0x34, 0xDA, 0x31, 0xCA, 0x52, 0xDA, 0x41, 0xC0, 0x39, 0xA1, 0x19, 0x00, 0x28, 0xC8,
+  0x48, 0xA0, 0x19, 0x10, 0xB0, 0x4A, 0xB0, 0x33, 0x9D, 0x12, 0x11, 0xCD, 0x34, 0xCC, 0x31, 0x90,
+  0x9B, 0x46, 0xCA, 0x30, 0x80, 0xB8, 0x7A, 0xB2, 0x0A, 0x02, 0xC8, 0x49, 0xC3, 0x1B, 0x86, 0x8A,
+  0x13, 0xAB, 0x15, 0x9B, 0x23, 0xAD, 0x33, 0xDB, 0x30, 0x90, 0x98, 0x01, 0x89, 0x93, 0x1F, 0x96,
+  0x1D, 0x03, 0x9C, 0x23, 0xB8, 0x39, 0x82, 0x98, 0x9B, 0x35, 0xFB, 0x59, 0xA1, 0x0B, 0x14, 0xB9,
+  0x38, 0xA3, 0x8B, 0x79, 0xB1, 0x4B, 0xA3, 0x1B, 0x81, 0x81, 0x9C, 0x23, 0xA8, 0x39, 0xE3, 0x48,
+  0xF9, 0x41, 0xC9, 0x40, 0xA0, 0x09, 0x12, 0x0A, 0x92, 0x1C, 0x85, 0x8E, 0x23, 0xAC, 0x42, 0xC9,
+  0x20, 0xA0, 0x18, 0x90, 0x29, 0xA2, 0x4B, 0x95, 0x0C, 0x15, 0xBB, 0x44, 0xDA, 0x30, 0xA8, 0x2A,
+  0x82, 0x1B, 0xA4, 0x3A, 0xB0, 0x70, 0xAA, 0x12, 0x89, 0xB1, 0x12, 0xA9, 0x88, 0x34, 0xBF, 0x24,
+  0x9B, 0x80, 0x60, 0xB0, 0x1A, 0x43, 0xCA, 0x51, 0xA9, 0x31, 0xD9, 0x31, 0xD0, 0x30, 0xF9, 0x48,
+  0x12, 0x00, 0x15, 0x00, 0x9A, 0x20, 0xA8, 0x20, 0xA0, 0x13, 0xBA, 0x37, 0xD8, 0x3B, 0x87, 0x8C,
+  0x12, 0x89, 0xA0, 0x40, 0xC0, 0x39, 0xA1, 0x19, 0x89, 0x12, 0x0C, 0x85, 0x19, 0x99, 0x43, 0xBA,
+  0x01, 0xB1, 0x5A, 0xF9, 0x78, 0xD1, 0x39, 0xB2, 0x1B, 0x83, 0x1B, 0x93, 0x19, 0x93, 0x3A, 0xB4,
+  0x1C, 0x96, 0x0C, 0x93, 0x0A, 0x80, 0x03, 0xBF, 0x15, 0x89, 0x99, 0x63, 0xDB, 0x42, 0xA9, 0x30,
+  0xA0, 0x08, 0x28, 0x88, 0x1A, 0x93, 0x8D, 0x83, 0x9C, 0x92, 0x79, 0xE0, 0x38, 0xA1, 0x39, 0x81,
+  0x80, 0x20, 0x99, 0x98, 0x39, 0xFB, 0x72, 0xE9, 0x30, 0x98, 0x0A, 0x23, 0xAC, 0x32, 0x99, 0x18,
+  0x11, 0x1C, 0x86, 0x2C, 0xB3, 0x2D, 0xB3, 0x1C, 0xB3, 0x0C, 0x14, 0xAB, 0x01, 0x30, 0xA9, 0x69,
+  0x08, 0x93, 0x39, 0xF9, 0x43, 0xD0, 0x18, 0x81, 0x9B, 0x07, 0x8C, 0x83, 0x8A, 0x92, 0x3A, 0x05,
+  0xAD, 0x52, 0xC8, 0x10, 0x00, 0xB8, 0x60, 0xB0, 0x2B, 0x82, 0x9B, 0x10, 0x82, 0xA1, 0x49, 0xA4,
+  0x1A, 0x99, 0x91, 0x1D, 0xB3, 0x4A, 0xA4, 0x0D, 0x04, 0x98, 0x39, 0x91, 0x9C, 0x10, 0x9C, 0xB3,
+  0x31, 0xA5, 0x3C, 0x81, 0x13, 0xCC, 0x62, 0x89, 0x2A, 0x01, 0x19, 0xC2, 0x12, 0xCA, 0x33, 0xAF,
+  0x01, 0x20, 0xC9, 0x21, 0x00, 0xF0, 0x10, 0xD0, 0x21, 0x9B, 0x03, 0x0C, 0x93, 0x9A, 0x31, 0xB3,
+  0x31, 0x0C, 0x17, 0x9C, 0x23, 0x99, 0x1A, 0x05, 0x9C, 0x32, 0xB0, 0x8A, 0x16, 0xBA, 0x30, 0xA2,
+  0x9B, 0x51, 0xA9, 0x88, 0x51, 0xD8, 0x4B, 0xC3, 0x29, 0x91, 0x20, 0x9C, 0x24, 0xBB, 0x23, 0xDA,
+  0x30, 0xB8, 0x3D, 0x93, 0x90, 0x9B, 0x92, 0x3B, 0xA6, 0x3A, 0x81, 0x9B, 0x53, 0xCA, 0x22, 0x89,
+  0x0A, 0x51, 0xB0, 0x59, 0xB1, 0xA9, 0x34, 0xBA, 0x33, 0x13, 0x99, 0x21, 0xB0, 0x19, 0xB1, 0x91,
+  0x04, 0x00, 0x00, 0x00, 0x10, 0x0B, 0xB4, 0x59, 0xB8, 0x39, 0xB2, 0x1D, 0x01, 0x29, 0xAB, 0x41,
+  0x9A, 0x11, 0x93, 0x9B, 0x21, 0x3B, 0x90, 0x31, 0x2B, 0x91, 0x21, 0x94, 0x2B, 0x33, 0xBB, 0x51,
+  0x99, 0x1A, 0x91, 0xB1, 0x39, 0xA1, 0x9D, 0x15, 0xBB, 0x14, 0xA9, 0x91, 0x12, 0xB3, 0x1B, 0x87,
+  0x0B, 0x13, 0xB9, 0x18, 0x22, 0xCB, 0x02, 0x10, 0x90, 0x39, 0x9A, 0x10, 0x0A, 0x11, 0xA0, 0x39,
+  0xAB, 0x31, 0xB2, 0x4B, 0xA1, 0x19, 0xB3, 0x3A, 0x93, 0x9B, 0x33, 0x1C, 0x39, 0x03, 0x1A, 0x91,
+  0x30, 0x99, 0x21, 0x9B, 0x3A, 0xB9, 0x31, 0xC0, 0x01, 0xB2, 0x1A, 0x10, 0x00, 0x1B, 0x11, 0xA1,
+  0x21, 0x92, 0x0B, 0x2A, 0x19, 0xA9, 0x33, 0x90, 0x0A, 0x10, 0x1A, 0x19, 0x19, 0x29, 0xB9, 0x12,
+  0x09, 0xA1, 0x31, 0xB1, 0x11, 0x10, 0xA1, 0x09, 0x31, 0xA0, 0x21, 0x1A, 0x9A, 0x93, 0xB1, 0x21,
+  0x1B, 0x01, 0x99, 0x32, 0xBB, 0x93, 0x93, 0xA9, 0x20, 0xA0, 0x19, 0x21, 0x0B, 0x01, 0x91, 0x10,
+  0x29, 0x9A, 0xC3, 0x00, 0x21, 0x9A, 0x00, 0x12, 0x99, 0x39, 0x2B, 0xC9, 0x02, 0x91, 0x90, 0x39,
+  0xB9, 0x31, 0x19, 0x91, 0x91, 0x10, 0xA9, 0x19, 0x19, 0x01, 0x91, 0x90, 0x10, 0x99, 0xA1, 0x12,
+  0x19, 0x99, 0x11, 0x10, 0x19, 0xB0, 0x11, 0x92, 0x99, 0x93, 0x99, 0x90, 0x10, 0x19, 0x19, 0x19,
+  0x99, 0x01, 0x90, 0x11, 0x93, 0x1B, 0xA3, 0x99, 0x11, 0x1A, 0x19, 0x11, 0x10, 0xB9, 0xB3, 0x21,
+  0x19, 0x09, 0x19, 0x10, 0x00, 0x3B, 0x1A, 0x92, 0x91, 0x2A, 0x19, 0x09, 0xA0, 0x31, 0x99, 0x3A,
+  0x99, 0x09, 0x11, 0x19, 0x91, 0x11, 0x0A, 0xA3, 0x19, 0x09, 0x01, 0x19, 0x10, 0x90, 0x99, 0x11,
+  0x91, 0x10, 0x99, 0x93, 0x09, 0x00, 0x90, 0x29, 0xA0, 0x10, 0x01, 0x91, 0xB1, 0xA3, 0x91, 0x19,
+  0x01, 0x00, 0x00, 0x00, 0x9A, 0x93, 0x90, 0x11, 0x99, 0x10, 0x91, 0xA0, 0x31, 0x9B, 0xA3, 0x01,
+  0x10, 0x09, 0x19, 0x21, 0x9A, 0x11, 0x99, 0x10, 0x90, 0x91, 0x11, 0x19, 0x91, 0x09, 0xB3, 0x91,
+  0x09, 0x30, 0xA9, 0x91, 0x01, 0x19, 0x00, 0x90, 0x01, 0x90, 0x01, 0x91, 0x90, 0x01, 0x91, 0x19,
+  0x90, 0x91, 0x11, 0x19, 0x09, 0xA9, 0x23, 0x1B, 0x11, 0x1A, 0x21, 0x1B, 0x09, 0x91, 0x92, 0x19,
+  0x19, 0x1B, 0x39, 0xA1, 0x19, 0x01, 0xB2, 0x10, 0xA0, 0x03, 0xA0, 0x10, 0x20, 0xB9, 0x93, 0x3A,
+  0x99, 0x10, 0x00, 0x99, 0x11, 0x1A, 0x91, 0x11, 0x99, 0x01, 0x10, 0x29, 0xB9, 0x93, 0x91, 0x09,
+  0x10, 0x91, 0x10, 0x2A, 0x19, 0x99, 0x1A, 0xA3, 0x01, 0x91, 0x90, 0x11, 0x99, 0x01, 0x90, 0x10,
+  0x19, 0x10, 0xA1, 0x00, 0xB3, 0xB2, 0x29, 0xB1, 0x11, 0x29, 0x09, 0xA2, 0xA1, 0x11, 0x90, 0x11,
+  0x09, 0x09, 0x00, 0x11, 0x19, 0x99, 0x10, 0x10, 0x19, 0x19, 0xA1, 0x10, 0x91, 0x91, 0x19, 0x10,
+  0x90, 0x10, 0x09, 0x19, 0x29, 0x19, 0x0B, 0x11, 0x29, 0x1A, 0x19, 0x39, 0x99, 0x19, 0xB1, 0x11,
+  0x91, 0x00, 0x19, 0x92, 0x19, 0x19, 0x90, 0x09, 0x91, 0x19, 0x91, 0xA0, 0x93, 0xB1, 0x03, 0xA0,
+  0x29, 0x90, 0x02, 0x90, 0x99, 0x20, 0xA0, 0x90, 0x01, 0x01, 0x19, 0x39, 0x0B, 0x91, 0x11, 0x09,
+  0xA0, 0x31, 0x99, 0x09
+};
@@ -0,0 +1,209 @@
+#
+# wav2adpcm.py
+#
+# OpenAudio, Oct 2026
+# MIT License
+#
+# Converts a WAV file into a C header (*.h) holding the audio as IMA-ADPCM (4 bits per
+# sample), ready for AudioPlayMemoryI16_F32 in the Tympan Library.  That is a quarter
+# of the memory of the plain int16 arrays used by the RamWavPlayer example.
+#
+# The WAV can be 8, 16, 24, or 32-bit integer, or 32 or 64-bit float.  Multichannel
+# files are mixed down to mono (or use --channel to pick one channel).  The sample
+# rate is kept as it is; the Tympan resamples as it plays.
+#
+# Usage:
+#    python wav2adpcm.py myAudio.wav                      (writes myAudio_adpcm.h)
+#    python wav2adpcm.py myAudio.wav -o sample_X.h --name sample_X --block-bytes 512
+#
+# Then, in your sketch:
+#    #include "sample_X.h"
+#    audioPlayMemory.play(sample_X, sample_X_len, sample_X_sample_rate_Hz, sample_X_block_bytes);
+#
+# Needs only Python 3 (no other packages).
+#
+
+import argparse
+import math
+import os
+import struct
+import sys
+
+# IMA-ADPCM tables (the same as in AudioPlayMemory_F32.cpp)
+STEP_TABLE = [
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118,
+    130, 143, 157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963, 1060,
+    1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132,
+    7845, 8630, 9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767]
+INDEX_TABLE = [-1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8]
+
+
+def read_wav(fname, channel=None):
+    """Read a WAV file.  Returns (sample_rate_Hz, list of mono samples as floats, -1.0 to +1.0)."""
+    with open(fname, 'rb') as f:
+        data = f.read()
+    if (data[0:4] != b'RIFF') or (data[8:12] != b'WAVE'):
+        raise ValueError(fname + ' is not a WAV file')
+
+    # walk the chunks to find "fmt " and "data"
+    fmt = None
+    audio = None
+    pos = 12
+    while pos + 8 <= len(data):
+        chunk_id = data[pos:pos+4]
+        chunk_len = struct.unpack('<I', data[pos+4:pos+8])[0]
+        body = data[pos+8:pos+8+chunk_len]
+        if chunk_id == b'fmt ':
+            fmt = body
+        elif chunk_id == b'data':
+            audio = body
+            break
+        pos += 8 + chunk_len + (chunk_len & 1)  # chunks are padded to an even length
+    if (fmt is None) or (audio is None):
+        raise ValueError(fname + ': cannot find the "fmt " and "data" chunks')
+
+    format_tag, n_chan, fs_Hz = struct.unpack('<HHI', fmt[0:8])
+    bits = struct.unpack('<H', fmt[14:16])[0]
+    if format_tag == 0xFFFE:  # WAVE_FORMAT_EXTENSIBLE: the real format is at the start of the sub-format GUID
+        format_tag = struct.unpack('<H', fmt[24:26])[0]
+    if format_tag not in (1, 3):
+        raise ValueError(fname + ': only PCM or float WAV files can be converted (format = ' + str(format_tag) + ')')
+    if (channel is not None) and ((channel < 0) or (channel >= n_chan)):
+        raise ValueError(fname + ' has ' + str(n_chan) + ' channels, so cannot use channel ' + str(channel))
+
+    # unpack the samples, scaled to -1.0 to +1.0
+    bytes_per_samp = bits // 8
+    n_frames = len(audio) // (bytes_per_samp * n_chan)
+    if format_tag == 3:
+        if bits not in (32, 64):
+            raise ValueError(fname + ': float data must be 32 or 64 bits')
+        vals = struct.unpack('<' + str(n_frames * n_chan) + ('f' if bits == 32 else 'd'), audio[0:n_frames * n_chan * bytes_per_samp])
+    elif bits == 8:
+        vals = [(b - 128) / 128.0 for b in audio[0:n_frames * n_chan]]
+    elif bits == 16:
+        vals = [v / 32768.0 for v in struct.unpack('<' + str(n_frames * n_chan) + 'h', audio[0:n_frames * n_chan * 2])]
+    elif bits == 24:
+        vals = [int.from_bytes(audio[3*i:3*i+3], 'little', signed=True) / 8388608.0 for i in range(n_frames * n_chan)]
+    elif bits == 32:
+        vals = [v / 2147483648.0 for v in struct.unpack('<' + str(n_frames * n_chan) + 'i', audio[0:n_frames * n_chan * 4])]
+    else:
+        raise ValueError(fname + ': cannot convert ' + str(bits) + '-bit data')
+
+    # mix down to mono (or pick one channel)
+    if channel is not None:
+        mono = list(vals[channel::n_chan])
+    elif n_chan == 1:
+        mono = list(vals)
+    else:
+        mono = [sum(vals[i*n_chan:(i+1)*n_chan]) / n_chan for i in range(n_frames)]
+    return fs_Hz, mono
+
+
+def to_int16(x):
+    return [max(-32768, min(32767, int(round(v * 32768.0)))) for v in x]
+
+
+def decode_code(predictor, step_ind, code):
+    """One step of the IMA-ADPCM decoder (exactly as on the Tympan).  Returns the new (predictor, step_ind)."""
+    step = STEP_TABLE[step_ind]
+    diff = step >> 3
+    if code & 4: diff += step
+    if code & 2: diff += step >> 1
+    if code & 1: diff += step >> 2
+    predictor = predictor - diff if (code & 8) else predictor + diff
+    predictor = max(-32768, min(32767, predictor))
+    step_ind = max(0, min(88, step_ind + INDEX_TABLE[code]))
+    return predictor, step_ind
+
+
+def encode_adpcm(x, block_bytes):
+    """Encode int16 samples as mono IMA-ADPCM blocks (as in an IMA-ADPCM WAV file).  Each block has a 4-byte header
+    (the first sample, the step index, and a zero), then 4-bit codes, low nibble first.  The last block is only as
+    long as it needs to be.  Returns (the encoded bytes, the decoded samples)."""
+    samples_per_block = 2 * (block_bytes - 4) + 1
+    out = bytearray()
+    decoded = []
+    step_ind = 0
+    for start in range(0, len(x), samples_per_block):
+        block = x[start:start + samples_per_block]
+        predictor = block[0]
+        out += struct.pack('<hBB', predictor, step_ind, 0)
+        decoded.append(predictor)
+        codes = []
+        for val in block[1:]:
+            # choose the code (this is the usual IMA-ADPCM encoder, which matches the decoder's arithmetic)
+            step = STEP_TABLE[step_ind]
+            diff = val - predictor
+            code = 0
+            if diff < 0:
+                code = 8
+                diff = -diff
+            if diff >= step:
+                code |= 4
+                diff -= step
+            if diff >= (step >> 1):
+                code |= 2
+                diff -= (step >> 1)
+            if diff >= (step >> 2):
+                code |= 1
+            predictor, step_ind = decode_code(predictor, step_ind, code)  # track the decoder exactly
+            decoded.append(predictor)
+            codes.append(code)
+        if len(codes) % 2:
+            codes.append(0)
+        out += bytes([codes[i] | (codes[i+1] << 4) for i in range(0, len(codes), 2)])
+    return bytes(out), decoded
+
+
+def write_header(fname, name, source_name, fs_Hz, n_samples, block_bytes, adpcm):
+    fs_text = ('%d' % fs_Hz) if (fs_Hz == int(fs_Hz)) else repr(fs_Hz)
+    with open(fname, 'w') as f:
+        f.write('\n')
+        f.write('// Made by wav2adpcm.py from "' + source_name + '".\n')
+        f.write('// IMA-ADPCM, mono, 4 bits per sample, in ' + str(block_bytes) + '-byte blocks: ' + str(n_samples) + ' samples in ' +
+                str(len(adpcm)) + ' bytes (rather than ' + str(2 * n_samples) + ' bytes as int16).\n')
+        f.write('// To play it: audioPlayMemory.play(' + name + ', ' + name + '_len, ' + name + '_sample_rate_Hz, ' + name + '_block_bytes);\n')
+        f.write('\n')
+        f.write('#define ' + name.upper() + '_LEN ' + str(n_samples) + '  //number of samples (not bytes)\n')
+        f.write('const uint32_t ' + name + '_len = ' + name.upper() + '_LEN;\n')
+        f.write('const float ' + name + '_sample_rate_Hz = ' + fs_text + ';\n')
+        f.write('const uint16_t ' + name + '_block_bytes = ' + str(block_bytes) + ';\n')
+        f.write('PROGMEM\n')
+        f.write('const uint8_t ' + name + '[' + str(len(adpcm)) + '] = {\n')
+        for i in range(0, len(adpcm), 16):
+            f.write('  ' + ', '.join('0x%02X' % b for b in adpcm[i:i+16]) + (',\n' if i + 16 < len(adpcm) else '\n'))
+        f.write('};\n')
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Convert a WAV file into an IMA-ADPCM C header for AudioPlayMemoryI16_F32')
+    parser.add_argument('wav', help='the WAV file to convert')
+    parser.add_argument('-o', '--output', help='the header file to write (default: <wav name>_adpcm.h)')
+    parser.add_argument('--name', help='the name of the array in the header (default: from the output file name)')
+    parser.add_argument('--block-bytes', type=int, default=256, help='bytes per IMA-ADPCM block, 5 to 65535 (default: 256)')
+    parser.add_argument('--channel', type=int, help='use just this channel (counting from 0) rather than mixing down to mono')
+    args = parser.parse_args()
+
+    if (args.block_bytes < 5) or (args.block_bytes > 65535):
+        sys.exit('wav2adpcm: --block-bytes must be 5 to 65535')
+    out_fname = args.output if args.output else os.path.splitext(args.wav)[0] + '_adpcm.h'
+    name = args.name if args.name else os.path.splitext(os.path.basename(out_fname))[0]
+    name = ''.join(c if (c.isalnum() or c == '_') else '_' for c in name)
+    if name[0].isdigit():
+        name = '_' + name
+
+    fs_Hz, mono = read_wav(args.wav, args.channel)
+    x = to_int16(mono)
+    adpcm, decoded = encode_adpcm(x, args.block_bytes)
+    write_header(out_fname, name, os.path.basename(args.wav), fs_Hz, len(x), args.block_bytes, adpcm)
+
+    # report the size and the quality
+    sig_pow = sum(v * v for v in x)
+    err_pow = sum((a - b) * (a - b) for a, b in zip(x, decoded))
+    snr_text = ('%.1f dB' % (10.0 * math.log10(sig_pow / err_pow))) if (err_pow > 0) and (sig_pow > 0) else 'lossless'
+    print('wav2adpcm: wrote ' + out_fname + ': ' + str(len(x)) + ' samples at ' + str(fs_Hz) + ' Hz in ' + str(len(adpcm)) +
+          ' bytes (' + ('%.1f' % (100.0 * len(adpcm) / max(1, 2 * len(x)))) + '% of int16), SNR = ' + snr_text)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,69 @@
+// Minimal stand-in for the Teensy/Arduino header of the same name, for the host tests only.
+#pragma once
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <stdio.h>
+#include <string>
+#include <new>
+#include "Print.h"
+#include "core_pins.h"
+typedef bool boolean;
+typedef uint8_t byte;
+#define F(x) x
+#define PI 3.14159265358979f
+#define HEX 16
+#define DEC 10
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+template<class A, class B> constexpr auto min(A a, B b) -> decltype(a+b) { return a<b?a:b; }
+template<class A, class B> constexpr auto max(A a, B b) -> decltype(a+b) { return a>b?a:b; }
+#define constrain(x,a,b) ((x)<(a)?(a):((x)>(b)?(b):(x)))
+class String {
+ public:
+  std::string s;
+  String() {}
+  String(const char *c) : s(c?c:"") {}
+  String(const std::string &c) : s(c) {}
+  String(char c) : s(1,c) {}
+  String(int v, int base=10) : s(std::to_string(v)) {}
+  String(unsigned int v, int base=10) : s(std::to_string(v)) {}
+  String(long v, int base=10) : s(std::to_string(v)) {}
+  String(unsigned long v, int base=10) : s(std::to_string(v)) {}
+  String(float v, int d=2) : s(std::to_string(v)) {}
+  String(double v, int d=2) : s(std::to_string(v)) {}
+  String operator+(const String &o) const { return String(s+o.s); }
+  String &operator+=(const String &o) { s+=o.s; return *this; }
+  friend String operator+(const char *a, const String &b) { return String(std::string(a)+b.s); }
+  const char *c_str() const { return s.c_str(); }
+  int length() const { return s.length(); }
+  char charAt(int i) const { return s[i]; }
+  char operator[](int i) const { return s[i]; }
+  char &operator[](int i) { return s[i]; }
+  bool operator==(const String &o) const { return s==o.s; }
+  bool operator==(const char *o) const { return s==o; }
+  String substring(int a, int b=-1) const { return String(s.substr(a, b<0?std::string::npos:b-a)); }
+  int indexOf(char c) const { auto p=s.find(c); return p==std::string::npos?-1:p; }
+  int toInt() const { return atoi(s.c_str()); }
+  float toFloat() const { return atof(s.c_str()); }
+  void toCharArray(char *b, int n) const { strncpy(b,s.c_str(),n); }
+  void trim() {}
+  bool concat(const String &o) { s += o.s; return true; }
+  void replace(const String &a, const String &b) { for (size_t p = s.find(a.s); (p != std::string::npos) && !a.s.empty(); p = s.find(a.s, p + b.s.size())) s.replace(p, a.s.size(), b.s); }
+};
+class Stream : public Print { public: virtual int available() {return 0;} virtual int read() {return -1;} virtual int peek(){return -1;} };
+class HardwareSerial : public Stream { public: size_t write(uint8_t){return 1;} void begin(long){} operator bool(){return true;} using Print::write; };
+extern HardwareSerial Serial, Serial1, Serial2;
+#define usb_serial_class HardwareSerial
+class elapsedMicros { public: unsigned long v=0; operator unsigned long() const {return v;} elapsedMicros &operator=(unsigned long x){v=x;return *this;} };
+class elapsedMillis { public: unsigned long v=0; operator unsigned long() const {return v;} elapsedMillis &operator=(unsigned long x){v=x;return *this;} };
+unsigned long millis(); unsigned long micros(); void delay(unsigned long); void delayMicroseconds(unsigned);
+void pinMode(int,int); void digitalWrite(int,int); int digitalRead(int); int analogRead(int);
+#define OUTPUT 1
+#define INPUT 0
+#define HIGH 1
+#define LOW 0
+#define INPUT_PULLUP 2
+long random(long); long random(long,long);
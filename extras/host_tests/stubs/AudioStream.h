@@ -0,0 +1,22 @@
+// Minimal stand-in for the Teensy/Arduino header of the same name, for the host tests only.
+#pragma once
+#include <Arduino.h>
+#define AUDIO_BLOCK_SAMPLES 128
+#define AUDIO_SAMPLE_RATE 44117.64706
+#define AUDIO_SAMPLE_RATE_EXACT 44117.64706f
+typedef struct audio_block_struct { uint8_t ref_count; uint8_t reserved1; uint16_t memory_pool_index; int16_t data[AUDIO_BLOCK_SAMPLES]; } audio_block_t;
+class AudioConnection;
+class AudioStream { public:
+ AudioStream(unsigned char n, audio_block_t **q) {}
+ static audio_block_t *allocate(void); static void release(audio_block_t*);
+ bool isActive() { return active; }
+ static uint16_t cpu_cycles_total, cpu_cycles_total_max;
+ uint16_t cpu_cycles, cpu_cycles_max;
+ protected:
+ bool active; unsigned char num_inputs;
+ void transmit(audio_block_t*, unsigned char=0);
+ audio_block_t *receiveReadOnly(unsigned int=0); audio_block_t *receiveWritable(unsigned int=0);
+ static bool update_setup(void); static void update_stop(void); static void update_all(void) {}
+ static bool update_scheduled;
+ virtual void update(void)=0;
+};
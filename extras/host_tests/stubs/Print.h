@@ -0,0 +1,17 @@
+// Minimal stand-in for the Teensy/Arduino header of the same name, for the host tests only.
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+class String;
+class Print { public:
+ virtual size_t write(uint8_t)=0;
+ virtual size_t write(const uint8_t *b, size_t n){ for(size_t i=0;i<n;i++) write(b[i]); return n;}
+ size_t write(const char *s){return 0;}
+ size_t print(const char*){return 0;} size_t print(const String&){return 0;} size_t print(char){return 0;}
+ size_t print(int, int=10){return 0;} size_t print(unsigned int, int=10){return 0;} size_t print(long, int=10){return 0;} size_t print(unsigned long, int=10){return 0;} size_t print(double, int=2){return 0;}
+ size_t println(){return 0;}
+ size_t println(const char*){return 0;} size_t println(const String&){return 0;} size_t println(char){return 0;}
+ size_t println(int, int=10){return 0;} size_t println(unsigned int, int=10){return 0;} size_t println(long, int=10){return 0;} size_t println(unsigned long, int=10){return 0;} size_t println(double, int=2){return 0;}
+ int printf(const char*, ...){return 0;}
+ virtual void flush(){}
+};
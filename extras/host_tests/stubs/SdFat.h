@@ -0,0 +1,59 @@
+// Minimal stand-in for the Teensy/Arduino header of the same name, for the host tests only.
+// The "card" is simDisk: each file is a vector of bytes, and every write, preallocation and truncation is
+// logged so that the tests can check what the library asked the card to do.
+#pragma once
+#include <Arduino.h>
+#include <vector>
+#include <map>
+#include <string>
+#include <string.h>
+#define O_RDONLY 0
+#define O_READ 0
+#define O_WRONLY 1
+#define O_RDWR 2
+#define O_CREAT 0x40
+#define O_TRUNC 0x200
+#define O_APPEND 0x400
+#define O_WRITE 1
+#define O_AT_END 0x800
+#define FIFO_SDIO 0
+#define SdioConfig(x) (x)
+struct SimWrite { std::string name; uint64_t pos; size_t nbytes; };
+struct SimDisk {
+ std::map<std::string, std::vector<uint8_t>> files;
+ std::vector<SimWrite> writes;                  //every call to write(), in order
+ uint64_t prealloc_bytes = 0; int n_prealloc = 0; bool fail_prealloc = false;
+ int n_truncate = 0;
+ void reset() { files.clear(); writes.clear(); prealloc_bytes = 0; n_prealloc = 0; fail_prealloc = false; n_truncate = 0; }
+};
+extern SimDisk simDisk;  //in stubimpl.cpp
+class FsBaseFile { public: void flush() {} };
+class FsFile : public Stream, public FsBaseFile { public:
+ std::string name; std::vector<uint8_t> *d = nullptr; uint64_t pos = 0;
+ bool open(const char* n, int f=0) { if (!(f & O_CREAT) && !simDisk.files.count(n)) return false; name = n; d = &simDisk.files[n]; if (f & O_TRUNC) d->clear(); pos = (f & O_AT_END) ? d->size() : 0; return true; }
+ bool open(FsFile*, const char* n, int f=0) { return open(n, f); }
+ bool close() { d = nullptr; return true; } bool isOpen() const { return d != nullptr; }
+ int read(void* b, size_t n) { if (!d) return -1; size_t k = (pos < d->size()) ? std::min(n, (size_t)(d->size()-pos)) : 0; memcpy(b, d->data()+pos, k); pos += k; return (int)k; }
+ int read() override { uint8_t c; return (read(&c,1)==1) ? c : -1; }
+ size_t write(const void* b, size_t n) { if (!d) return 0; simDisk.writes.push_back({name,pos,n}); if (d->size() < pos+n) d->resize(pos+n); memcpy(d->data()+pos, b, n); pos += n; return n; }
+ size_t write(uint8_t c) override { return write((const void*)&c,(size_t)1); }
+ size_t write(const uint8_t* b, size_t n) override { return write((const void*)b, n); }
+ size_t write(const char* b, size_t n) { return write((const void*)b, n); }
+ bool seek(uint64_t p) { pos = p; return true; } bool seekSet(uint64_t p) { pos = p; return true; } bool seekCur(int64_t o) { pos += o; return true; }
+ uint64_t curPosition() { return pos; } uint64_t position() { return pos; } uint64_t size() { return d ? d->size() : 0; } uint64_t fileSize() { return size(); }
+ int available() override { return (int)(size()-pos); } int peek() override { return (pos < size()) ? (*d)[pos] : -1; } bool sync() { return isOpen(); }
+ bool preAllocate(uint64_t n) { simDisk.prealloc_bytes = n; simDisk.n_prealloc++; return !simDisk.fail_prealloc; }
+ bool truncate() { return truncate(pos); } bool truncate(uint64_t n) { if (!d) return false; simDisk.n_truncate++; d->resize(n); if (pos > n) pos = n; return true; }
+ bool isBusy() { return false; } bool isContiguous() { return true; } uint32_t firstSector() { return 0; } bool contiguousRange(uint32_t*, uint32_t*) { return true; }
+ bool getName(char* b, size_t n) { if (!d || n == 0) return false; strncpy(b, name.c_str(), n-1); b[n-1] = 0; return true; }
+ bool isDir() { return false; } bool openNext(FsFile*, int=0) { return false; } void rewind() { pos = 0; } int fgets(char*, int, char* =0) { return 0; } operator bool() { return isOpen(); }
+ using Print::write;
+};
+typedef FsFile SdFile; typedef FsFile File32; typedef FsFile SdBaseFile;
+class SdCardInterface { public: bool isBusy() { return false; } bool writeSectors(uint32_t, const uint8_t*, size_t) { return false; } bool readSectors(uint32_t, uint8_t*, size_t) { return false; } };
+class SdFs { public: bool begin(int) { return true; } void end() {} bool exists(const char* n) { return simDisk.files.count(n) > 0; } bool remove(const char* n) { return simDisk.files.erase(n) > 0; }
+ FsFile open(const char* n, int f=0) { FsFile x; x.open(n,f); return x; } void errorHalt(Print*, const char*) {} void errorHalt(const char*) {} SdCardInterface *card() { return nullptr; }
+ bool mkdir(const char*) { return true; } bool rename(const char* a, const char* b) { if (!exists(a)) return false; simDisk.files[b] = simDisk.files[a]; simDisk.files.erase(a); return true; } bool ls() { return true; } };
+class SdFat : public SdFs {};
+#define FILE_WRITE (O_RDWR|O_CREAT|O_AT_END)
+#define FILE_READ O_RDONLY
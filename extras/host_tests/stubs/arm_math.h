@@ -0,0 +1,54 @@
+// Minimal stand-in for the Teensy/Arduino header of the same name, for the host tests only.
+#pragma once
+#include <stdint.h>
+#include <math.h>
+typedef float float32_t; typedef int16_t q15_t; typedef int32_t q31_t; typedef int8_t q7_t;
+typedef enum { ARM_MATH_SUCCESS=0, ARM_MATH_ARGUMENT_ERROR=-1, ARM_MATH_LENGTH_ERROR=-2 } arm_status;
+void arm_copy_f32(const float32_t*, float32_t*, uint32_t);
+void arm_fill_f32(float32_t, float32_t*, uint32_t);
+void arm_scale_f32(const float32_t*, float32_t, float32_t*, uint32_t);
+void arm_mult_f32(const float32_t*, const float32_t*, float32_t*, uint32_t);
+void arm_add_f32(const float32_t*, const float32_t*, float32_t*, uint32_t);
+void arm_sub_f32(const float32_t*, const float32_t*, float32_t*, uint32_t);
+void arm_offset_f32(const float32_t*, float32_t, float32_t*, uint32_t);
+void arm_abs_f32(const float32_t*, float32_t*, uint32_t);
+void arm_dot_prod_f32(const float32_t*, const float32_t*, uint32_t, float32_t*);
+void arm_power_f32(const float32_t*, uint32_t, float32_t*);
+void arm_mean_f32(const float32_t*, uint32_t, float32_t*);
+void arm_rms_f32(const float32_t*, uint32_t, float32_t*);
+void arm_max_f32(const float32_t*, uint32_t, float32_t*, uint32_t*);
+void arm_min_f32(const float32_t*, uint32_t, float32_t*, uint32_t*);
+void arm_cmplx_mag_f32(const float32_t*, float32_t*, uint32_t);
+void arm_cmplx_mag_squared_f32(const float32_t*, float32_t*, uint32_t);
+void arm_cmplx_mult_cmplx_f32(const float32_t*, const float32_t*, float32_t*, uint32_t);
+void arm_cmplx_conj_f32(const float32_t*, float32_t*, uint32_t);
+void arm_float_to_q15(const float32_t*, q15_t*, uint32_t);
+void arm_q15_to_float(const q15_t*, float32_t*, uint32_t);
+void arm_float_to_q31(const float32_t*, q31_t*, uint32_t);
+void arm_q31_to_float(const q31_t*, float32_t*, uint32_t);
+arm_status arm_sqrt_f32(float32_t, float32_t*);
+float32_t arm_sin_f32(float32_t); float32_t arm_cos_f32(float32_t);
+typedef struct { uint16_t numTaps; float32_t *pState; const float32_t *pCoeffs; } arm_fir_instance_f32;
+void arm_fir_init_f32(arm_fir_instance_f32*, uint16_t, const float32_t*, float32_t*, uint32_t);
+void arm_fir_f32(const arm_fir_instance_f32*, const float32_t*, float32_t*, uint32_t);
+typedef struct { uint8_t M; uint16_t numTaps; const float32_t *pCoeffs; float32_t *pState; } arm_fir_decimate_instance_f32;
+arm_status arm_fir_decimate_init_f32(arm_fir_decimate_instance_f32*, uint16_t, uint8_t, const float32_t*, float32_t*, uint32_t);
+void arm_fir_decimate_f32(const arm_fir_decimate_instance_f32*, const float32_t*, float32_t*, uint32_t);
+typedef struct { uint8_t L; uint16_t phaseLength; const float32_t *pCoeffs; float32_t *pState; } arm_fir_interpolate_instance_f32;
+arm_status arm_fir_interpolate_init_f32(arm_fir_interpolate_instance_f32*, uint8_t, uint16_t, const float32_t*, float32_t*, uint32_t);
+void arm_fir_interpolate_f32(const arm_fir_interpolate_instance_f32*, const float32_t*, float32_t*, uint32_t);
+typedef struct { uint32_t numStages; float32_t *pState; const float32_t *pCoeffs; } arm_biquad_casd_df1_inst_f32;
+void arm_biquad_cascade_df1_init_f32(arm_biquad_casd_df1_inst_f32*, uint8_t, const float32_t*, float32_t*);
+void arm_biquad_cascade_df1_f32(const arm_biquad_casd_df1_inst_f32*, const float32_t*, float32_t*, uint32_t);
+typedef struct { uint16_t fftLen; uint8_t ifftFlag; } arm_cfft_radix2_instance_f32;
+typedef struct { uint16_t fftLen; uint8_t ifftFlag; } arm_cfft_radix4_instance_f32;
+typedef struct { uint16_t fftLen; } arm_cfft_instance_f32;
+typedef struct { uint16_t fftLen; } arm_rfft_fast_instance_f32;
+arm_status arm_cfft_radix2_init_f32(arm_cfft_radix2_instance_f32*, uint16_t, uint8_t, uint8_t);
+arm_status arm_cfft_radix4_init_f32(arm_cfft_radix4_instance_f32*, uint16_t, uint8_t, uint8_t);
+void arm_cfft_radix2_f32(const arm_cfft_radix2_instance_f32*, float32_t*);
+void arm_cfft_radix4_f32(const arm_cfft_radix4_instance_f32*, float32_t*);
+arm_status arm_rfft_fast_init_f32(arm_rfft_fast_instance_f32*, uint16_t);
+void arm_rfft_fast_f32(const arm_rfft_fast_instance_f32*, float32_t*, float32_t*, uint8_t);
+void arm_cfft_f32(const arm_cfft_instance_f32*, float32_t*, uint8_t, uint8_t);
+extern const arm_cfft_instance_f32 arm_cfft_sR_f32_len16, arm_cfft_sR_f32_len32, arm_cfft_sR_f32_len64, arm_cfft_sR_f32_len128, arm_cfft_sR_f32_len256, arm_cfft_sR_f32_len512, arm_cfft_sR_f32_len1024, arm_cfft_sR_f32_len2048, arm_cfft_sR_f32_len4096;
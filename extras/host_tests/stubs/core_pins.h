@@ -0,0 +1,11 @@
+// Minimal stand-in for the Teensy/Arduino header of the same name, for the host tests only.
+#pragma once
+#include <stdint.h>
+#define __disable_irq()
+#define __enable_irq()
+#define F_CPU 600000000
+#define FLASHMEM
+#define DMAMEM
+#define PROGMEM
+#define FASTRUN
+#define ARM_DWT_CYCCNT (*(volatile uint32_t*)0)
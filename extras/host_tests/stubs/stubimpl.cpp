@@ -0,0 +1,47 @@
+// Host implementations of the few Teensy/Arduino/CMSIS functions that the host tests link against.
+// They are plain reference versions, written for clarity rather than speed.
+#include <Arduino.h>
+#include <arm_math.h>
+#include <AudioStream.h>
+#include <SdFat.h>
+#include <stdlib.h>
+HardwareSerial Serial, Serial1, Serial2;
+SimDisk simDisk;
+long random(long n){ return (n > 0) ? (rand() % n) : 0; } long random(long a, long b){ return (b > a) ? (a + rand() % (b - a)) : a; }
+void arm_dot_prod_f32(const float32_t*a, const float32_t*b, uint32_t n, float32_t*r){ float s=0; for(uint32_t i=0;i<n;i++) s+=a[i]*b[i]; *r=s; }
+void arm_copy_f32(const float32_t*a, float32_t*b, uint32_t n){ for(uint32_t i=0;i<n;i++) b[i]=a[i]; }
+void arm_fill_f32(float32_t v, float32_t*b, uint32_t n){ for(uint32_t i=0;i<n;i++) b[i]=v; }
+void arm_scale_f32(const float32_t*a, float32_t s, float32_t*b, uint32_t n){ for(uint32_t i=0;i<n;i++) b[i]=a[i]*s; }
+void arm_mult_f32(const float32_t*a, const float32_t*b, float32_t*c, uint32_t n){ for(uint32_t i=0;i<n;i++) c[i]=a[i]*b[i]; }
+void arm_add_f32(const float32_t*a, const float32_t*b, float32_t*c, uint32_t n){ for(uint32_t i=0;i<n;i++) c[i]=a[i]+b[i]; }
+void arm_sub_f32(const float32_t*a, const float32_t*b, float32_t*c, uint32_t n){ for(uint32_t i=0;i<n;i++) c[i]=a[i]-b[i]; }
+void arm_offset_f32(const float32_t*a, float32_t s, float32_t*b, uint32_t n){ for(uint32_t i=0;i<n;i++) b[i]=a[i]+s; }
+void arm_abs_f32(const float32_t*a, float32_t*b, uint32_t n){ for(uint32_t i=0;i<n;i++) b[i]=fabsf(a[i]); }
+void arm_max_f32(const float32_t*a, uint32_t n, float32_t*r, uint32_t*ind){ float m=a[0]; uint32_t k=0; for(uint32_t i=1;i<n;i++) if(a[i]>m){m=a[i];k=i;} *r=m; *ind=k; }
+void arm_power_f32(const float32_t*a, uint32_t n, float32_t*r){ float s=0; for(uint32_t i=0;i<n;i++) s+=a[i]*a[i]; *r=s; }
+void arm_mean_f32(const float32_t*a, uint32_t n, float32_t*r){ float s=0; for(uint32_t i=0;i<n;i++) s+=a[i]; *r=s/n; }
+void arm_float_to_q31(const float32_t*a, q31_t*b, uint32_t n){ for(uint32_t i=0;i<n;i++){ const double v=(double)a[i]*2147483648.0; b[i]=(v>=2147483647.0)?0x7FFFFFFF:((v<=-2147483648.0)?(q31_t)0x80000000:(q31_t)v); } }  //saturating, truncating (as in CMSIS without ARM_MATH_ROUNDING)
+void arm_q31_to_float(const q31_t*a, float32_t*b, uint32_t n){ for(uint32_t i=0;i<n;i++) b[i]=(float32_t)a[i]*(1.0f/2147483648.0f); }
+arm_status arm_sqrt_f32(float32_t x, float32_t*r){ *r=sqrtf(x); return ARM_MATH_SUCCESS; }
+unsigned long millis(){return 0;} unsigned long micros(){return 0;} void delay(unsigned long){}
+audio_block_t *AudioStream::allocate(void){return 0;} void AudioStream::release(audio_block_t*){}
+void AudioStream::transmit(audio_block_t*, unsigned char){} audio_block_t *AudioStream::receiveReadOnly(unsigned int){return 0;} audio_block_t *AudioStream::receiveWritable(unsigned int){return 0;}
+bool AudioStream::update_setup(void){return true;} void AudioStream::update_stop(void){}
+void arm_biquad_cascade_df1_init_f32(arm_biquad_casd_df1_inst_f32*S, uint8_t n, const float32_t*c, float32_t*st){ S->numStages=n; S->pCoeffs=c; S->pState=st; for(int i=0;i<4*n;i++) st[i]=0; }
+void arm_biquad_cascade_df1_f32(const arm_biquad_casd_df1_inst_f32*S, const float32_t*in, float32_t*out, uint32_t n){
+  const float32_t*src=in; for(uint32_t s=0;s<S->numStages;s++){ const float*c=S->pCoeffs+5*s; float*st=S->pState+4*s; for(uint32_t i=0;i<n;i++){ float x=src[i]; float y=c[0]*x+c[1]*st[0]+c[2]*st[1]+c[3]*st[2]+c[4]*st[3]; st[1]=st[0]; st[0]=x; st[3]=st[2]; st[2]=y; out[i]=y;} src=out; } }
+void arm_fir_init_f32(arm_fir_instance_f32*S, uint16_t n, const float32_t*c, float32_t*st, uint32_t block){ S->numTaps=n; S->pCoeffs=c; S->pState=st; for(uint32_t i=0;i<n+block-1;i++) st[i]=0; }
+void arm_fir_f32(const arm_fir_instance_f32*S, const float32_t*in, float32_t*out, uint32_t n){  //coefficients are time-reversed, as in CMSIS
+  const int T=S->numTaps; float*st=S->pState; for(uint32_t i=0;i<n;i++) st[T-1+i]=in[i];
+  for(uint32_t i=0;i<n;i++){ float acc=0; for(int k=0;k<T;k++) acc+=st[i+k]*S->pCoeffs[k]; out[i]=acc; }
+  for(int k=0;k<T-1;k++) st[k]=st[n+k]; }
+static void cfft_ref(uint16_t N, uint8_t ifft, float32_t *buf){  //in place, interleaved [real, imag].  The inverse is scaled by 1/N, as in CMSIS
+  for(uint32_t i=1,j=0;i<N;i++){ uint32_t bit=N>>1; for(;j&bit;bit>>=1) j^=bit; j^=bit; if(i<j){ float t=buf[2*i]; buf[2*i]=buf[2*j]; buf[2*j]=t; t=buf[2*i+1]; buf[2*i+1]=buf[2*j+1]; buf[2*j+1]=t; } }
+  for(uint32_t len=2;len<=N;len<<=1){ const double ang=(ifft?2.0:-2.0)*M_PI/len;
+    for(uint32_t i=0;i<N;i+=len) for(uint32_t k=0;k<len/2;k++){ const double wr=cos(ang*k), wi=sin(ang*k); float*a=buf+2*(i+k), *b=buf+2*(i+k+len/2);
+      const double br=b[0]*wr-b[1]*wi, bi=b[0]*wi+b[1]*wr; b[0]=(float)(a[0]-br); b[1]=(float)(a[1]-bi); a[0]=(float)(a[0]+br); a[1]=(float)(a[1]+bi); } }
+  if(ifft) for(uint32_t i=0;i<2u*N;i++) buf[i]/=N; }
+arm_status arm_cfft_radix2_init_f32(arm_cfft_radix2_instance_f32*S, uint16_t N, uint8_t ifft, uint8_t){ S->fftLen=N; S->ifftFlag=ifft; return ARM_MATH_SUCCESS; }
+arm_status arm_cfft_radix4_init_f32(arm_cfft_radix4_instance_f32*S, uint16_t N, uint8_t ifft, uint8_t){ S->fftLen=N; S->ifftFlag=ifft; return ARM_MATH_SUCCESS; }
+void arm_cfft_radix2_f32(const arm_cfft_radix2_instance_f32*S, float32_t*buf){ cfft_ref(S->fftLen, S->ifftFlag, buf); }
+void arm_cfft_radix4_f32(const arm_cfft_radix4_instance_f32*S, float32_t*buf){ cfft_ref(S->fftLen, S->ifftFlag, buf); }
@@ -0,0 +1,179 @@
+/*
+ * test_afc_nfxlms_fused
+ *
+ * Checks the faster NFXLMS kernels of AudioFeedbackCancelNFXLMS_F32 against the code as it was before they
+ * were added (a frozen copy in reference/AudioFeedbackCancelNFXLMS_F32_orig.h):
+ *
+ *   - The fused kernel (cha_afc_input_fused, the default) and the two-pass code (setUseFusedKernel(false))
+ *     must give the same results as the original: every output sample, every coefficient of the estimated
+ *     feedback path, and every coefficient of the band-limit filter must match bit for bit.
+ *   - The delayed update (setUpdateSubBlockSize(n), which runs cha_afc_input_delayed) is a slightly different
+ *     algorithm, so it is checked by how well it learns the feedback path instead.  Its normalized
+ *     misalignment, 10*log10(|h - h_est|^2 / |h|^2), is tracked over time and must fall, and must end within
+ *     1 dB of the original's.  The estimated path h_est is the adaptive filter convolved with the
+ *     band-limit filter, as in the BTNRH quality metric.
+ *
+ * The input is a simulated hearing aid: the loop-back (receiver) signal is colored noise, and the
+ * microphone picks it up through a known, decaying random feedback path after the hardware delay.  Timing on
+ * a PC only gives a rough idea of the speed-up on the Teensy, so it is printed but not asserted.  Build and
+ * run with "make check" in this directory.
+ */
+
+#include "AudioFeedbackCancelNFXLMS_F32.h"
+#include "AudioFeedbackCancelNFXLMS_F32_orig.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <chrono>
+#include <vector>
+
+//gives access to the estimated feedback path and the band-limit filter
+template <class AFC>
+class TestAFC : public AFC {
+	public:
+		TestAFC(const AudioSettings_F32 &settings) : AFC(settings) {}
+		const float32_t *getCoeff(void) { return this->efbp; }
+		const float32_t *getBandLimit(void) { return this->ffrp; }
+
+		//normalized misalignment against the true feedback path h (which starts after the hardware delay), in dB
+		float misalignment_dB(const std::vector<float> &h) {
+			const int afl = this->getAFL(), pfl = this->getPFL();
+			const int n = max(afl + max(pfl, 1) - 1, (int)h.size());
+			double err = 0.0, ref = 0.0;
+			for (int k = 0; k < n; k++) {
+				double est = 0.0;
+				if (pfl > 0) {
+					for (int j = max(0, k - pfl + 1); j <= min(k, afl - 1); j++) est += this->efbp[j] * this->ffrp[k - j];
+				} else if (k < afl) {
+					est = this->efbp[k];
+				}
+				const double h_true = (k < (int)h.size()) ? h[k] : 0.0;
+				err += (h_true - est) * (h_true - est);
+				ref += h_true * h_true;
+			}
+			return (float)(10.0 * log10(err / ref));
+		}
+};
+
+static float randn(void) {
+	const float u1 = (rand() + 1.0f) / (RAND_MAX + 2.0f), u2 = rand() / (float)RAND_MAX;
+	return sqrtf(-2.0f*logf(u1)) * cosf(2.0f*(float)M_PI*u2);
+}
+
+static const float t_track[] = { 0.1f, 0.25f, 0.5f, 1.0f, 2.0f, 5.0f };  //when to note the misalignment (s)
+static const int n_track = sizeof(t_track) / sizeof(t_track[0]);
+
+struct Result { double t_sec; std::vector<float> y; float mis_dB[n_track]; };
+
+//run the whole signal through one instance, a block at a time, noting the misalignment along the way
+template <class AFC>
+static Result runAFC(TestAFC<AFC> &afc, const std::vector<float> &u, const std::vector<float> &x, const std::vector<float> &h, float fs_Hz, int block_samples) {
+	Result r;
+	r.y.assign(x.size(), 0.0f);
+	r.t_sec = 0.0;
+	int Itrack = 0;
+	for (size_t i = 0; i + block_samples <= x.size(); i += block_samples) {
+		const auto t0 = std::chrono::steady_clock::now();
+		afc.receiveLoopBackAudio((float *)&u[i], block_samples);
+		afc.cha_afc_input((float *)&x[i], &r.y[i], block_samples);
+		r.t_sec += std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+		if ((Itrack < n_track) && ((i + block_samples) >= (size_t)(t_track[Itrack] * fs_Hz))) r.mis_dB[Itrack++] = afc.misalignment_dB(h);
+	}
+	return r;
+}
+
+template <class AFC>
+static void setupAFC(TestAFC<AFC> &afc, int afl, float mu) {
+	if (afl > 0) afc.setAFL(afl);
+	afc.setMu(mu);
+	afc.cha_afc_prepare();
+	afc.initializeStates();
+}
+
+static void printTrack(const char *name, const Result &r, const Result &ref) {
+	printf("    %-14s %6.3f s (x%.2f), misalignment", name, r.t_sec, ref.t_sec / r.t_sec);
+	for (int k = 0; k < n_track; k++) printf(" %6.1f", r.mis_dB[k]);
+	printf(" dB at");
+	for (int k = 0; k < n_track; k++) printf(" %g", t_track[k]);
+	printf(" s\n");
+}
+
+struct Case { float fs_Hz; int block_samples; int afl; float mu; };
+static const Case cases[] = {
+	{ 24000.f, 32,    0, 0.0005f },  //library defaults for the filter lengths
+	{ 24000.f, 16,  100, 0.0005f },
+	{ 44100.f, 128, 200, 0.0005f },
+	{ 96000.f, 64,  250, 0.0005f },
+};
+
+int main(void) {
+	int n_fail = 0;
+	for (const Case &c : cases) {
+		AudioSettings_F32 settings(c.fs_Hz, c.block_samples);
+		TestAFC<AudioFeedbackCancelNFXLMS_F32_orig> &orig = *(new TestAFC<AudioFeedbackCancelNFXLMS_F32_orig>(settings));  //never freed
+		TestAFC<AudioFeedbackCancelNFXLMS_F32> &fused = *(new TestAFC<AudioFeedbackCancelNFXLMS_F32>(settings));
+		TestAFC<AudioFeedbackCancelNFXLMS_F32> &two_pass = *(new TestAFC<AudioFeedbackCancelNFXLMS_F32>(settings));
+		TestAFC<AudioFeedbackCancelNFXLMS_F32> &delayed8 = *(new TestAFC<AudioFeedbackCancelNFXLMS_F32>(settings));
+		TestAFC<AudioFeedbackCancelNFXLMS_F32> &delayed32 = *(new TestAFC<AudioFeedbackCancelNFXLMS_F32>(settings));
+		setupAFC(orig, c.afl, c.mu);
+		for (TestAFC<AudioFeedbackCancelNFXLMS_F32> *afc : { &fused, &two_pass, &delayed8, &delayed32 }) setupAFC(*afc, c.afl, c.mu);
+		two_pass.setUseFusedKernel(false);
+		delayed8.setUpdateSubBlockSize(8);
+		delayed32.setUpdateSubBlockSize(32);
+
+		//simulated feedback
+		const int n = (int)(t_track[n_track-1] * c.fs_Hz) / c.block_samples * c.block_samples;
+		const int afl = orig.getAFL(), hdel = orig.getHDel(), n_taps = 3*afl/4;
+		std::vector<float> h(n_taps), u(n), x(n);
+		srand(5);
+		for (int j = 0; j < n_taps; j++) h[j] = 0.1f * randn() * expf(-j / (n_taps / 4.0f));
+		float s = 0.0f;
+		for (int i = 0; i < n; i++) { s = 0.9f*s + 0.05f*randn(); u[i] = s; }
+		for (int i = 0; i < n; i++) {
+			double acc = 0.0;
+			for (int j = 0; j < n_taps; j++) { const int k = i - hdel - j; if (k >= 0) acc += h[j] * u[k]; }
+			x[i] = (float)acc + 1.0e-4f * randn();
+		}
+
+		const Result r_orig = runAFC(orig, u, x, h, c.fs_Hz, c.block_samples);
+		const Result r_fused = runAFC(fused, u, x, h, c.fs_Hz, c.block_samples);
+		const Result r_two_pass = runAFC(two_pass, u, x, h, c.fs_Hz, c.block_samples);
+		const Result r_delayed8 = runAFC(delayed8, u, x, h, c.fs_Hz, c.block_samples);
+		const Result r_delayed32 = runAFC(delayed32, u, x, h, c.fs_Hz, c.block_samples);
+
+		printf("fs %6.0f Hz, block %3d, afl %3d, pfl %2d:\n", c.fs_Hz, c.block_samples, afl, orig.getPFL());
+		printTrack("original", r_orig, r_orig);
+
+		//the fused and two-pass code must match the original exactly
+		for (TestAFC<AudioFeedbackCancelNFXLMS_F32> *afc : { &fused, &two_pass }) {
+			const Result &r = (afc == &fused) ? r_fused : r_two_pass;
+			int n_diff = 0, n_diff_coeff = 0;
+			for (int i = 0; i < n; i++) if (r.y[i] != r_orig.y[i]) n_diff++;
+			for (int j = 0; j < afl; j++) if (afc->getCoeff()[j] != orig.getCoeff()[j]) n_diff_coeff++;
+			for (int j = 0; j < orig.getPFL(); j++) if (afc->getBandLimit()[j] != orig.getBandLimit()[j]) n_diff_coeff++;
+			const bool ok = (n_diff == 0) && (n_diff_coeff == 0);
+			printTrack((afc == &fused) ? "fused" : "two-pass", r, r_orig);
+			printf("        %d samples and %d coefficients differ from the original%s\n", n_diff, n_diff_coeff, ok ? "" : "  <-- FAIL");
+			if (!ok) n_fail++;
+		}
+
+		//the delayed update must converge about as well as the original
+		for (TestAFC<AudioFeedbackCancelNFXLMS_F32> *afc : { &delayed8, &delayed32 }) {
+			const Result &r = (afc == &delayed8) ? r_delayed8 : r_delayed32;
+			char name[32];
+			snprintf(name, sizeof(name), "delayed (n=%d)", afc->getUpdateSubBlockSize());
+			const float final_dB = r.mis_dB[n_track-1], orig_dB = r_orig.mis_dB[n_track-1];
+			const bool ok = (final_dB < r.mis_dB[0]) && (final_dB < orig_dB + 1.0f);
+			printTrack(name, r, r_orig);
+			printf("        ends %+.2f dB from the original%s\n", final_dB - orig_dB, ok ? "" : "  <-- FAIL");
+			if (!ok) n_fail++;
+		}
+
+		//and the original itself must be learning the path, or the comparison means nothing
+		const bool ok = (r_orig.mis_dB[n_track-1] < r_orig.mis_dB[0]) && (r_orig.mis_dB[n_track-1] < -6.0f);
+		if (!ok) { printf("    the original did not converge  <-- FAIL\n"); n_fail++; }
+	}
+
+	printf("%s\n", (n_fail == 0) ? "PASS" : "FAIL");
+	return (n_fail == 0) ? 0 : 1;
+}
@@ -0,0 +1,134 @@
+/*
+ * test_afc_pbfdaf_convergence
+ *
+ * Checks that the partitioned-block frequency-domain feedback canceller (AudioFeedbackCancelPBFDAF_F32)
+ * learns a known, long feedback path.  The simulated hearing aid runs at 96 kHz: the loop-back (receiver)
+ * signal is fed in through receiveLoopBackAudio(), and the microphone picks it up through a feedback path
+ * that is 10.4 msec (1000 taps) long, plus a little noise.
+ *
+ * For several partition sizes, and for white and colored loop-back signals, it tracks the normalized
+ * misalignment of the estimated feedback path, 10*log10(|h - h_est|^2 / |h|^2), after every block.  It asserts that:
+ *   - the misalignment gets below -20 dB within 0.5 s,
+ *   - by the end, it is below -40 dB, and no more than 1 dB above its best (ie, it does not drift away),
+ *   - the feedback left in the output over the last second is at least 40 dB below the feedback in the input.
+ * Every instance is first built with the default partition size, so the other sizes also check that the FFTs
+ * can be set up again at a different length.
+ *
+ * Build and run with "make check" in this directory.
+ */
+
+#include "AudioFeedbackCancelPBFDAF_F32.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <vector>
+
+static const float fs_Hz = 96000.f;
+static const int block_samples = 128;
+static const int fb_len = 1000;   //taps in the true feedback path (10.4 msec at 96 kHz)
+static const int afl = 1024;      //taps in the adaptive filter
+
+static float randn(void) {
+	const float u1 = (rand() + 1.0f) / (RAND_MAX + 2.0f), u2 = rand() / (float)RAND_MAX;
+	return sqrtf(-2.0f*logf(u1)) * cosf(2.0f*(float)M_PI*u2);
+}
+
+//a feedback path with a bulk delay followed by a decaying random response that is still
+//about 30 dB down at its last tap
+static std::vector<float> makeFeedbackPath(void) {
+	std::vector<float> h(fb_len, 0.0f);
+	const int delay = 40;
+	for (int i = delay; i < fb_len; i++) h[i] = 0.05f * randn() * expf(-3.5f * (i - delay) / (float)(fb_len - delay));
+	return h;
+}
+
+//normalized misalignment of the estimate, in dB
+static float misalignment_dB(AudioFeedbackCancelPBFDAF_F32 &afc, const std::vector<float> &h) {
+	std::vector<float> h_est(afl, 0.0f);
+	afc.getEstimatedFeedbackImpulseResponse(h_est.data(), afl);
+	double err = 0.0, ref = 0.0;
+	for (int i = 0; i < afl; i++) {
+		const double h_true = (i < fb_len) ? h[i] : 0.0;
+		err += (h_true - h_est[i]) * (h_true - h_est[i]);
+		ref += h_true * h_true;
+	}
+	return (float)(10.0 * log10(err / ref));
+}
+
+struct Signals { std::vector<float> u, fb, x; };  //loop-back, feedback at the microphone, and microphone
+
+static const int n_sec = 3;
+
+//the loop-back signal (white, or lowpass colored), and the microphone signal
+static Signals makeSignals(bool colored, const std::vector<float> &h) {
+	const int n = n_sec * (int)fs_Hz;
+	Signals s;
+	s.u.resize(n); s.fb.assign(n, 0.0f); s.x.resize(n);
+	float state = 0.0f;
+	for (int i = 0; i < n; i++) {
+		const float w = 0.1f * randn();
+		state = colored ? (0.9f*state + w) : w;
+		s.u[i] = state;
+	}
+	for (int i = 0; i < n; i++) {
+		float acc = 0.0f;
+		for (int k = 0; k < fb_len && k <= i; k++) acc += h[k] * s.u[i-k];
+		s.fb[i] = acc;
+		s.x[i] = acc + 1.0e-4f * randn();  //near-end noise, more than 50 dB below the feedback
+	}
+	return s;
+}
+
+static int runCase(int partition_len, bool colored, const Signals &s, const std::vector<float> &h) {
+	AudioSettings_F32 settings(fs_Hz, block_samples);
+	AudioFeedbackCancelPBFDAF_F32 &afc = *(new AudioFeedbackCancelPBFDAF_F32(settings));  //never freed
+	afc.setParams(0.3f, 0.9f, 1.0e-6f, afl, partition_len);
+
+	//run it, a block at a time, and track the misalignment
+	const int n = (int)s.x.size();
+	std::vector<float> y(n);
+	audio_block_f32_t loopback;
+	float mis_dB = 0.0f, best_dB = 0.0f, t_20dB = -1.0f, mis_at[3] = { 0.0f, 0.0f, 0.0f };
+	const float t_at[3] = { 0.05f, 0.2f, 1.0f };
+	for (int i = 0; i + block_samples <= n; i += block_samples) {
+		loopback.id = i / block_samples;
+		loopback.length = block_samples;
+		for (int k = 0; k < block_samples; k++) loopback.data[k] = s.u[i+k];
+		afc.receiveLoopBackAudio(&loopback);
+		afc.cha_afc((float32_t *)&s.x[i], &y[i], block_samples);
+
+		mis_dB = misalignment_dB(afc, h);
+		best_dB = fminf(best_dB, mis_dB);
+		const float t = (i + block_samples) / fs_Hz;
+		if ((t_20dB < 0.0f) && (mis_dB < -20.0f)) t_20dB = t;
+		for (int k = 0; k < 3; k++) if ((t >= t_at[k]) && (t - block_samples/fs_Hz < t_at[k])) mis_at[k] = mis_dB;
+	}
+
+	//feedback in the input vs what is left in the output, over the last second
+	double fb_pow = 0.0, res_pow = 0.0;
+	for (int i = n - (int)fs_Hz; i < n; i++) {
+		const double res = y[i] - (s.x[i] - s.fb[i]);
+		fb_pow += s.fb[i] * s.fb[i];
+		res_pow += res * res;
+	}
+	const float cancel_dB = (float)(10.0 * log10(fb_pow / res_pow));
+
+	const bool ok = (t_20dB > 0.0f) && (t_20dB <= 0.5f) && (mis_dB < -40.0f) && (mis_dB < best_dB + 1.0f) && (cancel_dB > 40.0f);
+	printf("partition %3d (%2d partitions), %s loop-back: misalignment %6.1f, %6.1f, %6.1f dB at 0.05, 0.2, 1 s, %6.1f dB at %d s (best %6.1f), -20 dB at %.3f s; feedback reduced by %5.1f dB%s\n",
+		afc.getPartitionSize(), afc.getNumPartitions(), colored ? "colored" : "white  ", mis_at[0], mis_at[1], mis_at[2], mis_dB, n_sec, best_dB, t_20dB,
+		cancel_dB, ok ? "" : "  <-- FAIL");
+	return ok ? 0 : 1;
+}
+
+int main(void) {
+	srand(6);
+	const std::vector<float> h = makeFeedbackPath();
+	int n_fail = 0;
+	for (bool colored : { false, true }) {
+		const Signals s = makeSignals(colored, h);
+		for (int P : { 16, 32, 64, 128 }) n_fail += runCase(P, colored, s, h);
+	}
+
+	printf("%s\n", (n_fail == 0) ? "PASS" : "FAIL");
+	return (n_fail == 0) ? 0 : 1;
+}
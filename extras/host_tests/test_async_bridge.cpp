@@ -0,0 +1,127 @@
+/*
+ * test_async_bridge
+ *
+ * Runs AudioAsyncBridge_F32 between a producer and a consumer whose clocks drift apart, as between a USB host
+ * and the audio codec.  The consumer's clock is the reference, and the producer runs at its nominal rate
+ * times (1 + drift).  Each case simulates 60 seconds of stereo audio (a sine on the left, its negative on the
+ * right), with writes and reads interleaved in time order.
+ *
+ *   - The drift estimate (getDriftPPM()) must be within 5 ppm of the true drift from 30 seconds on, for
+ *     +500, -500, 0 and +37 ppm at the same nominal rate, -120 ppm from 24 kHz up to 44.1 kHz, +250 ppm
+ *     from 44.1 kHz down to 24 kHz, and -1500 ppm from 44.1 kHz up to 96 kHz.  The producer and consumer
+ *     blocks are of different lengths in some cases.
+ *   - There must be no underruns or overruns at all, and the ring must stay at its target fill.
+ *   - The output must be a clean sine: the residual of the two-term sine recursion (which is zero for a pure
+ *     sine) must stay small, so there are no clicks from dropped or repeated samples.  The right channel
+ *     must stay the exact negative of the left.
+ *   - Without the number of samples in flight (read() with n_in_flight = 0) the estimate is rougher, but
+ *     the audio must still be clean with no underruns or overruns.
+ *   - Drift beyond the limit of the controller saturates the correction at that limit (with underruns).
+ *   - begin() rejects bad rates and channel counts, and an unstarted bridge moves no audio.
+ *
+ * Build and run with "make check" in this directory.
+ */
+
+#include "AudioAsyncBridge_F32.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+static int n_fail = 0;
+static bool check(bool ok, const char *what) { if (!ok) { printf("    %s  <-- FAIL\n", what); n_fail++; } return ok; }
+
+static const double sim_seconds = 60.0, settle_seconds = 30.0;
+
+//one case: producer blocks of Np at in_Hz*(1+drift), consumer blocks of Nc at out_Hz
+static void testDrift(float in_Hz, float out_Hz, float drift_ppm, int Np, int Nc, float tone_Hz, bool use_in_flight, float tol_ppm) {
+	AudioAsyncBridge_F32 &bridge = *(new AudioAsyncBridge_F32);  //never freed
+	const int target = 2 * max(Np, (int)ceil(Nc * in_Hz / out_Hz));
+	check(bridge.begin(in_Hz, out_Hz, 2, target), "begin()");
+
+	const double in_true_Hz = in_Hz * (1.0 + drift_ppm * 1e-6);
+	const double w = 2.0 * M_PI * tone_Hz * (in_true_Hz / in_Hz) / out_Hz;  //the tone, in radians per sample at the consumer
+	float32_t in[2][256], out[2][256];
+	float32_t *p_in[2] = { in[0], in[1] }, *p_out[2] = { out[0], out[1] };
+	double t_in = 0.0, t_out = 0.0, y1 = 0.0, y2 = 0.0;
+	double worst_drift_err = 0.0, worst_fill_err = 0.0, worst_residual = 0.0, worst_left_right = 0.0;
+	long n_in = 0, n_out = 0;
+	const long n_settle = (long)(out_Hz * settle_seconds);
+	while (t_out < sim_seconds) {
+		if (t_in <= t_out) {
+			//the producer's next block is due
+			for (int i = 0; i < Np; i++) {
+				in[0][i] = 0.5f * sinf((float)fmod(2.0 * M_PI * tone_Hz * (double)(n_in + i) / in_Hz, 2.0 * M_PI));
+				in[1][i] = -in[0][i];
+			}
+			bridge.write(p_in, Np);
+			n_in += Np; t_in += Np / in_true_Hz;
+		} else {
+			//the consumer's next block is due.  The producer's last block started arriving at t_in - Np/in_true_Hz.
+			const float n_in_flight = use_in_flight ? (float)((t_out - (t_in - Np / in_true_Hz)) * in_true_Hz) : 0.0f;
+			bridge.read(p_out, Nc, n_in_flight);
+			for (int i = 0; i < Nc; i++) {
+				const double y = out[0][i];
+				if (n_out + i > n_settle) {
+					worst_residual = fmax(worst_residual, fabs(y - 2.0 * cos(w) * y1 + y2));
+					worst_left_right = fmax(worst_left_right, fabs(out[0][i] + out[1][i]));
+				}
+				y2 = y1; y1 = y;
+			}
+			n_out += Nc; t_out += Nc / (double)out_Hz;
+			if (n_out > n_settle) {
+				worst_drift_err = fmax(worst_drift_err, fabs(bridge.getDriftPPM() - drift_ppm));
+				worst_fill_err = fmax(worst_fill_err, fabs(bridge.getFill() - target));
+			}
+		}
+	}
+
+	printf("%5.0f -> %5.0f Hz, %+6.0f ppm, blocks %3d/%3d%s: drift %+8.2f ppm (worst error %6.2f), fill %5.1f of %d (worst error %5.1f), %lu underruns, %lu overruns, residual %.1e\n",
+		in_Hz, out_Hz, drift_ppm, Np, Nc, use_in_flight ? "" : ", no in-flight", bridge.getDriftPPM(), worst_drift_err,
+		bridge.getFill(), target, worst_fill_err, bridge.getNumUnderruns(), bridge.getNumOverruns(), worst_residual);
+	check(worst_drift_err < tol_ppm, "tracks the drift");
+	check((bridge.getNumUnderruns() == 0) && (bridge.getNumOverruns() == 0), "no underruns or overruns");
+	if (use_in_flight) check(worst_fill_err < 2.0, "stays at the target fill");
+	check(worst_residual < 2.0e-3, "clean sine (no dropped or repeated samples)");
+	check(worst_left_right < 1.0e-6, "right channel is the negative of the left");
+}
+
+int main(void) {
+	//tracking the drift, with the samples in flight
+	testDrift(44100, 44100,   +500, 128, 128, 1000, true, 5.0f);
+	testDrift(44100, 44100,   -500, 128, 128, 1000, true, 5.0f);
+	testDrift(44100, 44100,      0, 128, 128, 1000, true, 5.0f);
+	testDrift(44100, 44100,    +37, 128,  32, 1000, true, 5.0f);
+	testDrift(24000, 44100,   -120,  32, 128,  500, true, 5.0f);
+	testDrift(44100, 24000,   +250, 128,  64,  500, true, 5.0f);
+	testDrift(44100, 96000,  -1500, 128, 128, 1000, true, 5.0f);
+
+	//without the samples in flight, the estimate is rougher, but the audio must still be clean
+	testDrift(44100, 44100,   +500, 128, 128, 1000, false, 1000.0f);
+	testDrift(44100, 44100,    -80, 128, 128, 1000, false, 1000.0f);
+
+	//more drift than the controller may correct: every 50th producer block is missing (-2%)
+	{
+		AudioAsyncBridge_F32 &bridge = *(new AudioAsyncBridge_F32);  //never freed
+		check(bridge.begin(44100, 44100, 1), "begin()");
+		float32_t x[128] = { 0 };
+		float32_t *p[1] = { x };
+		for (int k = 0; k < 20000; k++) { bridge.write(p, (k % 50 == 0) ? 0 : 128); bridge.read(p, 128); }
+		printf("-2%% drift: correction %.1f ppm, drift %.1f ppm, %lu underruns\n", bridge.getCorrectionPPM(), bridge.getDriftPPM(), bridge.getNumUnderruns());
+		check(fabsf(bridge.getDriftPPM() + ASYNCBRIDGE_DEFAULT_MAX_PPM) < 1.0f, "drift estimate saturates at the limit");
+		check(bridge.getNumUnderruns() > 0, "underruns are counted");
+	}
+
+	//bad arguments
+	{
+		AudioAsyncBridge_F32 &bridge = *(new AudioAsyncBridge_F32);  //never freed
+		check(!bridge.begin(44100, 0), "begin() rejects a zero rate");
+		check(!bridge.begin(44100, 44100, ASYNCBRIDGE_MAX_CHAN + 1), "begin() rejects too many channels");
+		float32_t x[8];
+		float32_t *p[2] = { x, x };
+		check((bridge.read(p, 8) == 0) && (bridge.write(p, 8) == 0), "an unstarted bridge moves no audio");
+		printf("bad arguments: checked\n");
+	}
+
+	printf("%s\n", (n_fail == 0) ? "PASS" : "FAIL");
+	return (n_fail == 0) ? 0 : 1;
+}
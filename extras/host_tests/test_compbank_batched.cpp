@@ -0,0 +1,139 @@
+/*
+ * test_compbank_batched
+ *
+ * Checks the batched kernel of AudioEffectCompBankWDRC_F32 (setUseBatchedKernel(true)) against the same bank
+ * processing one compressor at a time, and benchmarks it for different numbers of channels.  Each channel
+ * gets a different fitting, and the input is noise with a level that jumps around so that the envelopes
+ * move through every knee.
+ *
+ *   - When every compressor uses the table-driven gain (setUseFastGain(true)) with a gain decimation of 1,
+ *     the batched outputs and the compressor states must match bit for bit.
+ *   - Channels that use the original gain path, or a gain decimation above 1, are not batched, so their
+ *     outputs must still match bit for bit.
+ *
+ * Timing on a PC only gives a rough idea of the speed on the Teensy, so it is printed but not asserted.
+ * Build and run with "make check" in this directory.
+ */
+
+#include "AudioEffectCompBankWDRC_F32.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <chrono>
+#include <vector>
+
+//gives access to the inputs of the bank
+class TestBank : public AudioEffectCompBankWDRC_F32 {
+	public:
+		void setInput(int Ichan, audio_block_f32_t *block) { inputQueueArray[Ichan] = block; }
+};
+
+//collects the outputs of the bank
+class TestSink : public AudioStream_F32 {
+	public:
+		TestSink(void) : AudioStream_F32(__MAX_NUM_COMP, inputQueueArray) {}
+		void update(void) {}
+		int collect(int Ichan, float32_t *out) {
+			audio_block_f32_t *block = receiveReadOnly_f32(Ichan);
+			if (block == NULL) return 0;
+			const int n = block->length;
+			for (int i = 0; i < n; i++) out[i] = block->data[i];
+			AudioStream_F32::release(block);
+			return n;
+		}
+	private:
+		audio_block_f32_t *inputQueueArray[__MAX_NUM_COMP];
+};
+
+static float randn(void) {
+	const float u1 = (rand() + 1.0f) / (RAND_MAX + 2.0f), u2 = rand() / (float)RAND_MAX;
+	return sqrtf(-2.0f*logf(u1)) * cosf(2.0f*(float)M_PI*u2);
+}
+
+enum GainMode { FAST, MIXED };
+
+//configure the bank with a different fitting on each channel
+static void setupBank(TestBank &bank, int n_chan, bool batched, GainMode mode) {
+	bank.set_max_n_chan(n_chan);
+	bank.set_n_chan(n_chan);
+	bank.setUseBatchedKernel(batched);
+	for (int c = 0; c < n_chan; c++) {
+		AudioEffectCompWDRC_F32 &comp = bank.compressors[c];
+		comp.setSampleRate_Hz(24000.f);
+		comp.setParams(1.0f + c, 20.0f + 10.0f*c, 115.f, 1.0f + 0.25f*(c % 3), 20.f + 2.0f*c, 10.f + c, 1.2f + 0.3f*c, 40.f + 2.0f*c, 95.f + (c % 5));
+		comp.setUseFastGain(true);
+		if (mode == MIXED) {
+			if ((c % 3) == 1) comp.setUseFastGain(false);  //original gain path
+			if ((c % 3) == 2) comp.setGainDecimation(4);   //table-driven gain, computed every 4 samples
+		}
+	}
+}
+
+//run the whole signal through the bank.  Returns the time spent in update(), in seconds.
+static double runBank(TestBank &bank, TestSink &sink, int n_chan, const std::vector<float> &x, std::vector<std::vector<float>> &y, int block_samples) {
+	double t = 0.0;
+	for (size_t i = 0; i + block_samples <= x.size(); i += block_samples) {
+		for (int c = 0; c < n_chan; c++) {
+			audio_block_f32_t *block = AudioStream_F32::allocate_f32();
+			if (block == NULL) return -1.0;
+			block->length = block_samples;
+			for (int k = 0; k < block_samples; k++) block->data[k] = x[i+k] * (1.0f - 0.03f*c);
+			bank.setInput(c, block);
+		}
+		const auto t0 = std::chrono::steady_clock::now();
+		bank.update();
+		t += std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+		for (int c = 0; c < n_chan; c++) {
+			if (sink.collect(c, &y[c][i]) != block_samples) return -1.0;
+		}
+	}
+	return t;
+}
+
+int main(void) {
+	AudioMemory_F32(2*__MAX_NUM_COMP + 8);
+
+	const int block_samples = 32, n = 24000 / block_samples * block_samples;
+	std::vector<float> x(n);
+	srand(3);
+	float level = 0.01f;
+	for (int i = 0; i < n; i++) {
+		if ((i % 2400) == 0) level = powf(10.0f, (-90.0f + 90.0f * rand() / (float)RAND_MAX) / 20.0f);  //jump to a new level every 0.1 s
+		x[i] = level * randn();
+	}
+
+	int n_fail = 0;
+	const int n_chans[] = { 1, 3, 4, 8, 16, 24 };
+	for (GainMode mode : { FAST, MIXED }) {
+		for (int n_chan : n_chans) {
+			//fresh objects for each case (connections cannot be undone), which are never freed
+			TestBank &batched = *(new TestBank), &ref = *(new TestBank);
+			TestSink &sink_batched = *(new TestSink), &sink_ref = *(new TestSink);
+			for (int c = 0; c < n_chan; c++) {
+				new AudioConnection_F32(batched, c, sink_batched, c);
+				new AudioConnection_F32(ref, c, sink_ref, c);
+			}
+			setupBank(batched, n_chan, true, mode);
+			setupBank(ref, n_chan, false, mode);
+
+			std::vector<std::vector<float>> y_batched(n_chan, std::vector<float>(n)), y_ref(n_chan, std::vector<float>(n));
+			const double t_ref = runBank(ref, sink_ref, n_chan, x, y_ref, block_samples);
+			const double t_batched = runBank(batched, sink_batched, n_chan, x, y_batched, block_samples);
+
+			int n_diff = 0, n_diff_state = 0;
+			for (int c = 0; c < n_chan; c++) {
+				for (int i = 0; i < n; i++) if (y_batched[c][i] != y_ref[c][i]) n_diff++;
+				if (batched.compressors[c].calcEnvelope.getCurrentLevel() != ref.compressors[c].calcEnvelope.getCurrentLevel()) n_diff_state++;
+				if (batched.compressors[c].calcGain.getCurrentGain() != ref.compressors[c].calcGain.getCurrentGain()) n_diff_state++;
+			}
+			const bool ok = (t_ref >= 0.0) && (t_batched >= 0.0) && (n_diff == 0) && (n_diff_state == 0);
+			printf("%s, %2d channels: one at a time %6.1f ns/sample/chan, batched %6.1f ns/sample/chan (x%.2f), %d samples and %d states differ%s\n",
+				(mode == FAST) ? "fast gain " : "mixed gain", n_chan, 1.0e9*t_ref/n/n_chan, 1.0e9*t_batched/n/n_chan, t_ref / t_batched,
+				n_diff, n_diff_state, ok ? "" : "  <-- FAIL");
+			if (!ok) n_fail++;
+		}
+	}
+
+	printf("%s\n", (n_fail == 0) ? "PASS" : "FAIL");
+	return (n_fail == 0) ? 0 : 1;
+}
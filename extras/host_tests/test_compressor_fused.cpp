@@ -0,0 +1,159 @@
+/*
+ * test_compressor_fused
+ *
+ * Checks the fused processing of AudioEffectCompressor_F32 (processSamples_fused(), the default) against the
+ * original step-by-step calculation (setUseFusedProcessing(false): calcAudioLevel_dB(), calcGain(), and
+ * arm_mult_f32()).  Both run through update(), so the high-pass prefilter is included.
+ *
+ *   - The building blocks: log2f_approx_bits() must be within 1.4e-3 of log2() (the same cubic fit as the
+ *     original log2f_approx(), 0.004 dB of power), and exp2f_lut() must be within 1.5e-5 of 2^x, relative
+ *     (0.00013 dB).
+ *   - The gain that the fused processing applies to each sample must be within 0.0025 dB of the gain from
+ *     the step-by-step calculation, for a sweep of thresholds, compression ratios (including a ratio below
+ *     one), attack and release times, and block sizes, with the input level jumping from silence up to
+ *     6 dB over full scale.  The compressor states must agree as well.  Both paths use the same log2 fit,
+ *     so most of the difference is float round-off in the attack/release smoothing, which builds up when
+ *     the gain is large and the release is long.
+ *
+ * Build and run with "make check" in this directory.
+ */
+
+#include "AudioEffectCompressor_F32.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <vector>
+
+//feeds the input of the compressor
+class TestSource : public AudioStream_F32 {
+	public:
+		TestSource(void) : AudioStream_F32(0, NULL) {}
+		void update(void) {}
+		void send(audio_block_f32_t *block) { AudioStream_F32::transmit(block); AudioStream_F32::release(block); }
+};
+
+//collects the output of the compressor
+class TestSink : public AudioStream_F32 {
+	public:
+		TestSink(void) : AudioStream_F32(1, inputQueueArray) {}
+		void update(void) {}
+		int collect(float32_t *out) {
+			audio_block_f32_t *block = receiveReadOnly_f32();
+			if (block == NULL) return 0;
+			const int n = block->length;
+			for (int i = 0; i < n; i++) out[i] = block->data[i];
+			AudioStream_F32::release(block);
+			return n;
+		}
+	private:
+		audio_block_f32_t *inputQueueArray[1];
+};
+
+static float randn(void) {
+	const float u1 = (rand() + 1.0f) / (RAND_MAX + 2.0f), u2 = rand() / (float)RAND_MAX;
+	return sqrtf(-2.0f*logf(u1)) * cosf(2.0f*(float)M_PI*u2);
+}
+
+static const float fs_Hz = 24000.f;
+
+struct Settings { float thresh_dBFS, ratio, attack_sec, release_sec; int block_samples; };
+
+//a compressor wired between a source and a sink (connections cannot be undone, so these are never freed)
+struct Chain { TestSource &src; AudioEffectCompressor_F32 &comp; TestSink &sink; };
+static Chain newChain(const Settings &s, bool fused) {
+	Chain c = { *(new TestSource), *(new AudioEffectCompressor_F32(AudioSettings_F32(fs_Hz, s.block_samples))), *(new TestSink) };
+	new AudioConnection_F32(c.src, 0, c.comp, 0);
+	new AudioConnection_F32(c.comp, 0, c.sink, 0);
+	c.comp.setThresh_dBFS(s.thresh_dBFS);
+	c.comp.setCompressionRatio(s.ratio);
+	c.comp.setAttack_sec(s.attack_sec, fs_Hz);
+	c.comp.setRelease_sec(s.release_sec, fs_Hz);
+	c.comp.setUseFusedProcessing(fused);
+	return c;
+}
+
+//run the whole signal through, a block at a time.  Returns false if a block went missing.
+static bool run(Chain &c, const std::vector<float> &x, std::vector<float> &y, int block_samples) {
+	for (size_t i = 0; i + block_samples <= x.size(); i += block_samples) {
+		audio_block_f32_t *block = AudioStream_F32::allocate_f32();
+		if (block == NULL) return false;
+		block->length = block_samples;
+		for (int k = 0; k < block_samples; k++) block->data[k] = x[i+k];
+		c.src.send(block);
+		c.comp.update();
+		if (c.sink.collect(&y[i]) != block_samples) return false;
+	}
+	return true;
+}
+
+int main(void) {
+	AudioMemory_F32(8);
+	int n_fail = 0;
+
+	//the building blocks
+	AudioEffectCompressor_F32 &comp = *(new AudioEffectCompressor_F32);
+	double max_log2_err = 0.0, max_exp2_rel_err = 0.0;
+	for (double e = -43.0; e <= 4.0; e += 1.0e-4) {  //the smoothed power, from below the -130 dBFS floor to above full scale
+		const float x = (float)pow(2.0, e);
+		max_log2_err = fmax(max_log2_err, fabs(AudioEffectCompressor_F32::log2f_approx_bits(x) - log2((double)x)));
+	}
+	for (double e = -30.0; e <= 10.0; e += 1.0e-5) {  //the gain, in log2 units of amplitude
+		const float y = (float)e;
+		max_exp2_rel_err = fmax(max_exp2_rel_err, fabs(comp.exp2f_lut(y) / pow(2.0, (double)y) - 1.0));
+	}
+	const bool ok_blocks = (max_log2_err <= 1.4e-3) && (max_exp2_rel_err <= 1.5e-5);
+	printf("log2f_approx_bits: max error %.2e (limit 1.4e-3).  exp2f_lut: max relative error %.2e (limit 1.5e-5)%s\n",
+		max_log2_err, max_exp2_rel_err, ok_blocks ? "" : "  <-- FAIL");
+	if (!ok_blocks) n_fail++;
+
+	//noise and tones whose level jumps every 50 msec, from silence up to 6 dB over full scale
+	const int n = (int)(2.0f * fs_Hz);
+	std::vector<float> x(n);
+	srand(4);
+	float level = 0.0f, f_Hz = 1000.f, ph = 0.0f;
+	bool tone = false;
+	for (int i = 0; i < n; i++) {
+		if ((i % 1200) == 0) {
+			const int r = rand() % 8;
+			level = (r == 0) ? 0.0f : powf(10.0f, (-80.0f + 86.0f * rand() / (float)RAND_MAX) / 20.0f);
+			tone = (rand() % 2) == 0;
+			f_Hz = 100.f + 8000.f * rand() / (float)RAND_MAX;
+		}
+		ph += 2.0f*(float)M_PI*f_Hz/fs_Hz;
+		x[i] = tone ? (level * sinf(ph)) : (0.5f * level * randn());
+	}
+
+	//the sweep
+	const float limit_dB = 0.0025f;
+	const float times_sec[][2] = { { 0.001f, 0.05f }, { 0.005f, 0.2f }, { 0.05f, 1.0f } };  //attack and release
+	for (float thresh : { -50.f, -30.f, -10.f, 0.f }) {
+		for (float ratio : { 0.5f, 1.0f, 2.0f, 5.0f, 20.0f }) {
+			double worst_dB = 0.0, worst_state_dB = 0.0;
+			bool ran = true;
+			for (const float *t : times_sec) {
+				for (int block_samples : { 16, 128 }) {
+					const Settings s = { thresh, ratio, t[0], t[1], block_samples };
+					Chain fused = newChain(s, true), ref = newChain(s, false);
+					std::vector<float> y_fused(n, 0.0f), y_ref(n, 0.0f);
+					ran = ran && run(fused, x, y_fused, block_samples) && run(ref, x, y_ref, block_samples);
+
+					//difference in the gain applied to each sample (they share the same prefiltered input)
+					for (int i = 0; i < n; i++) {
+						if ((y_ref[i] == 0.0f) && (y_fused[i] == 0.0f)) continue;
+						const double d_dB = fabs(20.0 * log10(fabs((double)y_fused[i] / (double)y_ref[i])));
+						if (!(d_dB <= worst_dB)) worst_dB = d_dB;  //also catches NaN and a zero on only one side
+					}
+					worst_state_dB = fmax(worst_state_dB, fabs(fused.comp.getCurrentGain_dB() - ref.comp.getCurrentGain_dB()));
+					worst_state_dB = fmax(worst_state_dB, fabs(fused.comp.getCurrentLevel_dBFS() - ref.comp.getCurrentLevel_dBFS()));
+				}
+			}
+			const bool ok = ran && (worst_dB <= limit_dB) && (worst_state_dB <= limit_dB);
+			printf("thresh %4.0f dBFS, ratio %4.1f: gain differs by at most %.5f dB, final states by %.5f dB (limit %.4f dB)%s\n",
+				thresh, ratio, worst_dB, worst_state_dB, limit_dB, ok ? "" : "  <-- FAIL");
+			if (!ok) n_fail++;
+		}
+	}
+
+	printf("%s\n", (n_fail == 0) ? "PASS" : "FAIL");
+	return (n_fail == 0) ? 0 : 1;
+}
@@ -0,0 +1,203 @@
+/*
+ * test_flac_roundtrip
+ *
+ * Encodes known PCM with the library's real-time FLAC encoder (src/utility/flac_codec), decodes the
+ * result, and checks that every sample comes back bit-exact.  It covers 16-bit and 24-bit, 1-8 channels,
+ * and signals that exercise each kind of subframe (constant, fixed-predictor, and verbatim for
+ * incompressible noise), including a short final frame.
+ *
+ * Every stream is decoded by the library's own FlacDecoder.  If libFLAC is installed (eg, "apt install
+ * libflac-dev"), every stream is also decoded by libFLAC, the reference decoder, which checks that the
+ * streams are standard FLAC, not just that the library can read them back.
+ *
+ * Build and run with "make check" in this directory.
+ */
+
+#include "utility/flac_codec.h"
+#ifdef HAVE_LIBFLAC
+#include <FLAC/stream_decoder.h>
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <vector>
+
+//the encoded stream, and what a decoder made of it
+struct Stream {
+	std::vector<uint8_t> bytes;
+	size_t read_pos = 0;
+	std::vector<int32_t> decoded;  //interleaved
+	unsigned int n_chan = 0, bps = 0, fs_Hz = 0;
+	uint64_t total_samples = 0;
+	int n_errors = 0;
+	bool bad_frame_header = false;
+	bool stopped_early = false;
+	void clearDecoded(void) { read_pos = 0; decoded.clear(); n_chan = 0; bps = 0; fs_Hz = 0; total_samples = 0; n_errors = 0; bad_frame_header = false; stopped_early = false; }
+};
+
+//decode with the library's own decoder, a frame at a time
+static void decodeWithFlacDecoder(Stream &s) {
+	s.clearDecoded();
+	FlacDecoder dec;
+	int pos = dec.readStreamHeader(s.bytes.data(), (uint32_t)s.bytes.size());
+	if (pos < 0) { s.stopped_early = true; return; }
+	s.n_chan = dec.getNumChannels(); s.bps = dec.getBitsPerSample(); s.fs_Hz = dec.getSampleRate_Hz(); s.total_samples = dec.getTotalSamples();
+	std::vector<int32_t> out((size_t)dec.getMaxBlockSize() * dec.getNumChannels());
+	while ((size_t)pos < s.bytes.size()) {
+		const int n_bytes = dec.decodeFrame(s.bytes.data() + pos, (uint32_t)(s.bytes.size() - pos), out.data(), dec.getMaxBlockSize());
+		if (n_bytes <= 0) { printf("    FlacDecoder: bad frame at byte %d\n", pos); s.n_errors++; s.stopped_early = true; return; }
+		s.decoded.insert(s.decoded.end(), out.begin(), out.begin() + (size_t)dec.getLastBlockSize() * s.n_chan);
+		pos += n_bytes;
+	}
+}
+
+#ifdef HAVE_LIBFLAC
+
+static FLAC__StreamDecoderReadStatus readCallback(const FLAC__StreamDecoder *, FLAC__byte buffer[], size_t *bytes, void *client_data) {
+	Stream *s = (Stream *)client_data;
+	if (s->read_pos >= s->bytes.size()) { *bytes = 0; return FLAC__STREAM_DECODER_READ_STATUS_END_OF_STREAM; }
+	size_t n = s->bytes.size() - s->read_pos;
+	if (n > *bytes) n = *bytes;
+	memcpy(buffer, s->bytes.data() + s->read_pos, n);
+	s->read_pos += n;
+	*bytes = n;
+	return FLAC__STREAM_DECODER_READ_STATUS_CONTINUE;
+}
+
+static FLAC__StreamDecoderWriteStatus writeCallback(const FLAC__StreamDecoder *, const FLAC__Frame *frame, const FLAC__int32 * const buffer[], void *client_data) {
+	Stream *s = (Stream *)client_data;
+	if ((frame->header.channels != s->n_chan) || (frame->header.bits_per_sample != s->bps) || (frame->header.sample_rate != s->fs_Hz)) s->bad_frame_header = true;
+	for (unsigned int i = 0; i < frame->header.blocksize; i++) {
+		for (unsigned int c = 0; c < frame->header.channels; c++) s->decoded.push_back(buffer[c][i]);
+	}
+	return FLAC__STREAM_DECODER_WRITE_STATUS_CONTINUE;
+}
+
+static void metadataCallback(const FLAC__StreamDecoder *, const FLAC__StreamMetadata *metadata, void *client_data) {
+	Stream *s = (Stream *)client_data;
+	if (metadata->type != FLAC__METADATA_TYPE_STREAMINFO) return;
+	s->n_chan = metadata->data.stream_info.channels;
+	s->bps = metadata->data.stream_info.bits_per_sample;
+	s->fs_Hz = metadata->data.stream_info.sample_rate;
+	s->total_samples = metadata->data.stream_info.total_samples;
+}
+
+static void errorCallback(const FLAC__StreamDecoder *, FLAC__StreamDecoderErrorStatus status, void *client_data) {
+	Stream *s = (Stream *)client_data;
+	printf("    libFLAC error: %s\n", FLAC__StreamDecoderErrorStatusString[status]);
+	s->n_errors++;
+}
+
+//decode with libFLAC
+static void decodeWithLibFLAC(Stream &s) {
+	s.clearDecoded();
+	FLAC__StreamDecoder *dec = FLAC__stream_decoder_new();
+	FLAC__StreamDecoderInitStatus init = FLAC__stream_decoder_init_stream(dec, readCallback, NULL, NULL, NULL, NULL,
+		writeCallback, metadataCallback, errorCallback, &s);
+	if (init != FLAC__STREAM_DECODER_INIT_STATUS_OK) { printf("    libFLAC: could not init\n"); s.stopped_early = true; FLAC__stream_decoder_delete(dec); return; }
+	if (!FLAC__stream_decoder_process_until_end_of_stream(dec)) s.stopped_early = true;
+	FLAC__stream_decoder_finish(dec);
+	FLAC__stream_decoder_delete(dec);
+}
+#endif
+
+enum Signal { SINE, NOISE, CONSTANT, IMPULSES, SINE_PLUS_NOISE, SILENCE };
+
+static int32_t makeSample(Signal sig, long i, int c, int bps) {
+	const int32_t full_pos = (1 << (bps - 1)) - 1, full_neg = -(1 << (bps - 1));
+	switch (sig) {
+		case SINE:      return (int32_t)(0.5 * full_pos * sin(0.01 * i * (c + 1)));
+		case NOISE:     return full_neg + (int32_t)(((uint32_t)rand() * 2654435761u) >> (32 - bps));  //full-scale and incompressible
+		case CONSTANT:  return (c == 0) ? 1234 : -5;
+		case IMPULSES:  return ((i % 500) == 0) ? full_pos : (((i % 500) == 1) ? full_neg : 0);
+		case SINE_PLUS_NOISE: {
+			double v = 0.99 * full_pos * sin(0.001 * i + c) + (rand() % 64) - 32;
+			return (int32_t)fmax((double)full_neg, fmin((double)full_pos, v));
+		}
+		default:        return 0;
+	}
+}
+
+//encode, decode with libFLAC, and compare.  Returns the number of failures.
+static int roundTrip(const char *name, Signal sig, int n_chan, int bps, int block_size, long n_samples) {
+	const uint32_t fs_Hz = 48000;
+	srand(1);
+	std::vector<int32_t> pcm(n_samples * n_chan);  //interleaved
+	for (long i = 0; i < n_samples; i++) for (int c = 0; c < n_chan; c++) pcm[i*n_chan + c] = makeSample(sig, i, c, bps);
+
+	//encode, the same way that the SD writer does: a placeholder header, the frames, and then the final header
+	FlacEncoder enc;
+	if (enc.setup(n_chan, fs_Hz, bps, block_size) != 0) { printf("FAIL: %s: encoder setup\n", name); return 1; }
+	Stream s;
+	s.bytes.resize(FLAC_STREAMINFO_BYTES);
+	enc.writeStreamHeader(s.bytes.data());
+	std::vector<uint8_t> frame(enc.getMaxFrameBytes());
+	std::vector<int32_t> chan(block_size);
+	int n_fail = 0;
+	for (long start = 0; start < n_samples; start += block_size) {
+		const int n = (int)((n_samples - start < block_size) ? (n_samples - start) : block_size);
+		enc.beginFrame(n, frame.data());
+		for (int c = 0; c < n_chan; c++) {
+			for (int i = 0; i < n; i++) chan[i] = pcm[(start + i)*n_chan + c];
+			enc.addChannel(chan.data());
+		}
+		const uint32_t n_bytes = enc.endFrame();
+		if (n_bytes > enc.getMaxFrameBytes()) { printf("FAIL: %s: frame of %u bytes is over the stated max\n", name, n_bytes); n_fail++; }
+		s.bytes.insert(s.bytes.end(), frame.begin(), frame.begin() + n_bytes);
+	}
+	enc.writeStreamHeader(s.bytes.data());
+
+	//decode, and compare
+	struct Decoder { const char *name; void (*decode)(Stream &); };
+	const Decoder decoders[] = {
+		{ "FlacDecoder", decodeWithFlacDecoder },
+#ifdef HAVE_LIBFLAC
+		{ "libFLAC", decodeWithLibFLAC },
+#endif
+	};
+	for (const Decoder &d : decoders) {
+		d.decode(s);
+		if (s.stopped_early) { printf("FAIL: %s: %s stopped early\n", name, d.name); n_fail++; }
+		if (s.n_errors > 0) { printf("FAIL: %s: %s reported %d errors\n", name, d.name, s.n_errors); n_fail++; }
+		if ((s.n_chan != (unsigned int)n_chan) || (s.bps != (unsigned int)bps) || (s.fs_Hz != fs_Hz) || (s.total_samples != (uint64_t)n_samples)) {
+			printf("FAIL: %s: %s: STREAMINFO says %u chan, %u bits, %u Hz, %llu samples\n", name, d.name, s.n_chan, s.bps, s.fs_Hz, (unsigned long long)s.total_samples);
+			n_fail++;
+		}
+		if (s.bad_frame_header) { printf("FAIL: %s: %s: a frame header disagrees with STREAMINFO\n", name, d.name); n_fail++; }
+		long n_diff = 0, first_diff = -1;
+		if (s.decoded.size() != pcm.size()) {
+			printf("FAIL: %s: %s decoded %zu samples, expected %zu\n", name, d.name, s.decoded.size(), pcm.size());
+			n_fail++;
+		} else {
+			for (size_t i = 0; i < pcm.size(); i++) if (s.decoded[i] != pcm[i]) { if (first_diff < 0) first_diff = i; n_diff++; }
+			if (n_diff > 0) { printf("FAIL: %s: %s: %ld samples differ (first at %ld)\n", name, d.name, n_diff, first_diff); n_fail++; }
+		}
+	}
+	printf("%-22s %d chan, %d bits, block %4d, %7ld samples: compression %.2f %s\n", name, n_chan, bps, block_size, n_samples,
+		(double)(n_samples * n_chan * bps / 8) / (double)(s.bytes.size() - FLAC_STREAMINFO_BYTES), (n_fail == 0) ? "" : "<-- FAIL");
+	return n_fail;
+}
+
+int main(void) {
+	int n_fail = 0;
+#ifdef HAVE_LIBFLAC
+	printf("decoding with FlacDecoder and libFLAC\n");
+#else
+	printf("decoding with FlacDecoder only (libFLAC not found; install libflac-dev to check against it, too)\n");
+#endif
+	for (int bps : { 16, 24 }) {
+		for (int n_chan : { 1, 2, 3, 6, 8 }) {
+			n_fail += roundTrip("sine", SINE, n_chan, bps, 1024, 100000);              //ends in a short frame
+			n_fail += roundTrip("full-scale noise", NOISE, n_chan, bps, 1024, 20480);  //verbatim subframes
+			n_fail += roundTrip("constant", CONSTANT, n_chan, bps, 1024, 10000);
+			n_fail += roundTrip("impulses", IMPULSES, n_chan, bps, 1024, 30000);
+			n_fail += roundTrip("sine plus noise", SINE_PLUS_NOISE, n_chan, bps, 4096, 50000);
+			n_fail += roundTrip("silence", SILENCE, n_chan, bps, 192, 1000);
+		}
+	}
+	n_fail += roundTrip("many frames", SINE, 1, 16, 192, 192L*3000 + 3);  //frame numbers that take 2 and 3 UTF-8 bytes
+
+	printf("%s\n", (n_fail == 0) ? "PASS" : "FAIL");
+	return (n_fail == 0) ? 0 : 1;
+}
@@ -0,0 +1,81 @@
+/*
+ * test_freqweighting_iec61672
+ *
+ * Checks the A and C weighting filters designed at runtime by FreqWeighting_IEC1672::designFilter_matlab_sos()
+ * against the IEC 61672-1:2013 Class 1 acceptance limits (Table 3), at every nominal frequency below
+ * 98% of Nyquist, for a range of sample rates.  It also checks the analog reference itself against the
+ * weightings printed in the standard.
+ *
+ * Build and run with "make check" in this directory.
+ */
+
+#include <stdio.h>
+#include <math.h>
+#include <algorithm>
+using std::min; using std::max;
+typedef float float32_t;
+#include "utility/FreqWeighting_IEC1672.h"
+
+//IEC 61672-1:2013, Table 3: nominal frequency, A weighting, C weighting, Class 1 upper and lower limits (dB).
+//A lower limit of -99 stands for minus infinity.
+struct TableRow { double f_Hz, A_dB, C_dB, upper_dB, lower_dB; };
+static const TableRow table3[] = {
+	{   10.0, -70.4, -14.3, 3.0, -99.0 }, {   12.5, -63.4, -11.2, 2.5, -99.0 }, {   16.0, -56.7,  -8.5, 2.0,  -4.0 },
+	{   20.0, -50.5,  -6.2, 2.0,  -2.0 }, {   25.0, -44.7,  -4.4, 2.0,  -1.5 }, {   31.5, -39.4,  -3.0, 1.5,  -1.5 },
+	{   40.0, -34.6,  -2.0, 1.0,  -1.0 }, {   50.0, -30.2,  -1.3, 1.0,  -1.0 }, {   63.0, -26.2,  -0.8, 1.0,  -1.0 },
+	{   80.0, -22.5,  -0.5, 1.0,  -1.0 }, {  100.0, -19.1,  -0.3, 1.0,  -1.0 }, {  125.0, -16.1,  -0.2, 1.0,  -1.0 },
+	{  160.0, -13.4,  -0.1, 1.0,  -1.0 }, {  200.0, -10.9,   0.0, 1.0,  -1.0 }, {  250.0,  -8.6,   0.0, 1.0,  -1.0 },
+	{  315.0,  -6.6,   0.0, 1.0,  -1.0 }, {  400.0,  -4.8,   0.0, 1.0,  -1.0 }, {  500.0,  -3.2,   0.0, 1.0,  -1.0 },
+	{  630.0,  -1.9,   0.0, 1.0,  -1.0 }, {  800.0,  -0.8,   0.0, 1.0,  -1.0 }, { 1000.0,   0.0,   0.0, 0.7,  -0.7 },
+	{ 1250.0,   0.6,   0.0, 1.0,  -1.0 }, { 1600.0,   1.0,  -0.1, 1.0,  -1.0 }, { 2000.0,   1.2,  -0.2, 1.0,  -1.0 },
+	{ 2500.0,   1.3,  -0.3, 1.0,  -1.0 }, { 3150.0,   1.2,  -0.5, 1.0,  -1.0 }, { 4000.0,   1.0,  -0.8, 1.0,  -1.0 },
+	{ 5000.0,   0.5,  -1.3, 1.5,  -1.5 }, { 6300.0,  -0.1,  -2.0, 1.5,  -2.0 }, { 8000.0,  -1.1,  -3.0, 1.5,  -2.5 },
+	{10000.0,  -2.5,  -4.4, 2.0,  -3.0 }, {12500.0,  -4.3,  -6.2, 2.0,  -5.0 }, {16000.0,  -6.6,  -8.5, 2.5, -16.0 },
+	{20000.0,  -9.3, -11.2, 3.0, -99.0 }
+};
+static const int n_rows = sizeof(table3) / sizeof(table3[0]);
+
+//the standard's nominal frequencies are rounded versions of the exact base-ten frequencies 1000*10^(k/10)
+static double exactFreq_Hz(double nominal_Hz) { return 1000.0 * pow(10.0, round(10.0 * log10(nominal_Hz / 1000.0)) / 10.0); }
+
+int main(void) {
+	int n_fail = 0;
+
+	//the analog reference must reproduce the printed weightings (which are rounded to 0.1 dB)
+	for (int i = 0; i < n_rows; i++) {
+		const double f = exactFreq_Hz(table3[i].f_Hz);
+		const double errA = FreqWeighting_IEC1672::analogResponse_dB(A_WEIGHT, f) - table3[i].A_dB;
+		const double errC = FreqWeighting_IEC1672::analogResponse_dB(C_WEIGHT, f) - table3[i].C_dB;
+		if ((fabs(errA) > 0.051) || (fabs(errC) > 0.051)) {
+			printf("FAIL: analog reference at %.1f Hz: A off by %.3f dB, C off by %.3f dB\n", table3[i].f_Hz, errA, errC);
+			n_fail++;
+		}
+	}
+
+	//the digital designs must be inside the Class 1 limits, relative to the analog reference
+	const double all_fs_Hz[] = { 8000, 11025, 16000, 22050, 24000, 32000, 44100, 48000, 88200, 96000 };
+	for (double fs_Hz : all_fs_Hz) {
+		for (int type : { A_WEIGHT, C_WEIGHT }) {
+			float32_t sos[6*IEC1672_MAX_DESIGN_SOS];
+			const int n_sos = FreqWeighting_IEC1672::designFilter_matlab_sos(type, fs_Hz, sos);
+			double worst_frac = 0.0, worst_f = 0.0;
+			for (int i = 0; i < n_rows; i++) {
+				const double f = exactFreq_Hz(table3[i].f_Hz);
+				if (f > 0.98 * 0.5 * fs_Hz) break;
+				const double err = FreqWeighting_IEC1672::digitalResponse_dB(sos, n_sos, f, fs_Hz) - FreqWeighting_IEC1672::analogResponse_dB(type, f);
+				const double frac = (err > 0.0) ? (err / table3[i].upper_dB) : (err / table3[i].lower_dB);  //fraction of the allowed tolerance
+				if (frac > worst_frac) { worst_frac = frac; worst_f = table3[i].f_Hz; }
+				if (frac > 1.0) {
+					printf("FAIL: %c weighting at fs = %.0f Hz: %.1f Hz is off by %.2f dB (limits +%.1f / %.1f)\n",
+						(type == A_WEIGHT) ? 'A' : 'C', fs_Hz, table3[i].f_Hz, err, table3[i].upper_dB, table3[i].lower_dB);
+					n_fail++;
+				}
+			}
+			printf("%c weighting, fs = %6.0f Hz: worst error is %3.0f%% of the Class 1 limit (at %.1f Hz)\n",
+				(type == A_WEIGHT) ? 'A' : 'C', fs_Hz, 100.0 * worst_frac, worst_f);
+		}
+	}
+
+	printf("%s\n", (n_fail == 0) ? "PASS" : "FAIL");
+	return (n_fail == 0) ? 0 : 1;
+}
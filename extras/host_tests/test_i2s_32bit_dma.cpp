@@ -0,0 +1,288 @@
+/*
+ * test_i2s_32bit_dma
+ *
+ * Checks the 32-bit I2S transfers (begin(true) on the I2S classes) without a Tympan.  A small model of the
+ * eDMA engine moves words between the DMA buffer and the SAI data registers, using the same TCD settings as
+ * the Teensy 4 code in input_i2s_f32.cpp, output_i2s_F32.cpp, input_i2s_quad_F32.cpp, output_i2s_quad_F32.cpp,
+ * and input_i2s_hex_F32.cpp.  At each half-buffer interrupt, the half that the DMA just finished is converted
+ * with the same helpers (and slot order) as the ISRs.  It checks that:
+ *
+ *   - each channel comes out of (or goes into) the right slot on the right data line,
+ *   - 24-bit audio survives: the sample is left-justified in the slot, with the low 8 bits zero on the way
+ *     out, and scaled so that full scale is +/-1.0 on the way in,
+ *   - samples beyond full scale saturate, and NaN goes to zero,
+ *   - the DMA stays inside the default buffers when they are sized for 32-bit transfers, for the full block
+ *     size and for a shorter one, and inside a user-supplied buffer of the documented size (2, 4, or 6 times
+ *     audio_block_samples), which is how the 32-bit transfers run without I2S_F32_ENABLE_32BIT_TRANSFERS.
+ *
+ * The Cortex-M path of i2s_f32_to_i32_sat (VCVT then SSAT) is not run here; this tests the portable path,
+ * which computes the same result.  Build and run with "make check" in this directory.
+ */
+
+#include "utility/i2s_convert_f32.h"
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <vector>
+#include <deque>
+
+#define MAX_AUDIO_BLOCK_SAMPLES_F32 128  //as in AudioStream_F32.h
+
+#if !I2S_F32_ENABLE_32BIT_TRANSFERS
+#error "build with -DI2S_F32_ENABLE_32BIT_TRANSFERS=1"
+#endif
+
+//////////// a model of the part of the eDMA engine that the I2S classes use
+
+static const uint32_t REG_BASE = 0x1000;    //the four SAI data registers (RDR0..RDR3 or TDR0..TDR3), 4 bytes apart
+static const uint32_t RAM_BASE = 0x100000;  //the DMA buffer
+
+struct Tcd {
+	uint32_t saddr = 0; int soff = 0; int ssize = 4;
+	uint32_t nbytes = 4; int mloff = 0; bool smloe = false, dmloe = false;
+	int slast = 0;
+	uint32_t daddr = 0; int doff = 0;
+	int citer = 0, biter = 0;
+	int dlastsga = 0;
+};
+
+struct Sim {
+	std::vector<uint32_t> ram;     //the DMA buffer, plus guard words after it
+	size_t buffer_words = 0;
+	std::deque<uint32_t> rx[4];    //words arriving from the codec on each data line
+	std::vector<uint32_t> tx[4];   //words sent to the codec on each data line
+	int n_bad_access = 0;
+
+	uint32_t read(uint32_t addr, int size) {
+		if (addr >= RAM_BASE) {
+			const uint32_t off = addr - RAM_BASE;
+			if (off + size > buffer_words*4) { n_bad_access++; return 0; }
+			uint32_t v = 0; memcpy(&v, (uint8_t *)ram.data() + off, size); return v;
+		}
+		//reading any part of a receive data register pops the next word from that data line
+		const int line = (addr - REG_BASE) / 4, byte = (addr - REG_BASE) % 4;
+		if ((line < 0) || (line > 3) || rx[line].empty()) { n_bad_access++; return 0; }
+		const uint32_t w = rx[line].front(); rx[line].pop_front();
+		return (size == 4) ? w : (w >> (8*byte)) & 0xFFFF;
+	}
+	void write(uint32_t addr, int size, uint32_t v) {
+		if (addr >= RAM_BASE) {
+			const uint32_t off = addr - RAM_BASE;
+			if (off + size > buffer_words*4) { n_bad_access++; return; }
+			memcpy((uint8_t *)ram.data() + off, &v, size); return;
+		}
+		//writing the upper half of a transmit data register sends it as the upper half of the slot
+		const int line = (addr - REG_BASE) / 4, byte = (addr - REG_BASE) % 4;
+		if ((line < 0) || (line > 3)) { n_bad_access++; return; }
+		tx[line].push_back((size == 4) ? v : (v << (8*byte)));
+	}
+
+	//run one minor loop.  Returns 1 at the half-way interrupt, 2 at the end of the major loop, otherwise 0.
+	int minorLoop(Tcd &t) {
+		for (uint32_t b = 0; b < t.nbytes; b += t.ssize) {
+			write(t.daddr, t.ssize, read(t.saddr, t.ssize));
+			t.saddr += t.soff; t.daddr += t.doff;
+		}
+		t.citer--;
+		if (t.citer == 0) {
+			//the minor loop offset is not applied after the last minor loop; SLAST and DLASTSGA are applied instead
+			t.saddr += t.slast; t.daddr += t.dlastsga; t.citer = t.biter;
+			return 2;
+		}
+		if (t.smloe) t.saddr += t.mloff;
+		if (t.dmloe) t.daddr += t.mloff;
+		return (t.citer == t.biter/2) ? 1 : 0;
+	}
+};
+
+//////////// test signals and checks
+
+static int n_fail = 0;
+static void check(bool ok, const char *what, int chan, int i) {
+	if (!ok && (n_fail++ < 10)) printf("    FAIL: %s (chan %d, sample %d)\n", what, chan, i);
+}
+
+//a 24-bit test value for each channel and sample, including both full-scale values
+static int32_t testI24(int chan, int i) {
+	if (i == 3) return 8388607;
+	if (i == 4) return -8388608;
+	if (i == 5) return (chan % 2) ? 1 : -1;  //1 LSB, which 16-bit transfers would lose
+	return (int32_t)((((uint32_t)(chan + 1) * 2654435761u) ^ ((uint32_t)i * 40503u)) & 0xFFFFFF) - 8388608;
+}
+
+//float test values for each channel and sample, including some beyond full scale and a NaN
+static float testF32(int chan, int i) {
+	if (i == 3) return 1.5f;
+	if (i == 4) return -1.5f;
+	if (i == 5) return NAN;
+	if (i == 6) return (chan + 1) / 8388607.0f;  //a few LSBs
+	return 0.999f * sinf(0.05f * (i + 1) * (chan + 1));
+}
+
+//what the codec should receive for x: saturate24(x * (2^23-1)), with the product in float (as on the Teensy),
+//rounded toward zero, in the upper 24 bits
+static uint32_t expectedSlot(float x) {
+	double v = (x != x) ? 0.0 : (double)(x * 8388607.0f);
+	if (v > 8388607.0) v = 8388607.0;
+	if (v < -8388608.0) v = -8388608.0;
+	return ((uint32_t)(int32_t)v) << 8;
+}
+
+//the slot order of the frame (and so of the DMA buffer), for n_line data lines of two slots each.  Each
+//minor loop takes one slot from each data line, so the frame is (left of each line, then right of each line).
+//Data line k carries channels 2k+1 (left) and 2k+2 (right), so slot s carries this (zero-based) channel:
+static int chanOfSlot(int s, int n_line) { return (s < n_line) ? (2*s) : (2*(s - n_line) + 1); }
+
+//////////// receiving
+
+//n_line is 1 for the stereo input, 2 for the quad, 3 for the hex.  user_buffer is for a buffer given to the constructor.
+static void testInput(const char *name, int n_line, int block_samples, bool user_buffer = false) {
+	const int n_chan = 2*n_line, n_slots = n_chan;
+	Sim sim;
+	sim.buffer_words = user_buffer ? (n_chan*block_samples)
+	                 : (n_line == 1) ? (I2S_F32_DMA_BUFFER_SCALE*MAX_AUDIO_BLOCK_SAMPLES_F32)
+	                                 : (MAX_AUDIO_BLOCK_SAMPLES_F32/2*2*n_line*I2S_F32_DMA_BUFFER_SCALE);
+	sim.ram.assign(sim.buffer_words + 16, 0);
+	const int buffer_bytes = block_samples*n_chan*4;  //I2S_BUFFER_TO_USE_BYTES for 32-bit transfers
+
+	Tcd t;
+	t.saddr = REG_BASE; t.ssize = 4; t.daddr = RAM_BASE; t.doff = 4;
+	if (n_line == 1) {
+		t.soff = 0; t.nbytes = 4;
+		t.citer = t.biter = buffer_bytes / 4;
+	} else {
+		t.soff = 4; t.nbytes = 4*n_line; t.smloe = true; t.mloff = -4*n_line; t.slast = -4*n_line;
+		t.citer = t.biter = block_samples * 2;
+	}
+	t.dlastsga = -buffer_bytes;
+
+	//the codec sends 3 blocks
+	const int n_frames = 3*block_samples;
+	for (int f = 0; f < n_frames; f++) {
+		for (int lr = 0; lr < 2; lr++) {
+			for (int k = 0; k < n_line; k++) sim.rx[k].push_back(((uint32_t)testI24(2*k + lr, f)) << 8);
+		}
+	}
+
+	//what the ISR does: at each interrupt, convert the half that the DMA has just finished
+	std::vector<std::vector<float>> got(n_chan);
+	std::vector<float> dest[6];
+	for (int c = 0; c < n_chan; c++) dest[c].resize(block_samples/2);
+	while (!sim.rx[0].empty()) {
+		const int irq = sim.minorLoop(t);
+		if (irq == 0) continue;
+		const uint32_t *src = sim.ram.data() + ((irq == 1) ? 0 : (buffer_bytes / 2 / 4));
+		float *d[6]; for (int s = 0; s < n_slots; s++) d[s] = dest[chanOfSlot(s, n_line)].data();
+		if (n_line == 1) i2s_i32_to_f32_deinterleave2(src, d[0], d[1], block_samples/2);
+		if (n_line == 2) i2s_i32_to_f32_deinterleave4(src, d[0], d[1], d[2], d[3], block_samples/2);
+		if (n_line == 3) i2s_i32_to_f32_deinterleave6(src, d[0], d[1], d[2], d[3], d[4], d[5], block_samples/2);
+		for (int c = 0; c < n_chan; c++) got[c].insert(got[c].end(), dest[c].begin(), dest[c].end());
+	}
+
+	for (int c = 0; c < n_chan; c++) {
+		check((int)got[c].size() == n_frames, "number of samples", c, 0);
+		for (int i = 0; i < (int)got[c].size(); i++) {
+			const double want = testI24(c, i) / 8388607.0;
+			check(fabs(got[c][i] - want) <= 1.0e-7 + 1.0e-6*fabs(want), "24-bit sample", c, i);
+		}
+	}
+	check(sim.n_bad_access == 0, "DMA access outside the buffer or registers", -1, -1);
+	for (size_t i = sim.buffer_words; i < sim.ram.size(); i++) check(sim.ram[i] == 0, "DMA wrote past the buffer", -1, (int)i);
+	printf("%-28s block %3d: %zu samples per channel checked\n", name, block_samples, got[0].size());
+}
+
+//////////// sending
+
+//n_line is 1 for the stereo output, 2 for the quad.  For the stereo output, mono_side is 0 for a normal
+//stereo test, or 1 or 2 to send only the left or right block (the other slot must be silent).
+static void testOutput(const char *name, int n_line, int block_samples, int mono_side = 0, bool user_buffer = false) {
+	const int n_chan = 2*n_line;
+	Sim sim;
+	sim.buffer_words = user_buffer ? (n_chan*block_samples)
+	                 : (n_line == 1) ? (I2S_F32_DMA_BUFFER_SCALE*MAX_AUDIO_BLOCK_SAMPLES_F32)
+	                                 : (MAX_AUDIO_BLOCK_SAMPLES_F32/2*4*I2S_F32_DMA_BUFFER_SCALE);
+	sim.ram.assign(sim.buffer_words + 16, 0);
+	const int buffer_bytes = block_samples*n_chan*4;  //I2S_BUFFER_TO_USE_BYTES for 32-bit transfers
+
+	Tcd t;
+	t.saddr = RAM_BASE; t.soff = 4; t.ssize = 4; t.slast = -buffer_bytes; t.daddr = REG_BASE;
+	if (n_line == 1) {
+		t.nbytes = 4; t.doff = 0;
+		t.citer = t.biter = buffer_bytes / 4;
+	} else {
+		t.nbytes = 8; t.doff = 4; t.dmloe = true; t.mloff = -8; t.dlastsga = -8;
+		t.citer = t.biter = block_samples * 2;
+	}
+
+	//what the ISR does: fill the half that the DMA has just finished with the next half block
+	const int n_halves = 6, half = block_samples/2;
+	std::vector<std::vector<float>> audio(n_chan, std::vector<float>(n_halves*half));
+	for (int c = 0; c < n_chan; c++) for (int i = 0; i < n_halves*half; i++) audio[c][i] = testF32(c, i);
+	int next_half = 0;
+	auto fill = [&](uint32_t *dest) {
+		const float *s[4]; for (int c = 0; c < n_chan; c++) s[c] = audio[c].data() + next_half*half;
+		if (n_line == 1) {
+			if (mono_side == 0) i2s_f32_to_i32_interleave2(dest, s[0], s[1], half);
+			if (mono_side == 1) { i2s_f32_to_i32_slot(dest, s[0], half, 2); i2s_f32_to_i32_slot(dest+1, NULL, half, 2); }
+			if (mono_side == 2) { i2s_f32_to_i32_slot(dest, NULL, half, 2); i2s_f32_to_i32_slot(dest+1, s[1], half, 2); }
+		} else {
+			i2s_f32_to_i32_interleave4(dest, s[0], s[2], s[1], s[3], half);  //slot order is 1, 3, 2, 4
+		}
+		next_half++;
+	};
+	uint32_t *first = sim.ram.data(), *second = sim.ram.data() + buffer_bytes/2/4;
+	fill(first); fill(second);
+	while (next_half < n_halves) {
+		const int irq = sim.minorLoop(t);
+		if (irq == 1) fill(first);
+		if (irq == 2) fill(second);
+	}
+	while (sim.tx[0].size() < (size_t)(2*n_halves*half)) sim.minorLoop(t);  //send the rest
+
+	for (int c = 0; c < n_chan; c++) {
+		const std::vector<uint32_t> &line = sim.tx[c/2];
+		const int lr = c % 2;
+		const bool silent = ((mono_side == 1) && (c == 1)) || ((mono_side == 2) && (c == 0));
+		for (int i = 0; i < n_halves*half; i++) {
+			const uint32_t w = line[2*i + lr];
+			check(w == (silent ? 0u : expectedSlot(audio[c][i])), "24-bit slot", c, i);
+			check((w & 0xFF) == 0, "low 8 bits of the slot", c, i);
+		}
+	}
+	check(sim.n_bad_access == 0, "DMA access outside the buffer or registers", -1, -1);
+	printf("%-28s block %3d: %d samples per channel checked\n", name, block_samples, n_halves*half);
+}
+
+int main(void) {
+	//the default buffers must be twice the 16-bit size when (and only when) 32-bit transfers are enabled
+	check(I2S_F32_DMA_BUFFER_SCALE == 2, "I2S_F32_DMA_BUFFER_SCALE", -1, -1);
+
+	//the conversions on their own
+	check(i2s_f32_to_i32_sat(1.0f) == 0x7FFFFF00u, "full scale", -1, -1);
+	check(i2s_f32_to_i32_sat(2.0f) == 0x7FFFFF00u, "positive saturation", -1, -1);
+	check(i2s_f32_to_i32_sat(-2.0f) == 0x80000000u, "negative saturation", -1, -1);
+	check(i2s_f32_to_i32_sat(NAN) == 0u, "NaN", -1, -1);
+	check(i2s_f32_to_i32_sat(1.0f/8388607.0f) == 0x100u, "one LSB", -1, -1);
+	check(fabsf(i2s_i32_to_f32(0x7FFFFF00u) - 1.0f) < 1.0e-7f, "full scale in", -1, -1);
+
+	const int block_sizes[] = { MAX_AUDIO_BLOCK_SAMPLES_F32, 32 };
+	for (int block_samples : block_sizes) {
+		testInput("stereo input", 1, block_samples);
+		testInput("quad input", 2, block_samples);
+		testInput("hex input", 3, block_samples);
+		testOutput("stereo output", 1, block_samples);
+		testOutput("stereo output, left only", 1, block_samples, 1);
+		testOutput("stereo output, right only", 1, block_samples, 2);
+		testOutput("quad output", 2, block_samples);
+	}
+	for (int block_samples : { 16, 64, MAX_AUDIO_BLOCK_SAMPLES_F32 }) {  //user-supplied buffers, sized for the block
+		testInput("stereo input, user buffer", 1, block_samples, true);
+		testInput("quad input, user buffer", 2, block_samples, true);
+		testInput("hex input, user buffer", 3, block_samples, true);
+		testOutput("stereo output, user buffer", 1, block_samples, 0, true);
+		testOutput("quad output, user buffer", 2, block_samples, 0, true);
+	}
+
+	printf("%s\n", (n_fail == 0) ? "PASS" : "FAIL");
+	return (n_fail == 0) ? 0 : 1;
+}
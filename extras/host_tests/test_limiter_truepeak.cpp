@@ -0,0 +1,163 @@
+/*
+ * test_limiter_truepeak
+ *
+ * Checks the look-ahead limiter (AudioEffectLimiter_F32):
+ *
+ *   - No output sample exceeds the ceiling, and the safety clipper is never needed (getNumClipped() == 0),
+ *     for loud noise and tones with levels that jump around.
+ *   - With the true-peak detector on, the true (inter-sample) peak of the output, measured by 16x
+ *     oversampling with a long interpolator, stays within 0.25 dB of the ceiling for content below fs/4,
+ *     for look-aheads of 0.5 msec or more.  With setUseTruePeak(false) the same signal overshoots, which
+ *     shows that the check can fail.
+ *   - The latency is exactly getLookAhead_samps(): an impulse below the ceiling comes out that many samples
+ *     later, at the same level (to within round-off in the moving average of the gain).
+ *   - The output does not depend on how the audio is split into calls.
+ *
+ * Build and run with "make check" in this directory.
+ */
+
+#include "AudioEffectLimiter_F32.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <vector>
+
+static const float fs_Hz = 48000.f;
+static const float ceiling_dBFS = -1.0f;
+
+static float randn(void) {
+	const float u1 = (rand() + 1.0f) / (RAND_MAX + 2.0f), u2 = rand() / (float)RAND_MAX;
+	return sqrtf(-2.0f*logf(u1)) * cosf(2.0f*(float)M_PI*u2);
+}
+
+static AudioEffectLimiter_F32 &newLimiter(float lookahead_msec, bool true_peak) {
+	AudioEffectLimiter_F32 &lim = *(new AudioEffectLimiter_F32(AudioSettings_F32(fs_Hz, 128)));  //never freed
+	lim.setCeiling_dBFS(ceiling_dBFS);
+	lim.setUseTruePeak(true_peak);
+	lim.setLookAhead_msec(lookahead_msec);
+	return lim;
+}
+
+//run the signal through in calls of random length (or all at once, if max_chunk is zero)
+static std::vector<float> run(AudioEffectLimiter_F32 &lim, const std::vector<float> &x, int max_chunk) {
+	std::vector<float> y(x.size());
+	size_t i = 0;
+	while (i < x.size()) {
+		int n = (max_chunk > 0) ? (1 + rand() % max_chunk) : (int)x.size();
+		if (i + n > x.size()) n = (int)(x.size() - i);
+		lim.processSamples(&x[i], &y[i], n);
+		i += n;
+	}
+	return y;
+}
+
+//the largest magnitude of the signal when oversampled 16x, by a Hann-windowed sinc that is 64 samples long
+static float truePeak16x(const std::vector<float> &y) {
+	const int over = 16, half = 32;
+	static double coeff[over][2*half];
+	for (int p = 0; p < over; p++) {
+		for (int j = -half + 1; j <= half; j++) {
+			const double u = ((double)p) / over - j;
+			const double sinc = (fabs(u) < 1e-12) ? 1.0 : sin(M_PI*u) / (M_PI*u);
+			coeff[p][j + half - 1] = sinc * (0.5 + 0.5*cos(M_PI*u/half));
+		}
+	}
+	float peak = 0.0f;
+	for (size_t m = half; m + half < y.size(); m++) {
+		for (int p = 0; p < over; p++) {
+			double acc = 0.0;
+			for (int k = 0; k < 2*half; k++) acc += coeff[p][k] * y[m - half + 1 + k];
+			peak = fmaxf(peak, fabsf((float)acc));
+		}
+	}
+	return peak;
+}
+
+//noise, and sums of tones, with levels that jump around.  Tones land anywhere between the samples,
+//so the inter-sample peaks are often well above the sample peaks.
+static std::vector<float> makeSignal(bool below_quarter_fs) {
+	const int n = (int)(1.0f * fs_Hz);
+	std::vector<float> x(n);
+	const float f_max = below_quarter_fs ? 0.25f*fs_Hz : 0.45f*fs_Hz;
+	float level = 1.0f, f1 = 1000.f, f2 = 3000.f, ph1 = 0.0f, ph2 = 0.0f;
+	bool noise = false;
+	for (int i = 0; i < n; i++) {
+		if ((i % 2000) == 0) {
+			level = powf(10.0f, (-20.0f + 32.0f * rand() / (float)RAND_MAX) / 20.0f);  //up to 12 dB over full scale
+			f1 = 0.02f*fs_Hz + (f_max - 0.02f*fs_Hz) * rand() / (float)RAND_MAX;
+			f2 = 0.02f*fs_Hz + (f_max - 0.02f*fs_Hz) * rand() / (float)RAND_MAX;
+			noise = !below_quarter_fs && ((rand() % 3) == 0);
+		}
+		ph1 += 2.0f*(float)M_PI*f1/fs_Hz;  ph2 += 2.0f*(float)M_PI*f2/fs_Hz;
+		x[i] = noise ? (0.3f * level * randn()) : (0.5f * level * (sinf(ph1) + sinf(ph2)));
+	}
+	return x;
+}
+
+static int checkSamplePeaks(float lookahead_msec, bool true_peak) {
+	AudioEffectLimiter_F32 &lim = newLimiter(lookahead_msec, true_peak);
+	const std::vector<float> y = run(lim, makeSignal(false), 128);
+	const float ceiling = powf(10.0f, ceiling_dBFS/20.0f);
+	float peak = 0.0f;
+	for (float v : y) peak = fmaxf(peak, fabsf(v));
+	const bool ok = (peak <= ceiling) && (lim.getNumClipped() == 0);
+	printf("sample peaks, look-ahead %2d samples, true peak %s: max %.2f dBFS (ceiling %.1f), %lu clipped%s\n", lim.getLookAhead_samps(),
+		true_peak ? "on " : "off", 20.0f*log10f(peak), ceiling_dBFS, lim.getNumClipped(), ok ? "" : "  <-- FAIL");
+	return ok ? 0 : 1;
+}
+
+static int checkTruePeak(float lookahead_msec, bool true_peak) {
+	AudioEffectLimiter_F32 &lim = newLimiter(lookahead_msec, true_peak);
+	const std::vector<float> y = run(lim, makeSignal(true), 128);
+	const float tp_dBFS = 20.0f*log10f(truePeak16x(y));
+	const float tol_dB = 0.25f;
+	const bool ok = true_peak ? (tp_dBFS <= ceiling_dBFS + tol_dB) : (tp_dBFS > ceiling_dBFS + tol_dB);  //without it, expect an overshoot
+	printf("true peak below fs/4, look-ahead %2d samples, true peak %s: max %.2f dBFS (ceiling %.1f, %s)%s\n", lim.getLookAhead_samps(),
+		true_peak ? "on " : "off", tp_dBFS, ceiling_dBFS, true_peak ? "must be within 0.25 dB" : "expect an overshoot", ok ? "" : "  <-- FAIL");
+	return ok ? 0 : 1;
+}
+
+static int checkLatency(float lookahead_msec, bool true_peak) {
+	AudioEffectLimiter_F32 &lim = newLimiter(lookahead_msec, true_peak);
+	std::vector<float> x(1000, 0.0f);
+	const int at = 300;
+	x[at] = 0.5f;
+	const std::vector<float> y = run(lim, x, 0);
+	int found = 0, n_other = 0;
+	for (int i = 0; i < (int)y.size(); i++) if (fabsf(y[i]) > fabsf(y[found])) found = i;
+	for (int i = 0; i < (int)y.size(); i++) if ((i != found) && (y[i] != 0.0f)) n_other++;
+	const bool ok = (found - at == lim.getLookAhead_samps()) && (fabsf(y[found] - 0.5f) < 1.0e-6f) && (n_other == 0);
+	printf("latency, look-ahead %.2f msec, true peak %s: impulse delayed by %d samples, getLookAhead_samps() = %d%s\n", lookahead_msec,
+		true_peak ? "on " : "off", found - at, lim.getLookAhead_samps(), ok ? "" : "  <-- FAIL");
+	return ok ? 0 : 1;
+}
+
+static int checkChunking(bool true_peak) {
+	const std::vector<float> x = makeSignal(false);
+	const std::vector<float> y_whole = run(newLimiter(1.0f, true_peak), x, 0);
+	int n_diff = 0;
+	for (int max_chunk : { 1, 7, 128, 300 }) {
+		const std::vector<float> y = run(newLimiter(1.0f, true_peak), x, max_chunk);
+		for (size_t i = 0; i < x.size(); i++) if (y[i] != y_whole[i]) n_diff++;
+	}
+	const bool ok = (n_diff == 0);
+	printf("random call lengths vs one call, true peak %s: %d samples differ%s\n", true_peak ? "on " : "off", n_diff, ok ? "" : "  <-- FAIL");
+	return ok ? 0 : 1;
+}
+
+int main(void) {
+	srand(5);
+	int n_fail = 0;
+	for (bool tp : { true, false }) {
+		for (float msec : { 0.0f, 0.25f, 1.0f, 2.0f }) n_fail += checkSamplePeaks(msec, tp);
+	}
+	for (float msec : { 0.5f, 1.0f, 2.0f }) n_fail += checkTruePeak(msec, true);
+	n_fail += checkTruePeak(1.0f, false);
+	for (bool tp : { true, false }) {
+		for (float msec : { 0.0f, 0.05f, 1.0f, 5.0f }) n_fail += checkLatency(msec, tp);
+	}
+	for (bool tp : { true, false }) n_fail += checkChunking(tp);
+
+	printf("%s\n", (n_fail == 0) ? "PASS" : "FAIL");
+	return (n_fail == 0) ? 0 : 1;
+}
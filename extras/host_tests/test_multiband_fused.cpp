@@ -0,0 +1,128 @@
+/*
+ * test_multiband_fused
+ *
+ * Checks the fused, chunked processing of the multiband WDRC (setUseFusedProcessing(true)) against the
+ * normal block processing, for FIR and IIR filterbanks and several chunk sizes, with the look-ahead limiter
+ * off and on.  The compressors compute their gain every sample (the default), so the two must give the same
+ * output, bit for bit.
+ *
+ * It also checks the error path: if the compressors cannot get their scratch memory, processAudioBlock()
+ * must return an error and leave a silent output block, not a partially processed one.  Build and run with "make check" in this directory.
+ */
+
+#include "AudioEffectMultiBandWDRC_F32.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <vector>
+
+static const int N_CHAN = 8;
+static BTNRH_WDRC::CHA_DSL dsl = {5,  // attack (ms)
+	50,      // release (ms)
+	115,     // maxdB
+	0,       // left
+	N_CHAN,  // num channels
+	{317.1666, 502.9734, 797.6319, 1264.9, 2005.9, 3181.1, 5044.7},   // cross frequencies (Hz)
+	{0.7, 0.7, 0.7, 0.7, 0.7, 0.7, 0.7, 0.7},           // compression ratio for low-SPL region
+	{30.0, 30.0, 30.0, 30.0, 30.0, 30.0, 30.0, 30.0},   // expansion-end kneepoint
+	{-13.0, -16.0, -4.0, 7.0, 11.0, 20.0, 26.0, 27.0},  // compression-start gain
+	{0.7f, 0.9f, 1.0f, 1.1f, 1.2f, 1.4f, 1.5f, 1.5f},   // compression ratio
+	{32.0, 27.0, 27.0, 27.0, 30.0, 30.0, 30.0, 30.0},   // compression-start kneepoint (input dB SPL)
+	{79.f, 88.f, 91.f, 93.f, 98.f, 103.f, 102.f, 100.f} // output limiting threshold
+};
+static BTNRH_WDRC::CHA_WDRC gha = {1.0, 50.0, 24000.0, 115.0, 1.0, 0.0, 0.0, 105.0, 10.0, 105.0};
+
+static float randn(void) {
+	const float u1 = (rand() + 1.0f) / (RAND_MAX + 2.0f), u2 = rand() / (float)RAND_MAX;
+	return sqrtf(-2.0f*logf(u1)) * cosf(2.0f*(float)M_PI*u2);
+}
+
+//run the signal through, a block at a time.  Returns the number of blocks that gave an error.
+static int run(AudioEffectMultiBandWDRC_Base_F32_UI &wdrc, const std::vector<float> &x, std::vector<float> &y, int block_samples) {
+	audio_block_f32_t block_in, block_out;
+	int n_err = 0;
+	for (size_t i = 0; i + block_samples <= x.size(); i += block_samples) {
+		block_in.length = block_samples;
+		for (int k = 0; k < block_samples; k++) block_in.data[k] = x[i+k];
+		if (wdrc.processAudioBlock(&block_in, &block_out) != 0) n_err++;
+		for (int k = 0; k < block_samples; k++) y[i+k] = block_out.data[k];
+	}
+	return n_err;
+}
+
+template <class WDRC>
+static int compareFused(const char *name, int filt_order, int chunk, bool use_limiter, const std::vector<float> &x, float fs_Hz, int block_samples) {
+	AudioSettings_F32 settings(fs_Hz, block_samples);
+	WDRC &fused = *(new WDRC(settings)), &ref = *(new WDRC(settings));  //fresh instances for each case, which are never freed
+	for (WDRC *w : { &fused, &ref }) {
+		w->setupFromBTNRH(dsl, gha, filt_order);
+		w->enable(true);
+		w->limiter.enable(use_limiter);
+	}
+	fused.setFusedChunkSize(chunk);
+	fused.setUseFusedProcessing(true);
+
+	std::vector<float> y_fused(x.size()), y_ref(x.size());
+	const int n_err = run(ref, x, y_ref, block_samples) + run(fused, x, y_fused, block_samples);
+	int n_diff = 0;
+	for (size_t i = 0; i < x.size(); i++) if (y_fused[i] != y_ref[i]) n_diff++;
+	const bool ok = (n_err == 0) && (n_diff == 0);
+	printf("%s, order %3d, chunk %3d, limiter %s (max %4.1f dB reduction): %d errors, %d samples differ%s\n", name, filt_order, chunk, use_limiter ? "on " : "off",
+		use_limiter ? ref.limiter.getMaxGainReduction_dB() : 0.0f, n_err, n_diff, ok ? "" : "  <-- FAIL");
+	return ok ? 0 : 1;
+}
+
+//starve the compressors of scratch memory, and check that the output is silent
+static int checkScratchFailure(const std::vector<float> &x, float fs_Hz, int block_samples) {
+	AudioSettings_F32 settings(fs_Hz, block_samples);
+	AudioEffectMultiBandWDRC_F32_UI &wdrc = *(new AudioEffectMultiBandWDRC_F32_UI(settings));
+	wdrc.setupFromBTNRH(dsl, gha, 96);
+	wdrc.setFusedChunkSize(block_samples / 4);
+	wdrc.setUseFusedProcessing(true);
+	wdrc.enable(true);
+
+	//warm up, so that the output would not be silent
+	std::vector<float> y(x.size());
+	int n_fail = run(wdrc, x, y, block_samples);
+
+	//leave room for the band's chunk, but not for the compressors' arrays
+	AudioScratch_F32 hog;
+	while ((AudioScratchArena_F32::getSize() - AudioScratchArena_F32::getMark()) >= (block_samples / 4 + 4)) hog.get(4);
+	audio_block_f32_t block_in, block_out;
+	block_in.length = block_samples;
+	for (int k = 0; k < block_samples; k++) { block_in.data[k] = x[k]; block_out.data[k] = 1.0f; }
+	const int ret = wdrc.processAudioBlock(&block_in, &block_out);
+	int n_nonzero = 0;
+	for (int k = 0; k < block_samples; k++) if (block_out.data[k] != 0.0f) n_nonzero++;
+	const bool ok = (n_fail == 0) && (ret != 0) && (n_nonzero == 0) && (block_out.length == block_samples);
+	printf("no scratch memory for the compressors: returned %d, %d output samples not silent%s\n", ret, n_nonzero, ok ? "" : "  <-- FAIL");
+	return ok ? 0 : 1;
+}
+
+int main(void) {
+	AudioMemory_F32(10);
+	const float fs_Hz = 24000.f;
+	const int block_samples = 128;
+
+	//noise with a level that jumps around, so that the compressors move through their knees
+	const int n = (int)(2.0f * fs_Hz) / block_samples * block_samples;
+	std::vector<float> x(n);
+	srand(4);
+	float level = 0.01f;
+	for (int i = 0; i < n; i++) {
+		if ((i % 2400) == 0) level = powf(10.0f, (-80.0f + 80.0f * rand() / (float)RAND_MAX) / 20.0f);
+		x[i] = level * randn();
+	}
+
+	int n_fail = 0;
+	for (bool use_limiter : { false, true }) {
+		for (int chunk : { 1, 16, 32, 40, 128 }) {
+			n_fail += compareFused<AudioEffectMultiBandWDRC_F32_UI>("FIR", 96, chunk, use_limiter, x, fs_Hz, block_samples);
+			n_fail += compareFused<AudioEffectMultiBandWDRC_IIR_F32_UI>("IIR", 6, chunk, use_limiter, x, fs_Hz, block_samples);
+		}
+	}
+	n_fail += checkScratchFailure(x, fs_Hz, block_samples);
+
+	printf("%s\n", (n_fail == 0) ? "PASS" : "FAIL");
+	return (n_fail == 0) ? 0 : 1;
+}
@@ -0,0 +1,117 @@
+/*
+ * test_playmemory_adpcm
+ *
+ * Checks the IMA-ADPCM decoding of AudioPlayMemoryI16_F32, which decodes one sample at a time as it plays
+ * (getDataValue()), against a plain decoder here that decodes each whole block into a buffer.  The data is
+ * sample_YES_adpcm.h from the RamWavPlayer_ADPCM example: 12000 samples in 256-byte blocks of 505 samples,
+ * with a shorter last block.
+ *
+ *   - getDataValue() for every sample in order, which crosses every block boundary, must match exactly.
+ *   - getDataValue() must also match when it jumps around: back within a block, back and forward across a
+ *     block boundary, and straight to the first or last sample of a block.
+ *   - Playing the sample with getNextAudioValue(), at its own sample rate and upsampled 2x, must give the
+ *     decoded values (scaled by 1/32768), and then stop at the end.
+ *
+ * Build and run with "make check" in this directory.
+ */
+
+#include "AudioPlayMemory_F32.h"
+#include "../../examples/02-Utility/RamWavPlayer_ADPCM/sample_YES_adpcm.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+static int n_fail = 0;
+static bool check(bool ok, const char *what) { if (!ok) { printf("    %s  <-- FAIL\n", what); n_fail++; } return ok; }
+
+//gives the test access to the decoder
+class TestPlayer : public AudioPlayMemoryI16_F32 {
+	public:
+		using AudioPlayMemoryI16_F32::getDataValue;
+		using AudioPlayMemoryI16_F32::getNextAudioValue;
+};
+
+//the plain IMA-ADPCM decoder: each mono block is a 4-byte header (the first sample as int16, the step index, a
+//reserved byte) followed by 4-bit codes, low nibble first.  Decodes the whole block into out.
+static void referenceDecodeBlock(const uint8_t *block, int n_samples, std::vector<int16_t> &out) {
+	static const int step_table[89] = {
+		7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118,
+		130, 143, 157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963, 1060,
+		1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132,
+		7845, 8630, 9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767 };
+	static const int index_table[16] = { -1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8 };
+	int predictor = (int16_t)(block[0] | (block[1] << 8)), step_ind = (block[2] > 88) ? 88 : block[2];
+	out.push_back((int16_t)predictor);
+	for (int i = 0; i < n_samples - 1; i++) {
+		const int code = (block[4 + i/2] >> ((i % 2) * 4)) & 0x0F, step = step_table[step_ind];
+		int diff = step >> 3;
+		if (code & 4) diff += step;
+		if (code & 2) diff += step >> 1;
+		if (code & 1) diff += step >> 2;
+		predictor += (code & 8) ? -diff : diff;
+		predictor = (predictor > 32767) ? 32767 : ((predictor < -32768) ? -32768 : predictor);
+		step_ind += index_table[code];
+		step_ind = (step_ind < 0) ? 0 : ((step_ind > 88) ? 88 : step_ind);
+		out.push_back((int16_t)predictor);
+	}
+}
+
+int main(void) {
+	const uint32_t n = sample_YES_adpcm_len, per_block = AUDIOPLAYMEMORY_ADPCM_SAMPLES_PER_BLOCK(sample_YES_adpcm_block_bytes);
+	std::vector<int16_t> want;
+	for (uint32_t b = 0; b * per_block < n; b++) {
+		const uint32_t n_block = ((n - b * per_block) < per_block) ? (n - b * per_block) : per_block;
+		referenceDecodeBlock(sample_YES_adpcm + b * sample_YES_adpcm_block_bytes, (int)n_block, want);
+	}
+	printf("sample_YES_adpcm: %u samples, %u per block, %u blocks\n", n, per_block, (n + per_block - 1) / per_block);
+	if (!check(want.size() == n, "the reference decodes every sample")) { printf("FAIL\n"); return 1; }
+
+	TestPlayer &player = *(new TestPlayer);  //never freed
+	player.setSampleRate_Hz(sample_YES_adpcm_sample_rate_Hz);
+
+	//every sample in order
+	{
+		player.play(sample_YES_adpcm, n, sample_YES_adpcm_sample_rate_Hz, sample_YES_adpcm_block_bytes);
+		long n_bad = 0;
+		for (uint32_t i = 0; i < n; i++) if (player.getDataValue(i) != want[i]) n_bad++;
+		printf("getDataValue() in order                : %ld of %u samples wrong\n", n_bad, n);
+		check(n_bad == 0, "decodes every sample, across every block boundary");
+
+		//the samples either side of the first block boundaries, on their own
+		char what[100];
+		for (uint32_t i : { per_block - 2, per_block - 1, per_block, per_block + 1, 2*per_block - 1, 2*per_block }) {
+			const int16_t got = player.getDataValue(i);
+			printf("    sample %5u (block %u, sample %3u): %6d, expected %6d\n", i, i / per_block, i % per_block, got, want[i]);
+			snprintf(what, sizeof(what), "sample %u", i);
+			check(got == want[i], what);
+		}
+	}
+
+	//jumping around
+	{
+		player.play(sample_YES_adpcm, n, sample_YES_adpcm_sample_rate_Hz, sample_YES_adpcm_block_bytes);
+		const uint32_t jumps[] = { 0, 300, 200, 504, 505, 503, 506, 1009, 1010, 3*per_block + 17, 3*per_block + 16, per_block - 1, n - 1, n - 2, 0, 1 };
+		long n_bad = 0;
+		for (uint32_t i : jumps) if (player.getDataValue(i) != want[i]) n_bad++;
+		printf("getDataValue() jumping around          : %ld of %zu samples wrong\n", n_bad, sizeof(jumps)/sizeof(jumps[0]));
+		check(n_bad == 0, "decodes after jumping back and forward");
+	}
+
+	//played, at the sample's own rate and upsampled 2x
+	for (int upsample : { 1, 2 }) {
+		player.setSampleRate_Hz(upsample * sample_YES_adpcm_sample_rate_Hz);
+		player.play(sample_YES_adpcm, n, sample_YES_adpcm_sample_rate_Hz, sample_YES_adpcm_block_bytes);
+		long n_bad = 0;
+		for (uint32_t i = 0; i < upsample * n; i++) {
+			if (player.getNextAudioValue() != (float)want[i / upsample] * (1.0f/32768.0f)) n_bad++;
+		}
+		const bool playing_at_end = player.isPlaying();
+		player.getNextAudioValue();
+		printf("getNextAudioValue(), upsampled %dx      : %ld of %u samples wrong\n", upsample, n_bad, upsample * n);
+		check(n_bad == 0, "plays the decoded samples");
+		check(playing_at_end && !player.isPlaying(), "stops after the last sample");
+	}
+
+	printf("%s\n", (n_fail == 0) ? "PASS" : "FAIL");
+	return (n_fail == 0) ? 0 : 1;
+}
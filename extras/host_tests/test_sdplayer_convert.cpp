@@ -0,0 +1,139 @@
+/*
+ * test_sdplayer_convert
+ *
+ * Checks how AudioSDPlayer_F32 turns the WAV data in its read buffer into float32 audio
+ * (readBuffer_to_f32(), and the chunked, CMSIS-based convertToF32() under it).  The buffer is filled
+ * directly with a payload of 8, 16, 24 or 32-bit integers or 32-bit floats, with 1-8 channels, and read
+ * out 128 samples at a time.  Each payload starts at several places in the circular buffer, including ones
+ * where a sample frame straddles the end of the buffer (the split-frame path).
+ *
+ *   - Every sample must match the plain conversion: (x-128)/128 for 8 bits, x/(2^15-1) for 16 bits (the
+ *     scaling of AudioSDWriter_F32), x/(2^23-1) for 24 bits, x/2^31 for 32 bits, and floats unchanged.
+ *     Integers must be within 2 float32 ulp (the CMSIS conversion rounds twice), full scale must give exactly
+ *     1.0 for 16 and 24 bits, and floats must be bit-exact.
+ *   - All of the payload must be used, and nothing more.
+ *
+ * Build and run with "make check" in this directory.
+ */
+
+#include "AudioSDPlayer_F32.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <vector>
+
+//gives the test access to the read buffer
+class TestPlayer : public AudioSDPlayer_F32 {
+	public:
+		using AudioSDPlayer_F32::readBuffer_to_f32;
+		static uint32_t getBufferSize(void) { return N_BUFFER; }
+
+		//put the payload into the circular buffer, starting at start, as the current file's audio
+		void load(const std::vector<uint8_t> &payload, int n_chan, int n_bits, bool flag_float, uint32_t start) {
+			channels = n_chan; bits = n_bits; is_float = flag_float;
+			data_length = (uint32_t)payload.size();
+			for (size_t i = 0; i < payload.size(); i++) buffer[(start + i) % N_BUFFER] = payload[i];
+			buffer_read = start;
+			buffer_write = (uint32_t)((start + payload.size()) % N_BUFFER);
+		}
+		uint32_t getBufferRead(void) { return buffer_read; }
+		uint32_t getBufferWrite(void) { return buffer_write; }
+};
+
+//the plain conversion of the sample at p
+static float referenceSample(const uint8_t *p, int bits, bool is_float) {
+	switch (bits) {
+		case 8:  return ((float)p[0] - 128.0f) / 128.0f;
+		case 16: return (float)((int16_t)(p[0] | (p[1] << 8))) / 32767.0f;
+		case 24: return (float)(((int32_t)(((uint32_t)p[0] << 8) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 24))) >> 8) / 8388607.0f;
+		default: {
+			if (is_float) { float f; memcpy(&f, p, 4); return f; }
+			int32_t v; memcpy(&v, p, 4);
+			return (float)((double)v / 2147483648.0);
+		}
+	}
+}
+
+//a payload of n_frames frames: random bytes (integers), or random values within +/-1.5 (floats), with full scale at the start
+static std::vector<uint8_t> makePayload(int n_chan, int bits, bool is_float, uint32_t n_frames) {
+	const int bytes = bits / 8;
+	std::vector<uint8_t> payload((size_t)n_frames * n_chan * bytes);
+	for (size_t k = 0; k < payload.size() / bytes; k++) {
+		uint8_t *p = &payload[k * bytes];
+		if (is_float) {
+			const float f = 3.0f * ((float)rand() / (float)RAND_MAX) - 1.5f;
+			memcpy(p, &f, 4);
+		} else {
+			for (int b = 0; b < bytes; b++) p[b] = (uint8_t)rand();
+			if (k < (size_t)n_chan) {  //the most negative and most positive values
+				for (int b = 0; b < bytes; b++) p[b] = (k % 2) ? 0xFF : 0x00;
+				if (bits == 8) p[0] ^= 0x80;  //8-bit WAV is unsigned
+				p[bytes - 1] ^= (bits == 8) ? 0x00 : 0x80;
+			}
+		}
+	}
+	return payload;
+}
+
+//one case.  Returns the number of failures.
+static int testCase(TestPlayer &player, int n_chan, int bits, bool is_float, uint32_t start) {
+	const uint32_t n_frames = 1000;  //not a whole number of 128-sample blocks, nor of 32-frame chunks
+	const int bytes = bits / 8, frame_bytes = n_chan * bytes;
+	const std::vector<uint8_t> payload = makePayload(n_chan, bits, is_float, n_frames);
+	player.load(payload, n_chan, bits, is_float, start);
+
+	std::vector<std::vector<float>> out(n_chan, std::vector<float>(n_frames + 128, -99.0f));
+	uint32_t n_got = 0;
+	while (n_got < n_frames + 128) {
+		float32_t *ptrs[AUDIOSDPLAYER_MAX_CHAN];
+		for (int c = 0; c < n_chan; c++) ptrs[c] = out[c].data() + n_got;
+		const uint32_t n = player.readBuffer_to_f32(ptrs, 128);
+		if (n == 0) break;
+		n_got += n;
+	}
+
+	long n_bad = 0;
+	for (uint32_t i = 0; i < n_frames; i++) {
+		for (int c = 0; c < n_chan; c++) {
+			const float want = referenceSample(&payload[i*frame_bytes + c*bytes], bits, is_float);
+			const float got = out[c][i];
+			bool ok = is_float ? (memcmp(&got, &want, 4) == 0) : (fabsf(got - want) <= 2.0f * 1.2e-7f * fmaxf(fabsf(want), 1.0e-30f));
+			if (((bits == 16) || (bits == 24)) && (want >= 1.0f)) ok = ok && (got == 1.0f);  //full scale is exactly 1.0 (not 1.0 - 2^-23)
+			if (!ok) n_bad++;
+		}
+	}
+	const bool all_used = (n_got == n_frames) && (player.getNumberRemainingBytes() == 0) && (player.getBufferRead() == player.getBufferWrite());
+	if ((n_bad > 0) || !all_used) {
+		printf("    %d-bit%s, %d chan, starting %u bytes before the end of the buffer: %ld samples wrong, %u of %u frames read  <-- FAIL\n",
+			bits, is_float ? " float" : "", n_chan, TestPlayer::getBufferSize() - start, n_bad, n_got, n_frames);
+		return 1;
+	}
+	return 0;
+}
+
+int main(void) {
+	int n_fail = 0;
+	srand(7);
+	TestPlayer &player = *(new TestPlayer);  //never freed
+	struct Type { int bits; bool is_float; const char *name; };
+	const Type types[] = { { 8, false, "8-bit int" }, { 16, false, "16-bit int" }, { 24, false, "24-bit int" }, { 32, false, "32-bit int" }, { 32, true, "32-bit float" } };
+	const uint32_t N = TestPlayer::getBufferSize();
+	for (const Type &t : types) {
+		int n_cases = 0, n_fail_type = 0, n_split = 0;
+		for (int n_chan = 1; n_chan <= AUDIOSDPLAYER_MAX_CHAN; n_chan++) {
+			const uint32_t frame_bytes = n_chan * t.bits / 8;
+			//from the start of the buffer, then ending exactly at the end of a frame, and then with frames split 1 byte in and 1 byte short
+			for (uint32_t back : { N, 10*frame_bytes, 10*frame_bytes + 1, 10*frame_bytes - 1, 1u }) {
+				if ((back % frame_bytes) != 0) n_split++;
+				n_fail_type += testCase(player, n_chan, t.bits, t.is_float, N - back);
+				n_cases++;
+			}
+		}
+		printf("%-12s: %d of %d cases wrong (1-%d channels, %d with a frame split across the end of the buffer)%s\n",
+			t.name, n_fail_type, n_cases, AUDIOSDPLAYER_MAX_CHAN, n_split, (n_fail_type == 0) ? "" : "  <-- FAIL");
+		n_fail += n_fail_type;
+	}
+
+	printf("%s\n", (n_fail == 0) ? "PASS" : "FAIL");
+	return (n_fail == 0) ? 0 : 1;
+}
@@ -0,0 +1,217 @@
+/*
+ * test_sdplayer_playlist
+ *
+ * Plays WAV files from the in-memory card of stubs/SdFat.h through AudioSDPlayer_F32, calling update() as
+ * the audio interrupt would and serviceSD() between audio blocks as loop() would.  The files hold one
+ * continuous test signal, split between them, so the output must be that signal with no gap and no overlap.
+ *
+ *   - A queue of three files in different formats: 16-bit PCM with an odd-length chunk between "fmt " and
+ *     "data", 24-bit WAVE_FORMAT_EXTENSIBLE that is shorter than one audio block, and 32-bit float
+ *     WAVE_FORMAT_EXTENSIBLE with a "fact" chunk and junk after the audio.  They must play back-to-back,
+ *     switching files in the middle of audio blocks.
+ *   - seekSamples() in the middle of the first file, while the SD reading is still in that file, and again
+ *     after the read-ahead has moved on into the queued files (which must go back on the queue, and then
+ *     play after the first file as before).  Playback must carry on from exactly the sample asked for.
+ *   - A queued file with fewer channels starts with the next audio block, and plays mono on both outputs.
+ *
+ * Build and run with "make check" in this directory.
+ */
+
+#include "AudioSDPlayer_F32.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <vector>
+
+static int n_fail = 0;
+static bool check(bool ok, const char *what) { if (!ok) { printf("    %s  <-- FAIL\n", what); n_fail++; } return ok; }
+
+static const float fs_Hz = 96000.f;
+static const int block_samples = 128;
+
+//gives the test a look at how far the SD reading has got
+class TestPlayer : public AudioSDPlayer_F32 {
+	public:
+		TestPlayer(SdFs *sd, const AudioSettings_F32 &settings) : AudioSDPlayer_F32(sd, settings) {}
+		bool isReadingAhead(void) { return seg_read != seg_play; }  //is the SD reading in a later file than the one playing?
+};
+
+//collects one output of the player
+class TestSink : public AudioStream_F32 {
+	public:
+		TestSink(void) : AudioStream_F32(1, inputQueueArray) {}
+		void update(void) {}
+		int collect(float32_t *out) {
+			audio_block_f32_t *block = receiveReadOnly_f32();
+			if (block == NULL) return 0;
+			const int n = block->length;
+			for (int i = 0; i < n; i++) out[i] = block->data[i];
+			AudioStream_F32::release(block);
+			return n;
+		}
+	private:
+		audio_block_f32_t *inputQueueArray[1];
+};
+
+//the test signal, sample n of channel c
+static float sig(long n, int c) { return 0.5f * sinf(0.001f * (float)n * (float)(c + 1)) + 0.01f * (float)c; }
+
+enum Format { PCM16, EXT24, EXT_FLOAT };
+struct WavFile { const char *name; Format format; int nchan; long first, nframes; };  //holds sig(first ... first+nframes-1)
+
+//write a WAV file by hand, byte by byte
+static void writeWav(const WavFile &w) {
+	std::vector<uint8_t> f;
+	auto put = [&](uint32_t v, int n) { for (int i = 0; i < n; i++) f.push_back((uint8_t)(v >> (8*i))); };
+	auto tag = [&](const char *s) { for (int i = 0; i < 4; i++) f.push_back((uint8_t)s[i]); };
+	const int bits = (w.format == PCM16) ? 16 : ((w.format == EXT24) ? 24 : 32);
+	const int block_align = w.nchan * bits / 8;
+	tag("RIFF"); put(0, 4); tag("WAVE");
+	tag("fmt "); put((w.format == PCM16) ? 16 : 40, 4);
+	put((w.format == PCM16) ? 1 : 0xFFFE, 2); put(w.nchan, 2); put((uint32_t)fs_Hz, 4); put((uint32_t)fs_Hz * block_align, 4); put(block_align, 2); put(bits, 2);
+	if (w.format != PCM16) {
+		put(22, 2); put(bits, 2); put(0, 4);
+		put((w.format == EXT_FLOAT) ? 3 : 1, 4); put(0x00100000, 4); put(0xAA000080, 4); put(0x719B3800, 4);  //sub-format GUID
+	}
+	if (w.format == EXT_FLOAT) { tag("fact"); put(4, 4); put((uint32_t)w.nframes, 4); }
+	if (w.format != EXT_FLOAT) { tag("LIST"); put(13, 4); for (int i = 0; i < 14; i++) f.push_back('x'); }  //odd length, so padded
+	tag("data"); put((uint32_t)(w.nframes * block_align), 4);
+	for (long n = w.first; n < w.first + w.nframes; n++) {
+		for (int c = 0; c < w.nchan; c++) {
+			const float v = sig(n, c);
+			if (w.format == PCM16) { put((uint32_t)(int32_t)lroundf(v * 32767.0f), 2); }
+			else if (w.format == EXT24) { put((uint32_t)(int32_t)lround((double)v * 8388607.0), 3); }
+			else { uint32_t u; memcpy(&u, &v, 4); put(u, 4); }
+		}
+	}
+	if (w.format == EXT_FLOAT) { put(0xDEADBEEF, 4); }  //junk after the audio, which must not be played
+	const uint32_t riff_size = (uint32_t)f.size() - 8;
+	memcpy(&f[4], &riff_size, 4);
+	simDisk.files[w.name] = f;
+}
+
+//how close the played sample must be to the signal
+static float tolerance(Format format) {
+	if (format == PCM16) return 0.5f/32767.0f + 1.0e-7f;
+	if (format == EXT24) return 0.5f/8388607.0f + 2.5e-7f;
+	return 0.0f;  //float is played as written
+}
+
+//a player, with a sink on each of its first two outputs (connections cannot be undone, so these are never freed)
+struct Chain { TestPlayer &player; TestSink &sink0, &sink1; };
+static Chain newChain(void) {
+	Chain c = { *(new TestPlayer(new SdFs, AudioSettings_F32(fs_Hz, block_samples))), *(new TestSink), *(new TestSink) };
+	new AudioConnection_F32(c.player, 0, c.sink0, 0);
+	new AudioConnection_F32(c.player, 1, c.sink1, 0);
+	return c;
+}
+
+//play one audio block (with serviceSD() first, as from loop()) and compare it with the signal, from sample e.n onward.
+//e.n moves on by the number of samples that came from the files, which is returned.
+struct Expect { const std::vector<WavFile> *files; long n; long n_bad; float worst; };
+static int playBlock(Chain &c, Expect &e) {
+	c.player.serviceSD();
+	c.player.update();
+	float out[2][block_samples];
+	const int n0 = c.sink0.collect(out[0]), n1 = c.sink1.collect(out[1]);
+	if ((n0 != block_samples) || (n1 != block_samples)) { e.n_bad++; return 0; }
+
+	//which file, and how far into it, is sample e.n?
+	int n_audio = 0;
+	for (int i = 0; i < block_samples; i++) {
+		const WavFile *w = nullptr;
+		for (const WavFile &f : *e.files) if ((e.n >= f.first) && (e.n < f.first + f.nframes)) w = &f;
+		if (w == nullptr) {  //past the last file: silence
+			if ((out[0][i] != 0.0f) || (out[1][i] != 0.0f)) e.n_bad++;
+			continue;
+		}
+		if ((e.n == w->first) && (i > 0) && (w != &(*e.files)[0]) && (w->nchan != (w - 1)->nchan)) {
+			//a file with a different number of channels starts with the next block, after silence
+			if ((out[0][i] != 0.0f) || (out[1][i] != 0.0f)) e.n_bad++;
+			continue;
+		}
+		for (int ch = 0; ch < 2; ch++) {
+			const float want = sig(e.n, (w->nchan == 1) ? 0 : ch), err = fabsf(out[ch][i] - want);
+			if (!(err <= tolerance(w->format))) e.n_bad++;
+			if (err > e.worst) e.worst = err;
+		}
+		e.n++;
+		n_audio++;
+	}
+	return n_audio;
+}
+
+static void report(const char *what, const Expect &e, long n_end) {
+	printf("%-60s: ends at sample %6ld of %6ld, %ld samples wrong (worst error %.2e)\n", what, e.n, n_end, e.n_bad, e.worst);
+	check((e.n == n_end) && (e.n_bad == 0), "plays the signal with no gap and no overlap");
+}
+
+int main(void) {
+	AudioMemory_F32(16);
+
+	//three files in different formats, holding one continuous signal.  The first is bigger than the read buffer.
+	const std::vector<WavFile> files = {
+		{ "A.WAV", PCM16,     2, 0,      60001 },
+		{ "B.WAV", EXT24,     2, 60001,  77 },      //shorter than an audio block
+		{ "C.WAV", EXT_FLOAT, 2, 60078,  20000 },
+	};
+	for (const WavFile &w : files) writeWav(w);
+	const long n_end = files.back().first + files.back().nframes;
+
+	//play the queue straight through
+	{
+		Chain c = newChain();
+		check(c.player.play("A.WAV") && c.player.queue("B.WAV") && c.player.queue("C.WAV"), "play and queue");
+		check(c.player.getNumQueued() == 2, "two files queued");
+		Expect e = { &files, 0, 0, 0.0f };
+		for (int b = 0; (b < 2000) && c.player.isPlaying(); b++) playBlock(c, e);
+		report("queue of 16-bit PCM, 24-bit and float EXTENSIBLE", e, n_end);
+		check(!c.player.isPlaying() && (c.player.getNumQueued() == 0), "stops at the end of the queue");
+	}
+
+	//seek in the middle of the first file, while the SD reading is still in it
+	{
+		Chain c = newChain();
+		c.player.play("A.WAV"); c.player.queue("B.WAV"); c.player.queue("C.WAV");
+		Expect e = { &files, 0, 0, 0.0f };
+		for (int b = 0; b < 10; b++) playBlock(c, e);
+		check(!c.player.isReadingAhead(), "(the SD reading is still in the first file)");
+		check(c.player.seekSamples(31234) && (c.player.positionSamples() == 31234), "seekSamples() in the middle of the first file");
+		e.n = 31234;
+		for (int b = 0; (b < 2000) && c.player.isPlaying(); b++) playBlock(c, e);
+		report("seek to 31234, before the read-ahead reaches the next file", e, n_end);
+	}
+
+	//seek after the read-ahead has moved on into the queued files
+	{
+		Chain c = newChain();
+		c.player.play("A.WAV"); c.player.queue("B.WAV"); c.player.queue("C.WAV");
+		Expect e = { &files, 0, 0, 0.0f };
+		for (int b = 0; (b < 2000) && !c.player.isReadingAhead(); b++) playBlock(c, e);
+		const bool reading_ahead = c.player.isReadingAhead() && (e.n < files[0].nframes);
+		check(reading_ahead, "(the SD reading has moved on into the queued files)");
+		const long n_reached = e.n;
+		check(c.player.seekSamples(12345) && (c.player.positionSamples() == 12345) && (c.player.lengthSamples() == files[0].nframes),
+			"seekSamples() in the first file");
+		check(!c.player.isReadingAhead() && (c.player.getNumQueued() == 2), "the queued files go back on the queue");
+		e.n = 12345;
+		for (int b = 0; (b < 2000) && c.player.isPlaying(); b++) playBlock(c, e);
+		char what[100];
+		snprintf(what, sizeof(what), "seek to 12345, from %ld, after the read-ahead reached file 2", n_reached);
+		report(what, e, n_end);
+	}
+
+	//a mono file after a stereo one starts with the next block
+	{
+		const std::vector<WavFile> files2 = { { "S.WAV", PCM16, 2, 0, 1000 }, { "M.WAV", EXT24, 1, 1000, 3000 } };
+		for (const WavFile &w : files2) writeWav(w);
+		Chain c = newChain();
+		c.player.play("S.WAV"); c.player.queue("M.WAV");
+		Expect e = { &files2, 0, 0, 0.0f };
+		for (int b = 0; (b < 100) && c.player.isPlaying(); b++) playBlock(c, e);
+		report("stereo then mono (which starts with the next block)", e, 4000);
+	}
+
+	printf("%s\n", (n_fail == 0) ? "PASS" : "FAIL");
+	return (n_fail == 0) ? 0 : 1;
+}
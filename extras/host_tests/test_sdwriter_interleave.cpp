@@ -0,0 +1,120 @@
+/*
+ * test_sdwriter_interleave
+ *
+ * Checks BufferedSDWriter::interleaveToBuffer(), which converts the float32 audio of each channel and
+ * interleaves it into the write buffer, 32 sample frames at a time.  It is compared against a plain
+ * sample-by-sample interleave for INT16 (with and without dither), INT24 and FLOAT32, with 1-16 channels,
+ * for lengths that are and are not a whole number of 32-frame chunks (1, 31, 32, 33, 95, 128, 200 frames),
+ * and for audio and buffer positions that start part way in (as when a block wraps around the ring).
+ *
+ *   - Without dither, every byte must be the same as the reference.  With dither, each INT16 sample must
+ *     be within 2 LSB of the undithered value.
+ *   - Nothing in the buffer outside of the frames being written may change.
+ *
+ * Build and run with "make check" in this directory.
+ */
+
+#include "SDWriter.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <vector>
+
+//gives the test access to the buffer and to interleaveToBuffer()
+class TestWriter : public BufferedSDWriter {
+	public:
+		TestWriter(SdFs *sd) : BufferedSDWriter(sd) {}
+		using BufferedSDWriter::interleaveToBuffer;
+		uint8_t *getBuffer(void) { return write_buffer; }
+		int getBufferBytes(void) { return bufferLengthBytes; }
+};
+
+//the conversion of one sample, written out the long way
+static void referenceSample(float x, int nbits, uint8_t *dest) {
+	if (nbits == 16) {
+		const int16_t v = (int16_t)fmaxf(-32767.0f, fminf(32767.0f, x*32767.0f));
+		memcpy(dest, &v, 2);
+	} else if (nbits == 24) {
+		const int32_t v = (int32_t)fmaxf(-8388607.0f, fminf(8388607.0f, x*8388607.0f));
+		dest[0] = v & 0xFF; dest[1] = (v >> 8) & 0xFF; dest[2] = (v >> 16) & 0xFF;
+	} else {
+		memcpy(dest, &x, 4);
+	}
+}
+
+static const uint8_t guard = 0xA5;  //fills the buffer before each write, so that stray writes show up
+
+//one case.  Returns the number of failures.
+static int testCase(TestWriter &w, int nbits, bool dither, int nchan, int nframes, int start, int32_t ind) {
+	const int nbytes = nbits / 8;
+	std::vector<std::vector<float>> audio(nchan, std::vector<float>(start + nframes));
+	float32_t *ptrs[16];
+	for (int c = 0; c < nchan; c++) {
+		for (int i = 0; i < start + nframes; i++) {
+			//mostly in range, with some samples over full scale to check the saturation
+			audio[c][i] = 1.2f * sinf(0.37f * (float)i + 0.9f * (float)c) * (((i + c) % 7 == 0) ? 1.0f : 0.8f);
+		}
+		ptrs[c] = audio[c].data();
+	}
+
+	//the reference
+	const int buf_bytes = w.getBufferBytes();
+	std::vector<uint8_t> want(buf_bytes, guard);
+	for (int i = 0; i < nframes; i++) {
+		for (int c = 0; c < nchan; c++) referenceSample(audio[c][start + i], nbits, &want[(ind + i*nchan + c) * nbytes]);
+	}
+
+	//the library
+	uint8_t *buf = w.getBuffer();
+	memset(buf, guard, buf_bytes);
+	w.interleaveToBuffer(ptrs, start, nframes, nchan, ind);
+
+	int n_bad = 0, n_stray = 0;
+	const int first = ind * nbytes, last = (ind + nframes*nchan) * nbytes;  //the bytes that should be written
+	for (int k = 0; k < buf_bytes; k++) {
+		if ((k < first) || (k >= last)) { if (buf[k] != guard) n_stray++; }
+	}
+	if (dither) {
+		for (int k = first; k < last; k += 2) {
+			int16_t got, ref;
+			memcpy(&got, buf + k, 2); memcpy(&ref, &want[k], 2);
+			if (abs((int)got - (int)ref) > 2) n_bad++;
+		}
+	} else {
+		for (int k = first; k < last; k++) if (buf[k] != want[k]) n_bad++;
+	}
+	if ((n_bad > 0) || (n_stray > 0)) {
+		printf("    %d bits%s, %d chan, %d frames from %d into %d: %d wrong, %d stray bytes  <-- FAIL\n",
+			nbits, dither ? " (dither)" : "", nchan, nframes, start, (int)ind, n_bad, n_stray);
+		return 1;
+	}
+	return 0;
+}
+
+int main(void) {
+	int n_fail = 0;
+	TestWriter &w = *(new TestWriter(new SdFs));  //never freed
+	struct Type { int nbits; bool dither; const char *name; };
+	const Type types[] = { { 16, false, "INT16" }, { 16, true, "INT16 with dither" }, { 24, false, "INT24" }, { 32, false, "FLOAT32" } };
+	for (const Type &t : types) {
+		w.setDataTypeWAV(t.nbits, t.nbits == 32);
+		w.setDitheringMethod(t.dither ? 1 : 0);
+		w.allocateBuffer(64*1024);
+		int n_cases = 0, n_fail_type = 0;
+		for (int nchan = 1; nchan <= 16; nchan++) {
+			for (int nframes : { 1, 31, 32, 33, 95, 128, 200 }) {
+				for (int start : { 0, 5 }) {
+					for (int32_t ind : { 0, 7*nchan }) {
+						n_fail_type += testCase(w, t.nbits, t.dither, nchan, nframes, start, ind);
+						n_cases++;
+					}
+				}
+			}
+		}
+		printf("%-17s: %d of %d cases wrong (1-16 channels)%s\n", t.name, n_fail_type, n_cases, (n_fail_type == 0) ? "" : "  <-- FAIL");
+		n_fail += n_fail_type;
+	}
+
+	printf("%s\n", (n_fail == 0) ? "PASS" : "FAIL");
+	return (n_fail == 0) ? 0 : 1;
+}
@@ -0,0 +1,204 @@
+/*
+ * test_sdwriter_preallocated
+ *
+ * Checks the preallocated recording of BufferedSDWriter (setPreallocateSeconds() before openAsWAV()) on the
+ * in-memory card of stubs/SdFat.h.  The audio goes in a block at a time (copyToWriteBuffer(), as from the
+ * audio interrupt), and writeBufferedData() is called every so often (as from loop()).  It checks that:
+ *
+ *   - openAsWAV() preallocates the whole recording plus one sector, rounded up to whole sectors
+ *     (preallocateFile()), and writes a header that is exactly one sector long,
+ *   - every write made while recording (writeBufferedData_preallocated()) starts on a sector boundary of the
+ *     file and is a whole number of sectors, for INT16, INT24 and FLOAT32 data and for 1-6 channels
+ *     (including odd numbers of channels, whose sample frames do not fit evenly into a sector),
+ *   - when the ring buffer is full, whole blocks are dropped and counted (getNumDroppedBlocks()), the
+ *     blocks that were kept are in the file in order, and recording carries on once the ring has room again,
+ *   - close() writes what is left, truncates the file to what was recorded, and fixes up the header.  Without
+ *     preallocation, nothing is truncated.
+ *
+ * Build and run with "make check" in this directory.
+ */
+
+#include "SDWriter.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <vector>
+
+static int n_fail = 0;
+static void check(bool ok, const char *what) { if (!ok) { printf("    %s  <-- FAIL\n", what); n_fail++; } }
+
+static const int block_samples = 128;
+static const float fs_Hz = 44100.f;
+
+//a distinct, slowly-changing value for each channel and sample, well inside full scale
+static float testSample(int chan, long i) { return 0.7f * sinf(0.001f * (float)i * (float)(chan + 1) + (float)chan); }
+
+static uint32_t readU32(const std::vector<uint8_t> &d, size_t at) { return d[at] | (d[at+1] << 8) | (d[at+2] << 16) | ((uint32_t)d[at+3] << 24); }
+
+//the value of sample k of the data chunk, as written
+static float decodeSample(const std::vector<uint8_t> &d, size_t data_start, int nbits, long k) {
+	const uint8_t *p = d.data() + data_start + k*(nbits/8);
+	if (nbits == 16) return (int16_t)(p[0] | (p[1] << 8)) / 32767.0f;
+	if (nbits == 24) return (((int32_t)(((uint32_t)p[0] << 8) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 24))) >> 8) / 8388607.0f;
+	float f; memcpy(&f, p, 4); return f;
+}
+
+struct Recording { uint32_t n_dropped; long n_blocks_kept; size_t n_writes_recording; bool all_aligned; };
+
+//record n_blocks blocks, calling writeBufferedData() after every write_every blocks (or never, if zero).
+//kept[] says which blocks made it into the ring, and its length is also the index of the next block.
+static Recording record(BufferedSDWriter &w, int nchan, int n_blocks, int write_every, std::vector<bool> &kept) {
+	const long first_block = (long)kept.size();
+	Recording r = { 0, 0, 0, true };
+	std::vector<std::vector<float>> audio(nchan, std::vector<float>(block_samples));
+	float32_t *ptrs[8];
+	for (int b = 0; b < n_blocks; b++) {
+		for (int c = 0; c < nchan; c++) {
+			for (int i = 0; i < block_samples; i++) audio[c][i] = testSample(c, (first_block + b)*block_samples + i);
+			ptrs[c] = audio[c].data();
+		}
+		const uint32_t dropped_before = w.getNumDroppedBlocks();
+		w.copyToWriteBuffer(ptrs, block_samples, nchan);
+		kept.push_back(w.getNumDroppedBlocks() == dropped_before);
+		if ((write_every > 0) && (((b + 1) % write_every) == 0)) while (w.writeBufferedData() > 0) {}
+	}
+	r.n_writes_recording = simDisk.writes.size();
+	for (const SimWrite &wr : simDisk.writes) r.all_aligned = r.all_aligned && ((wr.pos % 512) == 0) && ((wr.nbytes % 512) == 0);
+	r.n_dropped = w.getNumDroppedBlocks();
+	for (bool k : kept) if (k) r.n_blocks_kept++;
+	return r;
+}
+
+//the data in the file must be the kept blocks, in order
+static void checkContents(const char *fname, int nchan, int nbits, const std::vector<bool> &kept, size_t header_bytes) {
+	const std::vector<uint8_t> &d = simDisk.files[fname];
+	long n_kept = 0;
+	for (bool k : kept) if (k) n_kept++;
+	const size_t data_bytes = (size_t)n_kept * block_samples * nchan * (nbits/8);
+	check(d.size() == header_bytes + data_bytes, "file is exactly the header plus the recorded audio");
+	check(readU32(d, header_bytes - 4) == data_bytes, "size of the data chunk in the header");
+	check(readU32(d, 4) == d.size() - 8, "size of the RIFF chunk in the header");
+	if (d.size() != header_bytes + data_bytes) return;
+
+	const float tol = (nbits == 16) ? 1.0f/32767.0f : ((nbits == 24) ? 1.0f/8388607.0f : 0.0f);
+	long n_bad = 0, k = 0;
+	for (size_t b = 0; b < kept.size(); b++) {
+		if (!kept[b]) continue;
+		for (int i = 0; i < block_samples; i++) {
+			for (int c = 0; c < nchan; c++, k++) {
+				if (!(fabsf(decodeSample(d, header_bytes, nbits, k) - testSample(c, (long)b*block_samples + i)) <= tol)) n_bad++;
+			}
+		}
+	}
+	if (n_bad > 0) printf("    %ld samples are wrong\n", n_bad);
+	check(n_bad == 0, "audio in the file");
+}
+
+static BufferedSDWriter &newWriter(SdFs &sd, int nchan, int nbits, float prealloc_sec, int buffer_bytes) {
+	BufferedSDWriter &w = *(new BufferedSDWriter(&sd));  //never freed
+	w.setNChanWAV(nchan);
+	w.setSampleRateWAV(fs_Hz);
+	w.setDataTypeWAV(nbits, nbits == 32);
+	w.setPreallocateSeconds(prealloc_sec);
+	w.allocateBuffer(buffer_bytes);
+	return w;
+}
+
+//record with a writer that keeps up, and check the alignment, preallocation, truncation and contents
+static void testAligned(int nchan, int nbits, float prealloc_sec) {
+	simDisk.reset();
+	SdFs sd;
+	BufferedSDWriter &w = newWriter(sd, nchan, nbits, prealloc_sec, 64*1024);
+	const char *fname = "AUDIO001.WAV";
+	w.openAsWAV(fname);
+	w.resetBuffer();  //as AudioSDWriter_F32 does, once the file is open
+	const size_t header_bytes = simDisk.writes.empty() ? 0 : simDisk.writes[0].nbytes;
+
+	std::vector<bool> kept;
+	const int n_blocks = (int)(0.5f * fs_Hz / block_samples);
+	const Recording r = record(w, nchan, n_blocks, 3, kept);
+	const int n_truncate_before = simDisk.n_truncate;
+	w.close();
+
+	const uint64_t want_prealloc = ((uint64_t)(prealloc_sec * fs_Hz * nchan) * (nbits/8) + 511) / 512 * 512 + 512;
+	printf("%s, %d chan, %-7s: %zu writes while recording, %s; %u blocks dropped; preallocated %llu bytes, truncated %d times\n",
+		(nbits == 16) ? "INT16  " : ((nbits == 24) ? "INT24  " : "FLOAT32"), nchan, (prealloc_sec > 0.0f) ? "prealloc" : "plain", r.n_writes_recording,
+		r.all_aligned ? "all sector-aligned" : ((prealloc_sec > 0.0f) ? "NOT all sector-aligned" : "not sector-aligned (not needed)"), r.n_dropped, (unsigned long long)simDisk.prealloc_bytes, simDisk.n_truncate);
+	if (prealloc_sec > 0.0f) {
+		check(w.getPreallocateSeconds() == prealloc_sec, "getPreallocateSeconds()");
+		check((simDisk.n_prealloc == 1) && (simDisk.prealloc_bytes == want_prealloc), "preallocated size");
+		check(header_bytes == 512, "the header is one whole sector");
+		check(r.all_aligned, "every write while recording is whole sectors, on a sector boundary");
+		check((n_truncate_before == 0) && (simDisk.n_truncate == 1), "truncated once, when closed");
+	} else {
+		check(simDisk.n_prealloc == 0, "not preallocated");
+		check(simDisk.n_truncate == 0, "not truncated");
+	}
+	check(r.n_dropped == 0, "no blocks dropped");
+	checkContents(fname, nchan, nbits, kept, header_bytes);
+}
+
+//fill a small ring without writing anything, so that blocks get dropped, and then let it drain
+static void testOverflow(int nchan, int nbits) {
+	simDisk.reset();
+	SdFs sd;
+	const int buffer_bytes = 16*1024;
+	BufferedSDWriter &w = newWriter(sd, nchan, nbits, 1.0f, buffer_bytes);
+	const char *fname = "AUDIO002.WAV";
+	w.openAsWAV(fname);
+	w.resetBuffer();
+	const size_t header_bytes = simDisk.writes.empty() ? 0 : simDisk.writes[0].nbytes;
+
+	//the ring holds a whole number of sectors and of frames, and always keeps one frame empty
+	const long ring = w.getLengthOfBuffer(), per_block = (long)nchan * block_samples;
+	const long fit = (ring - 1) / per_block;  //blocks that fit before the first drop
+	std::vector<bool> kept;
+	Recording r = record(w, nchan, (int)fit + 5, 0, kept);
+	check(r.n_writes_recording == 1, "nothing written while the ring fills");  //only the header
+	check((r.n_blocks_kept == fit) && (r.n_dropped == 5), "the blocks that do not fit are dropped and counted");
+	for (long b = 0; b < fit; b++) check(kept[b], "the first blocks are kept");
+
+	//empty the ring, and then keep up: every later block must be kept
+	while (w.writeBufferedData() > 0) {}
+	const Recording r2 = record(w, nchan, 40, 1, kept);
+	const long n_kept2 = r2.n_blocks_kept - r.n_blocks_kept;
+	check((n_kept2 == 40) && (r2.n_dropped == 5), "recording carries on once there is room");
+	check(r2.all_aligned, "every write while recording is whole sectors, on a sector boundary");
+	printf("%s, %d chan, overflow : ring of %ld samples holds %ld blocks; %u of %ld blocks dropped, then %ld of 40 kept\n",
+		(nbits == 16) ? "INT16  " : ((nbits == 24) ? "INT24  " : "FLOAT32"), nchan, ring, fit, r.n_dropped, fit + 5, n_kept2);
+	w.close();
+
+	//the file has the kept blocks, in order
+	checkContents(fname, nchan, nbits, kept, header_bytes);
+}
+
+int main(void) {
+	for (int nbits : { 16, 24, 32 }) {
+		for (int nchan : { 1, 2, 3, 6 }) testAligned(nchan, nbits, 2.0f);
+	}
+	testAligned(2, 16, 0.0f);
+	testAligned(3, 24, 0.0f);
+
+	for (int nbits : { 16, 24, 32 }) {
+		for (int nchan : { 2, 3 }) testOverflow(nchan, nbits);
+	}
+
+	//if the card cannot preallocate, it records anyway
+	simDisk.reset();
+	simDisk.fail_prealloc = true;
+	{
+		SdFs sd;
+		BufferedSDWriter &w = newWriter(sd, 2, 16, 10.0f, 32*1024);
+		w.openAsWAV("AUDIO003.WAV");
+		w.resetBuffer();
+		std::vector<bool> kept;
+		const Recording r = record(w, 2, 100, 2, kept);
+		w.close();
+		printf("preallocation fails: recorded anyway, %s\n", r.all_aligned ? "all sector-aligned" : "NOT all sector-aligned");
+		check(r.all_aligned, "every write while recording is whole sectors, on a sector boundary");
+		checkContents("AUDIO003.WAV", 2, 16, kept, 512);
+	}
+
+	printf("%s\n", (n_fail == 0) ? "PASS" : "FAIL");
+	return (n_fail == 0) ? 0 : 1;
+}
@@ -0,0 +1,164 @@
+/*
+ * test_sdwriter_wav_format
+ *
+ * Checks the WAV files written by BufferedSDWriter, byte by byte, on the in-memory card of stubs/SdFat.h.
+ *
+ *   - The header, for every data type (setDataTypeWAV()) with 1, 2 and 6 channels at two sample rates:
+ *       INT16:   the plain 44-byte PCM header
+ *       INT24:   68 bytes, WAVE_FORMAT_EXTENSIBLE (a 40-byte "fmt " chunk with the PCM sub-format GUID)
+ *       FLOAT32: 80 bytes, WAVE_FORMAT_EXTENSIBLE with the IEEE float sub-format GUID, and a "fact" chunk
+ *                giving the number of sample frames
+ *     and, for a preallocated file, the same header padded to 512 bytes with a "JUNK" chunk so that the
+ *     audio starts on a sector boundary.  The sizes in the RIFF, "data" and "fact" chunks must match the
+ *     audio that was recorded.
+ *   - How the samples are packed: INT16 and INT24 are scaled so that 1.0 is 2^15-1 and 2^23-1, saturated,
+ *     and truncated toward zero (INT24 is three bytes, little-endian), and FLOAT32 is stored as it is.
+ *
+ * Build and run with "make check" in this directory.
+ */
+
+#include "SDWriter.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <vector>
+
+static int n_fail = 0;
+static bool check(bool ok, const char *what) { if (!ok) { printf("    %s  <-- FAIL\n", what); n_fail++; } return ok; }
+
+static const int block_samples = 128;
+
+//the sub-format GUIDs, KSDATAFORMAT_SUBTYPE_PCM (00000001-0000-0010-8000-00aa00389b71) and KSDATAFORMAT_SUBTYPE_IEEE_FLOAT (00000003-...)
+static const uint8_t guid_pcm[16] =   { 0x01,0x00,0x00,0x00, 0x00,0x00, 0x10,0x00, 0x80,0x00, 0x00,0xaa,0x00,0x38,0x9b,0x71 };
+static const uint8_t guid_float[16] = { 0x03,0x00,0x00,0x00, 0x00,0x00, 0x10,0x00, 0x80,0x00, 0x00,0xaa,0x00,0x38,0x9b,0x71 };
+
+static uint32_t u32(const std::vector<uint8_t> &d, size_t at) { return d[at] | (d[at+1] << 8) | (d[at+2] << 16) | ((uint32_t)d[at+3] << 24); }
+static uint32_t u16(const std::vector<uint8_t> &d, size_t at) { return d[at] | (d[at+1] << 8); }
+static bool tag(const std::vector<uint8_t> &d, size_t at, const char *s) { return memcmp(d.data() + at, s, 4) == 0; }
+
+//record n_blocks of audio (each channel filled by fill()) and return the file
+static const std::vector<uint8_t> &recordFile(const char *fname, int nchan, int nbits, float fs_Hz, float prealloc_sec, int n_blocks,
+		float (*fill)(int chan, long i)) {
+	BufferedSDWriter &w = *(new BufferedSDWriter(new SdFs));  //never freed
+	w.setNChanWAV(nchan);
+	w.setSampleRateWAV(fs_Hz);
+	w.setDataTypeWAV(nbits, nbits == 32);
+	w.setPreallocateSeconds(prealloc_sec);
+	w.allocateBuffer(64*1024);
+	w.openAsWAV(fname);
+	w.resetBuffer();  //as AudioSDWriter_F32 does, once the file is open
+	std::vector<std::vector<float>> audio(nchan, std::vector<float>(block_samples));
+	float32_t *ptrs[16];
+	for (int b = 0; b < n_blocks; b++) {
+		for (int c = 0; c < nchan; c++) {
+			for (int i = 0; i < block_samples; i++) audio[c][i] = fill(c, (long)b*block_samples + i);
+			ptrs[c] = audio[c].data();
+		}
+		w.copyToWriteBuffer(ptrs, block_samples, nchan);
+		w.writeBufferedData();
+	}
+	w.close();
+	return simDisk.files[fname];
+}
+
+static float fillSine(int chan, long i) { return 0.5f * sinf(0.01f * (float)i + (float)chan); }
+
+static void testHeader(int nchan, int nbits, float fs_Hz, bool prealloc) {
+	simDisk.reset();
+	const int n_blocks = 7;
+	const std::vector<uint8_t> &d = recordFile("AUDIO001.WAV", nchan, nbits, fs_Hz, prealloc ? 1.0f : 0.0f, n_blocks, fillSine);
+	const bool is_float = (nbits == 32), is_ext = (nbits != 16);
+	const size_t min_header = is_float ? 80 : (is_ext ? 68 : 44);
+	const size_t header = prealloc ? 512 : min_header;
+	const uint32_t bytes_per_frame = nchan * (nbits/8), data_bytes = n_blocks * block_samples * bytes_per_frame;
+	printf("%s, %d chan, %6.0f Hz, %-8s: %zu-byte file, %zu-byte header\n", (nbits == 16) ? "INT16  " : ((nbits == 24) ? "INT24  " : "FLOAT32"),
+		nchan, fs_Hz, prealloc ? "prealloc" : "plain", d.size(), header);
+	if (!check(d.size() == header + data_bytes, "file is the header plus the audio")) return;
+
+	check(tag(d, 0, "RIFF") && (u32(d, 4) == d.size() - 8) && tag(d, 8, "WAVE"), "RIFF chunk");
+	check(tag(d, 12, "fmt ") && (u32(d, 16) == (is_ext ? 40u : 16u)), "fmt chunk and its size");
+	check(u16(d, 20) == (is_ext ? 0xFFFEu : 1u), "format tag (1 = PCM, 0xFFFE = WAVE_FORMAT_EXTENSIBLE)");
+	check((u16(d, 22) == (uint32_t)nchan) && (u32(d, 24) == (uint32_t)fs_Hz), "channels and sample rate");
+	check((u32(d, 28) == (uint32_t)fs_Hz * bytes_per_frame) && (u16(d, 32) == bytes_per_frame) && (u16(d, 34) == (uint32_t)nbits),
+		"byte rate, block align, and bits per sample");
+	size_t ind = 36;  //where the chunk after "fmt " starts
+	if (is_ext) {
+		const uint32_t mask = (nchan == 1) ? 0x4 : ((nchan == 2) ? 0x3 : 0);
+		check((u16(d, 36) == 22) && (u16(d, 38) == (uint32_t)nbits) && (u32(d, 40) == mask), "extension size, valid bits, and channel mask");
+		check(memcmp(d.data() + 44, is_float ? guid_float : guid_pcm, 16) == 0, "sub-format GUID");
+		ind = 60;
+		if (is_float) {
+			check(tag(d, 60, "fact") && (u32(d, 64) == 4) && (u32(d, 68) == (uint32_t)n_blocks * block_samples), "fact chunk, with the number of frames");
+			ind = 72;
+		}
+	}
+	if (prealloc) {
+		const size_t junk_bytes = header - 8 - ind - 8;
+		bool zeros = true;
+		for (size_t k = ind + 8; k < header - 8; k++) zeros = zeros && (d[k] == 0);
+		check(tag(d, ind, "JUNK") && (u32(d, ind + 4) == junk_bytes) && zeros, "JUNK chunk pads the header to one sector");
+	} else {
+		check(ind + 8 == header, "no padding");
+	}
+	check(tag(d, header - 8, "data") && (u32(d, header - 4) == data_bytes), "data chunk and its size");
+}
+
+//values to pack, and what each must become
+struct PackCase { float x; int32_t int16, int24; };
+static const PackCase pack_cases[] = {
+	{  0.0f,         0,        0 },
+	{  1.0f,     32767,  8388607 },
+	{ -1.0f,    -32767, -8388607 },
+	{  1.5f,     32767,  8388607 },  //saturated
+	{ -2.0f,    -32767, -8388607 },
+	{  0.5f,     16383,  4194303 },  //x*(2^n-1) = 16383.5 and 4194303.5: truncated toward zero
+	{ -0.5f,    -16383, -4194303 },
+	{  0.25f,     8191,  2097151 },
+	{  1.0e-7f,      0,        0 },  //0.84 of an int24 step
+	{ -1.0e-7f,      0,        0 },
+	{  3.0e-7f,      0,        2 },  //2.5 steps
+	{ -3.0e-7f,      0,       -2 },
+	{ -0.0001f,     -3,     -838 },  //-3.28 and -838.86
+};
+static const int n_pack_cases = sizeof(pack_cases) / sizeof(pack_cases[0]);
+static float fillPack(int chan, long i) { return pack_cases[(i + chan) % n_pack_cases].x; }
+
+static void testPacking(int nbits, int nchan) {
+	simDisk.reset();
+	const std::vector<uint8_t> &d = recordFile("AUDIO002.WAV", nchan, nbits, 48000.f, 0.0f, 2, fillPack);
+	const size_t header = (nbits == 32) ? 80 : ((nbits == 24) ? 68 : 44);
+	const long n = 2L * block_samples * nchan;
+	if (!check(d.size() == header + n*(nbits/8), "file is the header plus the audio")) return;
+	long n_bad = 0;
+	for (long k = 0; k < n; k++) {
+		const PackCase &pc = pack_cases[(k / nchan + k % nchan) % n_pack_cases];
+		const uint8_t *p = d.data() + header + k*(nbits/8);
+		bool ok;
+		if (nbits == 16) {
+			ok = ((int16_t)(p[0] | (p[1] << 8))) == pc.int16;
+		} else if (nbits == 24) {
+			ok = (((int32_t)(((uint32_t)p[0] << 8) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 24))) >> 8) == pc.int24;
+		} else {
+			ok = memcmp(p, &pc.x, 4) == 0;  //bit-exact
+		}
+		if (!ok) n_bad++;
+	}
+	printf("%s packing, %d chan: %ld of %ld samples wrong\n", (nbits == 16) ? "INT16  " : ((nbits == 24) ? "INT24  " : "FLOAT32"), nchan, n_bad, n);
+	check(n_bad == 0, "packed samples");
+}
+
+int main(void) {
+	for (int nbits : { 16, 24, 32 }) {
+		for (int nchan : { 1, 2, 6 }) {
+			for (float fs_Hz : { 44100.f, 96000.f }) {
+				for (bool prealloc : { false, true }) testHeader(nchan, nbits, fs_Hz, prealloc);
+			}
+		}
+	}
+	for (int nbits : { 16, 24, 32 }) {
+		for (int nchan : { 1, 3 }) testPacking(nbits, nchan);
+	}
+
+	printf("%s\n", (n_fail == 0) ? "PASS" : "FAIL");
+	return (n_fail == 0) ? 0 : 1;
+}
@@ -0,0 +1,86 @@
+/*
+ * test_wdrc_fast_gain
+ *
+ * Compares the fast, table-driven WDRC gain (AudioCalcGainWDRC_F32 with setUseFastGain(true)) with the
+ * original per-sample path (db2(), which uses log2f_approx, and then undb2(), which uses expf), over the
+ * whole envelope range, for a set of fittings that put the knees in different places.  It asserts the accuracy stated in AudioCalcGainWDRC_F32.h:
+ *
+ *   fastLog2 is within 6.6e-4, fastExp2 is within 1.11e-4 (relative), and so the gain is within
+ *   (0.0040 * |slope| + 0.0010) dB of the original path, where slope is the slope of the gain curve in
+ *   the log domain (at most 1 when all of the compression ratios are 1 or more).
+ *
+ * Build and run with "make check" in this directory.
+ */
+
+#include "AudioCalcGainWDRC_F32.h"
+#include <stdio.h>
+#include <math.h>
+
+static const double float_margin_dB = 0.0002;  //allowance for the float rounding of the original path itself
+
+struct Fitting { const char *name; float maxdB, exp_cr, exp_end_knee, tkgain, cr, tk, bolt; };
+static const Fitting fittings[] = {
+	//name                             maxdB  exp_cr exp_knee tkgain  cr    tk     bolt
+	{ "linear (library default)",      119.f, 1.0f,   0.0f,   0.0f,  10.0f, 105.f, 105.f },
+	{ "mild compression",              115.f, 1.0f,   0.0f,  20.0f,  1.5f,  50.f,  90.f },
+	{ "strong compression, low knee",  110.f, 1.0f,   0.0f,  30.0f,  3.0f,  40.f, 100.f },
+	{ "expansion below 30 dB SPL",     115.f, 0.57f, 30.0f,  20.0f,  1.5f,  50.f,  90.f },
+	{ "steep expansion",               115.f, 0.3f,  45.0f,  25.0f,  2.0f,  55.f, 100.f },
+	{ "expansion ratio above one",     110.f, 1.5f,  30.0f,  10.0f,  3.0f,  40.f, 100.f },
+	{ "compression ratio below one",   119.f, 0.8f,  30.0f,  60.0f,  0.8f,  50.f,  95.f },
+	{ "knee above the limiter",        100.f, 1.0f,   5.0f,   2.0f,  2.0f,  70.f,  60.f },
+};
+
+int main(void) {
+	int n_fail = 0;
+
+	//the building blocks
+	double max_log2_err = 0.0, max_exp2_rel_err = 0.0;
+	for (double e = -40.0; e <= 10.0; e += 1.0e-4) {
+		const float x = (float)pow(2.0, e);
+		max_log2_err = fmax(max_log2_err, fabs(AudioCalcGainWDRC_F32::fastLog2(x) - log2((double)x)));
+		const float y = (float)e;
+		max_exp2_rel_err = fmax(max_exp2_rel_err, fabs(AudioCalcGainWDRC_F32::fastExp2(y) / pow(2.0, (double)y) - 1.0));
+	}
+	printf("fastLog2: max error %.2e (limit 6.6e-4).  fastExp2: max relative error %.2e (limit 1.11e-4)\n", max_log2_err, max_exp2_rel_err);
+	if (max_log2_err > 6.6e-4) { printf("FAIL: fastLog2\n"); n_fail++; }
+	if (max_exp2_rel_err > 1.11e-4) { printf("FAIL: fastExp2\n"); n_fail++; }
+
+	//the gain, for each fitting, with the envelope swept from -130 dBFS to +6 dBFS in 0.005 dB steps
+	const int N = 27200;
+	static float env[N], gain_ref[N], gain_fast[N];
+	for (int i = 0; i < N; i++) env[i] = (float)pow(10.0, (-130.0 + 0.005 * i) / 20.0);
+
+	AudioCalcGainWDRC_F32 calc;
+	for (const Fitting &f : fittings) {
+		calc.setParams(f.maxdB, f.exp_cr, f.exp_end_knee, f.tkgain, f.cr, f.tk, f.bolt);
+
+		calc.setUseFastGain(false); calc.calcGainFromEnvelope(env, gain_ref, N);
+		calc.setUseFastGain(true);  calc.calcGainFromEnvelope(env, gain_fast, N);
+
+		float start[4], offset[4], slope[4];
+		const int n_seg = calc.getGainTable(start, offset, slope);
+		double max_slope = 0.0;
+		for (int i = 0; i < n_seg; i++) max_slope = fmax(max_slope, fabs(slope[i]));
+		const double limit_dB = 0.0040 * max_slope + 0.0010 + float_margin_dB;
+
+		double max_err_dB = 0.0, worst_env_dB = 0.0;
+		for (int i = 0; i < N; i++) {
+			const double err_dB = fabs(20.0 * log10((double)gain_fast[i] / (double)gain_ref[i]));
+			if (!(err_dB <= max_err_dB)) { max_err_dB = err_dB; worst_env_dB = 20.0 * log10((double)env[i]); }  //also catches NaN
+		}
+		const bool ok = (max_err_dB <= limit_dB);
+		printf("%-30s: %d segments, max |slope| %.2f, max error %.4f dB at %6.1f dBFS (limit %.4f dB) %s\n",
+			f.name, n_seg, max_slope, max_err_dB, worst_env_dB, limit_dB, ok ? "" : "<-- FAIL");
+		if (!ok) n_fail++;
+		if ((max_slope <= 1.0) && (max_err_dB > 0.0050 + float_margin_dB)) { printf("FAIL: above 0.005 dB with |slope| <= 1\n"); n_fail++; }
+	}
+
+	//a silent envelope must still give a finite gain
+	float zero = 0.0f, g = 0.0f;
+	calc.calcGainFromEnvelope_fast(&zero, &g, 1);
+	if (!isfinite(g)) { printf("FAIL: gain for a zero envelope is %g\n", g); n_fail++; }
+
+	printf("%s\n", (n_fail == 0) ? "PASS" : "FAIL");
+	return (n_fail == 0) ? 0 : 1;
+}
@@ -0,0 +1,139 @@
+/*
+ * AudioAsyncBridge_F32
+ *
+ * Created: OpenAudio, Oct 2026
+ *
+ * MIT License.  Use at your own risk.  Have fun!
+ *
+ */
+
+#include "AudioAsyncBridge_F32.h"
+
+bool AudioAsyncBridge_F32::begin(float _in_rate_Hz, float _out_rate_Hz, int _n_chan, int _target_fill, int _ring_frames) {
+	is_begun = false;
+	if ((_in_rate_Hz <= 0.0f) || (_out_rate_Hz <= 0.0f) || (_n_chan < 1) || (_n_chan > ASYNCBRIDGE_MAX_CHAN)) {
+		Serial.println("AudioAsyncBridge_F32: begin: *** ERROR *** invalid sample rates or number of channels (" + String(_n_chan) + ")");
+		return false;
+	}
+
+	//the ring must be a power of two and must have room for the target fill plus a burst from the producer
+	uint32_t len = 16;
+	while ((len < (uint32_t)_ring_frames) || (len < (uint32_t)(2*_target_fill))) len <<= 1;
+	ring_frames = len; ring_mask = len - 1;
+	n_chan = _n_chan;
+	ring.assign(ring_frames*n_chan, 0.0f);
+	if (ring.size() == 0) {
+		Serial.println("AudioAsyncBridge_F32: begin: *** ERROR *** could not allocate memory.");
+		return false;
+	}
+
+	in_rate_Hz = _in_rate_Hz; out_rate_Hz = _out_rate_Hz;
+	nominal_ratio = out_rate_Hz / in_rate_Hz;
+	target_fill = max(1, _target_fill);
+	for (int Ichan=0; Ichan < n_chan; Ichan++) {
+		converter[Ichan].set_startSampleRate_Hz(in_rate_Hz);
+		if (!converter[Ichan].beginArbitrary(nominal_ratio)) return false;
+		converter[Ichan].enable(false);  //we drive it directly, so do not let its own update() touch its FIFO
+	}
+
+	integrator = 0.0f;
+	reset();
+	is_begun = true;
+	return true;
+}
+
+void AudioAsyncBridge_F32::reset(void) {
+	read_ind = write_ind;
+	is_primed = false;
+	fill_avg = 0.0f;
+	for (int Ichan=0; Ichan < n_chan; Ichan++) converter[Ichan].resetState();
+	cur_ratio = nominal_ratio * (1.0f - integrator);
+	for (int Ichan=0; Ichan < n_chan; Ichan++) converter[Ichan].setRatio(cur_ratio);
+}
+
+//producer side.  Only write_ind is changed here, and only after the samples are in place.
+int AudioAsyncBridge_F32::write(float32_t *in[], int n) {
+	if (!is_begun) return 0;
+	const uint32_t w = write_ind;
+	const uint32_t n_space = ring_frames - (w - read_ind);
+	int n_write = n;
+	if ((uint32_t)n_write > n_space) { n_write = n_space; n_overruns++; }  //full: drop the newest samples
+
+	for (int i=0; i < n_write; i++) {
+		float32_t *frame = &(ring[((w + i) & ring_mask)*n_chan]);
+		for (int Ichan=0; Ichan < n_chan; Ichan++) frame[Ichan] = in[Ichan][i];
+	}
+	__sync_synchronize();  //the samples must be in the ring before the consumer can see the new index
+	write_ind = w + n_write;
+	return n_write;
+}
+
+//consumer side.  Only read_ind is changed here, and only after the samples have been taken out.
+int AudioAsyncBridge_F32::read(float32_t *out[], int n, float n_in_flight) {
+	if (!is_begun) {
+		for (int Ichan=0; Ichan < n_chan; Ichan++) memset(out[Ichan], 0, n*sizeof(float32_t));
+		return 0;
+	}
+
+	//wait until there is enough audio in the ring before starting (or restarting after an underrun)
+	if (!is_primed) {
+		const uint32_t count = getRingCount();
+		if (count < (uint32_t)target_fill) {
+			for (int Ichan=0; Ichan < n_chan; Ichan++) memset(out[Ichan], 0, n*sizeof(float32_t));
+			return 0;
+		}
+		is_primed = true;
+		fill_avg = ((float)count) + n_in_flight;
+	}
+
+	//feed the resamplers one input sample at a time until they have enough output.  All of the channels
+	//use the same ratio, so they always produce the same number of samples.
+	uint32_t r = read_ind;
+	const uint32_t w = write_ind;
+	__sync_synchronize();  //do not read the samples until after reading the producer's index
+	int n_avail = converter[0].getNumSamplesAvailable();
+	while ((n_avail < n) && (r != w)) {
+		const float32_t *frame = &(ring[(r & ring_mask)*n_chan]);
+		n_avail += converter[0].processSamples(&(frame[0]), 1);
+		for (int Ichan=1; Ichan < n_chan; Ichan++) converter[Ichan].processSamples(&(frame[Ichan]), 1);
+		r++;
+	}
+	__sync_synchronize();  //finish reading the samples before giving their space back to the producer
+	read_ind = r;
+
+	int n_read = 0;
+	for (int Ichan=0; Ichan < n_chan; Ichan++) {
+		n_read = converter[Ichan].readSamples(out[Ichan], n);
+		if (n_read < n) memset(&(out[Ichan][n_read]), 0, (n - n_read)*sizeof(float32_t));
+	}
+	if (n_read < n) {
+		//ran dry.  Start again from silence once the ring has refilled
+		n_underruns++;
+		is_primed = false;
+		return n_read;
+	}
+
+	updateControl(n, n_in_flight);
+	return n_read;
+}
+
+//The PI controller.  The error is the (smoothed) fill of the ring relative to its target, expressed in seconds
+//of audio.  A positive error means that the producer is running fast, so the resampler needs to consume the
+//input a little faster (ie, a slightly smaller out/in ratio).
+void AudioAsyncBridge_F32::updateControl(int n_out, float n_in_flight) {
+	const float dt_sec = ((float)n_out) / out_rate_Hz;
+	const float alpha = min(1.0f, dt_sec / fill_smooth_sec);
+	fill_avg += alpha * (((float)getRingCount()) + n_in_flight - fill_avg);
+	const float err_sec = (fill_avg - (float)target_fill) / in_rate_Hz;
+
+	const float max_corr = max_correction_ppm * 1.0e-6f;
+	integrator += Ki * err_sec * dt_sec;
+	integrator = max(-max_corr, min(max_corr, integrator));
+	float corr = integrator + Kp * err_sec;
+	corr = max(-max_corr, min(max_corr, corr));
+
+	cur_ratio = nominal_ratio * (1.0f - corr);
+	for (int Ichan=0; Ichan < n_chan; Ichan++) converter[Ichan].setRatio(cur_ratio);
+	drift_ppm = integrator * 1.0e6f;
+	correction_ppm = corr * 1.0e6f;
+}
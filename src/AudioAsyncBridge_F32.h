@@ -0,0 +1,113 @@
+/*
+ * AudioAsyncBridge_F32
+ *
+ * Created: OpenAudio, Oct 2026
+ *
+ * Purpose: Carry audio between two parts of a system that run from different clocks (such as the Tympan's
+ *    audio codec and a USB host) without the buffer between them slowly filling up or running dry.  Even
+ *    when both sides are nominally at the same sample rate, their crystals differ by tens or hundreds of
+ *    ppm, so over a long session a plain buffer will eventually overrun or underrun, which is heard as a click.
+ *
+ *    The producer side calls write() at its own pace and the consumer side calls read() at its own pace.
+ *    In between is a ring buffer followed by an arbitrary-ratio resampler (AudioRateConverter_F32).  Each
+ *    time the consumer reads, a PI controller looks at how full the ring is and trims the resampling ratio
+ *    to keep the ring at its target fill.  Once it has settled, the resampler is running at exactly the
+ *    ratio of the two clocks, and the integral term of the controller is a measurement of the drift between
+ *    them (see getDriftPPM()).
+ *
+ *    The ring is lock-free for one producer and one consumer: write() only ever moves the write index and
+ *    read() only ever moves the read index, so the two sides can run in different interrupts.  All of the
+ *    resampling and control happens on the consumer side.
+ *
+ * MIT License.  Use at your own risk.  Have fun!
+ *
+ */
+
+#ifndef _AudioAsyncBridge_F32_h
+#define _AudioAsyncBridge_F32_h
+
+#include <Arduino.h>
+#include "AudioRateConverter_F32.h"
+#include <vector>
+
+#define ASYNCBRIDGE_MAX_CHAN              2     //number of channels carried by one bridge
+#define ASYNCBRIDGE_DEFAULT_RING_FRAMES   1024  //length of the ring buffer, in samples per channel (a power of two)
+#define ASYNCBRIDGE_DEFAULT_MAX_PPM       2000.0f  //limit on the correction applied by the controller
+
+class AudioAsyncBridge_F32 {
+	public:
+		AudioAsyncBridge_F32(void) {}
+
+		//in_rate_Hz and out_rate_Hz are the nominal sample rates of the producer and the consumer.  target_fill is the
+		//number of (producer-rate) samples to keep in the ring.  It needs to cover the largest burst from either side
+		//(such as one block from each side).  Returns true if successful.
+		bool begin(float in_rate_Hz, float out_rate_Hz, int n_chan = 2, int target_fill = 2*AUDIO_BLOCK_SAMPLES, int ring_frames = ASYNCBRIDGE_DEFAULT_RING_FRAMES);
+		bool isBegun(void) { return is_begun; }
+
+		//producer side: write n samples for each channel.  Returns the number written (fewer if the ring was full).
+		int write(float32_t *in[], int n);
+
+		//consumer side: read exactly n samples for each channel.  Until the ring first reaches its target fill (and after
+		//any underrun), this gives silence.  Returns the number of real (non-silent) samples.
+		//
+		//If either side moves audio in bursts, the fill seen at the moment of each read() jumps around by up to a burst.
+		//If you know how many (producer-rate) samples are "in flight" (made by the producer's clock but not yet written,
+		//or, if negative, already used up by the consumer's clock but not yet read), pass them as n_in_flight so that
+		//the controller sees the true fill.  Without it, the audio is still clean, but the drift telemetry is rougher.
+		int read(float32_t *out[], int n, float n_in_flight = 0.0f);
+
+		//telemetry.  These are safe to call from loop().
+		float getDriftPPM(void) { return drift_ppm; }     //how much faster the producer's clock runs than nominal, relative to the consumer's clock
+		float getCorrectionPPM(void) { return correction_ppm; }  //the correction being applied right now (the drift plus the proportional term)
+		float getRatio(void) { return cur_ratio; }        //the resampling ratio in use (out/in)
+		float getFill(void) { return fill_avg; }          //smoothed fill of the ring, in producer-rate samples
+		int getTargetFill(void) { return target_fill; }
+		bool isLocked(void) { return is_primed; }         //is audio flowing (ie, primed and not underrun)?
+		unsigned long getNumUnderruns(void) { return n_underruns; }   //times the consumer found the ring empty
+		unsigned long getNumOverruns(void) { return n_overruns; }     //times the producer found the ring full
+		void resetCounters(void) { n_underruns = 0; n_overruns = 0; }
+
+		//tuning of the PI controller.  Kp is in 1/sec (applied to the fill error expressed in seconds), Ki is in 1/sec^2.
+		//The defaults settle in a few seconds, which is slow enough that the resampler's ratio changes inaudibly.
+		void setLoopGains(float _Kp, float _Ki) { Kp = max(0.0f, _Kp); Ki = max(0.0f, _Ki); }
+		float getKp(void) { return Kp; }
+		float getKi(void) { return Ki; }
+		float setMaxCorrectionPPM(float ppm) { return max_correction_ppm = max(1.0f, ppm); }
+		float getMaxCorrectionPPM(void) { return max_correction_ppm; }
+
+		//empty the ring and restart the controller (keeping its drift estimate).  Only call when neither side is running.
+		void reset(void);
+
+	protected:
+		bool is_begun = false;
+		int n_chan = 2;
+		float in_rate_Hz = AUDIO_SAMPLE_RATE_EXACT, out_rate_Hz = AUDIO_SAMPLE_RATE_EXACT;
+		float nominal_ratio = 1.0f;
+
+		//the ring of interleaved samples.  The indices run freely (they are only wrapped when used) so that
+		//(write_ind - read_ind) is always the number of frames in the ring, even when it is completely full.
+		std::vector<float32_t> ring;
+		uint32_t ring_frames = 0, ring_mask = 0;
+		volatile uint32_t write_ind = 0;  //only changed by the producer
+		volatile uint32_t read_ind = 0;   //only changed by the consumer
+		uint32_t getRingCount(void) { return write_ind - read_ind; }
+
+		//the resamplers (one per channel, all run in step with each other).  Driven directly, not via update().
+		AudioRateConverter_F32 converter[ASYNCBRIDGE_MAX_CHAN];
+
+		//the controller
+		int target_fill = 2*AUDIO_BLOCK_SAMPLES;
+		bool is_primed = false;
+		float Kp = 1.0f, Ki = 0.25f;      //Ki = Kp^2/4 gives a critically-damped loop
+		float fill_smooth_sec = 0.1f;     //time constant for smoothing the measured fill
+		float max_correction_ppm = ASYNCBRIDGE_DEFAULT_MAX_PPM;
+		float fill_avg = 0.0f;
+		float integrator = 0.0f;          //fractional frequency correction from the integral term (this is the drift estimate)
+		void updateControl(int n_out, float n_in_flight);
+
+		//telemetry written by the consumer side
+		volatile float drift_ppm = 0.0f, correction_ppm = 0.0f, cur_ratio = 1.0f;
+		volatile unsigned long n_underruns = 0, n_overruns = 0;
+};
+
+#endif
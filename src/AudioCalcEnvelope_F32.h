@@ -133,6 +133,9 @@ class AudioCalcEnvelope_F32 : public AudioStream_F32
 	
 	void resetStates(void) { state_ppk = 1.0; }
 	float getCurrentLevel(void) { return state_ppk; } 
+	void setCurrentLevel(float val) { state_ppk = val; }  //for code (like a compressor bank) that runs smooth_env() itself
+	float getAttackCoeff(void) { return alfa; }   //the smoothing coefficients, in samples (not seconds)
+	float getReleaseCoeff(void) { return beta; }
 
   private:
     audio_block_f32_t *inputQueueArray_f32[1]; //memory pointer for the input to this module
@@ -60,26 +60,27 @@ class AudioCalcGainDecWDRC_F32 : public AudioStream_F32
       //gain = output, the gain in natural units (not power, not dB)
       //n = input, number of samples to process in each vector
   
-      //prepare intermediate data block
-      audio_block_f32_t *env_dB_block = AudioStream_F32::allocate_f32();
-      if (!env_dB_block) return;
+      //prepare intermediate array (from the scratch memory, not the audio block pool)
+      AudioScratch_F32 scratch;
+      float *env_dB = scratch.get(n);
+      if (!env_dB) env_dB = gain_out;  //no scratch memory, so work in the output array instead (every step below goes sample-by-sample)
   
       //convert to dB and calibrate (via maxdB)
-      //for (int k=0; k < n; k ++) env_dB_block->data[k] = maxdB + db2(env[k]); //maxdb in the private section 
+      //for (int k=0; k < n; k ++) env_dB[k] = maxdB + db2(env[k]); //maxdb in the private section 
       
 	  
-	  env_dB_block->data[0] = maxdB + db2(env[0]); //maxdb in the private section 
+	  env_dB[0] = maxdB + db2(env[0]); //maxdb in the private section 
 	  int subcounter = 1; int index_last_computed = 0;  //these are to effect the decimation so that it conly computes every decimate_factor points
 	  float temp_sum = 0.0;
 	  for (int k=1; k < n; k++) {
 		  temp_sum += env[k];
 		  if (subcounter == 0) {
-			//env_dB_block->data[k] = maxdB + db2(env[k]); //maxdb in the private section 
-			env_dB_block->data[k] = maxdB + db2(temp_sum / ((float)decimate_factor)); //maxdb in the private section 
+			//env_dB[k] = maxdB + db2(env[k]); //maxdb in the private section 
+			env_dB[k] = maxdB + db2(temp_sum / ((float)decimate_factor)); //maxdb in the private section 
 			temp_sum = 0.0;  //reset temp_sum to build up a new average value next time
 			index_last_computed = k;
 		  } else {
-			env_dB_block->data[k] = env_dB_block->data[index_last_computed];
+			env_dB[k] = env_dB[index_last_computed];
 		  }
 		  
 		  //increment the subcounter (and wrap as necessary) to handle the decimation
@@ -87,8 +88,7 @@ class AudioCalcGainDecWDRC_F32 : public AudioStream_F32
 	  }
 		  
       // apply wide-dynamic range compression
-      WDRC_circuit_gain(env_dB_block->data, gain_out, n, exp_cr, exp_end_knee, tkgn, tk, cr, bolt);
-      AudioStream_F32::release(env_dB_block);
+      WDRC_circuit_gain(env_dB, gain_out, n, exp_cr, exp_end_knee, tkgn, tk, cr, bolt);
     }
 
     //original call to WDRC_circuit
@@ -56,24 +56,27 @@ class AudioCalcGainWDRC_F32 : public AudioStream_F32
       //env = input, signal envelope (not the envelope of the power, but the envelope of the signal itslef)
       //gain = output, the gain in natural units (not power, not dB)
       //n = input, number of samples to process in each vector
+
+      //use the table-driven version, if requested
+      if (use_fast_gain) { calcGainFromEnvelope_fast(env, gain_out, n); return; }
   
-      //prepare intermediate data block
-      audio_block_f32_t *env_dB_block = AudioStream_F32::allocate_f32();
-      if (!env_dB_block) return;
+      //prepare intermediate array (from the scratch memory, not the audio block pool)
+      AudioScratch_F32 scratch;
+      float *env_dB = scratch.get(n);
+      if (!env_dB) env_dB = gain_out;  //no scratch memory, so work in the output array instead (every step below goes sample-by-sample)
   
       //convert to dB and calibrate (via maxdB)
-      for (int k=0; k < n; k++) env_dB_block->data[k] = maxdB + db2(env[k]); //maxdb in the private section 
+      for (int k=0; k < n; k++) env_dB[k] = maxdB + db2(env[k]); //maxdb in the private section 
 
 	  
       // apply wide-dynamic range compression
-      //WDRC_circuit_gain(env_dB_block->data, gain_out, n, exp_cr, exp_end_knee, tkgn, tk, cr, bolt);
-	  WDRC_circuit_gain_preComputedParams(env_dB_block->data, gain_out, n);
-      AudioStream_F32::release(env_dB_block);
+      //WDRC_circuit_gain(env_dB, gain_out, n, exp_cr, exp_end_knee, tkgn, tk, cr, bolt);
+	  WDRC_circuit_gain_preComputedParams(env_dB, gain_out, n);
     }
 
-	// Here is a faster method, but it gives the wrong answers.  The transition points (the knee points) are correct
-	// but the computed gains are wrong
-/* 	void WDRC_circuit_gain_preComputedParams(float *env_dB, float *gain_out, const int n) {
+	// Same as WDRC_circuit_gain() but it uses the parameters pre-computed by recomputeDerivedQuantities().
+	// (This used to give the wrong answers because setGain_dB() did not update the pre-computed parameters.)
+	void WDRC_circuit_gain_preComputedParams(float *env_dB, float *gain_out, const int n) {
 		float *pdb = env_dB; //just rename it to keep the code below unchanged (input SPL dB)
 		float gdb;
 		for (int k = 0; k < n; k++) {  //loop over each sample
@@ -91,16 +94,78 @@ class AudioCalcGainWDRC_F32 : public AudioStream_F32
 			//y[k] = x[k] * undb2(gdb); //apply the gain
 		}
 		last_gain = gain_out[n-1];  //hold this value, in case the user asks for it later (not needed for the algorithm)
-	} */
-	
-	//instead, for now, let's just point to the full code and accept the computational penalty
-	void WDRC_circuit_gain_preComputedParams(float *env_dB, float *gain_out, const int n) {
-		WDRC_circuit_gain(env_dB, gain_out, n, 
-			exp_cr, exp_end_knee, 
-			tkgn, tk, cr, bolt);
-		
 	}
 
+	// ///////////////////////// Fast, table-driven gain calculation
+	//
+	// The WDRC gain curve (in dB) is piecewise linear versus the input level (in dB).  Both dB scales are
+	// just scaled versions of log2(), so the curve is also piecewise linear in the log2 domain:
+	//
+	//     log2(gain) = offset[i] + slope[i] * log2(env)
+	//
+	// The segments are pre-computed whenever the parameters change (see recomputeDerivedQuantities), so
+	// each sample only needs a fast log2, a short table search, a multiply-add, and a fast exp2.
+	//
+	// Accuracy: fastLog2 is within 6.6e-4 (0.0040 dB) and fastExp2 is within 1.11e-4 relative (0.0010 dB),
+	// so the gain is within (0.0040 * |slope| + 0.0010) dB of the exact path.  For a compression ratio
+	// of 1 or more, |slope| is at most 1.  It is larger only in a steep expansion region.
+	//
+	// Optionally, the gain can be computed only every k samples (setGainDecimation) with linear
+	// interpolation in between.  The envelope is already smooth, so small values of k cost very little accuracy.
+	void calcGainFromEnvelope_fast(const float *env, float *gain_out, const int n) {
+		if (n < 1) return;
+		const int k = gain_decimation;
+		if (k <= 1) {
+			for (int i = 0; i < n; i++) gain_out[i] = calcGainFromEnvelope_fast(env[i]);
+		} else {
+			float prev_gain = last_gain;
+			for (int start = 0; start < n; start += k) {
+				const int n_chunk = min(k, n - start);
+				const float new_gain = calcGainFromEnvelope_fast(env[start + n_chunk - 1]);  //gain at the end of the chunk
+				const float step = (new_gain - prev_gain) / ((float)n_chunk);
+				for (int i = 0; i < n_chunk; i++) gain_out[start + i] = prev_gain + step * (float)(i+1);
+				prev_gain = new_gain;
+			}
+		}
+		last_gain = gain_out[n-1];
+	}
+	float calcGainFromEnvelope_fast(const float env) {
+		const float env_log2 = fastLog2(env);
+		int i = n_gain_seg - 1;
+		while ((i > 0) && (env_log2 < gain_seg_start_log2[i])) i--;
+		return fastExp2(gain_seg_offset_log2[i] + gain_seg_slope[i] * env_log2);
+	}
+
+	//copy out the fast path's gain table (for code, like a compressor bank, that evaluates it itself).  Returns the number of segments.
+	int getGainTable(float *start_log2, float *offset_log2, float *slope) {
+		for (int i = 0; i < n_gain_seg; i++) { start_log2[i] = gain_seg_start_log2[i]; offset_log2[i] = gain_seg_offset_log2[i]; slope[i] = gain_seg_slope[i]; }
+		return n_gain_seg;
+	}
+	void setCurrentGain(float gain) { last_gain = gain; }
+
+	bool setUseFastGain(bool enable) { return use_fast_gain = enable; }
+	bool getUseFastGain(void) { return use_fast_gain; }
+	int setGainDecimation(int k) { return gain_decimation = max(1, k); }  //compute the gain every k samples (fast path only)
+	int getGainDecimation(void) { return gain_decimation; }
+
+	//log2(x), for x > 0, within 6.6e-4.  (Cubic fit to log2 of the mantissa, plus the exponent.)
+	static float fastLog2(const float x) {
+		union { float f; uint32_t i; } u = { x };
+		const float E = (float)(((int)((u.i >> 23) & 0xFF)) - 127);
+		u.i = (u.i & 0x007FFFFF) | 0x3F800000;  //mantissa, in [1.0, 2.0)
+		const float m = u.f;
+		return E + (-2.15315738f + m*(3.04706795f + m*(-1.05142572f + m*0.15817241f)));
+	}
+
+	//2^x, within 1.11e-4 (relative).  (Cubic fit to 2^fraction, scaled by setting the exponent directly.)
+	static float fastExp2(float x) {
+		x = max(-126.0f, min(126.0f, x));
+		const float xi = floorf(x);
+		const float f = x - xi;  //in [0.0, 1.0)
+		union { float f; uint32_t i; } u;
+		u.i = ((uint32_t)((int)xi + 127)) << 23;
+		return u.f * (0.99988978f + f*(0.69647383f + f*(0.22432502f + f*0.07920105f)));
+	}
 
     //original call to WDRC_circuit
     //void WDRC_circuit(float *x, float *y, float *pdb, int n, float tkgn, float tk, float cr, float bolt)
@@ -207,11 +272,55 @@ class AudioCalcGainWDRC_F32 : public AudioStream_F32
 		}
 
 		exp_cr_const = 1.0f/max(0.01f,exp_cr) - 1.0f;		
+
+		recomputeGainTable();
+	}
+
+	//Build the piecewise-linear gain table used by the fast path.  The knee points split the input level
+	//into (at most) four intervals.  Evaluate the same branches as WDRC_circuit_gain to find the straight
+	//line used in each interval, then re-express each line in the log2 domain.
+	void recomputeGainTable(void) {
+		float knees_dB[3] = { exp_end_knee, tk_tmp, pblt };
+		for (int i = 0; i < 2; i++) for (int j = 0; j < 2-i; j++) if (knees_dB[j] > knees_dB[j+1]) { float t = knees_dB[j]; knees_dB[j] = knees_dB[j+1]; knees_dB[j+1] = t; }
+
+		const float dB_per_log2 = 6.020599913279623f;  //20*log10(2)
+		n_gain_seg = 0;
+		for (int Iseg = 0; Iseg < 4; Iseg++) {
+			float test_dB;  //a level inside this interval
+			if (Iseg == 0) { test_dB = knees_dB[0] - 1.0f; }
+			else if (Iseg == 3) { test_dB = knees_dB[2] + 1.0f; }
+			else { test_dB = 0.5f*(knees_dB[Iseg-1] + knees_dB[Iseg]); }
+
+			float offset_dB, slope;
+			getGainLine_dB(test_dB, &offset_dB, &slope);
+
+			//gdb = offset_dB + slope * (maxdB + dB_per_log2 * log2(env))
+			float offset_log2 = (offset_dB + slope * maxdB) / dB_per_log2;
+			if ((n_gain_seg > 0) && (slope == gain_seg_slope[n_gain_seg-1]) && (offset_log2 == gain_seg_offset_log2[n_gain_seg-1])) continue;  //same line as before
+			gain_seg_start_log2[n_gain_seg] = (Iseg == 0) ? -1.0e30f : ((knees_dB[Iseg-1] - maxdB) / dB_per_log2);
+			gain_seg_offset_log2[n_gain_seg] = offset_log2;
+			gain_seg_slope[n_gain_seg] = slope;
+			n_gain_seg++;
+		}
+	}
+
+	//the straight line (gdb = offset_dB + slope * pdb) that WDRC_circuit_gain uses at the given input level
+	void getGainLine_dB(const float pdb, float *offset_dB, float *slope) {
+		if (pdb < exp_end_knee) {  //expansion
+			*slope = exp_cr_const;  *offset_dB = gain_at_exp_end_knee - exp_end_knee*exp_cr_const;
+		} else if ((pdb < tk_tmp) && (cr >= 1.0f)) {  //linear
+			*slope = 0.0f;  *offset_dB = tkgn;
+		} else if (pdb > pblt) { //10:1 limiting
+			*slope = 0.1f - 1.0f;  *offset_dB = bolt - pblt / 10.0f;
+		} else {  //compression
+			*slope = cr_const;  *offset_dB = tkgo;
+		}
 	}
 
     //set the linear gain of the system
     float setGain_dB(float linear_gain_dB) {
       tkgn  = linear_gain_dB;
+      recomputeDerivedQuantities();
       return getGain_dB();
     }
     //increment the linear gain
@@ -277,6 +386,12 @@ class AudioCalcGainWDRC_F32 : public AudioStream_F32
     float maxdB, exp_cr, exp_end_knee, tkgn, tk, cr, bolt;
 	float tk_tmp, cr_const, tkgo, pblt, gain_at_exp_end_knee, exp_cr_const;
 	float last_gain = 1.0;  //what was the last gain value computed for the signal
+
+	//for the fast, table-driven gain calculation
+	bool use_fast_gain = false;
+	int gain_decimation = 1;
+	int n_gain_seg = 0;
+	float gain_seg_start_log2[4], gain_seg_offset_log2[4], gain_seg_slope[4];
 };
 
 #endif
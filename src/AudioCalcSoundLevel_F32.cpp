@@ -0,0 +1,199 @@
+/*
+ * AudioCalcSoundLevel_F32.cpp
+ *
+ * OpenAudio, Oct 2026
+ *
+ * MIT License,  Use at your own risk.
+ *
+*/
+
+#include "AudioCalcSoundLevel_F32.h"
+
+//keep the compiler from moving memory accesses across this point (the sequence counter relies on it)
+static inline void soundLevel_compilerBarrier(void) { __asm__ volatile("" ::: "memory"); }
+
+void AudioCalcSoundLevel_F32::setDefaultWindows(void) {
+	const float32_t default_windows_sec[SOUNDLEVEL_MAX_LEQ_WINDOWS] = { 0.125f, 1.0f, 60.0f, 0.0f };
+	for (int Iwin = 0; Iwin < SOUNDLEVEL_MAX_LEQ_WINDOWS; Iwin++) {
+		last_leq_ms[Iwin] = 0.0f;
+		leq_count[Iwin] = 0;
+		setLeqWindow_sec(Iwin, default_windows_sec[Iwin]);
+	}
+	doClearStates();
+}
+
+int AudioCalcSoundLevel_F32::setWeightingType(int type) {
+	weightingType = type;
+	if (type == Z_WEIGHT) {
+		freqWeight.bypass(true);
+	} else {
+		freqWeight.setWeightingType(type);
+		freqWeight.bypass(false);
+	}
+	clearStates();
+	return weightingType;
+}
+
+float32_t AudioCalcSoundLevel_F32::setSampleRate_Hz(float32_t _fs_Hz) {
+	sampleRate_Hz = _fs_Hz;
+	freqWeight.setSampleRate_Hz(sampleRate_Hz);  //redesigns the weighting filter
+	if (weightingType == Z_WEIGHT) freqWeight.bypass(true);
+	computeTimeConstants();
+	for (int Iwin = 0; Iwin < SOUNDLEVEL_MAX_LEQ_WINDOWS; Iwin++) setLeqWindow_sec(Iwin, givenLeqWindow_sec[Iwin]);
+	clearStates();
+	return sampleRate_Hz;
+}
+
+void AudioCalcSoundLevel_F32::computeTimeConstants(void) {
+	//same as AudioFilterTimeWeighting_F32
+	alpha_fast = expf(-1.0f / (sampleRate_Hz * TIME_CONST_FAST));
+	alpha_slow = expf(-1.0f / (sampleRate_Hz * TIME_CONST_SLOW));
+	alpha_imp_rise = expf(-1.0f / (sampleRate_Hz * TIME_CONST_IMPULSE_RISE));
+	alpha_imp_fall = expf(-1.0f / (sampleRate_Hz * TIME_CONST_IMPULSE_FALL));
+	settle_samp = (unsigned long)(5.0f * TIME_CONST_IMPULSE_FALL * sampleRate_Hz);  //the slowest of the time constants
+}
+
+float32_t AudioCalcSoundLevel_F32::setLeqWindow_sec(int Iwin, float32_t window_sec) {
+	if ((Iwin < 0) || (Iwin >= SOUNDLEVEL_MAX_LEQ_WINDOWS)) return 0.0f;
+	givenLeqWindow_sec[Iwin] = max(0.0f, window_sec);
+
+	//quantize to whole audio blocks
+	unsigned long n_blocks = (unsigned long)(givenLeqWindow_sec[Iwin] * sampleRate_Hz / ((float32_t)audio_block_samples) + 0.5f);
+	if ((givenLeqWindow_sec[Iwin] > 0.0f) && (n_blocks < 1)) n_blocks = 1;
+	leqWindow_samp[Iwin] = n_blocks * audio_block_samples;
+	leq_sum[Iwin] = 0.0;
+	leq_n[Iwin] = 0;
+	return getLeqWindow_sec(Iwin);
+}
+
+float32_t AudioCalcSoundLevel_F32::getLeqWindow_sec(int Iwin) {
+	if ((Iwin < 0) || (Iwin >= SOUNDLEVEL_MAX_LEQ_WINDOWS)) return 0.0f;
+	return ((float32_t)leqWindow_samp[Iwin]) / sampleRate_Hz;
+}
+
+void AudioCalcSoundLevel_F32::doClearStates(void) {
+	fast_ms = 0.0f; slow_ms = 0.0f; impulse_avg_ms = 0.0f; impulse_ms = 0.0f;
+	for (int Iwin = 0; Iwin < SOUNDLEVEL_MAX_LEQ_WINDOWS; Iwin++) { leq_sum[Iwin] = 0.0; leq_n[Iwin] = 0; }
+	integrated_sum = 0.0;
+	integrated_n = 0;
+	block_count = 0;
+	samples_since_clear = 0;
+	doResetMaxMin();
+}
+
+void AudioCalcSoundLevel_F32::doResetMaxMin(void) {
+	fast_max = fast_ms; slow_max = slow_ms; impulse_max = impulse_ms;
+	fast_min = fast_ms; slow_min = slow_ms; impulse_min = impulse_ms;
+	peak = 0.0f;
+}
+
+void AudioCalcSoundLevel_F32::update(void)
+{
+	audio_block_f32_t *block = AudioStream_F32::receiveWritable_f32();
+	if (!block) return;
+
+	processAudioBlock(block);
+
+	AudioStream_F32::transmit(block); // send the frequency-weighted audio
+	AudioStream_F32::release(block);
+}
+
+void AudioCalcSoundLevel_F32::processAudioBlock(audio_block_f32_t *block) {
+	if (flag_clearStates) { doClearStates(); flag_clearStates = false; flag_resetMaxMin = false; }
+	if (flag_resetMaxMin) { doResetMaxMin(); flag_resetMaxMin = false; }
+
+	//frequency weighting (in place)
+	freqWeight.processAudioBlock(block, block);
+
+	//everything else is done in this single pass through the data
+	const float32_t *data = block->data;
+	const int n = block->length;
+	const float32_t a_f = alpha_fast, a_s = alpha_slow, a_ir = alpha_imp_rise, a_if = alpha_imp_fall;
+	float32_t f = fast_ms, s = slow_ms, imp_avg = impulse_avg_ms, imp = impulse_ms;
+	float32_t f_max = fast_max, s_max = slow_max, i_max = impulse_max;
+	float32_t f_min = fast_min, s_min = slow_min, i_min = impulse_min;
+	float32_t sum = 0.0f, blk_peak = 0.0f;
+	const bool track_min = (samples_since_clear >= settle_samp);
+	for (int i=0; i < n; i++) {
+		const float32_t x2 = data[i]*data[i];
+		const float32_t ax = fabsf(data[i]);
+		sum += x2;
+		if (ax > blk_peak) blk_peak = ax;
+
+		f = x2 + a_f*(f - x2);  //same as (1-alpha)*x2 + alpha*f
+		s = x2 + a_s*(s - x2);
+		imp_avg = x2 + a_ir*(imp_avg - x2);  //impulse: 35 msec averaging...
+		imp = max(imp_avg, a_if*imp);          //...followed by a peak detector that decays with 1.5 sec
+
+		if (f > f_max) f_max = f;
+		if (s > s_max) s_max = s;
+		if (imp > i_max) i_max = imp;
+		if (track_min) {
+			if (f < f_min) f_min = f;
+			if (s < s_min) s_min = s;
+			if (imp < i_min) i_min = imp;
+		}
+	}
+	if (!track_min) { f_min = f; s_min = s; i_min = imp; }  //keep Lmin following the level until settled
+	fast_ms = f; slow_ms = s; impulse_avg_ms = imp_avg; impulse_ms = imp;
+	fast_max = f_max; slow_max = s_max; impulse_max = i_max;
+	fast_min = f_min; slow_min = s_min; impulse_min = i_min;
+	if (blk_peak > peak) peak = blk_peak;
+	samples_since_clear += n;
+	block_count++;
+
+	//Leq windows...only evaluated once per block
+	for (int Iwin = 0; Iwin < SOUNDLEVEL_MAX_LEQ_WINDOWS; Iwin++) {
+		if (leqWindow_samp[Iwin] == 0) continue;
+		leq_sum[Iwin] += sum;
+		leq_n[Iwin] += n;
+		if (leq_n[Iwin] >= leqWindow_samp[Iwin]) {
+			last_leq_ms[Iwin] = (float32_t)(leq_sum[Iwin] / (double)leq_n[Iwin]);
+			leq_count[Iwin]++;
+			leq_sum[Iwin] = 0.0;
+			leq_n[Iwin] = 0;
+		}
+	}
+	integrated_sum += sum;
+	integrated_n += n;
+
+	float32_t block_ms = (n > 0) ? (sum / (float32_t)n) : 0.0f;
+	publishSnapshot(block_ms, blk_peak);
+}
+
+//called from the audio interrupt.  Bracket the writing of the snapshot by incrementing the sequence counter.
+void AudioCalcSoundLevel_F32::publishSnapshot(float32_t block_ms, float32_t block_peak) {
+	snapshot_seq = snapshot_seq + 1;  //now odd: writing in progress
+	soundLevel_compilerBarrier();
+
+	snapshot.block_count = block_count;
+	snapshot.cal_dB = cal_dB;
+	snapshot.fast_ms = fast_ms;  snapshot.slow_ms = slow_ms;  snapshot.impulse_ms = impulse_ms;
+	snapshot.fast_max_ms = fast_max;  snapshot.slow_max_ms = slow_max;  snapshot.impulse_max_ms = impulse_max;
+	snapshot.fast_min_ms = fast_min;  snapshot.slow_min_ms = slow_min;  snapshot.impulse_min_ms = impulse_min;
+	snapshot.block_ms = block_ms;
+	snapshot.block_peak = block_peak;
+	snapshot.peak = peak;
+	for (int Iwin = 0; Iwin < SOUNDLEVEL_MAX_LEQ_WINDOWS; Iwin++) {
+		snapshot.leq_ms[Iwin] = last_leq_ms[Iwin];
+		snapshot.leq_count[Iwin] = leq_count[Iwin];
+	}
+	snapshot.integrated_leq_ms = (integrated_n > 0) ? (float32_t)(integrated_sum / (double)integrated_n) : 0.0f;
+
+	soundLevel_compilerBarrier();
+	snapshot_seq = snapshot_seq + 1;  //now even: done
+}
+
+//called from loop().  If the audio interrupt updates the snapshot while we're copying it, try again.
+bool AudioCalcSoundLevel_F32::getSnapshot(AudioCalcSoundLevel_Snapshot *out, int max_tries) {
+	if (out == NULL) return false;
+	for (int Itry = 0; Itry < max_tries; Itry++) {
+		uint32_t seq_start = snapshot_seq;
+		if (seq_start & 0x01) continue;  //being written right now
+		soundLevel_compilerBarrier();
+		*out = snapshot;
+		soundLevel_compilerBarrier();
+		if (snapshot_seq == seq_start) return true;
+	}
+	return false;
+}
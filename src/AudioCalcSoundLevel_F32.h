@@ -0,0 +1,143 @@
+
+#ifndef _AudioCalcSoundLevel_F32_h
+#define _AudioCalcSoundLevel_F32_h
+
+#include <Arduino.h>
+#include <arm_math.h>
+#include "AudioStream_F32.h"
+#include "AudioFilterBiquad_F32.h"
+#include "AudioFilterFreqWeighting_F32.h"
+#include "AudioFilterTimeWeighting_F32.h"  //for TIME_CONST_SLOW and TIME_CONST_FAST
+
+/*
+ AudioCalcSoundLevel_F32.h
+
+ OpenAudio, Oct 2026
+
+ One-pass, multi-metric sound level meter.  Replaces the chain of AudioFilterFreqWeighting_F32,
+ AudioFilterTimeWeighting_F32, AudioCalcLevel_F32, and AudioCalcLeq_F32 with a single node:
+    * Applies A, C, or Z (ie, none) frequency weighting once
+    * In a single pass over the weighted audio, it computes:
+        - Fast, Slow, and Impulse exponentially time-weighted levels (and their max and min)
+        - Leq over several independent time windows (plus an integrating Leq since the last reset)
+        - Peak level
+    * At the end of every audio block, all of the statistics are copied into a snapshot that can
+      be safely read from loop() without disabling interrupts (see getSnapshot()).
+
+ All values in the snapshot are linear (mean-square or peak), so no log10 is done in the audio
+ processing.  Use the snapshot's dB() method to convert only the values that you actually need.
+
+ The Leq windows are quantized to whole audio blocks.  Use getLeqWindow_sec() to get the actual window.
+
+ The output of this node is the frequency-weighted audio.
+
+ MIT License,  Use at your own risk.
+*/
+
+#define SOUNDLEVEL_MAX_LEQ_WINDOWS  4
+#define TIME_CONST_IMPULSE_RISE  (0.035f)  //IEC 61672 impulse time weighting, averaging time constant
+#define TIME_CONST_IMPULSE_FALL  (1.5f)    //IEC 61672 impulse time weighting, decay of the peak detector
+
+//Holds all of the statistics from AudioCalcSoundLevel_F32.  Mean-square values (ms) and peak values are linear.
+class AudioCalcSoundLevel_Snapshot {
+	public:
+		unsigned long block_count = 0;      //number of audio blocks processed since the last reset
+		float32_t cal_dB = 0.0f;            //calibration added by dB() (such as to convert dBFS to dB SPL)
+
+		float32_t fast_ms = 0.0f, slow_ms = 0.0f, impulse_ms = 0.0f;                  //levels at the end of the latest block
+		float32_t fast_max_ms = 0.0f, slow_max_ms = 0.0f, impulse_max_ms = 0.0f;      //Lmax since the last resetMaxMin()
+		float32_t fast_min_ms = 0.0f, slow_min_ms = 0.0f, impulse_min_ms = 0.0f;      //Lmin since the last resetMaxMin()
+		float32_t block_ms = 0.0f;          //mean-square of just the latest block
+		float32_t block_peak = 0.0f;        //peak absolute value in just the latest block
+		float32_t peak = 0.0f;              //peak absolute value since the last resetMaxMin()
+
+		float32_t leq_ms[SOUNDLEVEL_MAX_LEQ_WINDOWS] = {0.0f};        //most recently completed Leq for each window
+		unsigned long leq_count[SOUNDLEVEL_MAX_LEQ_WINDOWS] = {0};    //number of completed windows (so you can see when it changes)
+		float32_t integrated_leq_ms = 0.0f; //Leq since the last reset
+
+		//convert to dB.  For peak values use dB_peak() instead.
+		float32_t dB(float32_t ms) const { return 10.0f*log10f(max(ms, 1.0e-20f)) + cal_dB; }
+		float32_t dB_peak(float32_t pk) const { return 20.0f*log10f(max(pk, 1.0e-10f)) + cal_dB; }
+};
+
+class AudioCalcSoundLevel_F32 : public AudioStream_F32
+{
+//GUI: inputs:1, outputs:1  //this line used for automatic generation of GUI node
+//GUI: shortName:sound_level
+	public:
+		AudioCalcSoundLevel_F32(void) : AudioStream_F32(1,inputQueueArray) {
+			setSampleRate_Hz(AUDIO_SAMPLE_RATE_EXACT);
+			setDefaultWindows();
+		}
+		AudioCalcSoundLevel_F32(const AudioSettings_F32 &settings) : AudioStream_F32(1,inputQueueArray),
+			freqWeight(settings), audio_block_samples(settings.audio_block_samples) {
+			setSampleRate_Hz(settings.sample_rate_Hz);
+			setDefaultWindows();
+		}
+
+		virtual void update(void);
+		virtual void processAudioBlock(audio_block_f32_t *block);  //processes in place, leaving the frequency-weighted audio
+
+		//frequency weighting: A_WEIGHT, C_WEIGHT, or Z_WEIGHT
+		virtual int setWeightingType(int type);
+		virtual int getWeightingType(void) { return weightingType; }
+
+		virtual float32_t setSampleRate_Hz(float32_t _fs_Hz);
+		virtual float32_t getSampleRate_Hz(void) { return sampleRate_Hz; }
+
+		//Leq windows.  Set a window to zero seconds to disable it.
+		virtual float32_t setLeqWindow_sec(int Iwin, float32_t window_sec);
+		virtual float32_t getLeqWindow_sec(int Iwin);
+
+		//calibration (dB) that is added when converting to dB.  For example, to convert dBFS into dB SPL.
+		virtual float32_t setCalibration_dB(float32_t val) { return cal_dB = val; }
+		virtual float32_t getCalibration_dB(void) { return cal_dB; }
+
+		//Copy the latest statistics.  This can be safely called from loop() while the audio is running.
+		//Returns false only if the audio interrupt kept changing the values during every attempt.
+		virtual bool getSnapshot(AudioCalcSoundLevel_Snapshot *out, int max_tries = 4);
+
+		virtual void resetMaxMin(void) { flag_resetMaxMin = true; }  //takes effect at the next update()
+		virtual void clearStates(void) { flag_clearStates = true; }  //takes effect at the next update()
+
+	protected:
+		audio_block_f32_t *inputQueueArray[1];
+		AudioFilterFreqWeighting_F32 freqWeight;
+		int weightingType = A_WEIGHT;
+		float32_t sampleRate_Hz = AUDIO_SAMPLE_RATE_EXACT;
+		int audio_block_samples = AUDIO_BLOCK_SAMPLES;
+		float32_t cal_dB = 0.0f;
+
+		//exponential time weighting coefficients and states
+		float32_t alpha_fast = 0.0f, alpha_slow = 0.0f, alpha_imp_rise = 0.0f, alpha_imp_fall = 0.0f;
+		float32_t fast_ms = 0.0f, slow_ms = 0.0f, impulse_avg_ms = 0.0f, impulse_ms = 0.0f;
+		float32_t fast_max = 0.0f, slow_max = 0.0f, impulse_max = 0.0f;
+		float32_t fast_min = 0.0f, slow_min = 0.0f, impulse_min = 0.0f;
+		float32_t peak = 0.0f;
+		unsigned long settle_samp = 0, samples_since_clear = 0;  //don't track Lmin until the time weighting has settled
+
+		//Leq states (doubles to avoid losing precision over long windows)
+		float32_t givenLeqWindow_sec[SOUNDLEVEL_MAX_LEQ_WINDOWS] = {0.0f};
+		unsigned long leqWindow_samp[SOUNDLEVEL_MAX_LEQ_WINDOWS] = {0};
+		double leq_sum[SOUNDLEVEL_MAX_LEQ_WINDOWS] = {0.0};
+		unsigned long leq_n[SOUNDLEVEL_MAX_LEQ_WINDOWS] = {0};
+		float32_t last_leq_ms[SOUNDLEVEL_MAX_LEQ_WINDOWS] = {0.0f};
+		unsigned long leq_count[SOUNDLEVEL_MAX_LEQ_WINDOWS] = {0};
+		unsigned long block_count = 0;
+		double integrated_sum = 0.0;
+		unsigned long long integrated_n = 0;
+
+		volatile bool flag_resetMaxMin = false, flag_clearStates = false;
+
+		//the snapshot is protected by a sequence counter: it is odd while the audio interrupt is writing
+		volatile uint32_t snapshot_seq = 0;
+		AudioCalcSoundLevel_Snapshot snapshot;
+
+		void setDefaultWindows(void);
+		void computeTimeConstants(void);
+		void doClearStates(void);
+		void doResetMaxMin(void);
+		void publishSnapshot(float32_t block_ms, float32_t block_peak);
+};
+
+#endif
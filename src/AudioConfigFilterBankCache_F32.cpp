@@ -0,0 +1,189 @@
+/*
+ * AudioConfigFilterBankCache_F32.cpp
+ *
+ * Created: OpenAudio, Oct 2026
+ *
+ * MIT License.  Use at your own risk.
+ *
+ */
+
+#include "AudioConfigFilterBankCache_F32.h"
+#include "AudioFilterbank_F32.h"  //for the longest FIR and IIR filters that the filterbanks can use
+
+int AudioConfigFilterBankCache_F32::setMaxEntries(int n) {
+	max_entries = max(1, n);
+	while ((int)entries.size() > max_entries) entries.erase(entries.begin() + findLeastRecentlyUsed());
+	return max_entries;
+}
+
+//returns the index of the matching entry or -1 if there is no match.  Floats are compared exactly, which is
+//appropriate because the filterbank classes sort and nudge the crossover frequencies deterministically
+int AudioConfigFilterBankCache_F32::findEntry(int design_type, int n_chan, int order, float sample_rate_Hz, int block_len, const float *crossover_freq, int n_coeff) {
+	int n_crossover = n_chan - 1;
+	for (int Ientry = 0; Ientry < (int)entries.size(); Ientry++) {
+		Entry &e = entries[Ientry];
+		if ((e.design_type != design_type) || (e.n_chan != n_chan) || (e.order != order)) continue;
+		if ((e.sample_rate_Hz != sample_rate_Hz) || (e.block_len != block_len)) continue;
+		if ((int)e.coeff.size() != n_coeff) continue;
+		bool is_match = true;
+		for (int i=0; i < n_crossover; i++) {
+			if (e.crossover_freq[i] != crossover_freq[i]) { is_match = false; break; }
+		}
+		if (is_match) return Ientry;
+	}
+	return -1;
+}
+
+int AudioConfigFilterBankCache_F32::findLeastRecentlyUsed(void) {
+	int ind = 0;
+	for (int Ientry = 1; Ientry < (int)entries.size(); Ientry++) {
+		if (entries[Ientry].last_used < entries[ind].last_used) ind = Ientry;
+	}
+	return ind;
+}
+
+bool AudioConfigFilterBankCache_F32::lookup(int design_type, int n_chan, int order, float sample_rate_Hz, int block_len,
+		const float *crossover_freq, float *filter_coeff, int n_coeff)
+{
+	if ((n_chan < 1) || (filter_coeff == NULL)) return false;
+	int ind = findEntry(design_type, n_chan, order, sample_rate_Hz, block_len, crossover_freq, n_coeff);
+	if (ind < 0) { n_misses++; return false; }
+
+	Entry &e = entries[ind];
+	for (int i=0; i < n_coeff; i++) filter_coeff[i] = e.coeff[i];
+	e.last_used = ++use_counter;
+	n_hits++;
+	return true;
+}
+
+int AudioConfigFilterBankCache_F32::store(int design_type, int n_chan, int order, float sample_rate_Hz, int block_len,
+		const float *crossover_freq, const float *filter_coeff, int n_coeff)
+{
+	if ((n_chan < 1) || (n_chan > AUDIOCONFIGFILTERBANKCACHE_MAX_CHAN) || (n_coeff < 1) || (filter_coeff == NULL)) return -1;
+	int n_crossover = n_chan - 1;
+
+	//re-use the existing entry if it is already here, otherwise make room for a new one
+	int ind = findEntry(design_type, n_chan, order, sample_rate_Hz, block_len, crossover_freq, n_coeff);
+	if (ind < 0) {
+		if ((int)entries.size() >= max_entries) entries.erase(entries.begin() + findLeastRecentlyUsed());
+		entries.push_back(Entry());
+		ind = entries.size() - 1;
+	}
+
+	Entry &e = entries[ind];
+	e.design_type = design_type;
+	e.n_chan = n_chan;
+	e.order = order;
+	e.sample_rate_Hz = sample_rate_Hz;
+	e.block_len = block_len;
+	e.crossover_freq.assign(crossover_freq, crossover_freq + n_crossover);
+	e.coeff.assign(filter_coeff, filter_coeff + n_coeff);
+	e.last_used = ++use_counter;
+	return (int)entries.size();
+}
+
+// ///////////////////////////////////////////////////////////////////////////////////////////
+//
+// Binary file format (all values little-endian, as written by the Teensy):
+//    uint32 magic, uint32 version, int32 n_entries
+//    for each entry:
+//        int32 design_type, int32 n_chan, int32 order, float32 sample_rate_Hz, int32 block_len, int32 n_coeff
+//        float32 crossover_freq[n_chan-1]
+//        float32 coeff[n_coeff]
+//
+// ///////////////////////////////////////////////////////////////////////////////////////////
+
+//check the header of an entry read from a file, so that a corrupt file cannot ask for a huge allocation.  The
+//number of coefficients must be exactly what the filterbank would have designed for that number of channels and order.
+bool AudioConfigFilterBankCache_F32::isValidFileEntry(int design_type, int n_chan, int order, float sample_rate_Hz, int block_len, int n_coeff) {
+	if ((n_chan < 1) || (n_chan > AUDIOCONFIGFILTERBANKCACHE_MAX_CHAN)) return false;
+	if (!(sample_rate_Hz > 0.0f) || (block_len < 1)) return false;  //also catches NaN
+	if (design_type == DESIGN_FIR) {
+		if ((order < 1) || (order > FIR_MAX_COEFFS)) return false;
+		return (n_coeff == n_chan * order);
+	} else if (design_type == DESIGN_IIR_SOS) {
+		if ((order < 1) || (order > AudioFilterbankBiquad_MAX_IIR_FILT_ORDER)) return false;
+		const int n_biquad = (order + 1) / 2;
+		return (n_coeff == n_chan * n_biquad * AudioFilterbankBiquad_COEFF_PER_BIQUAD);
+	}
+	return false;
+}
+
+int AudioConfigFilterBankCache_F32::saveToSD(SdFs *sd, const char *fname) {
+	if ((sd == NULL) || (fname == NULL)) return -1;
+	if (sd->exists(fname)) sd->remove(fname);
+
+	SdFile file;
+	if (!file.open(fname, O_RDWR | O_CREAT | O_TRUNC)) {
+		Serial.println("AudioConfigFilterBankCache_F32: saveToSD: *** ERROR *** could not open " + String(fname));
+		return -1;
+	}
+
+	int32_t n_entries = entries.size();
+	bool is_ok = true;
+	is_ok &= (file.write(&file_magic, sizeof(file_magic)) == sizeof(file_magic));
+	is_ok &= (file.write(&file_version, sizeof(file_version)) == sizeof(file_version));
+	is_ok &= (file.write(&n_entries, sizeof(n_entries)) == sizeof(n_entries));
+	for (int Ientry = 0; Ientry < n_entries; Ientry++) {
+		Entry &e = entries[Ientry];
+		int32_t header[6] = { e.design_type, e.n_chan, e.order, 0, e.block_len, (int32_t)e.coeff.size() };
+		memcpy(&header[3], &e.sample_rate_Hz, sizeof(float));
+		is_ok &= (file.write(header, sizeof(header)) == sizeof(header));
+		int n_bytes = e.crossover_freq.size()*sizeof(float);
+		if (n_bytes > 0) is_ok &= (file.write(e.crossover_freq.data(), n_bytes) == (size_t)n_bytes);
+		n_bytes = e.coeff.size()*sizeof(float);
+		is_ok &= (file.write(e.coeff.data(), n_bytes) == (size_t)n_bytes);
+	}
+	file.close();
+
+	if (!is_ok) {
+		Serial.println("AudioConfigFilterBankCache_F32: saveToSD: *** ERROR *** failed writing " + String(fname));
+		return -1;
+	}
+	return 0;
+}
+
+int AudioConfigFilterBankCache_F32::loadFromSD(SdFs *sd, const char *fname) {
+	if ((sd == NULL) || (fname == NULL)) return -1;
+	if (!sd->exists(fname)) return -1;
+
+	SdFile file;
+	if (!file.open(fname, O_RDONLY)) {
+		Serial.println("AudioConfigFilterBankCache_F32: loadFromSD: *** ERROR *** could not open " + String(fname));
+		return -1;
+	}
+
+	uint32_t magic = 0, version = 0;
+	int32_t n_entries = 0;
+	file.read(&magic, sizeof(magic));
+	file.read(&version, sizeof(version));
+	file.read(&n_entries, sizeof(n_entries));
+	if ((magic != file_magic) || (version != file_version) || (n_entries < 0)) {
+		Serial.println("AudioConfigFilterBankCache_F32: loadFromSD: *** ERROR *** " + String(fname) + " is not a valid cache file.");
+		file.close();
+		return -1;
+	}
+
+	int ret_val = 0;
+	std::vector<float> cf, coeff;
+	for (int Ientry = 0; Ientry < n_entries; Ientry++) {
+		int32_t header[6];
+		if (file.read(header, sizeof(header)) != (int)sizeof(header)) { ret_val = -1; break; }
+		int n_chan = header[1], n_coeff = header[5];
+		float sample_rate_Hz;
+		memcpy(&sample_rate_Hz, &header[3], sizeof(float));
+		if (!isValidFileEntry(header[0], n_chan, header[2], sample_rate_Hz, header[4], n_coeff)) { ret_val = -1; break; }  //check before allocating anything
+
+		cf.resize(n_chan-1);
+		coeff.resize(n_coeff);
+		int n_bytes = cf.size()*sizeof(float);
+		if ((n_bytes > 0) && (file.read(cf.data(), n_bytes) != n_bytes)) { ret_val = -1; break; }
+		n_bytes = coeff.size()*sizeof(float);
+		if (file.read(coeff.data(), n_bytes) != n_bytes) { ret_val = -1; break; }
+		store(header[0], n_chan, header[2], sample_rate_Hz, header[4], cf.data(), coeff.data(), n_coeff);
+	}
+	file.close();
+
+	if (ret_val < 0) Serial.println("AudioConfigFilterBankCache_F32: loadFromSD: *** WARNING *** " + String(fname) + " was truncated or corrupt.");
+	return ret_val;
+}
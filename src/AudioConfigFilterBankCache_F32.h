@@ -0,0 +1,95 @@
+/*
+ * AudioConfigFilterBankCache_F32
+ *
+ * Created: OpenAudio, Oct 2026
+ *
+ * Purpose: Designing a filterbank (AudioConfigFIRFilterBank_F32 or AudioConfigIIRFilterBank_F32) is
+ *     slow.  This class remembers the coefficients of previously-designed filterbanks so that recalling
+ *     a preset becomes a simple table lookup instead of a full re-design.
+ *
+ *     Each entry is keyed by the design parameters: the type of design (FIR or IIR-SOS), the number
+ *     of channels, the filter order, the sample rate, the audio block length, and the crossover
+ *     frequencies.  The cache holds up to "max_entries" designs in RAM.  When full, the least-recently
+ *     used design is evicted.
+ *
+ *     Optionally, the whole cache can be saved to (and loaded from) the SD card as a binary file so
+ *     that the designs survive a reboot.
+ *
+ *     To use, create one instance and hand it to your filterbank(s) via setCoeffCache().  One instance
+ *     can be shared by several filterbanks.
+ *
+ * MIT License.  Use at your own risk.
+ *
+ */
+
+#ifndef _AudioConfigFilterBankCache_F32_h
+#define _AudioConfigFilterBankCache_F32_h
+
+#include <Arduino.h>
+#include <SdFat.h>
+#include <vector>
+
+#define AUDIOCONFIGFILTERBANKCACHE_DEFAULT_ENTRIES  4   //default number of designs held in RAM
+#define AUDIOCONFIGFILTERBANKCACHE_MAX_CHAN  64         //most filters in one filterbank that will be loaded from the SD card
+
+class AudioConfigFilterBankCache_F32 {
+	public:
+		AudioConfigFilterBankCache_F32(void) { }
+		AudioConfigFilterBankCache_F32(int _max_entries) { setMaxEntries(_max_entries); }
+
+		//types of designs that can be held in the cache
+		enum DESIGN_TYPE { DESIGN_FIR=0, DESIGN_IIR_SOS=1 };
+
+		//Look for a previously-designed filterbank.  If found, the coefficients are copied into
+		//filter_coeff (which must hold n_coeff values) and true is returned.  If not found, false
+		//is returned and filter_coeff is untouched.
+		bool lookup(int design_type, int n_chan, int order, float sample_rate_Hz, int block_len,
+			const float *crossover_freq, float *filter_coeff, int n_coeff);
+
+		//Add a newly-designed filterbank to the cache.  If the cache is full, the least-recently used
+		//design is evicted.  Returns the number of entries in the cache, or -1 on error.
+		int store(int design_type, int n_chan, int order, float sample_rate_Hz, int block_len,
+			const float *crossover_freq, const float *filter_coeff, int n_coeff);
+
+		void clear(void) { entries.clear(); }
+		int setMaxEntries(int n);
+		int getMaxEntries(void) { return max_entries; }
+		int getNumEntries(void) { return (int)entries.size(); }
+
+		//statistics, useful for seeing if the cache is sized appropriately
+		unsigned long getNumHits(void) { return n_hits; }
+		unsigned long getNumMisses(void) { return n_misses; }
+		void resetStats(void) { n_hits = 0; n_misses = 0; }
+
+		//persist the cache to the SD card in a binary format.  Return 0 on success, negative on error.
+		//The SD card must have already been started (ie, sd->begin()) prior to calling these.
+		int saveToSD(SdFs *sd, const char *fname);
+		int loadFromSD(SdFs *sd, const char *fname);  //entries are added to whatever is already in RAM
+
+	protected:
+		class Entry {
+			public:
+				int design_type = 0;
+				int n_chan = 0;
+				int order = 0;
+				float sample_rate_Hz = 0.0f;
+				int block_len = 0;
+				unsigned long last_used = 0; //for the LRU eviction
+				std::vector<float> crossover_freq;
+				std::vector<float> coeff;
+		};
+
+		bool isValidFileEntry(int design_type, int n_chan, int order, float sample_rate_Hz, int block_len, int n_coeff);
+		int findEntry(int design_type, int n_chan, int order, float sample_rate_Hz, int block_len, const float *crossover_freq, int n_coeff);
+		int findLeastRecentlyUsed(void);
+
+		std::vector<Entry> entries;
+		int max_entries = AUDIOCONFIGFILTERBANKCACHE_DEFAULT_ENTRIES;
+		unsigned long use_counter = 0;
+		unsigned long n_hits = 0, n_misses = 0;
+
+		const uint32_t file_magic = 0x43424654;  //spells "TFBC" when read as little-endian bytes
+		const uint32_t file_version = 1;
+};
+
+#endif
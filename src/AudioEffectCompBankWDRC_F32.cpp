@@ -159,6 +159,7 @@ void AudioEffectCompBankWDRC_F32::collectParams_into_CHA_DSL(BTNRH_WDRC::CHA_DSL
 void AudioEffectCompBankWDRC_F32::update(void) {
 	//return if not enabled
 	if (!is_enabled) return;
+	if (use_batched_kernel) { update_batched(); return; }
 	
 	//loop over each channel...but only those up to the active channel limit
 	int n_chan = state.get_n_chan();
@@ -168,24 +169,158 @@ void AudioEffectCompBankWDRC_F32::update(void) {
 		audio_block_f32_t *block = AudioStream_F32::receiveReadOnly_f32(Ichan);
 		
 		if (block != NULL) { //did we get a block of data?
+			update_oneChannel(Ichan, block);
+		} 
+		AudioStream_F32::release(block); //release the memory block that we requested
+	} 
+}
+
+//process one channel with its own compressor and transmit it.  The caller keeps ownership of the input block.
+void AudioEffectCompBankWDRC_F32::update_oneChannel(int Ichan, audio_block_f32_t *block) {
+	
+	//request a data block to hold th processed data
+	audio_block_f32_t *out_block = AudioStream_F32::allocate_f32();
+	
+	if (out_block != NULL) { //did we get a valid memory handle?
+		//do the algorithm
+		int is_error = compressors[Ichan].processAudioBlock(block,out_block); //anything other than a zero is an error
 		
-			//request a data block to hold th processed data
-			audio_block_f32_t *out_block = AudioStream_F32::allocate_f32();
-			
-			if (out_block != NULL) { //did we get a valid memory handle?
-				//do the algorithm
-				int is_error = compressors[Ichan].processAudioBlock(block,out_block); //anything other than a zero is an error
-				
-				//if we had no error, transmit the processed data
-				if (!is_error) AudioStream_F32::transmit(out_block, Ichan);
+		//if we had no error, transmit the processed data
+		if (!is_error) AudioStream_F32::transmit(out_block, Ichan);
 
+	} else {
+		//Serial.println(F("AudioEffectCompBankWDRC_F32: update: could not allocate out_block ") + String(Ichan));
+	}
+	AudioStream_F32::release(out_block);  //release the memory block that we requested 
+}
+
+void AudioEffectCompBankWDRC_F32::update_batched(void) {
+	audio_block_f32_t *in_blocks[__MAX_NUM_COMP], *out_blocks[__MAX_NUM_COMP];
+	float32_t *x[__MAX_NUM_COMP], *y[__MAX_NUM_COMP];
+	int chan[__MAX_NUM_COMP];
+
+	//gather the blocks for all of the active channels
+	int n_chan = min(state.get_n_chan(), (int)compressors.size());
+	int n_active = 0, n = 0;
+	for (int Ichan=0; Ichan < n_chan; Ichan++) {
+		audio_block_f32_t *block = AudioStream_F32::receiveReadOnly_f32(Ichan);
+		if (block == NULL) continue;
+		AudioCalcGainWDRC_F32 *calcGain = &(compressors[Ichan].calcGain);
+		if ((!calcGain->getUseFastGain()) || (calcGain->getGainDecimation() != 1) || ((n_active > 0) && (block->length != n))) {
+			//the batch only does the table-driven gain computed every sample, and it needs all channels to be the
+			//same length, so do this one on its own (with its own settings)
+			update_oneChannel(Ichan, block);
+			AudioStream_F32::release(block);
+			continue;
+		}
+		audio_block_f32_t *out_block = AudioStream_F32::allocate_f32();
+		if (out_block == NULL) { AudioStream_F32::release(block); continue; }
+		n = block->length;
+		in_blocks[n_active] = block; out_blocks[n_active] = out_block; chan[n_active] = Ichan;
+		x[n_active] = block->data;  y[n_active] = out_block->data;
+		n_active++;
+	}
+	if (n_active == 0) return;
+
+	//copy the parameters and states of those channels into the structure-of-arrays
+	batch.n_chan = n_active;
+	for (int i=0; i < n_active; i++) {
+		AudioEffectCompWDRC_F32 *comp = &(compressors[chan[i]]);
+		batch.alfa[i] = comp->calcEnvelope.getAttackCoeff();
+		batch.one_minus_alfa[i] = 1.0f - batch.alfa[i];
+		batch.beta[i] = comp->calcEnvelope.getReleaseCoeff();
+		batch.env[i] = comp->calcEnvelope.getCurrentLevel();
+
+		float start[COMPBANK_MAX_GAIN_SEG], offset[COMPBANK_MAX_GAIN_SEG], slope[COMPBANK_MAX_GAIN_SEG];
+		int n_seg = comp->calcGain.getGainTable(start, offset, slope);
+		for (int Iseg=0; Iseg < COMPBANK_MAX_GAIN_SEG; Iseg++) {
+			if (Iseg < n_seg) {
+				batch.seg_start_log2[Iseg][i] = start[Iseg]; batch.seg_offset_log2[Iseg][i] = offset[Iseg]; batch.seg_slope[Iseg][i] = slope[Iseg];
 			} else {
-				//Serial.println(F("AudioEffectCompBankWDRC_F32: update: could not allocate out_block ") + String(Ichan));
+				batch.seg_start_log2[Iseg][i] = 1.0e30f; batch.seg_offset_log2[Iseg][i] = 0.0f; batch.seg_slope[Iseg][i] = 0.0f;  //never selected
 			}
-			AudioStream_F32::release(out_block);  //release the memory block that we requested 
-		} 
-		AudioStream_F32::release(block); //release the memory block that we requested
-	} 
+		}
+	}
+
+	//process all channels together.  If that failed, the outputs are not valid, so do not transmit them.
+	if (!batch.compress(x, y, n)) {
+		for (int i=0; i < n_active; i++) {
+			AudioStream_F32::release(out_blocks[i]);
+			AudioStream_F32::release(in_blocks[i]);
+		}
+		return;
+	}
+
+	//copy the states back, then transmit
+	for (int i=0; i < n_active; i++) {
+		AudioEffectCompWDRC_F32 *comp = &(compressors[chan[i]]);
+		comp->calcEnvelope.setCurrentLevel(batch.env[i]);
+		comp->calcGain.setCurrentGain(batch.last_gain[i]);
+
+		out_blocks[i]->id = in_blocks[i]->id;
+		out_blocks[i]->length = n;
+		AudioStream_F32::transmit(out_blocks[i], chan[i]);
+		AudioStream_F32::release(out_blocks[i]);
+		AudioStream_F32::release(in_blocks[i]);
+	}
+}
+
+//The batched kernel.  The channels are taken COMPBANK_N_LANES at a time.  Within each group, every sample
+//advances all of the lanes together, in an inner loop with a fixed number of iterations that the compiler
+//can unroll.  A partial group at the end is
+//padded with silent lanes that write into scratch memory.
+bool AudioEffectCompBankWDRC_Batch::compress(float32_t **x, float32_t **y, const int n) {
+	const int L = COMPBANK_N_LANES;
+	AudioScratch_F32 scratch;
+	float32_t *pad_in = NULL, *pad_out = NULL;
+	if ((n_chan % L) != 0) {
+		pad_in = scratch.get(n); pad_out = scratch.get(n);
+		if ((pad_in == NULL) || (pad_out == NULL)) return false;  //failed to get memory
+		for (int i=0; i < n; i++) pad_in[i] = 0.0f;
+	}
+
+	for (int c0 = 0; c0 < n_chan; c0 += L) {
+		//load this group of lanes
+		const float32_t *xl[L]; float32_t *yl[L];
+		float32_t a[L], oma[L], b[L], e[L], g[L];
+		float32_t st[COMPBANK_MAX_GAIN_SEG][L], of[COMPBANK_MAX_GAIN_SEG][L], sl[COMPBANK_MAX_GAIN_SEG][L];
+		for (int l = 0; l < L; l++) {
+			const int c = c0 + l;
+			const bool is_real = (c < n_chan);
+			const int cc = is_real ? c : c0;  //padded lanes just copy the parameters of the first lane
+			xl[l] = is_real ? x[c] : pad_in;
+			yl[l] = is_real ? y[c] : pad_out;
+			a[l] = alfa[cc]; oma[l] = one_minus_alfa[cc]; b[l] = beta[cc]; e[l] = is_real ? env[cc] : 0.0f; g[l] = 1.0f;
+			for (int s = 0; s < COMPBANK_MAX_GAIN_SEG; s++) { st[s][l] = seg_start_log2[s][cc]; of[s][l] = seg_offset_log2[s][cc]; sl[s][l] = seg_slope[s][cc]; }
+		}
+
+		//advance all of the lanes, one sample at a time
+		for (int i = 0; i < n; i++) {
+			for (int l = 0; l < L; l++) {
+				//envelope (same as AudioCalcEnvelope_F32::smooth_env)
+				const float32_t xin = xl[l][i];
+				const float32_t xab = (xin >= 0.0f) ? xin : -xin;
+				e[l] = (xab >= e[l]) ? (a[l] * e[l] + oma[l] * xab) : (b[l] * e[l]);
+
+				//gain (same as AudioCalcGainWDRC_F32::calcGainFromEnvelope_fast)
+				const float32_t env_log2 = AudioCalcGainWDRC_F32::fastLog2(e[l]);
+				float32_t off = of[0][l], slope = sl[0][l];
+				for (int s = 1; s < COMPBANK_MAX_GAIN_SEG; s++) {
+					if (env_log2 >= st[s][l]) { off = of[s][l]; slope = sl[s][l]; }
+				}
+				g[l] = AudioCalcGainWDRC_F32::fastExp2(off + slope * env_log2);
+
+				yl[l][i] = xin * g[l];
+			}
+		}
+
+		//save the states
+		for (int l = 0; l < L; l++) {
+			const int c = c0 + l;
+			if (c < n_chan) { env[c] = e[l]; last_gain[c] = g[l]; }
+		}
+	}
+	return true;
 }
 
 int AudioEffectCompBankWDRC_F32::set_n_chan(int val) {
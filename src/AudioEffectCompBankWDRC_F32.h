@@ -24,6 +24,27 @@
 #include <vector>
 
 #define __MAX_NUM_COMP 24  //max number of compressors.  Limited by number fo inputs that we enable for the Audio Library connections
+#define COMPBANK_N_LANES 4  //the batched kernel advances this many channels together
+#define COMPBANK_MAX_GAIN_SEG 4  //must match the size of the gain table in AudioCalcGainWDRC_F32
+
+//The state and parameters for all of the channels, laid out as structure-of-arrays for the batched kernel.
+//It is filled from the individual compressors at the start of each update (so that any parameter changes
+//made to the compressors are always picked up) and the states are copied back at the end.
+class AudioEffectCompBankWDRC_Batch {
+	public:
+		int n_chan = 0;
+		float32_t alfa[__MAX_NUM_COMP], one_minus_alfa[__MAX_NUM_COMP], beta[__MAX_NUM_COMP];  //envelope time constants
+		float32_t env[__MAX_NUM_COMP];                                                           //envelope state
+		float32_t seg_start_log2[COMPBANK_MAX_GAIN_SEG][__MAX_NUM_COMP];                         //gain table
+		float32_t seg_offset_log2[COMPBANK_MAX_GAIN_SEG][__MAX_NUM_COMP];
+		float32_t seg_slope[COMPBANK_MAX_GAIN_SEG][__MAX_NUM_COMP];
+		float32_t last_gain[__MAX_NUM_COMP];
+
+		//envelope and WDRC gain for all channels, advancing COMPBANK_N_LANES channels per sample.
+		//x[Ichan] and y[Ichan] are the input and output audio of each channel.  They can be the same arrays.
+		//Returns false (having written nothing to y and changed no states) if it could not get its scratch memory.
+		bool compress(float32_t **x, float32_t **y, const int n);
+};
 
 //This class helps manage some of the configuration and state information of the AudioEffectCompWDRC classes.
 //It is also helpful for managing the GUI on the TympanRemote mobile App.
@@ -100,6 +121,14 @@ class AudioEffectCompBankWDRC_F32 : public AudioStream_F32 {
 		AudioEffectCompBankWDRCState state;
 		
 		bool enable(bool val=true) { return is_enabled = val; }
+
+		//Process all channels together (structure-of-arrays, several channels per sample) instead of one
+		//compressor at a time.  It uses the same math as the compressors' table-driven gain (see
+		//AudioCalcGainWDRC_F32::calcGainFromEnvelope_fast), so it is bit-exact with that path.  Only the channels
+		//whose compressors use that path (setUseFastGain(true), see setUseFastGain_all()) with a gain decimation
+		//of 1 are batched.  The other channels are processed by their own compressor, as usual.
+		bool setUseBatchedKernel(bool val) { return use_batched_kernel = val; }
+		bool getUseBatchedKernel(void) { return use_batched_kernel; }
 		
 		// /////////////////////////////// set / get methods
 		
@@ -122,6 +151,7 @@ class AudioEffectCompBankWDRC_F32 : public AudioStream_F32 {
 		float setAttack_msec_all(float val)  { for (int i=0; i < get_max_n_chan(); i++) setAttack_msec(val,i);  return getAttack_msec(); }
 		float setRelease_msec_all(float val) { for (int i=0; i < get_max_n_chan(); i++) setRelease_msec(val,i); return getRelease_msec(); }
 		float setMaxdB_all(float val)        { for (int i=0; i < get_max_n_chan(); i++) setMaxdB(val,i);        return getMaxdB(); }
+		bool setUseFastGain_all(bool val)    { for (int i=0; i < get_max_n_chan(); i++) compressors[i].setUseFastGain(val); return val; }
 
 		float setScaleFactor_dBSPL_at_dBFS_all(float val) { return setMaxdB_all(val); } //another name for setMaxdB_all
 		
@@ -162,6 +192,11 @@ class AudioEffectCompBankWDRC_F32 : public AudioStream_F32 {
 		audio_block_f32_t *inputQueueArray[__MAX_NUM_COMP];  //required as part of AudioStream_F32.  One input.
 		bool is_enabled = false;
 		//AudioSettings_F32 *audio_settings_ptr = NULL;
+
+		bool use_batched_kernel = false;
+		AudioEffectCompBankWDRC_Batch batch;
+		void update_batched(void);
+		void update_oneChannel(int Ichan, audio_block_f32_t *block);
 };
 
 
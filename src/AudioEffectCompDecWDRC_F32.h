@@ -33,11 +33,13 @@ class AudioEffectCompDecWDRC_F32 : public AudioStream_F32
     AudioEffectCompDecWDRC_F32(void): AudioStream_F32(1,inputQueueArray) { //need to modify this for user to set sample rate
       setSampleRate_Hz(AUDIO_SAMPLE_RATE);
       setDefaultValues();
+      AudioScratchArena_F32::reserve(3, MAX_AUDIO_BLOCK_SAMPLES_F32); //for compress(): envelope and gain, plus one array inside calcGain
     }
 
     AudioEffectCompDecWDRC_F32(AudioSettings_F32 settings): AudioStream_F32(1,inputQueueArray) { //need to modify this for user to set sample rate
       setSampleRate_Hz(settings.sample_rate_Hz);
       setDefaultValues();
+      AudioScratchArena_F32::reserve(3, settings.audio_block_samples); //for compress(): envelope and gain, plus one array inside calcGain
     }
 
     //here is the method called automatically by the audio library
@@ -48,52 +50,54 @@ class AudioEffectCompDecWDRC_F32 : public AudioStream_F32
       
       //allocate memory for the output of our algorithm
       audio_block_f32_t *out_block = AudioStream_F32::allocate_f32();
-      if (!out_block) return;
+      if (!out_block) { AudioStream_F32::release(block); return; }
       
       //do the algorithm
-      cha_agc_channel(block->data, out_block->data, block->length);
+      int is_error = cha_agc_channel(block->data, out_block->data, block->length);
 	  
 	  //copy the audio_block id
 	  out_block->id = block->id;
       
       // transmit the block and release memory
-      AudioStream_F32::transmit(out_block); // send the FIR output
+      if (!is_error) AudioStream_F32::transmit(out_block); // send the FIR output
       AudioStream_F32::release(out_block);
       AudioStream_F32::release(block);
     }
 
 
     //here is the function that does all the work
-    void cha_agc_channel(float *input, float *output, int cs) {  
+    int cha_agc_channel(float *input, float *output, int cs) {  //returns zero if OK
       //compress(input, output, cs, &prev_env,
       //  CHA_DVAR.alfa, CHA_DVAR.beta, CHA_DVAR.tkgain, CHA_DVAR.tk, CHA_DVAR.cr, CHA_DVAR.bolt, CHA_DVAR.maxdB);
-      compress(input, output, cs);
+      return compress(input, output, cs);
     }
 
     //void compress(float *x, float *y, int n, float *prev_env,
     //    float &alfa, float &beta, float &tkgn, float &tk, float &cr, float &bolt, float &mxdB)
-     void compress(float *x, float *y, int n)    
+     int compress(float *x, float *y, int n)    
      //x, input, audio waveform data
      //y, output, audio waveform data after compression
      //n, input, number of samples in this audio block
+     //returns zero if OK.  If it could not get its memory, the audio is passed through unchanged and it returns -1.
     {        
+        //get temporary arrays from the scratch memory (not the audio block pool)
+        AudioScratch_F32 scratch;
+        float *envelope = scratch.get(n);
+        float *gain = scratch.get(n);
+        if ((envelope == NULL) || (gain == NULL)) {  //failed to get memory
+          if (y != x) for (int i=0; i < n; i++) y[i] = x[i];
+          return -1;
+        }
+
         // find smoothed envelope
-        audio_block_f32_t *envelope_block = AudioStream_F32::allocate_f32();
-        if (!envelope_block) return;
-        calcEnvelope.smooth_env(x, envelope_block->data, n);
-        //float *xpk = envelope_block->data; //get pointer to the array of (empty) data values
+        calcEnvelope.smooth_env(x, envelope, n);
 
         //calculate gain
-        audio_block_f32_t *gain_block = AudioStream_F32::allocate_f32();
-        if (!gain_block) return;
-        calcGain.calcGainFromEnvelope(envelope_block->data, gain_block->data, n);
+        calcGain.calcGainFromEnvelope(envelope, gain, n);
         
         //apply gain
-        arm_mult_f32(x, gain_block->data, y, n);
-
-        // release memory
-        AudioStream_F32::release(envelope_block);
-        AudioStream_F32::release(gain_block);
+        arm_mult_f32(x, gain, y, n);
+        return 0;
     }
 
 
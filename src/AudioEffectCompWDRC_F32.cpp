@@ -94,7 +94,7 @@ void AudioEffectCompWDRC_F32::update(void) {
 int AudioEffectCompWDRC_F32::processAudioBlock(audio_block_f32_t *block, audio_block_f32_t *out_block) {
 	if ((block == NULL) || (out_block == NULL)) return -1;  //-1 is error
 	
-	compress(block->data, out_block->data, block->length);
+	if (compress(block->data, out_block->data, block->length) != 0) return -1;  //-1 is error
 	
 	//copy the audio_block info
 	out_block->id = block->id;
@@ -103,28 +103,30 @@ int AudioEffectCompWDRC_F32::processAudioBlock(audio_block_f32_t *block, audio_b
 	return 0;  //0 is OK
 }
 
-void AudioEffectCompWDRC_F32::compress(float *x, float *y, int n)    
+int AudioEffectCompWDRC_F32::compress(float *x, float *y, int n)    
 //x, input, audio waveform data
 //y, output, audio waveform data after compression
 //n, input, number of samples in this audio block
+//returns zero if OK.  If it could not get its memory, the audio is passed through unchanged and it returns -1.
 {        
+	//get temporary arrays from the scratch memory (not the audio block pool)
+	AudioScratch_F32 scratch;
+	float *envelope = scratch.get(n);
+	float *gain = scratch.get(n);
+	if ((envelope == NULL) || (gain == NULL)) {  //failed to get memory
+		if (y != x) for (int i=0; i < n; i++) y[i] = x[i];
+		return -1;
+	}
+
 	// find smoothed envelope
-	audio_block_f32_t *envelope_block = AudioStream_F32::allocate_f32();
-	if (envelope_block == NULL) return;  //failed to allocate
-	calcEnvelope.smooth_env(x, envelope_block->data, n);
-	//float *xpk = envelope_block->data; //get pointer to the array of (empty) data values
+	calcEnvelope.smooth_env(x, envelope, n);
 
 	//calculate gain
-	audio_block_f32_t *gain_block = AudioStream_F32::allocate_f32();
-	if (gain_block == NULL) return;  //failed to allocate
-	calcGain.calcGainFromEnvelope(envelope_block->data, gain_block->data, n);
+	calcGain.calcGainFromEnvelope(envelope, gain, n);
 	
 	//apply gain
-	arm_mult_f32(x, gain_block->data, y, n);
-
-	// release memory
-	AudioStream_F32::release(envelope_block);
-	AudioStream_F32::release(gain_block);
+	arm_mult_f32(x, gain, y, n);
+	return 0;
 }
 
 
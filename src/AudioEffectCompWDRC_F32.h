@@ -78,11 +78,13 @@ class AudioEffectCompWDRC_F32 : public AudioStream_F32
     AudioEffectCompWDRC_F32(void): AudioStream_F32(1,inputQueueArray) { //need to modify this for user to set sample rate
       setSampleRate_Hz(AUDIO_SAMPLE_RATE);  //use the default sample rate from the Teensy Audio library
       setDefaultValues();
+      AudioScratchArena_F32::reserve(3, MAX_AUDIO_BLOCK_SAMPLES_F32); //for compress(): envelope and gain, plus one array inside calcGain
     }
 
     AudioEffectCompWDRC_F32(const AudioSettings_F32 settings): AudioStream_F32(1,inputQueueArray) { //need to modify this for user to set sample rate
       setSampleRate_Hz(settings.sample_rate_Hz);
       setDefaultValues();
+      AudioScratchArena_F32::reserve(3, settings.audio_block_samples); //for compress(): envelope and gain, plus one array inside calcGain
     }
 
 	//initialize with the default values
@@ -105,7 +107,7 @@ class AudioEffectCompWDRC_F32 : public AudioStream_F32
     //Here is the function that actually does all the work
 	//This method uses simply float arrays as the inptus and outputs, so that this is maximally compatible
 	//with other ways of using this class.
-     void compress(float *x, float *y, int n);
+     int compress(float *x, float *y, int n);  //returns zero if OK
 
 	// ///////////////////////// These are the methods used to configure or otherwise interact with this class
 
@@ -132,6 +134,12 @@ class AudioEffectCompWDRC_F32 : public AudioStream_F32
     float getGain_dB(void) { return calcGain.getGain_dB(); }
 	float getCurrentGain_dB(void) { return calcGain.getCurrentGain_dB(); }
     float getCurrentLevel_dB(void) { return AudioCalcGainWDRC_F32::db2(calcEnvelope.getCurrentLevel()); }  //this is 20*log10(abs(signal)) after the envelope smoothing
+
+	//use the faster, table-driven gain calculation (see AudioCalcGainWDRC_F32::calcGainFromEnvelope_fast)
+	bool setUseFastGain(bool enable) { return calcGain.setUseFastGain(enable); }
+	bool getUseFastGain(void) { return calcGain.getUseFastGain(); }
+	int setGainDecimation(int k) { return calcGain.setGainDecimation(k); }
+	int getGainDecimation(void) { return calcGain.getGainDecimation(); }
 	
 	//set or get the other parameters
 	void setAttackRelease_msec(float32_t attack_ms, float32_t release_ms) {
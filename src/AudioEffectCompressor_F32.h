@@ -7,6 +7,15 @@
 
    This processes a single stream fo audio data (ie, it is mono)
 
+   Fused core (Oct 2026): by default, update() runs the level estimate, the static compression curve, the
+       attack/release smoothing, and the application of the gain in a single pass through the audio, with no
+       temporary arrays.  It works in the log2 domain: the level is log2 of the smoothed power, the static curve
+       is a lookup table (with linear interpolation) indexed by that level, and the smoothed gain (in log2 units)
+       is turned back into a linear gain via a second lookup table.  Use setUseFusedProcessing(false) to go back
+       to the original step-by-step calculation (calcAudioLevel_dB(), calcGain(), etc).  The level uses the same
+       log2 fit as before (log2f_approx_bits(), within 1.4e-3), and exp2f_lut() is within 1.5e-5 (relative),
+       so the gain stays within about 0.0025 dB of the step-by-step calculation.
+
    MIT License.  use at your own risk.
 */
 
@@ -16,6 +25,11 @@
 #include <arm_math.h> //ARM DSP extensions.  https://www.keil.com/pack/doc/CMSIS/DSP/html/index.html
 #include "AudioStream_F32.h"
 
+#define COMPRESSOR_CURVE_LUT_LEN     192    //number of points in the static-curve lookup table
+#define COMPRESSOR_CURVE_LUT_THRESH  128    //the threshold lands exactly on this point of the table
+#define COMPRESSOR_CURVE_LUT_STEP    0.25f  //spacing of the table, in log2 units of power (about 0.75 dB)
+#define COMPRESSOR_EXP2_LUT_LEN      64     //number of points in the table for 2^x, 0 <= x < 1
+
 class AudioEffectCompressor_F32 : public AudioStream_F32
 {
   //GUI: inputs:1, outputs:1  //this line used for automatic generation of GUI node
@@ -23,10 +37,12 @@ class AudioEffectCompressor_F32 : public AudioStream_F32
     //constructor
     AudioEffectCompressor_F32(void) : AudioStream_F32(1, inputQueueArray_f32) {
 	  setDefaultValues(AUDIO_SAMPLE_RATE);   resetStates();
+	  AudioScratchArena_F32::reserve(5, MAX_AUDIO_BLOCK_SAMPLES_F32);  //deepest use of scratch memory is update() -> calcGain() -> calcInstantaneousTargetGain()
     };
 	
     AudioEffectCompressor_F32(const AudioSettings_F32 &settings) : AudioStream_F32(1, inputQueueArray_f32) {
 	  setDefaultValues(settings.sample_rate_Hz);   resetStates();
+	  AudioScratchArena_F32::reserve(5, settings.audio_block_samples);  //deepest use of scratch memory is update() -> calcGain() -> calcInstantaneousTargetGain()
     };
 	
 	void setDefaultValues(const float sample_rate_Hz) {
@@ -49,135 +65,226 @@ class AudioEffectCompressor_F32 : public AudioStream_F32
       //apply the pre-gain...a negative gain value will disable
       if (pre_gain > 0.0f) arm_scale_f32(audio_block->data, pre_gain, audio_block->data, audio_block->length); //use ARM DSP for speed!
 
+      //do all of the compression in one go, without any temporary arrays
+      const int n = audio_block->length;
+      if (use_fused_processing) {
+        processSamples_fused(audio_block->data, n);
+        AudioStream_F32::transmit(audio_block);
+        AudioStream_F32::release(audio_block);
+        return;
+      }
+
+      //get the temporary arrays from the scratch memory (not from the pool of audio blocks)
+      AudioScratch_F32 scratch;
+      float32_t *audio_level_dB = scratch.get(n);
+      float32_t *gain = scratch.get(n);
+      if ((audio_level_dB == NULL) || (gain == NULL)) { AudioStream_F32::release(audio_block); return; }
+
       //calculate the level of the audio (ie, calculate a smoothed version of the signal power)
-      audio_block_f32_t *audio_level_dB_block = AudioStream_F32::allocate_f32();
-      calcAudioLevel_dB(audio_block, audio_level_dB_block); //returns through audio_level_dB_block
+      calcAudioLevel_dB(audio_block->data, audio_level_dB, n); //returns through audio_level_dB
 
       //compute the desired gain based on the observed audio level
-      audio_block_f32_t *gain_block = AudioStream_F32::allocate_f32();
-      calcGain(audio_level_dB_block, gain_block);  //returns through gain_block
+      calcGain(audio_level_dB, gain, n);  //returns through gain
 
       //apply the desired gain...store the processed audio back into audio_block
-      arm_mult_f32(audio_block->data, gain_block->data, audio_block->data, audio_block->length);
+      arm_mult_f32(audio_block->data, gain, audio_block->data, n);
 
       //transmit the block and release memory
       AudioStream_F32::transmit(audio_block);
       AudioStream_F32::release(audio_block);
-      AudioStream_F32::release(gain_block);
-      AudioStream_F32::release(audio_level_dB_block);
+    }
+
+    //Here's the fused version of calcAudioLevel_dB(), calcGain(), and the application of the gain.  The audio is
+    //processed in place.  The states are shared with the step-by-step methods, so you can switch back and forth.
+    void processSamples_fused(float32_t *audio, const int n) {
+      const float32_t c1 = level_lp_const, c2 = 1.0f - c1;
+      const float32_t a1 = attack_const, r1 = release_const;
+      const float32_t lut_L0 = curve_lut_L0, inv_step = 1.0f / COMPRESSOR_CURVE_LUT_STEP;
+      float32_t level_pow = prev_level_lp_pow;
+      float32_t gain_log2 = prev_gain_dB * (1.0f/6.020599913279623f);  //dB to log2 units of amplitude
+
+      for (int i = 0; i < n; i++) {
+        const float32_t x = audio[i];
+
+        //smooth the signal power and take its log2
+        level_pow = c1*level_pow + c2*(x*x);
+        const float32_t level_log2 = log2f_approx_bits(level_pow);
+
+        //look up the target gain on the static curve (extrapolate off either end using the end segment)
+        const float32_t ind_f = (level_log2 - lut_L0)*inv_step;
+        const int ind = min(max((int)ind_f, 0), COMPRESSOR_CURVE_LUT_LEN-2);
+        const float32_t frac = ind_f - (float32_t)ind;
+        const float32_t targ_log2 = curve_lut[ind] + frac*(curve_lut[ind+1] - curve_lut[ind]);
+
+        //attack or release (written as c*prev + (1-c)*targ, but without a branch)
+        const float32_t c = (targ_log2 < gain_log2) ? a1 : r1;
+        gain_log2 = targ_log2 + c*(gain_log2 - targ_log2);
+
+        //apply the gain
+        audio[i] = x * exp2f_lut(gain_log2);
+      }
+
+      //save the states (limit how far the level can go toward negative infinity, just like calcAudioLevel_dB())
+      prev_level_lp_pow = max(level_pow, 1.0E-13f);
+      prev_gain_dB = gain_log2 * 6.020599913279623f;
+    }
+    void setUseFusedProcessing(bool use) { use_fused_processing = use; }
+    bool getUseFusedProcessing(void) { return use_fused_processing; }
+
+    //2^x via a table for the fractional part and the float's exponent for the integer part.  Used by the fused processing.
+    float32_t exp2f_lut(float32_t x) const {
+      x = min(max(x, -126.0f), 127.0f);  //keep the result a normal float
+      const int x_int = (int)(x + 128.0f) - 128;  //round toward -inf (floorf() without the function call)
+      const float32_t ind_f = (x - (float32_t)x_int) * (float32_t)COMPRESSOR_EXP2_LUT_LEN;
+      const int ind = (int)ind_f;
+      const float32_t frac = ind_f - (float32_t)ind;
+      const float32_t mant = exp2_lut[ind] + frac*(exp2_lut[ind+1] - exp2_lut[ind]);
+      union { uint32_t i; float32_t f; } scale;  //build 2^(integer part) directly from its exponent bits
+      scale.i = ((uint32_t)(x_int + 127)) << 23;
+      return mant * scale.f;
+    }
+
+    //Same as log2f_approx(), but it pulls the fraction and exponent straight from the bits of the float
+    //instead of calling frexpf().  Only for positive, normal numbers (like the smoothed signal power).
+    static float log2f_approx_bits(float X) {
+      union { float32_t f; uint32_t i; } u;
+      u.f = X;
+      const int E = (int)((u.i >> 23) & 0xFF) - 126;
+      u.i = (u.i & 0x007FFFFF) | 0x3F000000;  //F is now in [0.5, 1.0), just like from frexpf()
+      const float F = u.f;
+      return ((((1.23149591368684f*F) - 4.11852516267426f)*F + 6.02197014179219f)*F - 3.13396450166353f) + E;
+    }
+
+    //Block-based versions of the methods below (kept for compatibility).  They use the length of the first block.
+    void calcAudioLevel_dB(audio_block_f32_t *wav_block, audio_block_f32_t *level_dB_block) { 
+      calcAudioLevel_dB(wav_block->data, level_dB_block->data, wav_block->length);
+    }
+    void calcGain(audio_block_f32_t *audio_level_dB_block, audio_block_f32_t *gain_block) { 
+      calcGain(audio_level_dB_block->data, gain_block->data, audio_level_dB_block->length);
+    }
+    void calcInstantaneousTargetGain(audio_block_f32_t *audio_level_dB_block, audio_block_f32_t *inst_targ_gain_dB_block) {
+      calcInstantaneousTargetGain(audio_level_dB_block->data, inst_targ_gain_dB_block->data, audio_level_dB_block->length);
+    }
+    void calcSmoothedGain_dB(audio_block_f32_t *inst_targ_gain_dB_block, audio_block_f32_t *gain_dB_block) {
+      calcSmoothedGain_dB(inst_targ_gain_dB_block->data, gain_dB_block->data, inst_targ_gain_dB_block->length);
     }
 
     // Here's the method that estimates the level of the audio (in dB)
     // It squares the signal and low-pass filters to get a time-averaged
     // signal power.  It then 
-    void calcAudioLevel_dB(audio_block_f32_t *wav_block, audio_block_f32_t *level_dB_block) { 
+    void calcAudioLevel_dB(const float32_t *wav, float32_t *level_dB, const int n) { 
     	
       // calculate the instantaneous signal power (square the signal)
-      audio_block_f32_t *wav_pow_block = AudioStream_F32::allocate_f32();
-      arm_mult_f32(wav_block->data, wav_block->data, wav_pow_block->data, wav_block->length);
+      AudioScratch_F32 scratch;
+      float32_t *wav_pow = scratch.get(n);
+      if (wav_pow == NULL) wav_pow = level_dB;  //no scratch memory, so work in the output array instead (the loop below goes sample-by-sample)
+      arm_mult_f32((float32_t *)wav, (float32_t *)wav, wav_pow, n);
 
       // low-pass filter and convert to dB
       float c1 = level_lp_const, c2 = 1.0f - c1; //prepare constants
-      for (int i = 0; i < wav_pow_block->length; i++) {
+      for (int i = 0; i < n; i++) {
         // first-order low-pass filter to get a running estimate of the average power
-        wav_pow_block->data[i] = c1*prev_level_lp_pow + c2*wav_pow_block->data[i];
+        wav_pow[i] = c1*prev_level_lp_pow + c2*wav_pow[i];
         
         // save the state of the first-order low-pass filter
-        prev_level_lp_pow = wav_pow_block->data[i]; 
+        prev_level_lp_pow = wav_pow[i]; 
 
         //now convert the signal power to dB (but not yet multiplied by 10.0)
-        level_dB_block->data[i] = log10f_approx(wav_pow_block->data[i]);
+        level_dB[i] = log10f_approx(wav_pow[i]);
       }
 
       //limit the amount that the state of the smoothing filter can go toward negative infinity
       if (prev_level_lp_pow < (1.0E-13)) prev_level_lp_pow = 1.0E-13;  //never go less than -130 dBFS 
 
-      //scale the wav_pow_block by 10.0 to complete the conversion to dB
-      arm_scale_f32(level_dB_block->data, 10.0f, level_dB_block->data, level_dB_block->length); //use ARM DSP for speed!
+      //scale by 10.0 to complete the conversion to dB
+      arm_scale_f32(level_dB, 10.0f, level_dB, n); //use ARM DSP for speed!
 
-      //release memory and return
-      AudioStream_F32::release(wav_pow_block);
-      return; //output is passed through level_dB_block
+      return; //output is passed through level_dB
     }
 
     //This method computes the desired gain from the compressor, given an estimate
     //of the signal level (in dB)
-    void calcGain(audio_block_f32_t *audio_level_dB_block, audio_block_f32_t *gain_block) { 
+    void calcGain(const float32_t *audio_level_dB, float32_t *gain, const int n) { 
+      AudioScratch_F32 scratch;
+      float32_t *inst_targ_gain_dB = scratch.get(n); 
+      float32_t *gain_dB = scratch.get(n); 
+      if (inst_targ_gain_dB == NULL) inst_targ_gain_dB = gain;  //no scratch memory, so work in the output array instead
+      if (gain_dB == NULL) gain_dB = gain;                      //(each step below goes sample-by-sample)
     
       //first, calculate the instantaneous target gain based on the compression ratio
-      audio_block_f32_t *inst_targ_gain_dB_block = AudioStream_F32::allocate_f32(); 
-      calcInstantaneousTargetGain(audio_level_dB_block, inst_targ_gain_dB_block);
+      calcInstantaneousTargetGain(audio_level_dB, inst_targ_gain_dB, n);
     
       //second, smooth in time (attack and release) by stepping through each sample
-      audio_block_f32_t *gain_dB_block = AudioStream_F32::allocate_f32(); 
-      calcSmoothedGain_dB(inst_targ_gain_dB_block,gain_dB_block);
+      calcSmoothedGain_dB(inst_targ_gain_dB, gain_dB, n);
 
       //finally, convert from dB to linear gain: gain = 10^(gain_dB/20);  (ie this takes care of the sqrt, too!)
-      arm_scale_f32(gain_dB_block->data, 1.0f/20.0f, gain_dB_block->data, gain_dB_block->length);  //divide by 20 
-      for (int i = 0; i < gain_dB_block->length; i++) gain_block->data[i] = pow10f(gain_dB_block->data[i]); //do the 10^(x)
-      
+      arm_scale_f32(gain_dB, 1.0f/20.0f, gain_dB, n);  //divide by 20 
+      for (int i = 0; i < n; i++) gain[i] = pow10f(gain_dB[i]); //do the 10^(x)
 
-      //release memory and return
-      AudioStream_F32::release(gain_dB_block);
-      AudioStream_F32::release(inst_targ_gain_dB_block);
-      return;  //output is passed through gain_block
+      return;  //output is passed through gain
     }
       
     //Compute the instantaneous desired gain, including the compression ratio and
     //threshold for where the comrpession kicks in
-    void calcInstantaneousTargetGain(audio_block_f32_t *audio_level_dB_block, audio_block_f32_t *inst_targ_gain_dB_block) {
+    void calcInstantaneousTargetGain(const float32_t *audio_level_dB, float32_t *inst_targ_gain_dB, const int n) {
       
       // how much are we above the compression threshold?
-      audio_block_f32_t *above_thresh_dB_block = AudioStream_F32::allocate_f32(); 
-      arm_offset_f32(audio_level_dB_block->data,  //CMSIS DSP for "add a constant value to all elements"
+      AudioScratch_F32 scratch;
+      float32_t *above_thresh_dB = scratch.get(n); 
+      if (above_thresh_dB == NULL) {  //no scratch memory, so do the same math one sample at a time
+        for (int i=0; i < n; i++) {
+          const float32_t above = audio_level_dB[i] - thresh_dBFS;
+          inst_targ_gain_dB[i] = min(0.0f, above * (1.0f / comp_ratio) - above);
+        }
+        return;
+      }
+      arm_offset_f32((float32_t *)audio_level_dB,  //CMSIS DSP for "add a constant value to all elements"
         -thresh_dBFS,                         //this is the value to be added
-        above_thresh_dB_block->data,          //this is the output
-        audio_level_dB_block->length);  
+        above_thresh_dB,                      //this is the output
+        n);  
 
       // scale by the compression ratio...this is what the output level should be (this is our target level)
-      arm_scale_f32(above_thresh_dB_block->data,    //CMSIS DSP for "multiply all elements by a constant value"
-           1.0f / comp_ratio,                       //this is the value to be multiplied 
-           inst_targ_gain_dB_block->data,           //this is the output
-           above_thresh_dB_block->length); 
+      arm_scale_f32(above_thresh_dB,          //CMSIS DSP for "multiply all elements by a constant value"
+           1.0f / comp_ratio,                 //this is the value to be multiplied 
+           inst_targ_gain_dB,                 //this is the output
+           n); 
 
       // compute the instantaneous gain...which is the difference between the target level and the original level
-      arm_sub_f32(inst_targ_gain_dB_block->data,  //CMSIS DSP for "subtract two vectors element-by-element"
-           above_thresh_dB_block->data,           //this is the vector to be subtracted
-           inst_targ_gain_dB_block->data,         //this is the output
-           inst_targ_gain_dB_block->length);
+      arm_sub_f32(inst_targ_gain_dB,          //CMSIS DSP for "subtract two vectors element-by-element"
+           above_thresh_dB,                   //this is the vector to be subtracted
+           inst_targ_gain_dB,                 //this is the output
+           n);
 
       // limit the target gain to attenuation only (this part of the compressor should not make things louder!)
-      for (int i=0; i < inst_targ_gain_dB_block->length; i++) {
-        if (inst_targ_gain_dB_block->data[i] > 0.0f) inst_targ_gain_dB_block->data[i] = 0.0f;
+      for (int i=0; i < n; i++) {
+        if (inst_targ_gain_dB[i] > 0.0f) inst_targ_gain_dB[i] = 0.0f;
       }
 
-      // release memory before returning
-      AudioStream_F32::release(above_thresh_dB_block);
-      return;  //output is passed through inst_targ_gain_dB_block
+      return;  //output is passed through inst_targ_gain_dB
     }
 
     //this method applies the "attack" and "release" constants to smooth the
     //target gain level through time.
-    void calcSmoothedGain_dB(audio_block_f32_t *inst_targ_gain_dB_block, audio_block_f32_t *gain_dB_block) {
+    void calcSmoothedGain_dB(const float32_t *inst_targ_gain_dB, float32_t *gain_dB_out, const int n) {
       float32_t gain_dB;
       float32_t one_minus_attack_const = 1.0f - attack_const;
       float32_t one_minus_release_const = 1.0f - release_const;
-      for (int i = 0; i < inst_targ_gain_dB_block->length; i++) {
-        gain_dB = inst_targ_gain_dB_block->data[i];
+      for (int i = 0; i < n; i++) {
+        gain_dB = inst_targ_gain_dB[i];
 
         //smooth the gain using the attack or release constants
         if (gain_dB < prev_gain_dB) {  //are we in the attack phase?
-          gain_dB_block->data[i] = attack_const*prev_gain_dB + one_minus_attack_const*gain_dB;
+          gain_dB_out[i] = attack_const*prev_gain_dB + one_minus_attack_const*gain_dB;
         } else {   //or, we're in the release phase
-          gain_dB_block->data[i] = release_const*prev_gain_dB + one_minus_release_const*gain_dB;
+          gain_dB_out[i] = release_const*prev_gain_dB + one_minus_release_const*gain_dB;
         }
 
         //save value for the next time through this loop
-        prev_gain_dB = gain_dB_block->data[i];
+        prev_gain_dB = gain_dB_out[i];
       }
 
       //return
-      return;  //the output here is gain_block
+      return;  //the output here is gain_dB_out
     }
 
 
@@ -265,8 +372,37 @@ class AudioEffectCompressor_F32 : public AudioStream_F32
     void updateThresholdAndCompRatioConstants(void) {
       comp_ratio_const = 1.0f-(1.0f / comp_ratio);
       thresh_pow_FS_wCR = powf(thresh_pow_FS, comp_ratio_const);    
+      updateCurveLUT();
+    }
+
+    //lookup tables for the fused processing
+    bool use_fused_processing = true;
+    float32_t curve_lut[COMPRESSOR_CURVE_LUT_LEN];  //target gain (log2 units of amplitude) vs level (log2 units of power)
+    float32_t curve_lut_L0 = 0.0f;                   //level at the first point of curve_lut
+    void updateCurveLUT(void) {
+      //put the threshold exactly on one of the points so that the corner of the curve is exact
+      const float32_t thresh_log2 = log2f(max(thresh_pow_FS, 1.0E-30f));
+      curve_lut_L0 = thresh_log2 - COMPRESSOR_CURVE_LUT_THRESH*COMPRESSOR_CURVE_LUT_STEP;
+      for (int i = 0; i < COMPRESSOR_CURVE_LUT_LEN; i++) {
+        //same curve as calcInstantaneousTargetGain(): gain_dB = min(0, (level_dB - thresh_dB)*(1/CR - 1)).  In
+        //log2 units, the level is a power and the gain is an amplitude, hence the factor of 0.5
+        const float32_t above_thresh_log2 = (float32_t)(i - COMPRESSOR_CURVE_LUT_THRESH) * COMPRESSOR_CURVE_LUT_STEP;
+        curve_lut[i] = min(0.0f, -0.5f * comp_ratio_const * above_thresh_log2);
+      }
     }
 
+    //table of 2^x for 0 <= x <= 1, for exp2f_lut()
+    static const float32_t *exp2_frac_lut(void) {
+      static float32_t lut[COMPRESSOR_EXP2_LUT_LEN+1];
+      static bool is_built = false;
+      if (!is_built) {
+        for (int i = 0; i <= COMPRESSOR_EXP2_LUT_LEN; i++) lut[i] = powf(2.0f, ((float)i) / ((float)COMPRESSOR_EXP2_LUT_LEN));
+        is_built = true;
+      }
+      return lut;
+    }
+    const float32_t *exp2_lut = exp2_frac_lut();  //build it once, when the first compressor is created
+
     //settings
     float32_t attack_sec, release_sec, level_lp_sec; 
     float32_t thresh_dBFS = 0.0;  //threshold for compression, relative to digital full scale
@@ -327,7 +463,6 @@ class AudioEffectCompressor_F32 : public AudioStream_F32
       return(Y);
     }
     
-    
 };
 
 #endif
@@ -0,0 +1,160 @@
+/*
+ * AudioEffectLimiter_F32.cpp
+ *
+ * OpenAudio, Oct 2026
+ *
+ * MIT License,  Use at your own risk.
+ *
+*/
+
+#include "AudioEffectLimiter_F32.h"
+
+float AudioEffectLimiter_F32::setLookAhead_msec(float msec) {
+	lookahead_msec = max(0.0f, msec);
+	detector_delay = use_true_peak ? LIMITER_TRUEPEAK_DELAY_SAMPLES : 0;
+	int n = (int)(lookahead_msec * 0.001f * sample_rate_Hz + 0.5f);
+	if (n < max(1, detector_delay)) n = max(1, detector_delay);  //the true-peak detector needs this much of the future
+	if (n > LIMITER_MAX_LOOKAHEAD_SAMPLES) {
+		Serial.println(F("AudioEffectLimiter_F32: setLookAhead_msec: limiting look-ahead to ") + String(LIMITER_MAX_LOOKAHEAD_SAMPLES) + F(" samples."));
+		n = LIMITER_MAX_LOOKAHEAD_SAMPLES;
+	}
+	lookahead_samps = n;
+	resetState();
+	return getLookAhead_msec();
+}
+
+float AudioEffectLimiter_F32::setRelease_msec(float msec) {
+	release_msec = max(0.0f, msec);
+	if (release_msec < 0.001f) {
+		release_coeff = 0.0f;  //instantaneous release (well, still smoothed by the look-ahead moving average)
+	} else {
+		release_coeff = expf(-1.0f / (release_msec * 0.001f * sample_rate_Hz));
+	}
+	return release_msec;
+}
+
+void AudioEffectLimiter_F32::resetState(void) {
+	for (int i=0; i < LIMITER_MAX_LOOKAHEAD_SAMPLES; i++) delay_line[i] = 0.0f;
+	for (int i=0; i < LIMITER_MAX_LOOKAHEAD_SAMPLES+1; i++) gain_hist[i] = 1.0f;
+	for (int i=0; i < 2*LIMITER_TRUEPEAK_TAPS; i++) tp_hist[i] = 0.0f;
+	delay_ind = 0;  gain_ind = 0;  tp_ind = 0;
+	gain_sum = (float32_t)(lookahead_samps - detector_delay + 1);  //the sum of the gain_hist values that are in use
+	dq_front = 0;  dq_len = 0;  sample_count = 0;
+	released_gain = 1.0f;  cur_gain = 1.0f;  tp_prev_between = 0.0f;
+}
+
+//Design the interpolator for the true-peak detector.  Each phase is a Hann-windowed sinc that gives the
+//point at p/LIMITER_TRUEPEAK_OVERSAMPLE of the way between the middle two of LIMITER_TRUEPEAK_TAPS samples,
+//normalized to unity gain at DC.
+void AudioEffectLimiter_F32::designTruePeakInterpolator(void) {
+	const int mid = LIMITER_TRUEPEAK_TAPS/2 - 1;  //the tap of the sample just before the interpolated points
+	const float half_width = (float)(LIMITER_TRUEPEAK_TAPS/2);
+	for (int p=1; p < LIMITER_TRUEPEAK_OVERSAMPLE; p++) {
+		const float frac = ((float)p) / ((float)LIMITER_TRUEPEAK_OVERSAMPLE);
+		float sum = 0.0f;
+		for (int j=0; j < LIMITER_TRUEPEAK_TAPS; j++) {
+			const float u = frac - (float)(j - mid);  //distance from this tap to the interpolated point, in samples
+			const float sinc = sinf(PI*u) / (PI*u);   //u is never zero, since frac is between 0 and 1
+			const float window = 0.5f + 0.5f*cosf(PI*u/half_width);
+			tp_coeff[p-1][j] = sinc * window;
+			sum += tp_coeff[p-1][j];
+		}
+		for (int j=0; j < LIMITER_TRUEPEAK_TAPS; j++) tp_coeff[p-1][j] /= sum;
+	}
+}
+
+//Add a sample to the true-peak detector.  Returns the estimated true peak around the sample that is
+//LIMITER_TRUEPEAK_DELAY_SAMPLES old: the largest of its own magnitude and the interpolated points between
+//it and each of its neighbors.
+float32_t AudioEffectLimiter_F32::truePeak(const float32_t x) {
+	const int N = LIMITER_TRUEPEAK_TAPS;
+	tp_hist[tp_ind] = x;  tp_hist[tp_ind + N] = x;
+	if (++tp_ind >= N) tp_ind = 0;
+	const float32_t *h = &(tp_hist[tp_ind]);  //the newest N samples, oldest first
+
+	float32_t between = 0.0f;
+	for (int p=0; p < LIMITER_TRUEPEAK_OVERSAMPLE-1; p++) {
+		float32_t acc = 0.0f;
+		for (int j=0; j < N; j++) acc += tp_coeff[p][j] * h[j];
+		acc = fabsf(acc);
+		if (acc > between) between = acc;
+	}
+
+	float32_t peak = fabsf(h[N/2 - 1]);
+	if (tp_prev_between > peak) peak = tp_prev_between;
+	if (between > peak) peak = between;
+	tp_prev_between = between;
+	return peak;
+}
+
+void AudioEffectLimiter_F32::update(void) {
+	audio_block_f32_t *block = AudioStream_F32::receiveWritable_f32();
+	if (!block) return;
+
+	if (is_enabled) processSamples(block->data, block->data, block->length);  //in place
+
+	AudioStream_F32::transmit(block);
+	AudioStream_F32::release(block);
+}
+
+int AudioEffectLimiter_F32::processAudioBlock(audio_block_f32_t *block, audio_block_f32_t *block_new) {
+	if ((block == NULL) || (block_new == NULL)) return -1;  //-1 is error
+
+	if (is_enabled) {
+		processSamples(block->data, block_new->data, block->length);
+	} else if (block_new != block) {
+		for (int i=0; i < block->length; i++) block_new->data[i] = block->data[i];
+	}
+	block_new->id = block->id;
+	block_new->length = block->length;
+	return 0;
+}
+
+void AudioEffectLimiter_F32::processSamples(const float32_t *in, float32_t *out, const int n) {
+	const int L = lookahead_samps;       //length of the delay line
+	const int W = L - detector_delay + 1;  //length of the peak window and of the gain average.  The detector's output is already detector_delay old.
+	const float32_t inv_W = 1.0f / ((float32_t)W);
+	const float32_t ceil_val = ceiling, a_rel = release_coeff;
+	const float32_t aim_val = ceiling * 0.99994f;  //aim 0.0005 dB low, so that round-off in the moving average can't reach the ceiling
+
+	float32_t g_rel = released_gain, g_min = min_gain, g = cur_gain, g_sum = gain_sum;
+	int d_ind = delay_ind, g_ind = gain_ind;
+	for (int i=0; i < n; i++) {
+		const float32_t x = in[i];  //read before writing, in case this is in-place
+		const float32_t ax = use_true_peak ? truePeak(x) : fabsf(x);  //the peak around the sample that is detector_delay old
+
+		//sliding-window maximum: drop the oldest value if it has left the window, drop the smaller values
+		//from the back (they can never be the maximum again), then add this one.  At most W values are held.
+		if ((dq_len > 0) && ((sample_count - dq_count[dq_front]) >= (uint32_t)W)) { if (++dq_front >= W) dq_front = 0; dq_len--; }
+		int back = dq_front + dq_len - 1;  if (back >= W) back -= W;
+		while ((dq_len > 0) && (dq_val[back] <= ax)) { dq_len--; if (--back < 0) back = W-1; }
+		if (++back >= W) back = 0;
+		dq_val[back] = ax;  dq_count[back] = sample_count;  dq_len++;
+		sample_count++;
+		const float32_t peak = dq_val[dq_front];
+
+		//gain needed for the loudest sample in the window, with a slow release
+		const float32_t target = (peak > aim_val) ? (aim_val / peak) : 1.0f;
+		g_rel = (target < g_rel) ? target : (target + a_rel*(g_rel - target));
+
+		//moving average over the window.  It is re-summed once per trip around the window (not once per call),
+		//so that round-off can't accumulate and the output does not depend on how the audio is split into calls.
+		g_sum += g_rel - gain_hist[g_ind];
+		gain_hist[g_ind] = g_rel;
+		if (++g_ind >= W) {
+			g_ind = 0;
+			g_sum = 0.0f;  for (int k=0; k < W; k++) g_sum += gain_hist[k];
+		}
+		g = g_sum * inv_W;
+		if (g < g_min) g_min = g;
+
+		//delay the audio and apply the gain
+		float32_t y = delay_line[d_ind] * g;
+		delay_line[d_ind] = x;
+		if (++d_ind >= L) d_ind = 0;
+		if (fabsf(y) > ceil_val) { y = (y > 0.0f) ? ceil_val : -ceil_val; n_clipped++; }  //safety net
+		out[i] = y;
+	}
+	released_gain = g_rel;  cur_gain = g;  min_gain = g_min;  gain_sum = g_sum;
+	delay_ind = d_ind;  gain_ind = g_ind;
+}
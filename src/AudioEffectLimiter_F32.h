@@ -0,0 +1,138 @@
+/*
+ * AudioEffectLimiter_F32
+ *
+ * Created: OpenAudio, Oct 2026
+ *
+ * Purpose: Look-ahead brickwall limiter.  Unlike the WDRC "bolt" limiter (a 10:1 compressor driven by a
+ *     peak envelope), this limiter delays the audio by a short look-ahead (0.5-2 msec) so that the gain
+ *     has already come down by the time a peak reaches the output.  The output never exceeds the ceiling.
+ *
+ *     For each sample:
+ *        * The true (ie, inter-sample) peak is estimated by 4x oversampling, as in ITU-R BS.1770.  This is
+ *          only done on the detector path: a short polyphase interpolator gives three points between each
+ *          pair of samples, and the detector takes the largest magnitude around each sample.  The audio
+ *          itself is not resampled.
+ *        * The peak over the look-ahead window is found with a sliding-window maximum (a monotonic deque),
+ *          which costs O(1) per sample no matter how long the look-ahead is.
+ *        * The gain needed to bring that peak down to the ceiling is allowed to rise again (ie, release)
+ *          only slowly, via a one-pole filter.
+ *        * The gain is then smoothed with a moving average that spans the look-ahead.  Because every gain
+ *          value in the average is already low enough for the delayed sample, the average is too.  So the
+ *          attack is a smooth ramp, yet the ceiling is still guaranteed.
+ *     As a final safety net (for example, against round-off in the moving average), any output sample above
+ *     the ceiling is clipped.  getNumClipped() reports how often that happened, which should be never.
+ *
+ *     The interpolator needs LIMITER_TRUEPEAK_DELAY_SAMPLES of the future, which is taken out of the
+ *     look-ahead, so the look-ahead is at least that long.  Like any 4x true-peak meter, the estimate can
+ *     read low (by up to about 0.5 dB near fs/2, and about 0.15 dB below fs/4), and very short look-aheads
+ *     move the gain fast enough to add some overshoot of their own.  With a look-ahead of 0.5 msec or more,
+ *     the true peak of the output stays within about 0.2 dB of the ceiling for content below fs/4, so leave
+ *     that much margin in the ceiling if it matters.  Use setUseTruePeak(false) to limit only the
+ *     sample values.  All of the memory is fixed in size, so changing the look-ahead does not allocate
+ *     anything.  The latency is the look-ahead (getLookAhead_samps()).
+ *
+ * MIT License.  Use at your own risk.  Have fun!
+ *
+ */
+
+#ifndef _AudioEffectLimiter_F32_h
+#define _AudioEffectLimiter_F32_h
+
+#include <Arduino.h>
+#include "AudioStream_F32.h"
+#include "arm_math.h"
+
+#define LIMITER_MAX_LOOKAHEAD_SAMPLES  256   //2 msec at 96 kHz is 192 samples
+#define LIMITER_DEFAULT_LOOKAHEAD_MSEC 1.0f
+#define LIMITER_DEFAULT_RELEASE_MSEC   50.0f
+#define LIMITER_DEFAULT_CEILING_DBFS   -1.0f
+#define LIMITER_TRUEPEAK_OVERSAMPLE    4     //oversampling factor of the true-peak detector
+#define LIMITER_TRUEPEAK_TAPS          8     //taps per phase of the true-peak interpolator
+#define LIMITER_TRUEPEAK_DELAY_SAMPLES (LIMITER_TRUEPEAK_TAPS/2)  //how much of the future the true-peak detector needs
+
+class AudioEffectLimiter_F32 : public AudioStream_F32
+{
+//GUI: inputs:1, outputs:1  //this line used for automatic generation of GUI node
+//GUI: shortName:limiter
+	public:
+		AudioEffectLimiter_F32(void) : AudioStream_F32(1,inputQueueArray) { setDefaultValues(); }
+		AudioEffectLimiter_F32(const AudioSettings_F32 &settings) : AudioStream_F32(1,inputQueueArray),
+			sample_rate_Hz(settings.sample_rate_Hz) { setDefaultValues(); }
+
+		virtual void update(void);
+		virtual int processAudioBlock(audio_block_f32_t *block, audio_block_f32_t *block_new); //returns zero if OK
+		virtual void processSamples(const float32_t *in, float32_t *out, const int n);  //any length.  In-place is OK.
+
+		virtual bool enable(bool _enable = true) { return is_enabled = _enable; }
+		virtual bool get_is_enabled(void) { return is_enabled; }
+
+		//settings
+		virtual float setSampleRate_Hz(const float fs_Hz) { sample_rate_Hz = fs_Hz; setLookAhead_msec(lookahead_msec); setRelease_msec(release_msec); return sample_rate_Hz; }
+		virtual float getSampleRate_Hz(void) { return sample_rate_Hz; }
+		virtual float setLookAhead_msec(float msec);  //clears the limiter's state.  Limited by LIMITER_MAX_LOOKAHEAD_SAMPLES
+		virtual float getLookAhead_msec(void) { return 1000.0f * ((float)lookahead_samps) / sample_rate_Hz; }  //the actual (quantized) look-ahead
+		virtual int getLookAhead_samps(void) { return lookahead_samps; }  //this is also the latency
+		virtual float setRelease_msec(float msec);
+		virtual float getRelease_msec(void) { return release_msec; }
+		virtual float setCeiling_dBFS(float dBFS) { ceiling = powf(10.0f, dBFS/20.0f); return ceiling_dBFS = dBFS; }
+		virtual float getCeiling_dBFS(void) { return ceiling_dBFS; }
+		virtual bool setUseTruePeak(bool _use) { use_true_peak = _use; setLookAhead_msec(lookahead_msec); return use_true_peak; }  //clears the limiter's state
+		virtual bool getUseTruePeak(void) { return use_true_peak; }
+
+		virtual void resetState(void);
+
+		//status
+		virtual float getCurrentGain_dB(void) { return 20.0f*log10f(max(cur_gain, 1.0e-10f)); }
+		virtual float getMaxGainReduction_dB(void) { return -20.0f*log10f(max(min_gain, 1.0e-10f)); }  //since the last resetMaxGainReduction()
+		virtual void resetMaxGainReduction(void) { min_gain = 1.0f; }
+		virtual unsigned long getNumClipped(void) { return n_clipped; }  //output samples that the safety clipper had to catch
+
+	protected:
+		audio_block_f32_t *inputQueueArray[1];
+		bool is_enabled = true;
+		float sample_rate_Hz = AUDIO_SAMPLE_RATE;
+		float lookahead_msec = LIMITER_DEFAULT_LOOKAHEAD_MSEC, release_msec = LIMITER_DEFAULT_RELEASE_MSEC;
+		float ceiling_dBFS = LIMITER_DEFAULT_CEILING_DBFS, ceiling = 1.0f;
+		float release_coeff = 0.0f;
+		int lookahead_samps = 1;
+		bool use_true_peak = true;
+		int detector_delay = LIMITER_TRUEPEAK_DELAY_SAMPLES;  //0 when not using the true peak
+
+		//the true-peak detector: the interpolator for the points between the samples, the recent input (stored
+		//twice, so that the newest LIMITER_TRUEPEAK_TAPS are always contiguous), and the peak between the
+		//previous pair of samples
+		float32_t tp_coeff[LIMITER_TRUEPEAK_OVERSAMPLE-1][LIMITER_TRUEPEAK_TAPS];
+		float32_t tp_hist[2*LIMITER_TRUEPEAK_TAPS];
+		int tp_ind = 0;
+		float32_t tp_prev_between = 0.0f;
+		void designTruePeakInterpolator(void);
+		float32_t truePeak(const float32_t x);
+
+		//the delayed audio [lookahead_samps]
+		float32_t delay_line[LIMITER_MAX_LOOKAHEAD_SAMPLES];
+		int delay_ind = 0;
+
+		//the sliding-window maximum: a ring of (sample count, value) with the values in decreasing order
+		uint32_t dq_count[LIMITER_MAX_LOOKAHEAD_SAMPLES+1];
+		float32_t dq_val[LIMITER_MAX_LOOKAHEAD_SAMPLES+1];
+		int dq_front = 0, dq_len = 0;
+		uint32_t sample_count = 0;
+
+		//the moving average of the gain [lookahead_samps - detector_delay + 1]
+		float32_t gain_hist[LIMITER_MAX_LOOKAHEAD_SAMPLES+1];
+		int gain_ind = 0;
+		float32_t gain_sum = 0.0f;  //re-summed from gain_hist each time gain_ind wraps, so round-off can't accumulate
+		float32_t released_gain = 1.0f;
+
+		float32_t cur_gain = 1.0f, min_gain = 1.0f;
+		unsigned long n_clipped = 0;
+
+		void setDefaultValues(void) {
+			designTruePeakInterpolator();
+			setCeiling_dBFS(LIMITER_DEFAULT_CEILING_DBFS);
+			setRelease_msec(LIMITER_DEFAULT_RELEASE_MSEC);
+			setLookAhead_msec(LIMITER_DEFAULT_LOOKAHEAD_MSEC);
+		}
+};
+
+#endif
@@ -15,6 +15,7 @@ float AudioEffectMultiBandWDRC_Base_F32_UI::setSampleRate_Hz(float rate_Hz) {
 	compbank.setSampleRate_Hz(sample_rate_Hz);
 	broadbandGain.setSampleRate_Hz(sample_rate_Hz); //this algorithm doesn't care, but it does have this method, so we'll call it just in case
 	compBroadband.setSampleRate_Hz(sample_rate_Hz);
+	limiter.setSampleRate_Hz(sample_rate_Hz);
 	
 	return sample_rate_Hz;
 }
@@ -50,6 +51,11 @@ int AudioEffectMultiBandWDRC_Base_F32_UI::processAudioBlock(audio_block_f32_t *b
   //return if not enabled
   if (!is_enabled) return -1;
 
+  //use the fused processing, if requested
+  if (use_fused_processing && canUseFusedProcessing(min(fused_chunk_size, (int)block_in->length))) {
+	return processAudioBlock_fused(block_in, block_out);
+  }
+
   //get a temporary working block for audio
   audio_block_f32_t * block_tmp = AudioStream_F32::allocate_f32();
   if (block_tmp == NULL) return ret_val;  //there was no memory available 
@@ -113,6 +119,9 @@ int AudioEffectMultiBandWDRC_Base_F32_UI::processAudioBlock(audio_block_f32_t *b
 	//apply final broadband compression
 	int any_error = compBroadband.processAudioBlock(block_out, block_out);
 
+	//apply the look-ahead limiter (if enabled)
+	if (limiter.get_is_enabled()) limiter.processSamples(block_out->data, block_out->data, block_out->length);
+
 	//if it got this far without an error, it means that the data processed OK!!
 	if (!any_error) ret_val = 0;
   }
@@ -122,6 +131,76 @@ int AudioEffectMultiBandWDRC_Base_F32_UI::processAudioBlock(audio_block_f32_t *b
 
 } // close processAudioBlock()	
 
+bool AudioEffectMultiBandWDRC_Base_F32_UI::canUseFusedProcessing(int n_samps) {
+  AudioFilterbankBase_F32 *fb = getFilterbank();
+  int n_filters = fb->get_n_filters();
+  for (int Ichan = 0; Ichan < n_filters; Ichan++) {
+	AudioFilterBase_F32 *filter = fb->getFilter(Ichan);
+	if (filter->get_is_enabled() && (filter->canProcessSamples(n_samps) == false)) return false;
+  }
+  return true;
+}
+
+//if the fused processing fails partway through, the earlier chunks have already been written, so silence the
+//whole output block rather than leave it partially processed
+static int clearFusedOutput(audio_block_f32_t *block_in, audio_block_f32_t *block_out) {
+  for (int i=0; i < block_in->length; i++) block_out->data[i] = 0.0f;
+  block_out->id = block_in->id;   block_out->length = block_in->length;
+  return -1;
+}
+
+int AudioEffectMultiBandWDRC_Base_F32_UI::processAudioBlock_fused(audio_block_f32_t *block_in, audio_block_f32_t *block_out) {
+  const int n = block_in->length;
+  const int chunk = min(fused_chunk_size, n);
+  
+  //get a temporary working chunk for the audio of one band (instead of a whole audio block)
+  AudioScratch_F32 scratch;
+  float32_t *band = scratch.get(chunk);
+  if (band == NULL) return -1;  //there was no scratch memory available
+  
+  AudioFilterbankBase_F32 *fb = getFilterbank();
+  const int n_filters = fb->get_n_filters();
+  const float32_t bb_gain = broadbandGain.getGain();
+  bool were_any_blocks_processed = false;
+  
+  //step through the block, one chunk at a time
+  for (int start = 0; start < n; start += chunk) {
+	const int nc = min(chunk, n - start);
+	const float32_t *in = block_in->data + start;
+	float32_t *out = block_out->data + start;
+	
+	//loop over all the channels to do the per-band processing
+	bool firstChannelProcessed = true;
+	for (int Ichan = 0; Ichan < n_filters; Ichan++) {
+	  AudioFilterBase_F32 *filter = fb->getFilter(Ichan);
+	  if (filter->get_is_enabled() == false) continue;
+	  
+	  //apply the filter and the compressor
+	  if (filter->processSamples(in, band, nc) != 0) continue;
+	  if (compbank.compressors[Ichan].compress(band, band, nc) != 0) return clearFusedOutput(block_in, block_out);  //no scratch memory
+	  
+	  //mix with the other bands
+	  if (firstChannelProcessed) {
+		for (int i=0; i < nc; i++) out[i] = band[i];
+		firstChannelProcessed = false;
+	  } else {
+		arm_add_f32(out, band, out, nc);
+	  }
+	}
+	if (firstChannelProcessed) continue;  //no bands were processed
+	were_any_blocks_processed = true;
+	
+	//broadband gain and broadband compression
+	arm_scale_f32(out, bb_gain, out, nc);
+	if (compBroadband.compress(out, out, nc) != 0) return clearFusedOutput(block_in, block_out);  //no scratch memory
+	if (limiter.get_is_enabled()) limiter.processSamples(out, out, nc);
+  }
+  
+  if (!were_any_blocks_processed) return -1;
+  block_out->id = block_in->id;   block_out->length = block_in->length;
+  return 0;
+}
+
 
 
 void AudioEffectMultiBandWDRC_Base_F32_UI::getDSL(BTNRH_WDRC::CHA_DSL *new_dsl) {
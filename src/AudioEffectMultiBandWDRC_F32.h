@@ -35,8 +35,11 @@
 #include <AudioEffectCompBankWDRC_F32.h>  //from Tympan Library
 #include <AudioEffectGain_F32.h>     //from Tympan Library
 #include <AudioEffectCompWDRC_F32.h> //from Tympan Library
+#include <AudioEffectLimiter_F32.h>  //from Tympan Library
 #include <arm_math.h> 
 
+#define MULTIBANDWDRC_FUSED_CHUNK  32   //default number of samples per chunk when using the fused processing
+
 
 class AudioEffectMultiBandWDRC_Base_F32_UI : public AudioStream_F32, public SerialManager_UI {
   public:
@@ -50,6 +53,7 @@ class AudioEffectMultiBandWDRC_Base_F32_UI : public AudioStream_F32, public Seri
     // setup
     virtual void setup(void) {
       compBroadband.name_for_UI = "WDRC Broadband";  //overwrite the default name for the compressor being used as the broadband compressor
+      limiter.enable(false);  //the look-ahead limiter adds latency, so it is off unless you turn it on
     }
 
     // here are the mthods required (or encouraged) for AudioStream_F32 classes
@@ -58,6 +62,18 @@ class AudioEffectMultiBandWDRC_Base_F32_UI : public AudioStream_F32, public Seri
 
     virtual int processAudioBlock(audio_block_f32_t *block_in, audio_block_f32_t *block_out);
 
+    //Fused processing: rather than filtering and compressing each band as a whole audio block (which requires
+    //a temporary block per band), each block is processed in short chunks.  For each chunk, every band is
+    //filtered, compressed, and summed into the output, and then the broadband gain and compressor are applied,
+    //all while the chunk is still in cache.  The result is identical to the normal processing only when the
+    //compressors' gain decimation is 1 (the default).  With setGainDecimation(k > 1), the gain is interpolated
+    //from points that restart at each chunk, so the gain (and the output) differs slightly.  If the filters
+    //do not support chunked processing (see AudioFilterBase_F32::canProcessSamples()), it uses the normal processing.
+    virtual bool setUseFusedProcessing(bool _use) { if (_use) reserveFusedScratch(); return use_fused_processing = _use; }
+    virtual bool getUseFusedProcessing(void) { return use_fused_processing; }
+    virtual int setFusedChunkSize(int n_samps) { fused_chunk_size = max(1, n_samps); reserveFusedScratch(); return fused_chunk_size; }
+    virtual int getFusedChunkSize(void) { return fused_chunk_size; }
+
     // here are the methods required (or encouraged) for SerialManager_UI classes
     virtual void printHelp(void) {};
     //virtual bool processCharacter(char c); //not used here
@@ -84,12 +100,19 @@ class AudioEffectMultiBandWDRC_Base_F32_UI : public AudioStream_F32, public Seri
     AudioEffectCompBankWDRC_F32_UI compbank;
     AudioEffectGain_F32            broadbandGain;//broad band gain (could be part of compressor below)
     AudioEffectCompWDRC_F32_UI     compBroadband;//broadband compressor    
+    AudioEffectLimiter_F32         limiter;      //optional look-ahead brickwall limiter as the very last stage (use limiter.enable())
 
   protected:
     audio_block_f32_t *inputQueueArray[1];  //required as part of AudioStream_F32.  One input.
     bool is_enabled = false;
 	float sample_rate_Hz = AUDIO_SAMPLE_RATE;
 	int audio_block_samples = AUDIO_BLOCK_SAMPLES;
+	bool use_fused_processing = false;
+	int fused_chunk_size = MULTIBANDWDRC_FUSED_CHUNK;
+	void reserveFusedScratch(void) { AudioScratchArena_F32::reserve(4, fused_chunk_size); } //one band's chunk, plus three arrays inside the compressor
+
+	virtual bool canUseFusedProcessing(int n_samps);
+	virtual int processAudioBlock_fused(audio_block_f32_t *block_in, audio_block_f32_t *block_out);
   
 };
 
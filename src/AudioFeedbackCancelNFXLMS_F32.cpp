@@ -31,7 +31,9 @@ void AudioFeedbackCancelNFXLMS_F32::update(void) {
 
   //do the work
   if (enabled) {
+		uint32_t start_usec = telemetry.isEnabled() ? micros() : 0;
 		cha_afc_input(in_block->data, out_block->data, in_block->length);
+		if (telemetry.isEnabled()) updateTelemetry(in_block->data, out_block->data, in_block->length, micros() - start_usec);
   } else {
 		//simply copy input to output
 		for (int i = 0; i < in_block->length; i++) out_block->data[i] = in_block->data[i];
@@ -43,6 +45,13 @@ void AudioFeedbackCancelNFXLMS_F32::update(void) {
   AudioStream_F32::release(in_block);
 }
 
+void AudioFeedbackCancelNFXLMS_F32::updateTelemetry(float32_t *x, float32_t *y, int cs, uint32_t usec) {
+  float32_t coeff_energy;
+  arm_dot_prod_f32(efbp, efbp, afl, &coeff_energy);  //the energy of the estimated feedback path
+  telemetry.setNumUnderruns(n_underruns);
+  if (telemetry.endBlock(x, y, cs, coeff_energy, usec)) initializeStates();  //NaN or divergence.  Start over.
+}
+
 void AudioFeedbackCancelNFXLMS_F32::cha_afc_prepare(void) {
   //float fbm = 0;
  
@@ -64,6 +73,7 @@ void AudioFeedbackCancelNFXLMS_F32::cha_afc_prepare(void) {
 	  //cha_allocate(cp, rsz, sizeof(float), _rng3); // ee -> rng3
 	  //cha_allocate(cp, rsz, sizeof(float), _rng2); // uf -> rng2
 	  //wfrp = cha_allocate(cp, wfl, sizeof(float), _wfrp);
+	  for (int i = 0; i < wfl; i++) wfrp[i] = 0.0f;  //white_filt() does not set the last tap when wfl is even
 	  white_filt(wfrp, wfl);
   }
 
@@ -72,6 +82,7 @@ void AudioFeedbackCancelNFXLMS_F32::cha_afc_prepare(void) {
 	  //cha_allocate(cp, rsz, sizeof(float), _rng1); // uu -> rng1
 	  //ffrp = cha_allocate(cp, pfl, sizeof(float), _ffrp);
 	  ffrp[0] = 1;
+	  for (int i = 1; i < pfl; i++) ffrp[i] = 0.0f;
   } else {
 	  pup = 0;
   }
@@ -93,14 +104,30 @@ void AudioFeedbackCancelNFXLMS_F32::white_filt(float *h, int n) {  //initialize
 //the adaptive filter (the name "cha_afc_input" is simply the name used by BTNRH
 //in their original code)
 int AudioFeedbackCancelNFXLMS_F32::cha_afc_input(float32_t *x, float32_t *y, int cs) {
+  //when using the shared loop-back history, there is no cha_afc_output() to advance the ring buffer, so do it here
+  if (shared_hist != NULL) {
+	  if (shared_hist->checkForUnderrun(shared_chan, shared_last_count, cs)) n_underruns++;
+	  unsigned long n_bad = shared_hist->getNumNonFinite(shared_chan);
+	  if (n_bad != shared_last_non_finite) { shared_last_non_finite = n_bad; initializeStates(); telemetry.countNaNReset(); }  //bad data was found!  reset the states
+	  shared_newest = shared_hist->getWindow(shared_chan, shared_delay);
+	  shared_block_len = cs;
+	  if (shared_newest == NULL) { for (int i = 0; i < cs; i++) y[i] = x[i]; return -1; }  //no loop-back audio.  Just copy input to output
+	  rhd = rtl;
+	  rtl = (rhd + cs) % rsz;
+  } else if (rng0 == NULL) {
+	  for (int i = 0; i < cs; i++) y[i] = x[i];  //no ring buffer (out of memory?).  Just copy input to output
+	  return -1;
+  }
+
+  //use one of the faster versions, if requested
+  if (afl > 0) {
+	  if (update_sub_block > 1) return cha_afc_input_delayed(x, y, cs);
+	  if (use_fused_kernel) return cha_afc_input_fused(x, y, cs);
+  }
+	
   //float ye, yy, mmu, dif, dm, xx, ee, uu, ef, uf, cfc, sum, pwr;
-  float ye, yy, mmu, xx, ee, uu, ef, uf, cfc, sum; //, pwr;
-  //int i, ih, ij, is, id, j, jp1, k, nfc, puc, iqm = 0;
-  int i, ih, ij, is, id, j, jp1, k, nfc; //, puc, iqm = 0;
-  //static float *rng0, *rng1, *rng2, *rng3;
-  //static float *efbp, *sfbp, *wfrp, *ffrp, *qm;
-  //static float mu, rho, eps, alf, fbm;
-  //static int rhd, rsz, mask, afl, wfl, pfl, fbl, nqm, hdel, pup, *iqmp; 
+  float ye, mmu, xx, ee, ef;
+  int i, ih, is, id;
   
   int mask = rsz - 1;  //added by WEA.  "rsz" must be a factor of two for this to work!
 
@@ -111,110 +138,253 @@ int AudioFeedbackCancelNFXLMS_F32::cha_afc_input(float32_t *x, float32_t *y, int
 	  ih = (rhd + i) & mask;
 	  is = ih + rsz;
 	  id = is - hdel;
-	  // simulate feedback
-	  yy = 0;
-//        for (j = 0; j < fbl; j++) {
-//            ij = (id - j) & mask;
-//            yy += sfbp[j] * rng0[ij];
-//        }
 	  // apply band-limit filter
-	  if (pfl > 0) {
-		  uu = 0;
-		  for (j = 0; j < pfl; j++) {
-			  ij = (is - j) & mask;
-			  uu += ffrp[j] * rng0[ij];
-		  }
-		  rng1[ih] = uu;
-	  }
+	  applyBandLimitFilter(is, ih, mask);
 	  // estimate feedback
 	  ye = 0;
-	  if (afl > 0) {
-		  for (j = 0; j < afl; j++) {
-			  ij = (id - j) & mask;
-			  ye += efbp[j] * rng1[ij];
-		  }
-	  }
+	  if (afl > 0) ye = estimateFeedback(id, mask);
 	  // apply feedback to input signal
-	  ee = xx + yy - ye;
+	  ee = xx - ye;
 	  //------------------------------------
 	  // apply whiten filter
-	  if (wfl > 0) {
-		  rng3[ih] = ee;
-		  ef = uf = 0;
-		  for (j = 0; j < wfl; j++) {
-			  ij = (is - j) & mask;
-			  ef += rng3[ij] * wfrp[j];
-			  uf += rng1[ij] * wfrp[j];
-		  }
-		  rng2[ih] = uf;
-	  } else {
-		  ef = ee;
-	  }
+	  ef = applyWhitenFilter(ee, is, ih, mask);
 	  // update adaptive feedback coefficients
 	  if (afl > 0) {
-		  uf = rng2[id & mask];
-		  //pwr = rho * sqrtf(ef * ef + uf * uf) + (1.0f - rho) * pwr;  //WEA Nov 2021...per Steve Neely email Nov 8, 2021
-		  pwr = rho * (ef * ef + uf * uf) + (1 - rho) * pwr;
-		  mmu = mu / (eps + pwr);  // modified mu
-		  for (j = 0; j < afl; j++) {
-			  ij = (id - j) & mask;
-			  uf = rng2[ij];
-			  efbp[j] += mmu * ef * uf;
-		  }
+		  mmu = computeModifiedMu(ef, id, mask);  // modified mu
+		  updateAdaptiveCoeff(mmu * ef, id, mask);
 	  }
 	  // update band-limit filter coefficients
+	  if (pup) {
+			puc = (puc + 1) % pup;
+			if (puc == 0) updateBandLimitCoeff();
+	  }
+	  // copy AFC signal to output
+	  y[i] = ee;
+  }
+
+  return 0;
+}
+
+//The coefficient update for one sample, followed by the feedback estimate for the next sample, in a single
+//pass through the coefficients.  The ring buffers are read in reverse (newest first).  "acc" carries the
+//running sum of the dot product so that the result is the same as summing in one go.
+static inline float32_t afc_fusedUpdateAndDot(float32_t *w, const float32_t *u_upd, const float32_t g, const float32_t *u_dot, const int n, float32_t acc) {
+  for (int j = 0; j < n; j++) {
+	  const float32_t wj = w[j] + g * u_upd[-j];
+	  w[j] = wj;
+	  acc += wj * u_dot[-j];
+  }
+  return acc;
+}
+
+//Same results as the original cha_afc_input(), but the update of the adaptive coefficients is deferred until
+//the next sample, where it is done in the same pass as that sample's feedback estimate.  If anything needs the
+//updated coefficients sooner (the band-limit filter update or the end of the block), the update is done then.
+int AudioFeedbackCancelNFXLMS_F32::cha_afc_input_fused(float32_t *x, float32_t *y, int cs) {
+  const int mask = rsz - 1;  //"rsz" must be a factor of two for this to work!
+  bool is_pending = false;   //is there a coefficient update waiting to be done?
+  float32_t pending_g = 0.0f;
+  int pending_id = 0;
+
+  for (int i = 0; i < cs; i++) {
+	  const int ih = (rhd + i) & mask;
+	  const int is = ih + rsz;
+	  const int id = is - hdel;
+
+	  // apply band-limit filter
+	  applyBandLimitFilter(is, ih, mask);
+
+	  // do the previous sample's coefficient update and estimate the feedback, all in one pass
+	  float32_t ye;
+	  if (is_pending) {
+		  ye = 0.0f;
+		  int j0 = 0;
+		  while (j0 < afl) {  //step through in pieces that don't wrap around the ring buffers
+			  const int a = (pending_id - j0) & mask, b = (id - j0) & mask;
+			  const int n = min(afl - j0, min(a, b) + 1);
+			  ye = afc_fusedUpdateAndDot(efbp + j0, rng2 + a, pending_g, rng1 + b, n, ye);
+			  j0 += n;
+		  }
+		  is_pending = false;
+	  } else {
+		  ye = estimateFeedback(id, mask);
+	  }
+
+	  // apply feedback to input signal and whiten
+	  const float32_t ee = x[i] - ye;
+	  const float32_t ef = applyWhitenFilter(ee, is, ih, mask);
+
+	  // compute (but don't yet apply) the update of the adaptive coefficients
+	  pending_g = computeModifiedMu(ef, id, mask) * ef;
+	  pending_id = id;
+	  is_pending = true;
+
+	  // update band-limit filter coefficients (which needs the latest adaptive coefficients)
 	  if (pup) {
 			puc = (puc + 1) % pup;
 			if (puc == 0) {
-				sum = 0;
-				for (j = 0; j < pfl; j++) {
-					jp1 = j + 1;
-					nfc = (jp1 < pfl) ? jp1 : pfl;
-					cfc = 0;
-					for (k = 0; k < nfc; k++) {
-						cfc += efbp[j - k] * ffrp[k];
-					}
-					ffrp[j] += alf * (cfc - ffrp[j]);
-					sum += ffrp[j];
-				}
-				sum /= pfl;
-				for (j = 0; j < pfl; j++) {
-					ffrp[j] -= sum;
-				}
+				updateAdaptiveCoeff(pending_g, pending_id, mask);
+				is_pending = false;
+				updateBandLimitCoeff();
 			}
 	  }
-	  // save quality metrics
-//        if (nqm) {
-//          float dm = 0;
-//          for (j = 0; j < fbl; j++) {
-//            if (pfl) {
-//              jp1 = j + 1;
-//              nfc = (jp1 < pfl) ? jp1 : pfl;
-//              cfc = 0;
-//              for (k = 0; k < nfc; k++) {
-//                  cfc += efbp[j - k] * ffrp[k];
-//              }
-//            } else {
-//              cfc = efbp[j];
-//            }
-//            float dif = (j < afl) ? sfbp[j] - cfc : sfbp[j];
-//            dm += dif * dif;
-//          }
-//          qm[iqm++] = dm / fbm;
-//        }
+
 	  // copy AFC signal to output
 	  y[i] = ee;
   }
-//    CHA_IVAR[_puc] = puc;
-//    CHA_DVAR[_pwr] = pwr;
-//    if (nqm) {
-//        iqmp[0] = iqm;
-//        if ((iqm + cs) > nqm) nqm = 0;
-//    }
+  if (is_pending) updateAdaptiveCoeff(pending_g, pending_id, mask);
 
   return 0;
 }
 
+//Delayed-update NFXLMS: the coefficients are held fixed over each sub-block and then updated once using the
+//gradient summed over the sub-block.  Each step below is a simple loop over the whole sub-block.
+int AudioFeedbackCancelNFXLMS_F32::cha_afc_input_delayed(float32_t *x, float32_t *y, int cs) {
+  const int mask = rsz - 1;  //"rsz" must be a factor of two for this to work!
+  float32_t ye[MAX_AFC_NFXLMS_SUB_BLOCK], g[MAX_AFC_NFXLMS_SUB_BLOCK];
+
+  for (int i0 = 0; i0 < cs; i0 += update_sub_block) {
+	  const int nsub = min(update_sub_block, cs - i0);
+	  const int ih0 = (rhd + i0) & mask;
+	  const int id0 = ih0 + rsz - hdel;
+
+	  // apply band-limit filter to the whole sub-block
+	  for (int i = 0; i < nsub; i++) { const int ih = (ih0 + i) & mask; applyBandLimitFilter(ih + rsz, ih, mask); }
+
+	  // estimate the feedback for the whole sub-block.  Each coefficient is loaded once and is applied to
+	  // a contiguous run of the ring buffer (unless the run wraps around the end of the ring buffer)
+	  for (int i = 0; i < nsub; i++) ye[i] = 0.0f;
+	  for (int j = 0; j < afl; j++) {
+		  const float32_t w = efbp[j];
+		  const int b = (id0 - j) & mask;
+		  if ((b + nsub - 1) <= mask) {
+			  const float32_t *u = rng1 + b;
+			  for (int i = 0; i < nsub; i++) ye[i] += w * u[i];
+		  } else {
+			  for (int i = 0; i < nsub; i++) ye[i] += w * rng1[(b + i) & mask];
+		  }
+	  }
+
+	  // remove the feedback, whiten, and compute each sample's step
+	  int n_band_limit_updates = 0;
+	  for (int i = 0; i < nsub; i++) {
+		  const int ih = (ih0 + i) & mask;
+		  const float32_t ee = x[i0 + i] - ye[i];
+		  const float32_t ef = applyWhitenFilter(ee, ih + rsz, ih, mask);
+		  g[i] = computeModifiedMu(ef, id0 + i, mask) * ef;
+		  if (pup) { puc = (puc + 1) % pup; if (puc == 0) n_band_limit_updates++; }
+		  y[i0 + i] = ee;
+	  }
+
+	  // update the adaptive coefficients once for the whole sub-block
+	  for (int j = 0; j < afl; j++) {
+		  const int a = (id0 - j) & mask;
+		  float32_t acc = 0.0f;
+		  if ((a + nsub - 1) <= mask) {
+			  const float32_t *u = rng2 + a;
+			  for (int i = 0; i < nsub; i++) acc += g[i] * u[i];
+		  } else {
+			  for (int i = 0; i < nsub; i++) acc += g[i] * rng2[(a + i) & mask];
+		  }
+		  efbp[j] += acc;
+	  }
+
+	  // update band-limit filter coefficients
+	  for (int k = 0; k < n_band_limit_updates; k++) updateBandLimitCoeff();
+  }
+
+  return 0;
+}
+
+float32_t AudioFeedbackCancelNFXLMS_F32::applyBandLimitFilter(int is, int ih, int mask) {
+  if (pfl > 0) {
+	  float32_t uu = 0;
+	  if (shared_hist != NULL) {
+		  //the shared history is newest-first, so the current sample and the ones before it are contiguous
+		  const float32_t *u = shared_newest + (shared_block_len - 1) - ((ih - rhd) & mask);
+		  for (int j = 0; j < pfl; j++) uu += ffrp[j] * u[j];
+	  } else {
+		  for (int j = 0; j < pfl; j++) uu += ffrp[j] * rng0[(is - j) & mask];
+	  }
+	  rng1[ih] = uu;
+  }
+  return rng1[ih];
+}
+
+float32_t AudioFeedbackCancelNFXLMS_F32::estimateFeedback(int id, int mask) {
+  float32_t ye = 0;
+  for (int j = 0; j < afl; j++) ye += efbp[j] * rng1[(id - j) & mask];
+  return ye;
+}
+
+float32_t AudioFeedbackCancelNFXLMS_F32::applyWhitenFilter(float32_t ee, int is, int ih, int mask) {
+  if (wfl <= 0) return ee;
+  rng3[ih] = ee;
+  float32_t ef = 0, uf = 0;
+  for (int j = 0; j < wfl; j++) {
+	  const int ij = (is - j) & mask;
+	  ef += rng3[ij] * wfrp[j];
+	  uf += rng1[ij] * wfrp[j];
+  }
+  rng2[ih] = uf;
+  return ef;
+}
+
+float32_t AudioFeedbackCancelNFXLMS_F32::computeModifiedMu(float32_t ef, int id, int mask) {
+  const float32_t uf = rng2[id & mask];
+  //pwr = rho * sqrtf(ef * ef + uf * uf) + (1.0f - rho) * pwr;  //WEA Nov 2021...per Steve Neely email Nov 8, 2021
+  pwr = rho * (ef * ef + uf * uf) + (1 - rho) * pwr;
+  return mu / (eps + pwr);  // modified mu
+}
+
+void AudioFeedbackCancelNFXLMS_F32::updateAdaptiveCoeff(float32_t mmu_ef, int id, int mask) {
+  for (int j = 0; j < afl; j++) efbp[j] += mmu_ef * rng2[(id - j) & mask];
+}
+
+void AudioFeedbackCancelNFXLMS_F32::updateBandLimitCoeff(void) {
+  float32_t sum = 0;
+  for (int j = 0; j < pfl; j++) {
+	  const int nfc = ((j + 1) < pfl) ? (j + 1) : pfl;
+	  float32_t cfc = 0;
+	  for (int k = 0; k < nfc; k++) cfc += efbp[j - k] * ffrp[k];
+	  ffrp[j] += alf * (cfc - ffrp[j]);
+	  sum += ffrp[j];
+  }
+  sum /= pfl;
+  for (int j = 0; j < pfl; j++) ffrp[j] -= sum;
+}
+
+void AudioFeedbackCancelNFXLMS_F32::setSharedLoopBack(AudioLoopBackHistory_F32 *hist, int chan, int extra_delay_samps) {
+  //let go of any previous history
+  if (shared_hist != NULL) shared_hist->detach(shared_chan);
+
+  if (hist == NULL) {
+	  //go back to the private ring buffer, allocating it before the audio processing can see it
+	  float32_t *new_ring = (rng0 == NULL) ? new float32_t[MAX_RSZ] : rng0;
+	  if (new_ring != NULL) { for (int i = 0; i < MAX_RSZ; i++) new_ring[i] = 0.0; }
+	  __disable_irq();
+	  rng0 = new_ring;
+	  shared_hist = NULL;
+	  __enable_irq();
+	  return;
+  }
+
+  //the history must hold the band-limit filter, plus a whole audio block, plus the extra delay
+  shared_chan = chan;
+  shared_delay = max(0, extra_delay_samps);
+  hist->attach(shared_chan, MAX_AFC_NXFXLMS_FILT_LEN + MAX_AUDIO_BLOCK_SAMPLES_F32 + shared_delay);
+  shared_last_count = hist->getNumWritten(shared_chan);
+  shared_last_non_finite = hist->getNumNonFinite(shared_chan);
+
+  //switch over and free the private ring buffer
+  __disable_irq();
+  float32_t *old_ring = rng0;
+  shared_hist = hist;
+  rng0 = NULL;
+  __enable_irq();
+  if (old_ring != NULL) delete[] old_ring;
+}
+
 //Here is the routine for handling the looped-back audio (the name "cha_afc_output"
 //is simply the name used by BTNRH in their original code)
 void AudioFeedbackCancelNFXLMS_F32::cha_afc_output(float *x, int cs) { // audio input array and the block (chunk) size 
@@ -224,6 +394,7 @@ void AudioFeedbackCancelNFXLMS_F32::cha_afc_output(float *x, int cs) { // audio
   //static int rsz, mask;
 
   int mask = rsz - 1;  //"rsz" must be a factor of 2 for this to work!!
+  if (rng0 == NULL) return;  //using the shared history instead
 
 //      if (CHA_IVAR[_mxl] == 0) { // if no AFC, do nothing
 //          return;
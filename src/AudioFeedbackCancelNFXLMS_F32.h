@@ -8,6 +8,17 @@
 
    This processes a single stream fo audio data (ie, it is mono)
 
+   Speed options (Oct 2026):
+       * Fused kernel (on by default): the coefficient update for one sample is folded into the feedback
+         estimate (the dot product) for the next sample, so the adaptive filter is swept once per sample
+         instead of twice.  The results are identical to the original two-pass code.  Turn it off via
+         setUseFusedKernel(false).
+       * Delayed update (off by default): the coefficients are held fixed for a sub-block of samples and
+         then updated once with the gradient accumulated over the sub-block.  All of the feedback estimates
+         for the sub-block can then be computed in one go, and the coefficients are read and written only
+         once per sub-block.  This is a (slightly) different algorithm than the sample-by-sample NFXLMS, so it
+         adapts a little differently.  Enable via setUpdateSubBlockSize(n) with n > 1.
+
    MIT License.  use at your own risk.
 */
 
@@ -19,11 +30,14 @@
 #include "AudioStream_F32.h"  //for MAX_AUDIO_BLOCK_SAMPLES_F32
 //include "BTNRH_WDRC_Types.h" //from Tympan_Library
 #include "AudioLoopBack_F32.h"
+#include "AudioLoopBackHistory_F32.h"
+#include "AudioFeedbackCancelTelemetry_F32.h"
 
 
 #ifndef MAX_AFC_NXFXLMS_FILT_LEN
 #define MAX_AFC_NXFXLMS_FILT_LEN  (256)  //must be longer than afl
 #endif
+#define MAX_AFC_NFXLMS_SUB_BLOCK  (32)   //longest sub-block for the delayed-update option
 
 
 class settings_AFC_NFXLMS {
@@ -54,7 +68,7 @@ class AudioFeedbackCancelNFXLMS_F32 : public AudioStream_F32, public AudioLoopBa
       useDefaultSettings(sample_rate_Hz, audio_block_samples);
       cha_afc_prepare();
       initializeStates();
-      //initializeRingBuffer();
+      initializeRingBuffer();
     }
     AudioFeedbackCancelNFXLMS_F32(const AudioSettings_F32 &settings) : AudioStream_F32(1, inputQueueArray_f32) {
       sample_rate_Hz = settings.sample_rate_Hz; //used to set default values
@@ -63,11 +77,15 @@ class AudioFeedbackCancelNFXLMS_F32 : public AudioStream_F32, public AudioLoopBa
       useDefaultSettings(sample_rate_Hz, audio_block_samples);
       cha_afc_prepare();
       initializeStates();
-      //initializeRingBuffer();
+      initializeRingBuffer();
 
       //if you need the sample rate, it is: fs_Hz = settings.sample_rate_Hz;
       //if you need the block size, it is: n = settings.audio_block_samples;
     };
+    ~AudioFeedbackCancelNFXLMS_F32(void) {
+      if (shared_hist != NULL) shared_hist->detach(shared_chan);
+      if (rng0 != NULL) delete[] rng0;
+    }
 
     //simply get a copy of the default settings, don't actually use them
     static settings_AFC_NFXLMS getDefaultSettings(float sample_rate_Hz, int audio_block_samples) {
@@ -174,6 +192,11 @@ class AudioFeedbackCancelNFXLMS_F32 : public AudioStream_F32, public AudioLoopBa
     virtual int setPUP(int _pup) { return pup = max(0, _pup); }
     virtual int getPUP(void) { return pup; }
 
+    virtual bool setUseFusedKernel(bool _use) { return use_fused_kernel = _use; }
+    virtual bool getUseFusedKernel(void) { return use_fused_kernel; }
+    virtual int setUpdateSubBlockSize(int n) { return update_sub_block = min(max(n, 1), MAX_AFC_NFXLMS_SUB_BLOCK); }  //1 is the normal sample-by-sample update
+    virtual int getUpdateSubBlockSize(void) { return update_sub_block; }
+
     virtual bool enable(void) { return enable(true); }
     virtual bool enable(bool _enabled) { return enabled = _enabled; }
     virtual bool setEnable(bool _enabled) { return enable(_enabled); }
@@ -183,7 +206,7 @@ class AudioFeedbackCancelNFXLMS_F32 : public AudioStream_F32, public AudioLoopBa
     virtual void initializeStates(void) {
       pwr = 0.0;
       for (int i = 0; i < MAX_AFC_NXFXLMS_FILT_LEN; i++) efbp[i] = 0.0;
-      for (int i = 0; i < MAX_RSZ; i++) rng0[i] = 0.0;
+      if (rng0 != NULL) { for (int i = 0; i < MAX_RSZ; i++) rng0[i] = 0.0; }
       for (int i = 0; i < MAX_RSZ; i++) rng1[i] = 0.0;
       for (int i = 0; i < MAX_RSZ; i++) rng2[i] = 0.0;
       for (int i = 0; i < MAX_RSZ; i++) rng3[i] = 0.0;
@@ -191,11 +214,19 @@ class AudioFeedbackCancelNFXLMS_F32 : public AudioStream_F32, public AudioLoopBa
       //should we also clear the arrays for wfrp and ffrp?
     }
 
+    //ring buffer for the loop-back audio (only allocated when not using a shared loop-back history)
+    virtual void initializeRingBuffer(void) {
+      if ((shared_hist == NULL) && (rng0 == NULL)) rng0 = new float32_t[MAX_RSZ];
+      if (rng0 != NULL) { for (int i = 0; i < MAX_RSZ; i++) rng0[i] = 0.0; }
+    }
+
     //here's the method that is called automatically by the Teensy Audio Library
     virtual void update(void);
 	virtual void cha_afc_prepare(void);
 	virtual int cha_afc_input(float32_t *x, float32_t *y, int cs);
 	virtual void cha_afc_output(float *x, int cs);
+	virtual int cha_afc_input_fused(float32_t *x, float32_t *y, int cs);    //same results as cha_afc_input, but faster
+	virtual int cha_afc_input_delayed(float32_t *x, float32_t *y, int cs);  //coefficients updated once per sub-block
 
  
 
@@ -225,9 +256,23 @@ class AudioFeedbackCancelNFXLMS_F32 : public AudioStream_F32, public AudioLoopBa
     virtual void receiveLoopBackAudio(float *x, //input audio block
                              int cs)   //number of samples in this audio block
     {
-      cha_afc_output(x, cs);
+      if (shared_hist == NULL) cha_afc_output(x, cs);
     }
 
+    //Read the loop-back audio from a shared history (zero-copy) instead of from an AudioLoopBack_F32.
+    //extra_delay_samps shifts this canceler's view further into the past.  Pass NULL to go back to the
+    //private ring buffer.  While the shared history is in use, the private ring buffer is freed.  Call from
+    //setup(), not from the audio processing.
+    virtual void setSharedLoopBack(AudioLoopBackHistory_F32 *hist, int chan = 0, int extra_delay_samps = 0);
+    virtual AudioLoopBackHistory_F32* getSharedLoopBack(void) { return shared_hist; }
+    virtual unsigned long getNumUnderruns(void) { return n_underruns; }  //only counted when using the shared history
+
+    //optional convergence metrics (off by default).  Read them from loop() via getTelemetry()
+    AudioFeedbackCancelTelemetry_F32 telemetry;
+    virtual bool enableTelemetry(bool _enable = true) { return telemetry.enable(_enable); }
+    virtual bool getTelemetry(AudioFeedbackCancelTelemetry_Snapshot *snap) { return telemetry.getSnapshot(snap); }
+    virtual void printTelemetry(Print *p) { telemetry.printSnapshot(p); }
+    virtual void updateTelemetry(float32_t *x, float32_t *y, int cs, uint32_t usec);
 
     virtual void printEstimatedFeedbackImpulseResponse(void) {
       printEstimatedFeedbackImpulseResponse(&Serial, false);
@@ -278,20 +323,22 @@ class AudioFeedbackCancelNFXLMS_F32 : public AudioStream_F32, public AudioLoopBa
     //static const int max_afc_ringbuff_len = MAX_RSZ;
 
     //AFC parameters
-    int cs;      //chunk size (aka, audio block size)
-    int mxl;     //max length 
-    int rsz;     //ring buffer size?
+    int cs = 0;  //chunk size (aka, audio block size)
+    int mxl = 0; //max length 
+    int rsz = 32; //ring buffer size?
     int puc = 0; // ???
     float rho;   //forgetting factor...averaging factor for estimating audio envelope (bigger is longer averaging)
     float eps;   //when estimating audio level, this is the min value allowed (avoid divide-by-near-zero)
     float mu;    //AFC scale factor for how fast the filter adapts (bigger is faster)
     float alf;   //band-limit update
-    int afl;     //adaptive filter length (42 for 24kHz sample rate)
-    int wfl;     //whiten filter length (9 at 24 kHz)
-    int pfl;     //band-limit filter length (20 at 24 kHz)
+    int afl = 0; //adaptive filter length (42 for 24kHz sample rate)
+    int wfl = 0; //whiten filter length (9 at 24 kHz)
+    int pfl = 0; //band-limit filter length (20 at 24 kHz)
     //int fbl;     //simulated feedback length (this should always be zero?)
-    int hdel;    //output/input hardware delay...this is specific to Tympan AIC + Tympan Audio Library
-    int pup;     //band-limit update period (what units?)
+    int hdel = 0; //output/input hardware delay...this is specific to Tympan AIC + Tympan Audio Library
+    int pup = 0; //band-limit update period (what units?)
+    bool use_fused_kernel = true;
+    int update_sub_block = 1;
     
     //AFC states
     float32_t pwr;           // AFC estimate of error power...a state variable
@@ -306,9 +353,26 @@ class AudioFeedbackCancelNFXLMS_F32 : public AudioStream_F32, public AudioLoopBa
     //int sqm;                //save quality metric
  
     //ring buffer stuff
-    int rhd, rtl;
+    int rhd = 0, rtl = 0;
     unsigned long newest_ring_audio_block_id = 999999;
-    float32_t rng0[MAX_RSZ], rng1[MAX_RSZ], rng2[MAX_RSZ], rng3[MAX_RSZ];  //ring buffers
+    float32_t *rng0 = NULL;  //ring buffer of the loop-back audio (not allocated when using the shared history)
+    float32_t rng1[MAX_RSZ], rng2[MAX_RSZ], rng3[MAX_RSZ];  //ring buffers
+
+    //shared loop-back history (replaces rng0)
+    AudioLoopBackHistory_F32 *shared_hist = NULL;
+    int shared_chan = 0, shared_delay = 0;
+    uint32_t shared_last_count = 0;
+    unsigned long shared_last_non_finite = 0, n_underruns = 0;
+    const float32_t *shared_newest = NULL;  //this block's loop-back audio, newest sample first
+    int shared_block_len = 0;
+
+    //pieces of cha_afc_input() that are shared by all of its versions
+    float32_t applyBandLimitFilter(int is, int ih, int mask);
+    float32_t applyWhitenFilter(float32_t ee, int is, int ih, int mask);
+    float32_t computeModifiedMu(float32_t ef, int id, int mask);
+    void updateAdaptiveCoeff(float32_t mmu_ef, int id, int mask);
+    float32_t estimateFeedback(int id, int mask);
+    void updateBandLimitCoeff(void);
  
 
 };  //end class definition
@@ -31,7 +31,9 @@ void AudioFeedbackCancelNLMS_F32::update(void) {
 
   //do the work
   if (enabled) {
+		uint32_t start_usec = telemetry.isEnabled() ? micros() : 0;
 		cha_afc(in_block->data, out_block->data, in_block->length);
+		if (telemetry.isEnabled()) updateTelemetry(in_block->data, out_block->data, in_block->length, micros() - start_usec);
   } else {
 		//simply copy input to output
 		for (int i=0; i < in_block->length; i++) out_block->data[i] = in_block->data[i];
@@ -52,11 +54,29 @@ void AudioFeedbackCancelNLMS_F32::cha_afc(float32_t *x, //input audio array
   float32_t *offset_ringbuff;
   //float32_t foo;
 
+  //get the loop-back audio.  The newest sample is at [0], followed by older samples
+  float32_t *newest = ring;
+  if (shared_hist != NULL) {
+		if (shared_hist->checkForUnderrun(shared_chan, shared_last_count, cs)) n_underruns++;
+		unsigned long n_bad = shared_hist->getNumNonFinite(shared_chan);
+		if (n_bad != shared_last_non_finite) {
+			//bad data was found by the shared history!  reset the states
+			shared_last_non_finite = n_bad;
+			initializeStates();
+			telemetry.countNaNReset();
+		}
+		newest = (float32_t *)(shared_hist->getWindow(shared_chan, shared_delay));
+  }
+  if (newest == NULL) {
+		for (i = 0; i < cs; i++) y[i] = x[i];  //no loop-back audio available.  Just copy input to output
+		return;
+  }
+
   // subtract estimated feedback signal
   for (i = 0; i < cs; i++) {  //step through WAV sample-by-sample
 		s0 = x[i];  //current waveform sample
 		//ii = rhd + i;
-		offset_ringbuff = ring + (cs-1) - i;
+		offset_ringbuff = newest + (cs-1) - i;
 
 		// estimate feedback
 		#if 1
@@ -107,11 +127,45 @@ void AudioFeedbackCancelNLMS_F32::cha_afc(float32_t *x, //input audio array
   }
 }
 
+void AudioFeedbackCancelNLMS_F32::updateTelemetry(float32_t *x, float32_t *y, int cs, uint32_t usec) {
+  float32_t coeff_energy;
+  arm_dot_prod_f32(efbp, efbp, afl, &coeff_energy);  //the energy of the estimated feedback path
+  telemetry.setNumUnderruns(n_underruns);
+  if (telemetry.endBlock(x, y, cs, coeff_energy, usec)) initializeStates();  //NaN or divergence.  Start over.
+}
+
+void AudioFeedbackCancelNLMS_F32::setSharedLoopBack(AudioLoopBackHistory_F32 *hist, int chan, int extra_delay_samps) {
+  //let go of any previous history
+  if (shared_hist != NULL) shared_hist->detach(shared_chan);
+  
+  if (hist == NULL) {
+		shared_hist = NULL;
+		initializeRingBuffer();  //re-allocates the private ring buffer
+		return;
+  }
+
+  //the history must hold the longest filter, plus a whole audio block, plus the extra delay
+  shared_chan = chan;
+  shared_delay = max(0, extra_delay_samps);
+  hist->attach(shared_chan, MAX_AFC_NLMS_FILT_LEN + MAX_AUDIO_BLOCK_SAMPLES_F32 + shared_delay);
+  shared_last_count = hist->getNumWritten(shared_chan);
+  shared_last_non_finite = hist->getNumNonFinite(shared_chan);
+
+  //switch over and free the private ring buffer
+  __disable_irq();
+  float32_t *old_ring = ring;
+  shared_hist = hist;
+  ring = NULL;
+  __enable_irq();
+  if (old_ring != NULL) delete[] old_ring;
+}
+
 void AudioFeedbackCancelNLMS_F32::receiveLoopBackAudio(
       float *x, //input audio block
 			int cs)   //number of samples in this audio block
 {
   int Isrc, Idst;
+  if (ring == NULL) return;  //using the shared history instead
 
   //Check to see if the in-coming values are valid floats (ie, not NaN or Inf).
   //If the system is overloading, this could happen, which would lock-up this
@@ -120,6 +174,7 @@ void AudioFeedbackCancelNLMS_F32::receiveLoopBackAudio(
 		if (!std::isfinite(x[i])) {
 			//bad data found!  reset the states and return early
 			initializeStates();
+			telemetry.countNaNReset();
 			return;
 		}
   }
@@ -19,6 +19,8 @@
 #include "AudioStream_F32.h"
 #include "BTNRH_WDRC_Types.h" //from Tympan_Library
 #include "AudioLoopBack_F32.h" //form Tympan_Library
+#include "AudioLoopBackHistory_F32.h" //from Tympan_Library
+#include "AudioFeedbackCancelTelemetry_F32.h" //from Tympan_Library
 
 
 #ifndef MAX_AFC_NLMS_FILT_LEN
@@ -45,6 +47,10 @@ class AudioFeedbackCancelNLMS_F32 : public AudioStream_F32, public AudioLoopBack
       //if you need the sample rate, it is: fs_Hz = settings.sample_rate_Hz;
       //if you need the block size, it is: n = settings.audio_block_samples;
     };
+    ~AudioFeedbackCancelNLMS_F32(void) {
+      if (shared_hist != NULL) shared_hist->detach(shared_chan);
+      if (ring != NULL) delete[] ring;
+    }
 
   //Daniel, go ahead and change these as you'd like!
     virtual void setDefaultValues(void) {
@@ -105,16 +111,30 @@ class AudioFeedbackCancelNLMS_F32 : public AudioStream_F32, public AudioLoopBack
     virtual void setEnable(bool _enabled) { enable(_enabled); }
     virtual bool getEnable(void) { return enabled;};
 
-    //ring buffer
+    //ring buffer (only allocated when not using a shared loop-back history)
     //static const int max_afc_ringbuff_len = MAX_AFC_NLMS_FILT_LEN;
     static const int max_afc_ringbuff_len = 2*MAX_AFC_NLMS_FILT_LEN;
-    float32_t ring[max_afc_ringbuff_len];
+    float32_t *ring = NULL;
     int rhd, rtl;
     unsigned long newest_ring_audio_block_id = 999999;
     void initializeRingBuffer(void) {
       rhd = 0;  rtl = 0;
-      for (int i = 0; i < max_afc_ringbuff_len; i++) ring[i] = 0.0;
+      if ((shared_hist == NULL) && (ring == NULL)) ring = new float32_t[max_afc_ringbuff_len];
+      if (ring != NULL) { for (int i = 0; i < max_afc_ringbuff_len; i++) ring[i] = 0.0; }
     }
+
+    //Read the loop-back audio from a shared history (zero-copy) instead of from an AudioLoopBack_F32.  The
+    //private ring buffer is freed.  extra_delay_samps shifts this canceler's view further into the past.
+    //Pass NULL to go back to using the private ring buffer.  Call from setup(), not from the audio processing.
+    virtual void setSharedLoopBack(AudioLoopBackHistory_F32 *hist, int chan = 0, int extra_delay_samps = 0);
+    virtual AudioLoopBackHistory_F32* getSharedLoopBack(void) { return shared_hist; }
+    virtual unsigned long getNumUnderruns(void) { return n_underruns; }  //only counted when using the shared history
+
+    //optional convergence metrics (off by default).  Read them from loop() via getTelemetry()
+    AudioFeedbackCancelTelemetry_F32 telemetry;
+    virtual bool enableTelemetry(bool _enable = true) { return telemetry.enable(_enable); }
+    virtual bool getTelemetry(AudioFeedbackCancelTelemetry_Snapshot *snap) { return telemetry.getSnapshot(snap); }
+    virtual void printTelemetry(Print *p) { telemetry.printSnapshot(p); }
     //int rsz = max_afc_ringbuff_len;  //"ring buffer size"...variable name inherited from original BTNRH code
     //int mask = rsz - 1;
 
@@ -127,6 +147,7 @@ class AudioFeedbackCancelNLMS_F32 : public AudioStream_F32, public AudioLoopBack
 
 	virtual void update(void);
 	virtual void cha_afc(float32_t *x, float32_t *y, int cs);  //input array, output array, block (chunk) size
+	virtual void updateTelemetry(float32_t *x, float32_t *y, int cs, uint32_t usec);
   
   
     virtual void receiveLoopBackAudio(audio_block_f32_t *in_block) {
@@ -183,6 +204,12 @@ class AudioFeedbackCancelNLMS_F32 : public AudioStream_F32, public AudioLoopBack
     int afl;         // AFC adaptive filter length
     //int n_coeff_to_zero;  //number of the first AFC filter coefficients to artificially zero out (debugging)
 
+    //shared loop-back history
+    AudioLoopBackHistory_F32 *shared_hist = NULL;
+    int shared_chan = 0, shared_delay = 0;
+    uint32_t shared_last_count = 0;
+    unsigned long shared_last_non_finite = 0, n_underruns = 0;
+
     //AFC states
     float32_t pwr;   // AFC estimate of error power...a state variable
     float32_t efbp[MAX_AFC_NLMS_FILT_LEN];  //vector holding the estimated feedback impulse response
@@ -0,0 +1,267 @@
+
+#include "AudioFeedbackCancelPBFDAF_F32.h"
+#include <cmath>  //for "isfinite()"
+
+void AudioFeedbackCancelPBFDAF_F32::configure(int _afl, int _partition_len) {
+  //check the partition size
+  if (!FFT_F32::is_valid_N_FFT(2*_partition_len)) {
+    Serial.println(F("AudioFeedbackCancelPBFDAF_F32: *** ERROR ***"));
+    Serial.print(F("    : Partition size (")); Serial.print(_partition_len); Serial.println(F(") must be a power of 2 from 8 to 2048."));
+    if (partition_len > 0) return;  //keep the previous configuration
+    _partition_len = AFC_PBFDAF_DEFAULT_PARTITION;
+  }
+
+  //check the filter length
+  _afl = min(max(_afl,1),MAX_AFC_PBFDAF_FILT_LEN);
+
+  //set the sizes.  The filter length is rounded up to a whole number of partitions.
+  partition_len = _partition_len;
+  n_fft = 2*partition_len;
+  n_bins = partition_len+1;
+  n_part = (_afl + partition_len - 1) / partition_len;
+  afl = n_part * partition_len;
+
+  //set up the FFTs (no windowing!)
+  fft.setup(n_fft); fft.useRectangularWindow();
+  ifft.setup(n_fft); ifft.useRectangularWindow();
+
+  //allocate memory
+  fft_buff.assign(2*n_fft, 0.0f);
+  U_spec.assign(n_part*2*n_bins, 0.0f);
+  W_spec.assign(n_part*2*n_bins, 0.0f);
+  pwr.assign(n_bins, 0.0f);
+  E_spec.assign(2*n_bins, 0.0f);
+  time_buff.assign(n_fft, 0.0f);
+  u_prev.assign(partition_len, 0.0f);
+  u_block.assign(max(max_block_len, partition_len), 0.0f);
+  u_block_len = 0;
+  flag_printedBlockSizeError = false;
+
+  initializeStates();
+}
+
+void AudioFeedbackCancelPBFDAF_F32::initializeStates(void) {
+  for (int i=0; i < (int)U_spec.size(); i++) U_spec[i] = 0.0f;
+  for (int i=0; i < (int)W_spec.size(); i++) W_spec[i] = 0.0f;
+  for (int i=0; i < (int)pwr.size(); i++) pwr[i] = 0.0f;
+  for (int i=0; i < (int)u_prev.size(); i++) u_prev[i] = 0.0f;
+  for (int i=0; i < (int)u_block.size(); i++) u_block[i] = 0.0f;
+  U_newest = 0;
+  next_part_to_constrain = 0;
+  is_first_partition = true;
+}
+
+//here's the method that is called automatically by the Teensy Audio Library
+void AudioFeedbackCancelPBFDAF_F32::update(void) {
+
+  //receive the input audio data
+  audio_block_f32_t *in_block = AudioStream_F32::receiveReadOnly_f32();
+  if (!in_block) return;
+
+  //allocate memory for the output of our algorithm
+  audio_block_f32_t *out_block = AudioStream_F32::allocate_f32();
+  if (!out_block) {
+    AudioStream_F32::release(in_block);
+    return;
+  }
+
+  //check to see if we're outpacing our feedback data
+  if (newest_ring_audio_block_id != 999999) { //999999 is the default startup number, so ignore it
+    if ((in_block->id > 100) && (newest_ring_audio_block_id > 0)) { //ignore startup period
+      if ((in_block->id != 0) && ((in_block->id - newest_ring_audio_block_id) > 1)) {  //is the difference more than one block counter? (an offset of 1 is expected)
+        //the data in the ring buffer is older than expected!
+        Serial.print("AudioFeedbackCancelPBFDAF_F32: falling behind?  in_block = ");
+        Serial.print(in_block->id); Serial.print(", ring block = "); Serial.println(newest_ring_audio_block_id);
+      }
+    }
+  }
+
+  //do the work
+  if (enabled) {
+    uint32_t start_usec = telemetry.isEnabled() ? micros() : 0;
+    cha_afc(in_block->data, out_block->data, in_block->length);
+    if (telemetry.isEnabled()) updateTelemetry(in_block->data, out_block->data, in_block->length, micros() - start_usec);
+  } else {
+    //simply copy input to output
+    for (int i=0; i < in_block->length; i++) out_block->data[i] = in_block->data[i];
+  }
+  out_block->id = in_block->id;
+  out_block->length = in_block->length;
+
+  // transmit the block and release memory
+  AudioStream_F32::transmit(out_block);
+  AudioStream_F32::release(out_block);
+  AudioStream_F32::release(in_block);
+}
+
+void AudioFeedbackCancelPBFDAF_F32::cha_afc(float32_t *x, //input audio array
+    float32_t *y, //output audio array
+    int cs) //"chunk size"...the length of the audio array
+{
+  //the audio block must be a whole number of partitions (and the loop-back must have been the same length)
+  if (((cs % partition_len) != 0) || (cs > (int)u_block.size())) {
+    if (!flag_printedBlockSizeError) {
+      Serial.print(F("AudioFeedbackCancelPBFDAF_F32: *** ERROR ***: audio block size (")); Serial.print(cs);
+      Serial.print(F(") is not a multiple of the partition size (")); Serial.print(partition_len); Serial.println(F("). Not canceling."));
+      flag_printedBlockSizeError = true;
+    }
+    for (int i=0; i < cs; i++) y[i] = x[i];
+    return;
+  }
+
+  for (int i=0; i < cs; i += partition_len) processPartition(x+i, u_block.data()+i, y+i);
+}
+
+void AudioFeedbackCancelPBFDAF_F32::processPartition(const float32_t *x, const float32_t *u, float32_t *y) {
+  const int P = partition_len, NB = n_bins, K = n_part;
+
+  //transform the loop-back audio (overlap-save: the previous partition followed by this one) into the
+  //newest slot of the ring of spectra.  The ring holds the spectra from newest (k=0) to oldest (k=K-1).
+  U_newest = (U_newest == 0) ? (K-1) : (U_newest-1);
+  float32_t *U0 = &(U_spec[U_newest*2*NB]);
+  forwardFFT(u_prev.data(), u, U0);
+  for (int i=0; i < P; i++) u_prev[i] = u[i];
+
+  //update the power in each bin (on the very first partition, start from its power rather than from zero)
+  const float32_t a = is_first_partition ? 0.0f : rho, b = 1.0f - a;
+  for (int Ibin=0; Ibin < NB; Ibin++) {
+    const float32_t re = U0[2*Ibin], im = U0[2*Ibin+1];
+    pwr[Ibin] = a*pwr[Ibin] + b*(re*re + im*im);
+  }
+  is_first_partition = false;
+
+  //estimate the feedback: sum the products of each partition of the filter and its loop-back spectrum
+  float32_t *Y = E_spec.data();  //use the E_spec memory for now
+  for (int i=0; i < 2*NB; i++) Y[i] = 0.0f;
+  for (int k=0; k < K; k++) {
+    const float32_t *W = &(W_spec[k*2*NB]);
+    const float32_t *U = &(U_spec[((U_newest + k) % K)*2*NB]);
+    for (int Ibin=0; Ibin < NB; Ibin++) {
+      const float32_t wr = W[2*Ibin], wi = W[2*Ibin+1], ur = U[2*Ibin], ui = U[2*Ibin+1];
+      Y[2*Ibin]   += wr*ur - wi*ui;
+      Y[2*Ibin+1] += wr*ui + wi*ur;
+    }
+  }
+  inverseFFT(Y, time_buff.data());
+
+  //remove the estimated feedback (the last P samples are the valid ones)
+  const float32_t *fbe = time_buff.data() + P;
+  for (int i=0; i < P; i++) y[i] = x[i] - fbe[i];
+
+  //transform the error (zero-padded at the front) and scale by the normalized step size in each bin
+  float32_t *E = E_spec.data();
+  forwardFFT(NULL, y, E);
+  const float32_t mu_per_part = mu / ((float32_t)K);  //all K partitions adapt at once, so share the step between them
+  for (int Ibin=0; Ibin < NB; Ibin++) {
+    const float32_t scale = mu_per_part / (pwr[Ibin] + eps);
+    E[2*Ibin] *= scale;  E[2*Ibin+1] *= scale;
+  }
+
+  //update each partition of the filter: W += conj(U) * E
+  for (int k=0; k < K; k++) {
+    float32_t *W = &(W_spec[k*2*NB]);
+    const float32_t *U = &(U_spec[((U_newest + k) % K)*2*NB]);
+    for (int Ibin=0; Ibin < NB; Ibin++) {
+      const float32_t ur = U[2*Ibin], ui = U[2*Ibin+1], er = E[2*Ibin], ei = E[2*Ibin+1];
+      W[2*Ibin]   += ur*er + ui*ei;
+      W[2*Ibin+1] += ur*ei - ui*er;
+    }
+  }
+
+  //constrain the filter so that each partition stays P samples long
+  if (constrain_all) {
+    for (int k=0; k < K; k++) constrainPartition(k);
+  } else {
+    constrainPartition(next_part_to_constrain);
+    if (++next_part_to_constrain >= K) next_part_to_constrain = 0;
+  }
+}
+
+void AudioFeedbackCancelPBFDAF_F32::constrainPartition(int Ipart) {
+  float32_t *W = &(W_spec[Ipart*2*n_bins]);
+  inverseFFT(W, time_buff.data());
+  forwardFFT(time_buff.data(), NULL, W);  //keep only the first P samples
+}
+
+void AudioFeedbackCancelPBFDAF_F32::forwardFFT(const float32_t *first_half, const float32_t *second_half, float32_t *spec) {
+  const int P = partition_len;
+  float32_t *buff = fft_buff.data();
+  for (int i=0; i < P; i++) {
+    buff[2*i]       = (first_half == NULL) ? 0.0f : first_half[i];   buff[2*i+1] = 0.0f;
+    buff[2*(i+P)]   = (second_half == NULL) ? 0.0f : second_half[i]; buff[2*(i+P)+1] = 0.0f;
+  }
+  fft.execute(buff);
+  for (int i=0; i < 2*n_bins; i++) spec[i] = buff[i];  //keep only the positive frequencies
+}
+
+void AudioFeedbackCancelPBFDAF_F32::inverseFFT(const float32_t *spec, float32_t *time_out) {
+  const int N = n_fft;
+  float32_t *buff = fft_buff.data();
+  for (int i=0; i < 2*n_bins; i++) buff[i] = spec[i];
+  for (int Ibin = n_bins; Ibin < N; Ibin++) {  //negative frequencies are the complex conjugates
+    buff[2*Ibin]   =  spec[2*(N-Ibin)];
+    buff[2*Ibin+1] = -spec[2*(N-Ibin)+1];
+  }
+  ifft.execute(buff);
+  for (int i=0; i < N; i++) time_out[i] = buff[2*i];
+}
+
+void AudioFeedbackCancelPBFDAF_F32::receiveLoopBackAudio(
+      float *x, //input audio block
+      int cs)   //number of samples in this audio block
+{
+  //Check to see if the in-coming values are valid floats (ie, not NaN or Inf).
+  //If the system is overloading, this could happen, which would lock-up this
+  //feedback cancelation algorithm.
+  for (int i=0; i<cs; i++) {
+    if (!std::isfinite(x[i])) {
+      //bad data found!  reset the states and return early
+      initializeStates();
+      telemetry.countNaNReset();
+      return;
+    }
+  }
+
+  //just hold onto it.  It gets processed one partition at a time by cha_afc()
+  u_block_len = min(cs, (int)u_block.size());
+  for (int i=0; i < u_block_len; i++) u_block[i] = x[i];
+}
+
+void AudioFeedbackCancelPBFDAF_F32::updateTelemetry(float32_t *x, float32_t *y, int cs, uint32_t usec) {
+  //energy of the estimated feedback path, straight from the spectra (Parseval).  Only bins 0 to P are stored, so
+  //the bins in between count twice (for their negative-frequency twins).
+  float32_t coeff_energy = 0.0f;
+  for (int k=0; k < n_part; k++) {
+    const float32_t *W = &(W_spec[k*2*n_bins]);
+    float32_t sum = 0.0f;
+    for (int Ibin=1; Ibin < n_bins-1; Ibin++) sum += W[2*Ibin]*W[2*Ibin] + W[2*Ibin+1]*W[2*Ibin+1];
+    const int Inyq = n_bins-1;
+    coeff_energy += 2.0f*sum + W[0]*W[0] + W[1]*W[1] + W[2*Inyq]*W[2*Inyq] + W[2*Inyq+1]*W[2*Inyq+1];
+  }
+  if (n_fft > 0) coeff_energy /= (float32_t)n_fft;
+
+  if (telemetry.endBlock(x, y, cs, coeff_energy, usec)) initializeStates();  //NaN or divergence.  Start over.
+}
+
+int AudioFeedbackCancelPBFDAF_F32::getEstimatedFeedbackImpulseResponse(float32_t *out, int n_max) {
+  int count = 0;
+  for (int k=0; k < n_part; k++) {
+    inverseFFT(&(W_spec[k*2*n_bins]), time_buff.data());
+    for (int i=0; (i < partition_len) && (count < n_max); i++) out[count++] = time_buff[i];
+  }
+  return count;
+}
+
+void AudioFeedbackCancelPBFDAF_F32::printEstimatedFeedbackImpulseResponse(Print *p, bool flag_eachOnNewLine) {
+  p->println("AudioFeedbackCancelPBFDAF_F32: estimated feedback impulse response:");
+  float scale = 1.0;
+  if (flag_eachOnNewLine) scale = 20.0;
+  for (int k=0; k < n_part; k++) {
+    inverseFFT(&(W_spec[k*2*n_bins]), time_buff.data());
+    for (int i=0; i < partition_len; i++) {
+      p->print(time_buff[i]*scale,5);
+      if (flag_eachOnNewLine) { p->println(); } else { p->print(", "); }
+    }
+  }
+  if (!flag_eachOnNewLine) p->println();
+}
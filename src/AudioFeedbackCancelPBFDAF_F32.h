@@ -0,0 +1,170 @@
+
+/*
+   AudioFeedbackCancelPBFDAF_F32
+
+   Created: OpenAudio, Oct 2026
+   Purpose: Adaptive feedback cancelation using a partitioned-block frequency-domain adaptive filter (PBFDAF).
+       This is a drop-in alternative to AudioFeedbackCancelNLMS_F32 for long feedback paths.  It uses the same
+       loop-back interface (connect an AudioLoopBack_F32 to it via setTarget()).
+
+       AudioFeedbackCancelNLMS_F32 does a dot product and a coefficient update over the whole adaptive filter
+       for every sample, so its cost grows with (filter length x sample rate).  Here, the filter is split into
+       K partitions of P samples each.  Every P samples, the loop-back audio is transformed with one FFT (of
+       length 2P) and the estimated feedback is computed as a sum of K spectral products (overlap-save).  The
+       coefficients are updated in the frequency domain, with the step size normalized separately in each
+       frequency bin by that bin's power.  That per-bin normalization also makes it converge faster than NLMS
+       for colored (ie, speech or music) signals.
+
+       Cost per partition: 3 FFTs of length 2P (plus 2 more to constrain one partition...see below) and about
+       2*K*(P+1) complex multiply-adds.  So, a 10 msec filter at 96 kHz (960 taps) is practical.
+
+       The partition size P must be a power of 2 and it must divide the audio block size.  Bigger partitions
+       are cheaper but they adapt less often.
+
+       To save CPU, the "gradient constraint" (which keeps each partition's filter from wrapping around in time)
+       is applied to only one partition per update, in rotation.  Use setConstrainAll(true) to do all of them.
+
+   This processes a single stream of audio data (ie, it is mono)
+
+   MIT License.  use at your own risk.
+*/
+
+#ifndef _AudioFeedbackCancelPBFDAF_F32
+#define _AudioFeedbackCancelPBFDAF_F32
+
+#include <Arduino.h>  //for Serial.println()
+#include <arm_math.h> //ARM DSP extensions.  https://www.keil.com/pack/doc/CMSIS/DSP/html/index.html
+#include "AudioStream_F32.h"
+#include "BTNRH_WDRC_Types.h" //from Tympan_Library
+#include "AudioLoopBack_F32.h" //from Tympan_Library
+#include "FFT_F32.h"           //from Tympan_Library
+#include "AudioFeedbackCancelTelemetry_F32.h" //from Tympan_Library
+#include <vector>
+
+#ifndef MAX_AFC_PBFDAF_FILT_LEN
+#define MAX_AFC_PBFDAF_FILT_LEN  2048  //longest adaptive filter allowed
+#endif
+#define AFC_PBFDAF_DEFAULT_PARTITION  32
+
+class AudioFeedbackCancelPBFDAF_F32 : public AudioStream_F32, public AudioLoopBackInterface_F32
+{
+//GUI: inputs:1, outputs:1  //this line used for automatic generation of GUI node
+//GUI: shortName: FB_Cancel_PBFDAF
+  public:
+    //constructor
+    AudioFeedbackCancelPBFDAF_F32(void) : AudioStream_F32(1, inputQueueArray_f32) {
+      setDefaultValues();
+    }
+    AudioFeedbackCancelPBFDAF_F32(const AudioSettings_F32 &settings) : AudioStream_F32(1, inputQueueArray_f32),
+      max_block_len(settings.audio_block_samples) {
+      setDefaultValues();
+    }
+
+    virtual void setDefaultValues(void) {
+      float _mu = 0.3;     //normalized step size (0 to 1)
+      float _rho = 0.9;    //smoothing of the per-bin power (per partition)
+      float _eps = 1.0e-6; //floor on the per-bin power
+      int _afl = 256;      //adaptive filter length
+      setParams(_mu, _rho, _eps, _afl, AFC_PBFDAF_DEFAULT_PARTITION);
+    }
+    virtual void setParams(BTNRH_WDRC::CHA_AFC cha) {
+      setParams(mu, rho, eps, cha.afl, partition_len);  //the BTNRH mu/rho/eps are for the NLMS, so they are not used here
+      setEnable(cha.default_to_active);
+    }
+    virtual void setParams(float _mu, float _rho, float _eps, int _afl, int _partition_len) {
+      setMu(_mu); setRho(_rho); setEps(_eps);
+      configure(_afl, _partition_len);
+    }
+
+    virtual float setMu(float _mu) { return mu = _mu; }
+    virtual float setRho(float _rho) { return rho = min(max(_rho,0.0f),1.0f); };
+    virtual float setEps(float _eps) { return eps = min(max(_eps,1e-30f),1.0f); };
+    virtual float getMu(void) { return mu; };
+    virtual float getRho(void) { return rho; };
+    virtual float getEps(void) { return eps; };
+    virtual int setAfl(int _afl) { configure(_afl, partition_len); return afl; }  //rounded up to a whole number of partitions
+    virtual int getAfl(void) { return afl; };
+    virtual int setPartitionSize(int _P) { configure(afl, _P); return partition_len; }  //power of 2 from 8 to 2048.  Must divide the audio block size
+    virtual int getPartitionSize(void) { return partition_len; }
+    virtual int getNumPartitions(void) { return n_part; }
+    virtual bool setConstrainAll(bool _all) { return constrain_all = _all; }
+    virtual bool getConstrainAll(void) { return constrain_all; }
+
+    virtual bool enable(void) { return enable(true); }
+    virtual bool enable(bool _enabled) { return enabled = _enabled; }
+    virtual void setEnable(bool _enabled) { enable(_enabled); }
+    virtual bool getEnable(void) { return enabled;};
+
+    virtual void initializeStates(void);
+
+    virtual void update(void);
+    virtual void cha_afc(float32_t *x, float32_t *y, int cs);  //input array, output array, block (chunk) size
+
+    virtual void receiveLoopBackAudio(audio_block_f32_t *in_block) {
+      newest_ring_audio_block_id = in_block->id;
+      receiveLoopBackAudio(in_block->data, in_block->length);
+    }
+    virtual void receiveLoopBackAudio(float *x, int cs); //input array, block (chunk) size
+
+    //get the time-domain version of the estimated feedback impulse response.  Returns the number of values written.
+    virtual int getEstimatedFeedbackImpulseResponse(float32_t *out, int n_max);
+    virtual void printEstimatedFeedbackImpulseResponse(void) { printEstimatedFeedbackImpulseResponse(&Serial, false); }
+    virtual void printEstimatedFeedbackImpulseResponse(Print *p, bool flag_eachOnNewLine);
+
+    //optional convergence metrics (off by default).  Read them from loop() via getTelemetry()
+    AudioFeedbackCancelTelemetry_F32 telemetry;
+    virtual bool enableTelemetry(bool _enable = true) { return telemetry.enable(_enable); }
+    virtual bool getTelemetry(AudioFeedbackCancelTelemetry_Snapshot *snap) { return telemetry.getSnapshot(snap); }
+    virtual void printTelemetry(Print *p) { telemetry.printSnapshot(p); }
+    virtual void updateTelemetry(float32_t *x, float32_t *y, int cs, uint32_t usec);
+
+    virtual void printAlgorithmInfo(void) {
+      Serial.println("AudioFeedbackCancelPBFDAF_F32: parameter values...");
+      Serial.println("    rho = " + String(rho,6));
+      Serial.println("    eps = " + String(eps,6));
+      Serial.println("    mu = " + String(mu,6));
+      Serial.println("    afl = " + String(afl));
+      Serial.println("    partition = " + String(partition_len) + ", n_partitions = " + String(n_part));
+    }
+
+  protected:
+    audio_block_f32_t *inputQueueArray_f32[1]; //memory pointer for the input to this module
+    bool enabled = true;
+    int max_block_len = AUDIO_BLOCK_SAMPLES;
+    unsigned long newest_ring_audio_block_id = 999999;
+    bool flag_printedBlockSizeError = false;
+
+    //AFC parameters
+    float32_t mu;    // step size (normalized by the power in each frequency bin)
+    float32_t rho;   // averaging factor for the power in each frequency bin
+    float32_t eps;   // floor on the power in each frequency bin (avoid divide-by-near-zero)
+    int afl = 0;     // adaptive filter length (a multiple of partition_len)
+    int partition_len = 0, n_fft = 0, n_bins = 0, n_part = 0;  //P, 2P, P+1, K
+    bool constrain_all = false;
+    int next_part_to_constrain = 0;
+    bool is_first_partition = true;
+
+    //the FFTs.  Spectra only hold bins 0 to P (the rest are the complex conjugates), interleaved [real, imag]
+    FFT_F32 fft;
+    IFFT_F32 ifft;
+    std::vector<float32_t> fft_buff;    //[2*n_fft] complex workspace for the FFT routines
+    std::vector<float32_t> U_spec;      //[n_part][2*n_bins] spectra of the most recent loop-back partitions (a ring)
+    int U_newest = 0;                   //which of U_spec is the newest
+    std::vector<float32_t> W_spec;      //[n_part][2*n_bins] the adaptive filter, one spectrum per partition
+    std::vector<float32_t> pwr;         //[n_bins] smoothed power in each bin
+    std::vector<float32_t> E_spec;      //[2*n_bins] error spectrum, then the scaled gradient
+    std::vector<float32_t> time_buff;   //[n_fft] real-valued workspace
+
+    //the loop-back audio
+    std::vector<float32_t> u_prev;      //[partition_len] the previous loop-back partition (for overlap-save)
+    std::vector<float32_t> u_block;     //[max_block_len] the most recent loop-back block
+    int u_block_len = 0;
+
+    virtual void configure(int _afl, int _partition_len);
+    void processPartition(const float32_t *x, const float32_t *u, float32_t *y);
+    void forwardFFT(const float32_t *first_half, const float32_t *second_half, float32_t *spec);  //either half can be NULL (zeros)
+    void inverseFFT(const float32_t *spec, float32_t *time_out);  //time_out is [n_fft] real
+    void constrainPartition(int Ipart);
+};  //end class definition
+
+#endif
@@ -0,0 +1,183 @@
+
+#ifndef _AudioFeedbackCancelTelemetry_F32_h
+#define _AudioFeedbackCancelTelemetry_F32_h
+
+/*
+   AudioFeedbackCancelTelemetry_F32
+
+   Created: OpenAudio, Oct 2026
+   Purpose: Optional running metrics for the adaptive feedback cancelers (AudioFeedbackCancelNLMS_F32,
+       AudioFeedbackCancelNFXLMS_F32, and AudioFeedbackCancelPBFDAF_F32) so that mu and rho can be tuned,
+       and so that instability can be spotted before it is heard.
+
+       Everything is computed once per audio block from the input and output of the canceler (the estimated
+       feedback is simply the input minus the output), so nothing is added to the per-sample adaptive filter
+       loops.  When the telemetry is not enabled (the default), it costs nothing at all.
+
+       At the end of every block, the metrics are copied into a snapshot that can be read from loop() (or when
+       handling a command from the SerialManager) without disabling interrupts.  See getSnapshot().
+
+   MIT License.  use at your own risk.
+*/
+
+#include <Arduino.h>
+#include <arm_math.h>
+#include <cmath>  //for "isfinite()"
+
+//keep the compiler from moving memory accesses across this point (the sequence counter relies on it)
+static inline void afcTelemetry_compilerBarrier(void) { __asm__ volatile("" ::: "memory"); }
+
+//All of the metrics from AudioFeedbackCancelTelemetry_F32.  Powers are linear (mean-square) values.
+class AudioFeedbackCancelTelemetry_Snapshot {
+  public:
+    unsigned long block_count = 0;      //number of audio blocks measured since the last reset
+
+    float32_t input_ms = 0.0f;          //mean-square of the canceler's input (smoothed)
+    float32_t error_ms = 0.0f;          //mean-square of the canceler's output, ie the error signal (smoothed)
+    float32_t feedback_ms = 0.0f;       //mean-square of the estimated feedback signal (smoothed)
+    float32_t coeff_norm = 0.0f;        //L2 norm of the adaptive filter (sqrt of the estimated feedback-path energy)
+    float32_t max_coeff_norm = 0.0f;    //largest coeff_norm since the last reset
+
+    unsigned long n_divergence = 0;     //blocks where the output was much louder than the input (see setDivergenceRatio())
+    unsigned long n_nan_resets = 0;     //times that the adaptive filter was reset because of NaN or Inf
+    unsigned long n_divergence_resets = 0; //times that the adaptive filter was reset because of divergence (if enabled)
+    unsigned long n_underruns = 0;      //times that the loop-back audio wasn't ready in time
+
+    uint32_t update_usec = 0;           //processing time of the latest block
+    uint32_t max_update_usec = 0;       //longest processing time since the last reset
+
+    //convenience
+    float32_t errorToInput_dB(void) const { return 10.0f*log10f(max(error_ms,1.0e-20f)/max(input_ms,1.0e-20f)); }
+    float32_t feedbackToInput_dB(void) const { return 10.0f*log10f(max(feedback_ms,1.0e-20f)/max(input_ms,1.0e-20f)); }
+    float32_t coeffEnergy_dB(void) const { return 20.0f*log10f(max(coeff_norm,1.0e-10f)); }
+
+    void printTo(Print *p) const {
+      p->print(F("AFC telemetry: blocks = ")); p->print(block_count);
+      p->print(F(", err/in = ")); p->print(errorToInput_dB(),1); p->print(F(" dB"));
+      p->print(F(", fb/in = ")); p->print(feedbackToInput_dB(),1); p->print(F(" dB"));
+      p->print(F(", |w| = ")); p->print(coeff_norm,5); p->print(F(" (max ")); p->print(max_coeff_norm,5); p->print(F(")"));
+      p->print(F(", diverge = ")); p->print(n_divergence);
+      p->print(F(", resets NaN/div = ")); p->print(n_nan_resets); p->print(F("/")); p->print(n_divergence_resets);
+      p->print(F(", underruns = ")); p->print(n_underruns);
+      p->print(F(", usec = ")); p->print(update_usec); p->print(F(" (max ")); p->print(max_update_usec); p->println(F(")"));
+    }
+};
+
+class AudioFeedbackCancelTelemetry_F32 {
+  public:
+    AudioFeedbackCancelTelemetry_F32(void) {}
+
+    bool enable(bool _enable = true) { return is_enabled = _enable; }
+    bool isEnabled(void) { return is_enabled; }
+
+    //smoothing of the powers, in audio blocks (about 1/e time constant)
+    float32_t setAveragingBlocks(float32_t n_blocks) { alpha = (n_blocks <= 1.0f) ? 0.0f : expf(-1.0f/n_blocks); return n_blocks; }
+
+    //a block counts as divergent if the output power exceeds ratio*input power.  If n_blocks_to_reset > 0, the
+    //canceler is reset after that many divergent blocks in a row (off by default)
+    float32_t setDivergenceRatio(float32_t ratio) { return divergence_ratio = ratio; }
+    int setDivergenceReset(int n_blocks_to_reset) { return divergence_reset_blocks = n_blocks_to_reset; }
+
+    void reset(void) { flag_reset = true; }  //takes effect at the next block
+
+    //called by the canceler.  These are cheap, so they can be called even when not enabled.
+    void countNaNReset(void) { stats.n_nan_resets++; }
+    void setNumUnderruns(unsigned long n) { stats.n_underruns = n; }
+
+    //called by the canceler at the end of each block, when enabled.  x is the input, y is the output, and
+    //coeff_energy is the sum of the squares of the adaptive filter coefficients.  Returns true if the canceler
+    //should reset itself (because of NaN/Inf or because of divergence).
+    bool endBlock(const float32_t *x, const float32_t *y, int n, float32_t coeff_energy, uint32_t usec) {
+      if (flag_reset) { doReset(); flag_reset = false; }
+
+      //one pass through the block
+      float32_t sum_x = 0.0f, sum_y = 0.0f, sum_fb = 0.0f;
+      for (int i=0; i < n; i++) {
+        const float32_t fb = x[i] - y[i];
+        sum_x += x[i]*x[i];  sum_y += y[i]*y[i];  sum_fb += fb*fb;
+      }
+      const float32_t inv_n = (n > 0) ? (1.0f / (float32_t)n) : 0.0f;
+      const float32_t x_ms = sum_x*inv_n, y_ms = sum_y*inv_n, fb_ms = sum_fb*inv_n;
+
+      bool should_reset = false;
+      if (!std::isfinite(y_ms) || !std::isfinite(coeff_energy)) {
+        stats.n_nan_resets++;
+        should_reset = true;
+      } else {
+        //divergence
+        if (y_ms > divergence_ratio*x_ms + 1.0e-12f) {
+          stats.n_divergence++;
+          n_divergent_in_a_row++;
+          if ((divergence_reset_blocks > 0) && (n_divergent_in_a_row >= divergence_reset_blocks)) {
+            stats.n_divergence_resets++;
+            should_reset = true;
+          }
+        } else {
+          n_divergent_in_a_row = 0;
+        }
+
+        //smoothed powers
+        const float32_t a = (stats.block_count == 0) ? 0.0f : alpha;
+        stats.input_ms = x_ms + a*(stats.input_ms - x_ms);
+        stats.error_ms = y_ms + a*(stats.error_ms - y_ms);
+        stats.feedback_ms = fb_ms + a*(stats.feedback_ms - fb_ms);
+        stats.coeff_norm = sqrtf(max(coeff_energy, 0.0f));
+        if (stats.coeff_norm > stats.max_coeff_norm) stats.max_coeff_norm = stats.coeff_norm;
+      }
+      if (should_reset) n_divergent_in_a_row = 0;
+      stats.update_usec = usec;
+      if (usec > stats.max_update_usec) stats.max_update_usec = usec;
+      stats.block_count++;
+
+      publish();
+      return should_reset;
+    }
+
+    //Copy the latest metrics.  This can be safely called from loop() while the audio is running.
+    //Returns false only if the audio interrupt kept changing the values during every attempt.
+    bool getSnapshot(AudioFeedbackCancelTelemetry_Snapshot *out, int max_tries = 4) {
+      if (out == NULL) return false;
+      for (int Itry = 0; Itry < max_tries; Itry++) {
+        uint32_t seq_start = snapshot_seq;
+        if (seq_start & 0x01) continue;  //being written right now
+        afcTelemetry_compilerBarrier();
+        *out = snapshot;
+        afcTelemetry_compilerBarrier();
+        if (snapshot_seq == seq_start) return true;
+      }
+      return false;
+    }
+    void printSnapshot(Print *p) {
+      AudioFeedbackCancelTelemetry_Snapshot snap;
+      if (getSnapshot(&snap)) snap.printTo(p);
+    }
+
+  protected:
+    bool is_enabled = false;
+    float32_t alpha = 0.9f;  //about 10 blocks
+    float32_t divergence_ratio = 4.0f;  //ie, output 6 dB louder than the input
+    int divergence_reset_blocks = 0;
+    int n_divergent_in_a_row = 0;
+    volatile bool flag_reset = false;
+    AudioFeedbackCancelTelemetry_Snapshot stats;     //working copy (only touched by the audio interrupt)
+
+    //the snapshot is protected by a sequence counter: it is odd while the audio interrupt is writing
+    volatile uint32_t snapshot_seq = 0;
+    AudioFeedbackCancelTelemetry_Snapshot snapshot;
+
+    void doReset(void) {
+      unsigned long n_underruns = stats.n_underruns;
+      stats = AudioFeedbackCancelTelemetry_Snapshot();
+      stats.n_underruns = n_underruns;  //this one is owned by the canceler
+      n_divergent_in_a_row = 0;
+    }
+    void publish(void) {
+      snapshot_seq = snapshot_seq + 1;  //now odd: writing in progress
+      afcTelemetry_compilerBarrier();
+      snapshot = stats;
+      afcTelemetry_compilerBarrier();
+      snapshot_seq = snapshot_seq + 1;  //now even: done
+    }
+};
+
+#endif
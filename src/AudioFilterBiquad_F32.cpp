@@ -60,6 +60,18 @@ int AudioFilterBiquad_F32::processAudioBlock(const audio_block_f32_t *block, aud
 }
 
 
+int AudioFilterBiquad_F32::processSamples(const float32_t *in, float32_t *out, const int n)  {
+	if (!is_enabled || !in || !out) return -1;
+	
+	if (is_bypassed) {
+		for (int i=0; i<n; i++) out[i] = in[i]; //copy input to output
+	} else {
+		arm_biquad_cascade_df1_f32(&iir_inst, (float32_t *)in, out, n);
+	}
+	return 0;
+}
+
+
 //for all of these filters, a butterworth filter has q = 0.7017  (ie, 1/sqrt(2))
 void AudioFilterBiquad_F32::calcLowpass(float32_t freq_Hz, float32_t _q, float32_t *coeff) {
 	cutoff_Hz = freq_Hz;
@@ -54,6 +54,12 @@ class AudioFilterBase_F32 : public AudioStream_F32 {
 
     virtual int processAudioBlock(const audio_block_f32_t *block, audio_block_f32_t *block_new) = 0;
 
+    //Filter a run of samples that is shorter than a full block (such as when processing a block in small chunks).
+    //The filter states carry over from call to call, just like with processAudioBlock().  Returns zero if OK.
+    //Call canProcessSamples() first...not every filter supports this.
+    virtual bool canProcessSamples(const int n) { return false; }
+    virtual int processSamples(const float32_t *in, float32_t *out, const int n) { return -1; }
+
     virtual bool enable(bool enable = true) {
       if (enable == true) {
         //if (is_armed) {  //don't allow it to enable if it can't actually run the filters
@@ -221,6 +227,8 @@ class AudioFilterBiquad_F32 : public AudioFilterBase_F32
 
     virtual void update(void);
     virtual int processAudioBlock(const audio_block_f32_t *block, audio_block_f32_t *block_new);
+    virtual bool canProcessSamples(const int n) { return is_enabled; }
+    virtual int processSamples(const float32_t *in, float32_t *out, const int n);
     virtual float getCutoffFrequency_Hz(void) {  return cutoff_Hz;  }
     virtual float getQ(void) {  return q;  }
     virtual float getBW_Hz(void);
@@ -91,6 +91,14 @@ int AudioFilterFIR_F32::processAudioBlock(const audio_block_f32_t *block, audio_
 	return 0;
 }
 
+int AudioFilterFIR_F32::processSamples(const float32_t *in, float32_t *out, const int n) {
+	if ((is_enabled == false) || (in==NULL) || (out==NULL) || (n > configured_block_size)) return -1;
+	
+	//apply the FIR
+	arm_fir_f32(&fir_inst, (float32_t *)in, out, n);
+	return 0;
+}
+
 void AudioFilterFIR_F32::printCoeff(int start_ind, int end_ind) {
 	start_ind = min(n_coeffs-1,max(0,start_ind));
 	end_ind = min(n_coeffs-1,max(0,end_ind));
@@ -36,6 +36,8 @@ class AudioFilterFIR_F32 : public AudioFilterBase_F32
 		void end(void) {  coeff_p = NULL; enable(false); }
 		void update(void);
 		int processAudioBlock(const audio_block_f32_t *block, audio_block_f32_t *block_new); //called by update(); returns zero if OK
+		bool canProcessSamples(const int n) { return (is_enabled && (n <= configured_block_size)); }  //the FIR's state buffer is only sized for configured_block_size
+		int processSamples(const float32_t *in, float32_t *out, const int n);
 
  		bool enable(bool enable = true) { 
 			if (enable == true) {
@@ -4,7 +4,11 @@
 
 #include "utility/FreqWeighting_IEC1672.h"
 
-//Frequency weighting.  Defaults to A-Weighting
+//Frequency weighting.  Defaults to A-Weighting.
+//
+//By default, it uses the pre-computed filters if there is one for the current sample rate, otherwise
+//it designs the filter at runtime (see FreqWeighting_IEC1672::designFilter_matlab_sos()).  Use
+//setDesignMethod() to force one approach or the other.
 class AudioFilterFreqWeighting_F32: public AudioFilterBiquad_F32 {
 	public:
 		AudioFilterFreqWeighting_F32(void): AudioFilterBiquad_F32() {
@@ -26,15 +30,32 @@ class AudioFilterFreqWeighting_F32: public AudioFilterBiquad_F32 {
 			selectFilterCoeff();
 		}
 		virtual int getWeightingType(void) { return weightingType; }
+
+		enum DESIGN_METHOD { DESIGN_AUTO=0, DESIGN_TABLE, DESIGN_RUNTIME };
+		virtual int setDesignMethod(int method) { designMethod = method; selectFilterCoeff(); return designMethod; }
+		virtual int getDesignMethod(void) { return designMethod; }
+		virtual void setRuntimeDesignOptions(bool prewarp, bool shelf_fix) { use_prewarp = prewarp; use_shelf_fix = shelf_fix; selectFilterCoeff(); }
+		virtual bool getIsUsingRuntimeDesign(void) { return is_runtime_design; }
 	
 	protected:
 		int weightingType = A_WEIGHT;
+		int designMethod = DESIGN_AUTO;
+		bool use_prewarp = true, use_shelf_fix = true;
+		bool is_runtime_design = false;
 		FreqWeighting_IEC1672 IEC_coefficients;
+		float32_t runtime_sos[IEC1672_MAX_DESIGN_SOS*6];
 		
 		virtual void selectFilterCoeff(void) {
-			int N_sos = IEC_coefficients.get_N_sos_per_filter(getWeightingType());
-			float32_t *sos_matlab_coeff = IEC_coefficients.get_filter_matlab_sos(getWeightingType(),getSampleRate_Hz());
-			setFilterCoeff_Matlab_sos(sos_matlab_coeff, N_sos); //calling AudioFilterBiquad_F32 method
+			is_runtime_design = (designMethod == DESIGN_RUNTIME) ||
+				((designMethod == DESIGN_AUTO) && !IEC_coefficients.hasTableForSampleRate(getSampleRate_Hz()));
+			if (is_runtime_design) {
+				int N_sos = FreqWeighting_IEC1672::designFilter_matlab_sos(getWeightingType(), getSampleRate_Hz(), runtime_sos, use_prewarp, use_shelf_fix);
+				setFilterCoeff_Matlab_sos(runtime_sos, N_sos); //calling AudioFilterBiquad_F32 method
+			} else {
+				int N_sos = IEC_coefficients.get_N_sos_per_filter(getWeightingType());
+				float32_t *sos_matlab_coeff = IEC_coefficients.get_filter_matlab_sos(getWeightingType(),getSampleRate_Hz());
+				setFilterCoeff_Matlab_sos(sos_matlab_coeff, N_sos); //calling AudioFilterBiquad_F32 method
+			}
 		}
 	
 };
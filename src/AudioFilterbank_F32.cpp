@@ -319,7 +319,7 @@ int AudioFilterbankFIR_F32::designFilters(int n_chan, int n_fir, float sample_ra
 	//allocate memory (temporarily) for the filter coefficients
 	int n_coeff_needed = n_chan * n_fir;
 	if (n_coeff_needed > n_coeff_allocated) {
-		if (filter_coeff != NULL) delete filter_coeff;
+		if (filter_coeff != NULL) delete[] filter_coeff;
 		filter_coeff = new float[n_coeff_needed];
 		if (filter_coeff == NULL) { enable(false); return -1; }  //failed to allocate memory
 		n_coeff_allocated = n_coeff_needed;
@@ -327,12 +327,17 @@ int AudioFilterbankFIR_F32::designFilters(int n_chan, int n_fir, float sample_ra
 	
 	//call the designer...only for N_FIR up to 1024...but will it really work if it is that big??  64, 96, 128 are more normal
 	//Serial.println("AudioFilterbankFIR_F32: designFilters: creating coefficients...");
-	int ret_val = filterbankDesigner.createFilterCoeff(n_chan, n_fir, sample_rate_Hz, freqs_Hz, (float *)filter_coeff);
-	if (ret_val < 0) { 
-		Serial.println(F("AudioFilterbankFIR_F32: designFilters: createFilterCoeff failed with code ") + String(ret_val));
-		enable(false); 
-		return -1; //failed to compute coefficients
-	} 
+	//...but first, see if we have already designed this filterbank
+	const int cache_type = AudioConfigFilterBankCache_F32::DESIGN_FIR;
+	if ((coeff_cache == NULL) || (!coeff_cache->lookup(cache_type, n_chan, n_fir, sample_rate_Hz, block_len, freqs_Hz, filter_coeff, n_coeff_needed))) {
+		int ret_val = filterbankDesigner.createFilterCoeff(n_chan, n_fir, sample_rate_Hz, freqs_Hz, (float *)filter_coeff);
+		if (ret_val < 0) { 
+			Serial.println(F("AudioFilterbankFIR_F32: designFilters: createFilterCoeff failed with code ") + String(ret_val));
+			enable(false); 
+			return -1; //failed to compute coefficients
+		} 
+		if (coeff_cache != NULL) coeff_cache->store(cache_type, n_chan, n_fir, sample_rate_Hz, block_len, freqs_Hz, filter_coeff, n_coeff_needed);
+	}
 
 	
 	//copy the coefficients over to the individual filters
@@ -491,7 +496,7 @@ int AudioFilterbankBiquad_F32::designFilters(int n_chan, int n_iir, float sample
 	//float filter_sos[n_chan][ncol];
 	int n_coeff_needed = n_chan *ncol;
 	if (n_coeff_needed > n_coeff_allocated) {
-		if (filter_coeff != NULL) delete filter_coeff;
+		if (filter_coeff != NULL) delete[] filter_coeff;
 		filter_coeff = new float[n_coeff_needed];
 		if (filter_coeff == NULL) { enable(false); return -1; }  //failed to allocate memory
 		n_coeff_allocated = n_coeff_needed;
@@ -502,10 +507,14 @@ int AudioFilterbankBiquad_F32::designFilters(int n_chan, int n_iir, float sample
 	
 	
 	//call the designer
-	float td_msec = 0.000;  //assumed max delay (?) for the time-alignment process?
-	int ret_val = filterbankDesigner.createFilterCoeff_SOS(n_chan, n_iir, sample_rate_Hz, td_msec, freqs_Hz, filter_sos, filter_delay);
-	
-	if (ret_val < 0) { enable(false); return -1; } //failed to compute coefficients
+	//...but first, see if we have already designed this filterbank
+	const int cache_type = AudioConfigFilterBankCache_F32::DESIGN_IIR_SOS;
+	if ((coeff_cache == NULL) || (!coeff_cache->lookup(cache_type, n_chan, n_iir, sample_rate_Hz, block_len, freqs_Hz, filter_sos, n_coeff_needed))) {
+		float td_msec = 0.000;  //assumed max delay (?) for the time-alignment process?
+		int ret_val = filterbankDesigner.createFilterCoeff_SOS(n_chan, n_iir, sample_rate_Hz, td_msec, freqs_Hz, filter_sos, filter_delay);
+		if (ret_val < 0) { enable(false); return -1; } //failed to compute coefficients
+		if (coeff_cache != NULL) coeff_cache->store(cache_type, n_chan, n_iir, sample_rate_Hz, block_len, freqs_Hz, filter_sos, n_coeff_needed);
+	}
 	
 	//copy the coefficients over to the individual filters...is this right?!? 
 	for (int i=0; i< n_chan; i++) filters[i].setFilterCoeff_Matlab_sos(&(filter_sos[i*ncol]), N_BIQUAD_PER_FILT);  //sets multiple biquads.  Also calls begin().
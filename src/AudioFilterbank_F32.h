@@ -21,6 +21,7 @@
 #include <AudioConfigFIRFilterBank_F32.h> //from Tympan_Library
 #include <AudioFilterBiquad_F32.h> 		  //from Tympan_Library
 #include <AudioConfigIIRFilterBank_F32.h> //from Tympan_Library
+#include <AudioConfigFilterBankCache_F32.h> //from Tympan_Library
 #include <SerialManager_UI.h>			  //from Tympan_Library
 #include <TympanRemoteFormatter.h> 		  //from Tympan_Library
 #include <vector>
@@ -73,7 +74,7 @@ class AudioFilterbankBase_F32 : public AudioStream_F32 {
 	public:
 		AudioFilterbankBase_F32(void): AudioStream_F32(1,inputQueueArray) { } 
 		AudioFilterbankBase_F32(const AudioSettings_F32 &settings) : AudioStream_F32(1,inputQueueArray) { }
-		~AudioFilterbankBase_F32(void) { delete filter_coeff; }
+		~AudioFilterbankBase_F32(void) { delete[] filter_coeff; }
 		
 		virtual void enable(bool _enable = true) { is_enabled = _enable; }
 		
@@ -88,6 +89,11 @@ class AudioFilterbankBase_F32 : public AudioStream_F32 {
 		virtual AudioFilterBase_F32 *getFilter(int Ichan) = 0;
 		virtual int get_filter_order(void) { return state.filter_order; }
 		
+		//optionally, remember previous filter designs so that re-designing (such as on preset change) is fast.
+		//The cache can be shared across several filterbanks.  Set to NULL to disable caching (the default).
+		virtual AudioConfigFilterBankCache_F32* setCoeffCache(AudioConfigFilterBankCache_F32 *_cache) { return coeff_cache = _cache; }
+		virtual AudioConfigFilterBankCache_F32* getCoeffCache(void) { return coeff_cache; }
+		
 		AudioFilterbankState state;
 		String filter_type_str = String("no type");
 		
@@ -101,8 +107,9 @@ class AudioFilterbankBase_F32 : public AudioStream_F32 {
 		static int enforce_minimum_spacing_of_crossover_freqs(float *freqs_Hz, int n_crossover, float min_seperation_fac,  int direction = 1); //direction = 1 to move unacceptable freqs higher, -1 to move them lower
 		static void sortFrequencies(float *freq_Hz, int n_filts);
 		
-		float *filter_coeff;
+		float *filter_coeff = NULL;
 		float n_coeff_allocated = 0;
+		AudioConfigFilterBankCache_F32 *coeff_cache = NULL;
 };
 
 
@@ -0,0 +1,85 @@
+
+#include "AudioLoopBackHistory_F32.h"
+#include <cmath>  //for "isfinite()"
+
+void AudioLoopBackHistory_F32::update(void) {
+  for (int Ichan = 0; Ichan < LOOPBACKHISTORY_MAX_CHAN; Ichan++) {
+    audio_block_f32_t *in_block = AudioStream_F32::receiveReadOnly_f32(Ichan);
+    if (!in_block) continue;
+
+    write(Ichan, in_block->data, in_block->length);
+    newest_block_id[Ichan] = in_block->id;
+
+    AudioStream_F32::release(in_block);
+  }
+}
+
+void AudioLoopBackHistory_F32::write(int chan, const float32_t *x, int n) {
+  if (!isValidChan(chan) || (buff[chan] == NULL)) return;
+  n_written[chan] += n;
+
+  //only the newest "capacity" samples can be kept
+  float32_t *h = buff[chan];
+  const int cap = capacity[chan];
+  if (n > cap) { x += (n - cap); n = cap; }
+
+  //out of spare room?  Slide the history that is still needed to the back of the buffer
+  int ind = newest_ind[chan];
+  if (ind < n) {
+    memmove(h + slack + n, h + ind, (cap - n)*sizeof(float32_t));
+    ind = slack + n;
+  }
+
+  //write newest-first
+  for (int i = 0; i < n; i++) {
+    float32_t val = x[i];
+    if (!std::isfinite(val)) { val = 0.0f; n_non_finite[chan]++; }
+    h[--ind] = val;
+  }
+  newest_ind[chan] = ind;
+}
+
+int AudioLoopBackHistory_F32::attach(int chan, int n_samples_needed) {
+  if (!isValidChan(chan)) {
+    Serial.println(F("AudioLoopBackHistory_F32: attach: *** ERROR ***: channel ") + String(chan) + F(" is out of range."));
+    return 0;
+  }
+  n_readers[chan]++;
+  if ((n_samples_needed <= capacity[chan]) && (buff[chan] != NULL)) return n_readers[chan];  //the existing memory is big enough
+
+  //allocate the bigger buffer before touching the old one
+  int new_capacity = max(n_samples_needed, capacity[chan]);
+  float32_t *new_buff = new float32_t[slack + new_capacity];
+  if (new_buff == NULL) {
+    Serial.println(F("AudioLoopBackHistory_F32: attach: *** ERROR ***: could not allocate ") + String(new_capacity) + F(" samples of history."));
+    n_readers[chan]--;
+    return n_readers[chan];
+  }
+  for (int i = 0; i < slack + new_capacity; i++) new_buff[i] = 0.0f;
+
+  //swap it in without the audio interrupt seeing a half-finished state (the history restarts from silence)
+  __disable_irq();
+  float32_t *old_buff = buff[chan];
+  buff[chan] = new_buff;
+  capacity[chan] = new_capacity;
+  newest_ind[chan] = slack;
+  __enable_irq();
+  if (old_buff != NULL) delete[] old_buff;
+
+  return n_readers[chan];
+}
+
+int AudioLoopBackHistory_F32::detach(int chan) {
+  if (!isValidChan(chan) || (n_readers[chan] <= 0)) return 0;
+  n_readers[chan]--;
+  if (n_readers[chan] == 0) {
+    //last one out turns off the lights
+    __disable_irq();
+    float32_t *old_buff = buff[chan];
+    buff[chan] = NULL;
+    capacity[chan] = 0;
+    __enable_irq();
+    if (old_buff != NULL) delete[] old_buff;
+  }
+  return n_readers[chan];
+}
@@ -0,0 +1,105 @@
+
+#ifndef _AudioLoopBackHistory_F32_h
+#define _AudioLoopBackHistory_F32_h
+
+/*
+   AudioLoopBackHistory_F32
+
+   Created: OpenAudio, Oct 2026
+   Purpose: A single, shared history of the loop-back (ie, output) audio for use by several feedback
+       cancelers.  With AudioLoopBack_F32, every AFC instance gets its own copy of the output audio in its
+       own ring buffer.  In a stereo or a four-receiver build, that's a lot of duplicated RAM and copying.
+
+       Instead, connect each receiver's output audio to one input of this class (one writer).  Then, each
+       AFC instance (or a cross-path canceler) reads directly from this shared history (no copying) at its
+       own delay via setSharedLoopBack().  Each reader attach()es itself to one channel, stating how much
+       history it needs.  Memory is only allocated for channels that have readers.  It is sized for the most
+       demanding reader of that channel and is freed when the channel's last reader detach()es.
+
+       The history of each channel is stored newest-first so that any window of the history is contiguous
+       in memory.  So, getWindow(chan, age)[j] is the sample that is (age + j) samples old, which is exactly
+       what a FIR-style canceler wants to step through.  Rather than being a ring, each channel's buffer has
+       one block of spare room at its front.  New samples are written into the spare room and, once it is
+       used up, the history is slid back to the end of the buffer (one memmove every block or so).
+
+       Underruns (ie, a reader running when the writer has not delivered a new block) can be detected
+       with checkForUnderrun().  Non-finite (NaN or Inf) samples are replaced by zero and are counted, so
+       that readers can reset their adaptive filters (see getNumNonFinite()).
+
+   MIT License.  use at your own risk.
+*/
+
+#include <Arduino.h>
+#include "AudioStream_F32.h"    //from Tympan_Library
+#include "AudioSettings_F32.h"  //from Tympan_Library
+
+#define LOOPBACKHISTORY_MAX_CHAN  4
+
+class AudioLoopBackHistory_F32 : public AudioStream_F32
+{
+//GUI: inputs:4, outputs:0  //this line used for automatic generation of GUI node
+//GUI: shortName: LoopBackHistory
+  public:
+    //constructor
+    AudioLoopBackHistory_F32(void) : AudioStream_F32(LOOPBACKHISTORY_MAX_CHAN, inputQueueArray_f32) { resetCounters(); }
+    AudioLoopBackHistory_F32(const AudioSettings_F32 &settings) : AudioStream_F32(LOOPBACKHISTORY_MAX_CHAN, inputQueueArray_f32) { resetCounters(); }
+    ~AudioLoopBackHistory_F32(void) { for (int i=0; i < LOOPBACKHISTORY_MAX_CHAN; i++) { if (buff[i] != NULL) delete[] buff[i]; } }
+
+    //the writer.  Called automatically by the audio library
+    virtual void update(void);
+    virtual void write(int chan, const float32_t *x, int n);  //you can also feed it yourself (not from update())
+
+    //register (or unregister) a reader of channel "chan" that needs to look back "n_samples_needed" samples.  Returns
+    //the number of readers of that channel.  These may allocate or free memory, so call them from setup() or loop(),
+    //not from the audio processing.
+    virtual int attach(int chan, int n_samples_needed);
+    virtual int detach(int chan);
+    int getNumReaders(int chan) { return isValidChan(chan) ? n_readers[chan] : 0; }
+    int getCapacity(int chan) { return isValidChan(chan) ? capacity[chan] : 0; }  //samples of history held for this channel
+
+    //zero-copy access to the history.  Returns a pointer to the sample that is "age" samples old (age 0 is the
+    //newest), followed by older and older samples.  The window can run up to (getCapacity() - age) samples long.
+    //Returns NULL if the channel has no readers or the age is out of range.
+    const float32_t *getWindow(int chan, int age) {
+      if (!isValidChan(chan) || (buff[chan] == NULL) || (age < 0) || (age >= capacity[chan])) return NULL;
+      return buff[chan] + newest_ind[chan] + age;
+    }
+
+    //status for the readers
+    uint32_t getNumWritten(int chan) { return isValidChan(chan) ? n_written[chan] : 0; }
+    unsigned long getNewestBlockId(int chan) { return isValidChan(chan) ? newest_block_id[chan] : 0; }
+    unsigned long getNumNonFinite(int chan) { return isValidChan(chan) ? n_non_finite[chan] : 0; }
+
+    //Call once per audio block from each reader, where last_count is the reader's own copy of getNumWritten()
+    //from its previous call.  Returns true (and counts it) if fewer than n_expected new samples have been written.
+    bool checkForUnderrun(int chan, uint32_t &last_count, int n_expected) {
+      const uint32_t now = getNumWritten(chan);
+      const bool is_underrun = ((now - last_count) < (uint32_t)n_expected);
+      last_count = now;
+      if (is_underrun) n_underruns++;
+      return is_underrun;
+    }
+    unsigned long getNumUnderruns(void) { return n_underruns; }  //total across all readers
+
+  protected:
+    audio_block_f32_t *inputQueueArray_f32[LOOPBACKHISTORY_MAX_CHAN]; //memory pointer for the input to this module
+    static const int slack = MAX_AUDIO_BLOCK_SAMPLES_F32;  //spare room at the front of each channel's buffer
+    int n_readers[LOOPBACKHISTORY_MAX_CHAN];
+    int capacity[LOOPBACKHISTORY_MAX_CHAN];            //samples of history for each channel
+    float32_t *buff[LOOPBACKHISTORY_MAX_CHAN];         //[slack + capacity] for each channel with readers, else NULL
+    int newest_ind[LOOPBACKHISTORY_MAX_CHAN];          //location of the newest sample (0 to slack)
+    volatile uint32_t n_written[LOOPBACKHISTORY_MAX_CHAN];
+    unsigned long newest_block_id[LOOPBACKHISTORY_MAX_CHAN];
+    unsigned long n_non_finite[LOOPBACKHISTORY_MAX_CHAN];
+    unsigned long n_underruns = 0;
+
+    bool isValidChan(int chan) { return (chan >= 0) && (chan < LOOPBACKHISTORY_MAX_CHAN); }
+    void resetCounters(void) {
+      for (int i=0; i < LOOPBACKHISTORY_MAX_CHAN; i++) {
+        n_readers[i] = 0; capacity[i] = 0; buff[i] = NULL; newest_ind[i] = slack;
+        n_written[i] = 0; newest_block_id[i] = 0; n_non_finite[i] = 0;
+      }
+    }
+};
+
+#endif
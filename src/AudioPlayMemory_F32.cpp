@@ -27,6 +27,19 @@ int AudioPlayMemoryI16_F32::setCurrentSampleFromQueue(int ind) {
 	data_ptr = playQueue.all_sampleInfo[queue_ind].data_ptr;
 	data_len = playQueue.all_sampleInfo[queue_ind].length;
 	setDataSampleRate_Hz(playQueue.all_sampleInfo[queue_ind].sample_rate_Hz);
+	data_format = playQueue.all_sampleInfo[queue_ind].format;
+	if (data_format == SampleInfo::FORMAT_IMA_ADPCM) {
+		adpcm_ptr = playQueue.all_sampleInfo[queue_ind].adpcm_ptr;
+		adpcm_block_bytes = playQueue.all_sampleInfo[queue_ind].block_bytes;
+		if (adpcm_block_bytes < 5) {
+			Serial.println("AudioPlayMemoryI16_F32: setCurrentSampleFromQueue: *** ERROR ***: IMA-ADPCM block size of " + String(adpcm_block_bytes) + " bytes is not allowed.");
+			Serial.println("    : Must be at least 5 bytes.  Skipping this sample.");
+			data_len = 0;
+			adpcm_block_bytes = 5;
+		}
+		adpcm_samples_per_block = AUDIOPLAYMEMORY_ADPCM_SAMPLES_PER_BLOCK(adpcm_block_bytes);
+		adpcm_block_ind = 0xFFFFFFFF;  //nothing decoded yet
+	}
 
 	//reset the playback counters
 	data_ind = 0;
@@ -101,10 +114,11 @@ float32_t AudioPlayMemoryI16_F32::getNextAudioValue(void) {
 		
 	} else {
 		// get the current data value from the buffer
-		ret_val = CONVERT_I16_TO_F32(data_ptr[data_ind]);   //get the next piece of data
+		const int16_t data_value = getDataValue(data_ind);
+		ret_val = CONVERT_I16_TO_F32(data_value);   //get the next piece of data
 		if (abs(ret_val) > 1.0f) {
 			Serial.println("AudioPlayMemory: getNextAudioValue: *** WARNING ***: sample is beyond full-scale.");
-			Serial.println("    : val = " + String(ret_val,6) + " for data value " + String(data_ptr[data_ind]) + " at sample index = " + String(data_ind));
+			Serial.println("    : val = " + String(ret_val,6) + " for data value " + String(data_value) + " at sample index = " + String(data_ind));
 			Serial.println("    : continuing anyway...");
 		}
 		
@@ -124,4 +138,47 @@ float32_t AudioPlayMemoryI16_F32::getNextAudioValue(void) {
 
 	return ret_val;
   }
-	
+
+int16_t AudioPlayMemoryI16_F32::getDataValue(const uint32_t ind) {
+	if (data_format == SampleInfo::FORMAT_IMA_ADPCM) {
+		const uint32_t block_ind = ind / adpcm_samples_per_block;
+		if ((block_ind != adpcm_block_ind) || (ind < adpcm_ind)) startAdpcmBlock(block_ind);  //the playback moved into another block
+		while (adpcm_ind < ind) decodeNextAdpcmSample();  //decode up to the requested sample (usually just one step)
+		return (int16_t)adpcm_predictor;
+	}
+	return data_ptr[ind];
+}
+
+//IMA-ADPCM tables
+static const int16_t ima_adpcm_step_table[89] = {
+	7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118,
+	130, 143, 157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963, 1060,
+	1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132,
+	7845, 8630, 9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767 };
+static const int8_t ima_adpcm_index_table[16] = { -1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8 };
+
+//Mono IMA-ADPCM (as in an IMA-ADPCM WAV file) is in blocks.  Each block starts with a 4-byte header (the first sample as
+//int16, the step index, and a reserved byte), followed by 4-bit codes, low nibble first.  Start decoding a block from its header.
+void AudioPlayMemoryI16_F32::startAdpcmBlock(const uint32_t block_ind) {
+	const uint8_t *p = adpcm_ptr + block_ind * adpcm_block_bytes;
+	adpcm_predictor = (int16_t)((uint16_t)p[0] | ((uint16_t)p[1] << 8));
+	adpcm_step_ind = min((int)p[2], 88);
+	adpcm_block_ind = block_ind;
+	adpcm_ind = block_ind * adpcm_samples_per_block;
+}
+
+//Decode the next sample of the current block
+void AudioPlayMemoryI16_F32::decodeNextAdpcmSample(void) {
+	const uint32_t i = adpcm_ind - adpcm_block_ind * adpcm_samples_per_block;  //the last decoded sample, within the block
+	const uint32_t code = (adpcm_ptr[adpcm_block_ind * adpcm_block_bytes + 4 + (i >> 1)] >> ((i & 1) * 4)) & 0x0F;
+	const int32_t step = ima_adpcm_step_table[adpcm_step_ind];
+	int32_t diff = step >> 3;
+	if (code & 4) diff += step;
+	if (code & 2) diff += step >> 1;
+	if (code & 1) diff += step >> 2;
+	adpcm_predictor += (code & 8) ? -diff : diff;
+	if (adpcm_predictor > 32767) adpcm_predictor = 32767; else if (adpcm_predictor < -32768) adpcm_predictor = -32768;
+	adpcm_step_ind += ima_adpcm_index_table[code];
+	if (adpcm_step_ind < 0) adpcm_step_ind = 0; else if (adpcm_step_ind > 88) adpcm_step_ind = 88;
+	adpcm_ind++;
+}
@@ -24,24 +24,42 @@
  *              "SampleInfo" object.
  *            - If you want to play a series of samples in a row, you must use an "AudioPlayMemoryQueue"
  *              object.  This object holds a bunch of "SampleInfo" instances within it.
+ *
+ * Notes: The samples can be stored as plain Int16 values or, to take a quarter of the memory, as IMA-ADPCM
+ *        (4 bits per sample).  The IMA-ADPCM data is in blocks, as in an IMA-ADPCM WAV file, and it is decoded one
+ *        sample at a time as it is played (so no decoding buffer is needed).  To make the IMA-ADPCM arrays from a WAV file, use the "wav2adpcm.py"
+ *        script in the RamWavPlayer_ADPCM example.
  */
+
+#define AUDIOPLAYMEMORY_ADPCM_SAMPLES_PER_BLOCK(block_bytes) (2*((block_bytes)-4)+1)  //mono: a 4-byte header holding the first sample, then 4 bits per sample
  
  //define a structure to hold the sample info...but NOT the sample values themselves, just the info
 class SampleInfo {
 	public:
+		enum FORMAT {FORMAT_I16=0, FORMAT_IMA_ADPCM};
 		SampleInfo() {};
 		SampleInfo(const int16_t *_data, const uint32_t _data_len, const float32_t _data_fs_Hz) {
 			data_ptr = _data; length = _data_len; sample_rate_Hz = _data_fs_Hz;
 		}
+		//IMA-ADPCM data: _data_len is the number of samples (not bytes) and _block_bytes is the size of each block (such as 256)
+		SampleInfo(const uint8_t *_data, const uint32_t _data_len, const float32_t _data_fs_Hz, const uint16_t _block_bytes) {
+			adpcm_ptr = _data; length = _data_len; sample_rate_Hz = _data_fs_Hz; format = FORMAT_IMA_ADPCM; block_bytes = _block_bytes;
+		}
 		SampleInfo& operator=(const SampleInfo& sample) { //ensure a proper (shallow) copy
 			data_ptr = sample.data_ptr;
+			adpcm_ptr = sample.adpcm_ptr;
 			length = sample.length;
 			sample_rate_Hz = sample.sample_rate_Hz;
+			format = sample.format;
+			block_bytes = sample.block_bytes;
 			return *this;
 		}
-		const int16_t *data_ptr;
-		uint32_t length;
-		float32_t sample_rate_Hz;
+		const int16_t *data_ptr = NULL;
+		const uint8_t *adpcm_ptr = NULL;
+		uint32_t length = 0;  //number of samples
+		float32_t sample_rate_Hz = ((float)AUDIO_SAMPLE_RATE_EXACT);
+		int format = FORMAT_I16;
+		uint16_t block_bytes = 0;  //for IMA-ADPCM
 };
 
 //if you want to queue up many samples, use the class below!
@@ -58,6 +76,9 @@ class AudioPlayMemoryQueue {
 		int addSample(const int16_t *data, const uint32_t data_len, const float32_t data_fs_Hz) {
 			return addSample(SampleInfo(data,data_len,data_fs_Hz));
 		}
+		int addSample(const uint8_t *data, const uint32_t data_len, const float32_t data_fs_Hz, const uint16_t block_bytes) { //IMA-ADPCM
+			return addSample(SampleInfo(data,data_len,data_fs_Hz,block_bytes));
+		}
 		int addSample(SampleInfo sample);
 		int getQueueLen(void) { return queue_len; };
 		void reset(void) { queue_len = 0; }
@@ -96,6 +117,9 @@ class AudioPlayMemoryI16_F32 : public AudioStream_F32
 	virtual bool play(const int16_t *data, const uint32_t data_len, const float32_t data_fs_Hz) {
 		return play(AudioPlayMemoryQueue(SampleInfo(data,data_len,data_fs_Hz)));  //wrap the sample info into a queue
     }
+	virtual bool play(const uint8_t *data, const uint32_t data_len, const float32_t data_fs_Hz, const uint16_t block_bytes) { //IMA-ADPCM
+		return play(AudioPlayMemoryQueue(SampleInfo(data,data_len,data_fs_Hz,block_bytes)));  //wrap the sample info into a queue
+    }
 	
 	//here's how you check in on whether it is playing
 	enum STATE {STOPPED=0, PLAYING};
@@ -120,7 +144,7 @@ class AudioPlayMemoryI16_F32 : public AudioStream_F32
 	int setCurrentSampleFromQueue(int ind);
 
 
-    private:
+    protected:
       int state = STOPPED;
       const int16_t *data_ptr = NULL;
       uint32_t data_ind = 0;
@@ -137,6 +161,19 @@ class AudioPlayMemoryI16_F32 : public AudioStream_F32
 	  float32_t getNextAudioValue(void);
 	  int queue_ind;
 
+	  //related to IMA-ADPCM samples, which are decoded a sample at a time (the playback only ever moves forward)
+	  int data_format = SampleInfo::FORMAT_I16;
+	  const uint8_t *adpcm_ptr = NULL;
+	  uint32_t adpcm_block_bytes = 0;
+	  uint32_t adpcm_samples_per_block = 1;
+	  uint32_t adpcm_block_ind = 0xFFFFFFFF;  //the block being decoded
+	  uint32_t adpcm_ind = 0;                 //the index (within the whole sample) of the last decoded sample
+	  int32_t adpcm_predictor = 0;            //the last decoded sample
+	  int32_t adpcm_step_ind = 0;
+	  int16_t getDataValue(const uint32_t ind);
+	  void startAdpcmBlock(const uint32_t block_ind);
+	  void decodeNextAdpcmSample(void);
+
 };
 
 
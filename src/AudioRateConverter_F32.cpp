@@ -0,0 +1,203 @@
+/*
+ * AudioRateConverter_F32.cpp
+ *
+ * Created: OpenAudio, Oct 2026
+ *
+ * MIT License.  Use at your own risk.  Have fun!
+ *
+ */
+
+#include "AudioRateConverter_F32.h"
+
+bool AudioRateConverter_F32::beginRational(int _L, int _M, int taps_per_phase, float cutoff_frac) {
+	is_enabled = false; is_armed = false;
+	if ((_L < 1) || (_M < 1) || (_L > RATECONV_MAX_L) || (taps_per_phase < 2)) {
+		Serial.println("AudioRateConverter_F32: beginRational: *** ERROR *** invalid L (" + String(_L) + "), M (" + String(_M) + "), or taps (" + String(taps_per_phase) + ")");
+		return false;
+	}
+
+	//reduce the fraction so that we don't compute any more phases than necessary
+	int a = _L, b = _M;
+	while (b != 0) { int t = a % b; a = b; b = t; }
+	L = _L / a;  M = _M / a;
+
+	mode = MODE_RATIONAL;
+	ratio = ((float)L) / ((float)M);
+	step = ((float)M) / ((float)L);
+	float cutoff_norm = cutoff_frac * min(1.0f, ratio);  //relative to the input's Nyquist frequency
+	if (!allocateAndDesign(L, taps_per_phase, L, cutoff_norm)) return false;
+
+	is_armed = true;
+	return enable(true);
+}
+
+bool AudioRateConverter_F32::beginArbitrary(float ratio_out_over_in, int taps_per_phase, int _n_phases, float cutoff_frac) {
+	is_enabled = false; is_armed = false;
+	if ((ratio_out_over_in <= 0.0f) || (_n_phases < 2) || (taps_per_phase < 2)) {
+		Serial.println("AudioRateConverter_F32: beginArbitrary: *** ERROR *** invalid ratio (" + String(ratio_out_over_in) + "), phases, or taps");
+		return false;
+	}
+
+	mode = MODE_ARBITRARY;
+	ratio = ratio_out_over_in;
+	step = 1.0f / ratio;
+	float cutoff_norm = cutoff_frac * min(1.0f, ratio);  //relative to the input's Nyquist frequency
+
+	//one extra set of coefficients so that we can always interpolate between phase p and p+1
+	if (!allocateAndDesign(_n_phases, taps_per_phase, _n_phases+1, cutoff_norm)) return false;
+
+	is_armed = true;
+	return enable(true);
+}
+
+float AudioRateConverter_F32::setRatio(float ratio_out_over_in) {
+	if ((mode != MODE_ARBITRARY) || (ratio_out_over_in <= 0.0f)) return ratio;
+	ratio = ratio_out_over_in;
+	step = 1.0f / ratio;
+	return ratio;
+}
+
+//Design the prototype lowpass filter (windowed sinc, Kaiser window) at the upsampled rate and then
+//split it into its polyphase branches.
+bool AudioRateConverter_F32::allocateAndDesign(int _n_phases, int _n_taps, int n_coeff_sets, float cutoff_norm_at_input) {
+	n_phases = _n_phases;
+	n_taps = _n_taps;
+	coeff.assign(n_coeff_sets*n_taps, 0.0f);
+	hist.assign(2*n_taps, 0.0f);
+
+	int fifo_len = 4 * ((int)(max_in_block_len * max(1.0f, ratio) * 1.1f) + 8);
+	fifo_len = max(fifo_len, 4*max(MAX_AUDIO_BLOCK_SAMPLES_F32, max_in_block_len));
+	fifo.assign(fifo_len, 0.0f);
+	if ((coeff.size() == 0) || (hist.size() == 0) || (fifo.size() == 0)) {
+		Serial.println("AudioRateConverter_F32: allocateAndDesign: *** ERROR *** could not allocate memory.");
+		return false;
+	}
+
+	const int n_proto = n_phases*n_taps + (n_coeff_sets - n_phases);
+	const float fc = 0.5f * cutoff_norm_at_input / ((float)n_phases);  //cycles per sample at the upsampled rate
+	const float center = 0.5f * (float)(n_proto - 1);
+	const float beta = 8.0f;   //Kaiser window parameter.  About 80 dB stopband attenuation
+	const float I0_beta = besselI0(beta);
+	for (int Iset = 0; Iset < n_coeff_sets; Iset++) {
+		for (int k = 0; k < n_taps; k++) {
+			int n = Iset + k*n_phases;   //index into the prototype filter
+			float h = 0.0f;
+			if (n < n_proto) {
+				float t = ((float)n) - center;
+				float sinc = (fabsf(t) < 1.0e-6f) ? 1.0f : sinf(2.0f*M_PI*fc*t) / (2.0f*M_PI*fc*t);
+				float r = (n_proto > 1) ? (2.0f*((float)n)/((float)(n_proto-1)) - 1.0f) : 0.0f;
+				float win = besselI0(beta*sqrtf(max(0.0f, 1.0f - r*r))) / I0_beta;
+				h = 2.0f*fc*sinc*win * ((float)n_phases);  //scale by n_phases to make up for the zero-stuffing
+			}
+			coeff[Iset*n_taps + (n_taps-1-k)] = h;  //store time-reversed to match the order of the history buffer
+		}
+	}
+
+	resetState();
+	return true;
+}
+
+float32_t AudioRateConverter_F32::besselI0(float32_t x) {
+	//power series for the modified Bessel function of the first kind, order zero
+	float32_t sum = 1.0f, term = 1.0f, y = 0.25f*x*x;
+	for (int k = 1; k < 32; k++) {
+		term *= y / ((float32_t)(k*k));
+		sum += term;
+		if (term < 1.0e-9f*sum) break;
+	}
+	return sum;
+}
+
+void AudioRateConverter_F32::resetState(void) {
+	for (int i=0; i < (int)hist.size(); i++) hist[i] = 0.0f;
+	hist_ind = 0;
+	phase = 0;
+	frac_pos = 0.0f;
+	fifo_read_ind = 0;
+	fifo_count = 0;
+}
+
+void AudioRateConverter_F32::pushFifo(float32_t val) {
+	const int fifo_len = fifo.size();
+	if (fifo_count >= fifo_len) {
+		//full.  Drop the oldest sample
+		if (++fifo_read_ind >= fifo_len) fifo_read_ind = 0;
+		fifo_count--;
+		n_fifo_overruns++;
+	}
+	int write_ind = fifo_read_ind + fifo_count;
+	if (write_ind >= fifo_len) write_ind -= fifo_len;
+	fifo[write_ind] = val;
+	fifo_count++;
+}
+
+int AudioRateConverter_F32::readSamples(float32_t *out, int n_requested) {
+	const int fifo_len = fifo.size();
+	int n = min(n_requested, fifo_count);
+	for (int i=0; i < n; i++) {
+		out[i] = fifo[fifo_read_ind];
+		if (++fifo_read_ind >= fifo_len) fifo_read_ind = 0;
+	}
+	fifo_count -= n;
+	return n;
+}
+
+int AudioRateConverter_F32::processSamples(const float32_t *in, int n_in) {
+	if (!is_armed) return 0;
+	int n_out = 0;
+	float32_t y, y1;
+
+	if (mode == MODE_RATIONAL) {
+		for (int i=0; i < n_in; i++) {
+			pushHistory(in[i]);
+			while (phase < L) {  //compute every output sample that falls before the next input sample
+				arm_dot_prod_f32(&(hist[hist_ind]), getPhaseCoeff(phase), n_taps, &y);
+				pushFifo(y);  n_out++;
+				phase += M;
+			}
+			phase -= L;
+		}
+	} else {
+		for (int i=0; i < n_in; i++) {
+			pushHistory(in[i]);
+			while (frac_pos < 1.0f) {
+				float32_t phase_f = frac_pos * (float32_t)n_phases;
+				int Iphase = (int)phase_f;
+				float32_t a = phase_f - (float32_t)Iphase;
+				arm_dot_prod_f32(&(hist[hist_ind]), getPhaseCoeff(Iphase), n_taps, &y);
+				arm_dot_prod_f32(&(hist[hist_ind]), getPhaseCoeff(Iphase+1), n_taps, &y1);
+				pushFifo(y + a*(y1 - y));  n_out++;
+				frac_pos += step;
+			}
+			frac_pos -= 1.0f;
+		}
+	}
+	return n_out;
+}
+
+void AudioRateConverter_F32::update(void) {
+	if (!is_enabled) return;
+
+	//process whatever audio has arrived
+	audio_block_f32_t *block = AudioStream_F32::receiveReadOnly_f32();
+	if (block) {
+		processSamples(block->data, block->length);
+		last_block_id = block->id;
+		AudioStream_F32::release(block);
+	}
+
+	//is there enough to transmit?
+	if (fifo_count == 0) return;
+	if ((out_block_len > 0) && (fifo_count < out_block_len)) return;
+
+	audio_block_f32_t *block_new = AudioStream_F32::allocate_f32();
+	if (block_new == NULL) return;  //leave the samples in the FIFO for next time
+	int n = (out_block_len > 0) ? out_block_len : fifo_count;
+	n = min(n, block_new->full_length);
+	block_new->length = readSamples(block_new->data, n);
+	block_new->fs_Hz = get_endSampleRate_Hz();
+	block_new->id = last_block_id;
+
+	AudioStream_F32::transmit(block_new);
+	AudioStream_F32::release(block_new);
+}
@@ -0,0 +1,134 @@
+/*
+ * AudioRateConverter_F32
+ *
+ * Created: OpenAudio, Oct 2026
+ *
+ * Purpose: Change the sample rate of a stream of audio by a non-integer factor.  Two modes are provided:
+ *
+ *    * Rational mode: the sample rate is changed by exactly L/M (for example, 44.1kHz -> 48kHz is
+ *      L=160, M=147).  This uses a classic polyphase FIR filter so that only the non-zero taps of the
+ *      upsampled signal are ever computed.
+ *
+ *    * Arbitrary mode: the sample rate is changed by any (floating point) ratio.  The ratio can be
+ *      changed at any time via setRatio() so that it can track the drift between two clocks.  This
+ *      uses a finely-spaced polyphase filter bank where the output is linearly interpolated between
+ *      the two nearest phases.
+ *
+ *    Because the output sample rate is not an integer multiple of the input rate, the number of output
+ *    samples per update() will vary.  The converted samples are held in an internal FIFO.  By default,
+ *    each update() transmits everything that is available (so block->length varies from block to block).
+ *    Alternatively, use setOutputBlockLength() to have it only transmit blocks of a fixed length.
+ *
+ *    The core sample-by-sample routine, processSamples(), and readSamples() can also be called directly
+ *    without using update(), which is useful for bridging between two different audio graphs.
+ *
+ * MIT License.  Use at your own risk.  Have fun!
+ *
+ */
+
+#ifndef _AudioRateConverter_F32_h
+#define _AudioRateConverter_F32_h
+
+#include <Arduino.h>
+#include "AudioStream_F32.h"
+#include "arm_math.h"
+#include <vector>
+
+#define RATECONV_DEFAULT_TAPS_PER_PHASE   16    //FIR taps per polyphase branch.  More is steeper, but more expensive
+#define RATECONV_DEFAULT_N_PHASES_ARB     64    //number of polyphase branches used for arbitrary-ratio mode
+#define RATECONV_MAX_L                   512    //maximum upsampling factor in rational mode (limits RAM for coefficients)
+
+class AudioRateConverter_F32 : public AudioStream_F32 {
+//GUI: inputs:1, outputs:1  //this line used for automatic generation of GUI node
+//GUI: shortName:rate_converter
+	public:
+		AudioRateConverter_F32(void) : AudioStream_F32(1,inputQueueArray) {}
+		AudioRateConverter_F32(const AudioSettings_F32 &settings): AudioStream_F32(1,inputQueueArray),
+			start_sample_rate_Hz(settings.sample_rate_Hz),
+			max_in_block_len(settings.audio_block_samples) {}
+
+		enum MODE { MODE_RATIONAL=0, MODE_ARBITRARY=1 };
+
+		//Rational mode: output rate is (L/M) * input rate.  Returns true if successful.
+		//   cutoff_frac sets the anti-alias filter's corner as a fraction of the lower of the two Nyquist frequencies
+		bool beginRational(int L, int M, int taps_per_phase = RATECONV_DEFAULT_TAPS_PER_PHASE, float cutoff_frac = 0.90f);
+
+		//Arbitrary mode: output rate is ratio * input rate.  The filter is designed for the given nominal ratio, so
+		//you can adjust the ratio afterwards (via setRatio) by small amounts without needing to call begin again.
+		bool beginArbitrary(float ratio_out_over_in, int taps_per_phase = RATECONV_DEFAULT_TAPS_PER_PHASE, int n_phases = RATECONV_DEFAULT_N_PHASES_ARB, float cutoff_frac = 0.90f);
+		void end(void) { enable(false); is_armed = false; }
+
+		virtual void update(void);
+
+		//core processing: push input samples, converted samples accumulate in the output FIFO. Returns number of samples produced.
+		int processSamples(const float32_t *in, int n_in);
+		//pull converted samples out of the output FIFO.  Returns the number of samples actually read.
+		int readSamples(float32_t *out, int n_requested);
+		int getNumSamplesAvailable(void) { return fifo_count; }
+		void resetState(void);   //clears the filter history and output FIFO
+
+		bool enable(bool enable = true) {
+			if (enable && is_armed) { is_enabled = true; } else { is_enabled = false; }
+			return get_is_enabled();
+		}
+		bool get_is_enabled(void) { return is_enabled; }
+		int get_mode(void) { return mode; }
+
+		//Only for the arbitrary mode.  Change the conversion ratio on-the-fly (such as for tracking clock drift).
+		float setRatio(float ratio_out_over_in);
+		float getRatio(void) { return ratio; }
+
+		//0 (the default) means transmit however many samples are available at each update().  Otherwise, only
+		//transmit blocks of exactly this many samples (limited by the size of the audio blocks).
+		int setOutputBlockLength(int n) { return out_block_len = max(0, n); }
+		int getOutputBlockLength(void) { return out_block_len; }
+
+		float set_startSampleRate_Hz(float fs_Hz) { return start_sample_rate_Hz = fs_Hz; }
+		float get_startSampleRate_Hz(void) { return start_sample_rate_Hz; }
+		float get_endSampleRate_Hz(void) { return start_sample_rate_Hz * ratio; }
+
+		unsigned long getNumFifoOverruns(void) { return n_fifo_overruns; }  //samples dropped because the output FIFO was full
+
+	protected:
+		audio_block_f32_t *inputQueueArray[1];
+		float start_sample_rate_Hz = AUDIO_SAMPLE_RATE_EXACT;
+		int max_in_block_len = AUDIO_BLOCK_SAMPLES;
+
+		bool is_armed = false;   //have the filters been designed?
+		bool is_enabled = false; //do you want this to execute?
+		int mode = MODE_RATIONAL;
+		int out_block_len = 0;
+		unsigned long last_block_id = 0;
+
+		//the polyphase filter: n_phases branches, each with n_taps coefficients, stored time-reversed so that
+		//each branch can be applied with a single dot product against the history buffer
+		int n_taps = RATECONV_DEFAULT_TAPS_PER_PHASE;
+		int n_phases = 1;
+		std::vector<float32_t> coeff;    //[n_phases (+1 for arbitrary mode)][n_taps]
+		const float32_t *getPhaseCoeff(int Iphase) { return &(coeff[Iphase*n_taps]); }
+
+		//history of the input.  Each sample is written twice (Ind and Ind+n_taps) so that the last n_taps samples
+		//are always contiguous in memory, starting at hist[hist_ind]
+		std::vector<float32_t> hist;
+		int hist_ind = 0;
+		void pushHistory(float32_t val) { hist[hist_ind] = val; hist[hist_ind+n_taps] = val; if (++hist_ind >= n_taps) hist_ind = 0; }
+
+		//rational mode state
+		int L = 1, M = 1, phase = 0;
+
+		//arbitrary mode state
+		float ratio = 1.0f;     //output rate / input rate
+		float step = 1.0f;      //input samples per output sample (1/ratio)
+		float frac_pos = 0.0f;  //position of the next output sample relative to the newest input sample
+
+		//output FIFO
+		std::vector<float32_t> fifo;
+		int fifo_read_ind = 0, fifo_count = 0;
+		unsigned long n_fifo_overruns = 0;
+		void pushFifo(float32_t val);
+
+		bool allocateAndDesign(int _n_phases, int _n_taps, int n_coeff_sets, float cutoff_norm_at_input);
+		static float32_t besselI0(float32_t x);
+};
+
+#endif
@@ -0,0 +1,281 @@
+/*
+ * AudioRateHalfband_F32.cpp
+ *
+ * Created: OpenAudio, Oct 2026
+ *
+ * MIT License.  Use at your own risk.  Have fun!
+ *
+ */
+
+#include "AudioRateHalfband_F32.h"
+
+// ///////////////////////////////////////////////////////////////////////////////////////////
+//
+// HalfbandStage_F32
+//
+// A halfband filter of length 4K-1 has its center tap at c = 2K-1.  The center tap is 0.5 and
+// the only other non-zero taps are at odd offsets (+/-1, +/-3, ...) from the center.  So, there
+// are only K unique non-zero coefficients (not counting the center), which are stored in g[].
+//
+// ///////////////////////////////////////////////////////////////////////////////////////////
+
+static float32_t halfband_besselI0(float32_t x) {
+	float32_t sum = 1.0f, term = 1.0f, y = 0.25f*x*x;
+	for (int k = 1; k < 32; k++) {
+		term *= y / ((float32_t)(k*k));
+		sum += term;
+		if (term < 1.0e-9f*sum) break;
+	}
+	return sum;
+}
+
+int HalfbandStage_F32::design(float passband_Hz, float stopband_atten_dB, float high_sample_rate_Hz) {
+	//the transition band of a halfband filter is symmetric about fs/4
+	float trans_width = 0.5f - 2.0f*passband_Hz/high_sample_rate_Hz;  //(stop - pass) / fs
+	if ((trans_width <= 0.0f) || (passband_Hz <= 0.0f)) {
+		Serial.println("HalfbandStage_F32: design: *** ERROR *** passband (" + String(passband_Hz) + " Hz) must be below " + String(0.25f*high_sample_rate_Hz) + " Hz");
+		return -1;
+	}
+
+	//Kaiser's formulas for the filter length and window shape
+	float A = max(21.0f, stopband_atten_dB);
+	float beta;
+	if (A > 50.0f) {
+		beta = 0.1102f*(A - 8.7f);
+	} else {
+		beta = 0.5842f*powf(A - 21.0f, 0.4f) + 0.07886f*(A - 21.0f);
+	}
+	int N = (int)ceilf((A - 7.95f) / (14.36f*trans_width)) + 1;
+	K = max(1, (N + 1 + 3) / 4);  //round up to a length of the form 4K-1
+	N = 4*K - 1;
+
+	//compute the non-zero taps (odd offsets from center) of the windowed sinc
+	g.assign(K, 0.0f);
+	const float c = (float)(2*K - 1);
+	const float I0_beta = halfband_besselI0(beta);
+	float sum = 0.0f;
+	for (int k=1; k <= K; k++) {
+		float d = (float)(2*k - 1);   //offset from the center
+		float r = d / c;              //position within the window, from 0 to 1
+		float win = halfband_besselI0(beta*sqrtf(max(0.0f, 1.0f - r*r))) / I0_beta;
+		float x = 0.5f*M_PI*d;
+		g[k-1] = 0.5f * (sinf(x) / x) * win;
+		sum += g[k-1];
+	}
+
+	//normalize so that the DC gain is exactly one (the center tap of 0.5 plus both sides)
+	if (sum != 0.0f) for (int k=0; k < K; k++) g[k] *= 0.25f / sum;
+	return K;
+}
+
+int HalfbandStage_F32::allocateWorkBuffer(bool is_decimator, int max_input_len) {
+	n_hist = is_decimator ? (4*K - 2) : (2*K - 1);
+	work.assign(n_hist + max_input_len, 0.0f);
+	if (work.size() == 0) return -1;
+	return 0;
+}
+
+//y[m] = 0.5*x[2m-c] + sum_k g[k] * (x[2m-c-(2k-1)] + x[2m-c+(2k-1)])
+void HalfbandStage_F32::decimate(const float32_t *in, int n_in, float32_t *out) {
+	float32_t *w_all = work.data();
+	for (int i=0; i < n_in; i++) w_all[n_hist+i] = in[i];
+
+	const float32_t *gp = g.data();
+	const int c = 2*K - 1;
+	const int n_out = n_in / 2;
+	for (int m=0; m < n_out; m++) {
+		const float32_t *w = w_all + 2*m + c;  //points at the center tap
+		float32_t acc = 0.5f * w[0];
+		for (int k=0; k < K; k++) {
+			const int d = 2*k + 1;
+			acc += gp[k] * (w[-d] + w[d]);   //symmetric folding: one multiply per pair of taps
+		}
+		out[m] = acc;
+	}
+
+	//keep the end of this block as the history for next time
+	for (int i=0; i < n_hist; i++) w_all[i] = w_all[n_in+i];
+}
+
+//y[2m] = 2 * sum_k g[k] * (x[m-K+k] + x[m-K-k+1]) and y[2m+1] = x[m-K+1]
+void HalfbandStage_F32::interpolate(const float32_t *in, int n_in, float32_t *out) {
+	float32_t *w_all = work.data();
+	for (int i=0; i < n_in; i++) w_all[n_hist+i] = in[i];
+
+	const float32_t *gp = g.data();
+	for (int m=0; m < n_in; m++) {
+		const float32_t *w = w_all + m + K;   //w[0] is the sample that lines up with the center tap
+		float32_t acc = 0.0f;
+		for (int k=0; k < K; k++) acc += gp[k] * (w[k] + w[-k-1]);  //symmetric folding
+		out[2*m] = 2.0f*acc;  //times 2 to make up for the zero-stuffing
+		out[2*m+1] = w[0];    //the center tap (0.5) times 2
+	}
+
+	for (int i=0; i < n_hist; i++) w_all[i] = w_all[n_in+i];
+}
+
+// ///////////////////////////////////////////////////////////////////////////////////////////
+//
+// AudioRateDecimatorHalfband_F32
+//
+// ///////////////////////////////////////////////////////////////////////////////////////////
+
+static int halfband_numStages(int fac) {
+	switch (fac) {
+		case 2: return 1;
+		case 4: return 2;
+		case 8: return 3;
+	}
+	return -1;
+}
+
+bool AudioRateDecimatorHalfband_F32::begin(int _dec_fac, int block_size) {
+	is_armed = false; is_enabled = false;
+	n_stages = halfband_numStages(_dec_fac);
+	if ((n_stages < 1) || (n_stages > HALFBAND_MAX_STAGES)) {
+		Serial.println("AudioRateDecimatorHalfband_F32: begin: *** ERROR *** decimation factor must be 2, 4, or 8.  Given " + String(_dec_fac));
+		return false;
+	}
+	if ((block_size % _dec_fac) != 0) {
+		Serial.println("AudioRateDecimatorHalfband_F32: begin: *** ERROR *** block size (" + String(block_size) + ") must be divisible by " + String(_dec_fac));
+		return false;
+	}
+	dec_fac = _dec_fac;
+
+	float fs_Hz = start_sample_rate_Hz;
+	float pass_Hz = passband_Hz;
+	if (pass_Hz <= 0.0f) pass_Hz = 0.8f * 0.5f * (start_sample_rate_Hz / dec_fac);
+
+	//each stage is designed relative to its own (input) sample rate, but for the same final passband
+	int n_in = block_size;
+	for (int Istage = 0; Istage < n_stages; Istage++) {
+		if (stages[Istage].design(pass_Hz, stopband_atten_dB, fs_Hz) < 0) return false;
+		if (stages[Istage].allocateWorkBuffer(true, n_in) < 0) return false;
+		stages[Istage].resetState();
+		fs_Hz /= 2.0f;
+		n_in /= 2;
+	}
+	scratch.assign(block_size, 0.0f);
+	configured_block_size = block_size;
+
+	is_armed = true;
+	return enable(true);
+}
+
+void AudioRateDecimatorHalfband_F32::update(void) {
+	if (!is_enabled) return;
+
+	audio_block_f32_t *block = AudioStream_F32::receiveReadOnly_f32();
+	if (!block) return;
+
+	audio_block_f32_t *block_new = AudioStream_F32::allocate_f32();
+	if (block_new == NULL) { AudioStream_F32::release(block); return; } //failed to allocate
+
+	if (processAudioBlock(block, block_new) == 0) AudioStream_F32::transmit(block_new);
+	AudioStream_F32::release(block_new);
+	AudioStream_F32::release(block);
+}
+
+int AudioRateDecimatorHalfband_F32::processAudioBlock(audio_block_f32_t *block, audio_block_f32_t *block_new) {
+	if ((is_enabled == false) || (block==NULL) || (block_new==NULL)) return -1;
+
+	if (block->length != configured_block_size) {
+		Serial.println("AudioRateDecimatorHalfband_F32: block size (" + String(block->length) + ") doesn't match expectation (" + String(configured_block_size) + ").  Re-initializing Decimator.");
+		if (!begin(dec_fac, block->length)) return -1;
+	}
+
+	//run the cascade.  Intermediate results are written in-place into the scratch buffer, which is safe
+	//because each stage copies its input into its own work buffer before writing any output.
+	const float32_t *in = block->data;
+	int n = block->length;
+	for (int Istage = 0; Istage < n_stages; Istage++) {
+		float32_t *out = (Istage == n_stages-1) ? block_new->data : scratch.data();
+		stages[Istage].decimate(in, n, out);
+		in = out;
+		n /= 2;
+	}
+
+	block_new->length = n;
+	block_new->id = block->id;
+	block_new->fs_Hz = block->fs_Hz / dec_fac;
+	return 0;
+}
+
+// ///////////////////////////////////////////////////////////////////////////////////////////
+//
+// AudioRateInterpolatorHalfband_F32
+//
+// ///////////////////////////////////////////////////////////////////////////////////////////
+
+bool AudioRateInterpolatorHalfband_F32::begin(int _upsamp_fac, int block_size) {
+	is_armed = false; is_enabled = false;
+	n_stages = halfband_numStages(_upsamp_fac);
+	if ((n_stages < 1) || (n_stages > HALFBAND_MAX_STAGES) || (block_size < 1)) {
+		Serial.println("AudioRateInterpolatorHalfband_F32: begin: *** ERROR *** upsampling factor must be 2, 4, or 8.  Given " + String(_upsamp_fac));
+		return false;
+	}
+	upsamp_fac = _upsamp_fac;
+
+	float fs_Hz = start_sample_rate_Hz;
+	float pass_Hz = passband_Hz;
+	if (pass_Hz <= 0.0f) pass_Hz = 0.8f * 0.5f * start_sample_rate_Hz;
+
+	//each stage is designed relative to its own (output) sample rate, but for the same original passband
+	int n_in = block_size;
+	for (int Istage = 0; Istage < n_stages; Istage++) {
+		fs_Hz *= 2.0f;
+		if (stages[Istage].design(pass_Hz, stopband_atten_dB, fs_Hz) < 0) return false;
+		if (stages[Istage].allocateWorkBuffer(false, n_in) < 0) return false;
+		stages[Istage].resetState();
+		n_in *= 2;
+	}
+	scratch.assign(block_size * upsamp_fac, 0.0f);
+	configured_block_size = block_size;
+
+	is_armed = true;
+	return enable(true);
+}
+
+void AudioRateInterpolatorHalfband_F32::update(void) {
+	if (!is_enabled) return;
+
+	audio_block_f32_t *block = AudioStream_F32::receiveReadOnly_f32();
+	if (!block) return;
+
+	audio_block_f32_t *block_new = AudioStream_F32::allocate_f32();
+	if (block_new == NULL) { AudioStream_F32::release(block); return; } //failed to allocate
+
+	if (processAudioBlock(block, block_new) == 0) AudioStream_F32::transmit(block_new);
+	AudioStream_F32::release(block_new);
+	AudioStream_F32::release(block);
+}
+
+int AudioRateInterpolatorHalfband_F32::processAudioBlock(audio_block_f32_t *block, audio_block_f32_t *block_new) {
+	if ((is_enabled == false) || (block==NULL) || (block_new==NULL)) return -1;
+
+	if (block->length != configured_block_size) {
+		Serial.println("AudioRateInterpolatorHalfband_F32: block size (" + String(block->length) + ") doesn't match expectation (" + String(configured_block_size) + ").  Re-initializing Interpolator.");
+		if (!begin(upsamp_fac, block->length)) return -1;
+	}
+	if (block->length * upsamp_fac > block_new->full_length) {
+		Serial.println("AudioRateInterpolatorHalfband_F32: *** ERROR *** output (" + String(block->length * upsamp_fac) + " samples) does not fit in the audio block (" + String(block_new->full_length) + ")");
+		return -1;
+	}
+
+	//run the cascade, ping-ponging between the scratch buffer and the output block so that the final
+	//stage always writes into the output block
+	const float32_t *in = block->data;
+	int n = block->length;
+	for (int Istage = 0; Istage < n_stages; Istage++) {
+		bool to_output = (((n_stages - 1 - Istage) % 2) == 0);
+		float32_t *out = to_output ? block_new->data : scratch.data();
+		stages[Istage].interpolate(in, n, out);
+		in = out;
+		n *= 2;
+	}
+
+	block_new->length = n;
+	block_new->id = block->id;
+	block_new->fs_Hz = block->fs_Hz * upsamp_fac;
+	return 0;
+}
@@ -0,0 +1,151 @@
+/*
+ * AudioRateHalfband_F32
+ *
+ * Created: OpenAudio, Oct 2026
+ *
+ * Purpose: Decimate or interpolate by 2x, 4x, or 8x using a cascade of halfband FIR filters.  This
+ *     is much cheaper than AudioRateDecimator_F32 or AudioRateInterpolator_F32 with a generic FIR:
+ *
+ *     * Every other coefficient of a halfband filter is zero, so those taps are skipped entirely.
+ *     * It is polyphase, so no outputs are computed that would just be thrown away (decimation) and
+ *       no multiplies are wasted on zero-stuffed samples (interpolation).
+ *     * The filter is symmetric, so pairs of samples are added before multiplying (half the multiplies).
+ *     * Each stage of the cascade only needs to protect the final passband, so the early stages
+ *       (which run at the highest sample rate) have wide transition bands and are very short.
+ *
+ *     The filters are designed automatically (Kaiser-windowed) from a passband edge (Hz) and a
+ *     stopband attenuation (dB) that you specify via setPassband_Hz() and setStopbandAtten_dB()
+ *     before calling begin().
+ *
+ *     The audio block length must be divisible by the decimation factor.
+ *
+ * MIT License.  Use at your own risk.  Have fun!
+ *
+ */
+
+#ifndef _AudioRateHalfband_F32_h
+#define _AudioRateHalfband_F32_h
+
+#include <Arduino.h>
+#include "AudioStream_F32.h"
+#include "arm_math.h"
+#include <vector>
+
+#define HALFBAND_MAX_STAGES   3     //3 stages is 8x
+
+// One halfband filter stage.  Used by the decimator and interpolator classes below.
+class HalfbandStage_F32 {
+	public:
+		HalfbandStage_F32(void) {}
+
+		//design the filter.  Frequencies are relative to the higher of the two sample rates.
+		//Returns the number of non-zero, non-center coefficients (K), or -1 on error
+		int design(float passband_Hz, float stopband_atten_dB, float high_sample_rate_Hz);
+		int allocateWorkBuffer(bool is_decimator, int max_input_len);  //call after design()
+		void resetState(void) { for (int i=0; i < n_hist; i++) work[i] = 0.0f; }
+
+		void decimate(const float32_t *in, int n_in, float32_t *out);     //produces n_in/2 samples
+		void interpolate(const float32_t *in, int n_in, float32_t *out);  //produces n_in*2 samples
+
+		int getNumTaps(void) { return 4*K-1; }  //total length of the equivalent full FIR filter
+
+	protected:
+		int K = 0;                   //number of non-zero coefficients on each side of the center tap
+		std::vector<float32_t> g;    //the K non-zero coefficients on one side of the center (center tap is always 0.5)
+		std::vector<float32_t> work; //[history | new input]
+		int n_hist = 0;
+};
+
+class AudioRateDecimatorHalfband_F32 : public AudioStream_F32 {
+//GUI: inputs:1, outputs:1  //this line used for automatic generation of GUI node
+//GUI: shortName:decimate_halfband
+	public:
+		AudioRateDecimatorHalfband_F32(void) : AudioStream_F32(1,inputQueueArray) {}
+		AudioRateDecimatorHalfband_F32(const AudioSettings_F32 &settings): AudioStream_F32(1,inputQueueArray),
+			start_sample_rate_Hz(settings.sample_rate_Hz) {}
+
+		//set the filter specification.  Call these before begin().
+		float setPassband_Hz(float freq_Hz) { return passband_Hz = freq_Hz; }       //top of the passband.  Must be below the final Nyquist frequency
+		float setStopbandAtten_dB(float atten_dB) { return stopband_atten_dB = atten_dB; }
+		float getPassband_Hz(void) { return passband_Hz; }
+		float getStopbandAtten_dB(void) { return stopband_atten_dB; }
+
+		//dec_fac must be 2, 4, or 8.  If passband_Hz is not set, it defaults to 80% of the final Nyquist frequency
+		bool begin(int _dec_fac) { return begin(_dec_fac, AUDIO_BLOCK_SAMPLES); }
+		bool begin(int _dec_fac, int block_size);
+		void end(void) { enable(false); is_armed = false; }
+
+		virtual void update(void);
+		int processAudioBlock(audio_block_f32_t *block, audio_block_f32_t *block_new); //called by update(); returns zero if OK
+
+		bool enable(bool enable = true) { is_enabled = (enable && is_armed); return get_is_enabled(); }
+		bool get_is_enabled(void) { return is_enabled; }
+
+		float set_startSampleRate_Hz(float fs_Hz) { return start_sample_rate_Hz = fs_Hz; }
+		float get_startSampleRate_Hz(void) { return start_sample_rate_Hz; }
+		float get_endSampleRate_Hz(void) { return start_sample_rate_Hz / dec_fac; }
+		int get_n_stages(void) { return n_stages; }
+		int getNumTaps(int Istage) { if ((Istage < 0) || (Istage >= n_stages)) return 0; return stages[Istage].getNumTaps(); }
+
+	protected:
+		audio_block_f32_t *inputQueueArray[1];
+		float start_sample_rate_Hz = AUDIO_SAMPLE_RATE_EXACT;
+		float passband_Hz = -1.0f;          //negative means "use the default"
+		float stopband_atten_dB = 80.0f;
+
+		bool is_armed = false;
+		bool is_enabled = false;
+		int dec_fac = 1;
+		int n_stages = 0;
+		int configured_block_size = 0;
+		HalfbandStage_F32 stages[HALFBAND_MAX_STAGES];
+		std::vector<float32_t> scratch;  //holds the intermediate results between stages
+};
+
+class AudioRateInterpolatorHalfband_F32 : public AudioStream_F32 {
+//GUI: inputs:1, outputs:1  //this line used for automatic generation of GUI node
+//GUI: shortName:interpolate_halfband
+	public:
+		AudioRateInterpolatorHalfband_F32(void) : AudioStream_F32(1,inputQueueArray) {}
+		AudioRateInterpolatorHalfband_F32(const AudioSettings_F32 &settings): AudioStream_F32(1,inputQueueArray),
+			start_sample_rate_Hz(settings.sample_rate_Hz) {}
+
+		//set the filter specification.  Call these before begin().
+		float setPassband_Hz(float freq_Hz) { return passband_Hz = freq_Hz; }       //top of the passband.  Must be below the starting Nyquist frequency
+		float setStopbandAtten_dB(float atten_dB) { return stopband_atten_dB = atten_dB; }
+		float getPassband_Hz(void) { return passband_Hz; }
+		float getStopbandAtten_dB(void) { return stopband_atten_dB; }
+
+		//upsamp_fac must be 2, 4, or 8.  If passband_Hz is not set, it defaults to 80% of the starting Nyquist frequency
+		bool begin(int _upsamp_fac) { return begin(_upsamp_fac, AUDIO_BLOCK_SAMPLES / _upsamp_fac); }
+		bool begin(int _upsamp_fac, int block_size);  //block_size is the length of the incoming (low sample rate) blocks
+		void end(void) { enable(false); is_armed = false; }
+
+		virtual void update(void);
+		int processAudioBlock(audio_block_f32_t *block, audio_block_f32_t *block_new); //called by update(); returns zero if OK
+
+		bool enable(bool enable = true) { is_enabled = (enable && is_armed); return get_is_enabled(); }
+		bool get_is_enabled(void) { return is_enabled; }
+
+		float set_startSampleRate_Hz(float fs_Hz) { return start_sample_rate_Hz = fs_Hz; }
+		float get_startSampleRate_Hz(void) { return start_sample_rate_Hz; }
+		float get_endSampleRate_Hz(void) { return start_sample_rate_Hz * upsamp_fac; }
+		int get_n_stages(void) { return n_stages; }
+		int getNumTaps(int Istage) { if ((Istage < 0) || (Istage >= n_stages)) return 0; return stages[Istage].getNumTaps(); }
+
+	protected:
+		audio_block_f32_t *inputQueueArray[1];
+		float start_sample_rate_Hz = AUDIO_SAMPLE_RATE_EXACT;
+		float passband_Hz = -1.0f;          //negative means "use the default"
+		float stopband_atten_dB = 80.0f;
+
+		bool is_armed = false;
+		bool is_enabled = false;
+		int upsamp_fac = 1;
+		int n_stages = 0;
+		int configured_block_size = 0;
+		HalfbandStage_F32 stages[HALFBAND_MAX_STAGES];
+		std::vector<float32_t> scratch;  //holds the intermediate results between stages
+};
+
+#endif
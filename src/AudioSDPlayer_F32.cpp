@@ -49,12 +49,13 @@
 #define STATE_CONVERT_8BIT_STEREO 5  // playing stereo, converting sample rate
 #define STATE_CONVERT_16BIT_MONO  6  // playing mono, converting sample rate
 #define STATE_CONVERT_16BIT_STEREO  7  // playing stereo, converting sample rate
-#define STATE_PARSE1      8  // looking for 20 byte ID header
-#define STATE_PARSE2      9  // looking for 16 byte format header
-#define STATE_PARSE3      10 // looking for 8 byte data header
-#define STATE_PARSE4      11 // ignoring unknown chunk after "fmt "
-#define STATE_PARSE5      12 // ignoring unknown chunk before "fmt "
-#define STATE_STOP      13
+#define STATE_DIRECT_PCM  8  // playing any supported format and number of channels at native sample rate
+#define STATE_PARSE1      9  // looking for 20 byte ID header
+#define STATE_PARSE2      10 // looking for 16 byte format header
+#define STATE_PARSE3      11 // looking for 8 byte data header
+#define STATE_PARSE4      12 // ignoring unknown chunk after "fmt "
+#define STATE_PARSE5      13 // ignoring unknown chunk before "fmt "
+#define STATE_STOP      14
 #define STATE_NOT_BEGUN  99
 
 #define READ_STATE_NORMAL  1
@@ -113,9 +114,16 @@ bool AudioSDPlayer_F32::open(const char *filename, const bool flag_preload_buffe
 	active = false;  //from AudioStream.h.  Setting to false to prevent update() from being called.  Only for open().
 
   __disable_irq();
+  if (file.isOpen()) file.close();
   file.open(filename,O_READ);   //open for reading
   __enable_irq();
   if (!isFileOpen()) return false;
+
+  //any files from the playlist that were already pre-buffered go back onto the playlist, to follow this file
+  requeueBufferedFiles();
+  Segment_t &seg = segments[seg_play % AUDIOSDPLAYER_MAX_SEGMENTS];
+  strncpy(seg.filename, filename, AUDIOSDPLAYER_MAX_FILENAME-1);  //kept for seeking, which might need to re-open the file
+  seg.filename[AUDIOSDPLAYER_MAX_FILENAME-1] = 0;
   
   //buffer_length = 0;
   state_play = STATE_STOP;
@@ -127,7 +135,22 @@ bool AudioSDPlayer_F32::open(const char *filename, const bool flag_preload_buffe
   buffer_read = 0;
   buffer_write = 0;
   state_read = READ_STATE_NORMAL;
+  read_remaining = 0xFFFFFFFF;  //no limit until the header has been parsed
   readHeader();
+
+	//from here on, read only the audio into the buffer, so that the audio of any queued files can follow straight on.  The
+	//first read (which started at the start of the buffer) might already have gone past the end of the audio.
+	if (state < STATE_PARSE1) {
+		const uint32_t audio_end = data_offset + total_length;
+		const uint32_t n_read = file.curPosition();
+		if (n_read >= audio_end) {
+			buffer_write -= (n_read - audio_end);
+			read_remaining = 0;
+		} else {
+			read_remaining = audio_end - n_read;
+		}
+		if ((read_remaining == 0) || (state_read == READ_STATE_FILE_EMPTY)) finishReadingFile();
+	}
 	
 	//pre-fill the buffer?
 	if (flag_preload_buffer) fillBufferFromSD();
@@ -148,9 +171,16 @@ bool AudioSDPlayer_F32::play(const char *filename)
 
 //Play an already-opened file
 bool AudioSDPlayer_F32::play(void) {
-	if (isFileOpen()) {
+	if (isFileOpen() && (state != STATE_STOP)) {
 		Serial.println("AudioSDPlayer_F32: file was already open.  Starting playing");
 		active = true;  //in AudioStream.h.  Activates this instance so that update() gets called
+	} else if (n_playlist > 0) {
+		//no file is open, so start on the playlist
+		char filename[AUDIOSDPLAYER_MAX_FILENAME];
+		strcpy(filename, playlist[playlist_head]);
+		playlist_head = (playlist_head + 1) % AUDIOSDPLAYER_MAX_PLAYLIST;
+		n_playlist = n_playlist - 1;
+		return play(filename);
 	} else {
 		Serial.println("AudiOSDPlayer_F32: play: cannot play file because no file has been opened.");
 		active = false;
@@ -188,51 +218,56 @@ void AudioSDPlayer_F32::update(void) {
 	// only update if we're playing
 	if ((state == STATE_STOP) || (state == STATE_NOT_BEGUN)) return;
 
-	// allocate the audio blocks to transmit...and return early if none can be allocated
-	audio_block_f32_t *block_left_f32 = AudioStream_F32::allocate_f32();
-	if (block_left_f32 == NULL) return;
-	audio_block_f32_t *block_right_f32 = AudioStream_F32::allocate_f32();
-	if (block_right_f32 == NULL) {
-		AudioStream_F32::release(block_left_f32);
-		return;
+	// allocate the audio blocks to transmit (at least two, so that mono plays on both outputs)...and return early if they cannot all be allocated.
+	// The next file in the playlist might start during this block, so allow for its channels, too.
+	int n_chan = channels;
+	if (seg_read != seg_play) n_chan = max(n_chan, (int)segments[(uint8_t)(seg_play + 1) % AUDIOSDPLAYER_MAX_SEGMENTS].channels);
+	const int n_out = max(2, min(n_chan, AUDIOSDPLAYER_MAX_CHAN));
+	audio_block_f32_t *blocks_f32[AUDIOSDPLAYER_MAX_CHAN];
+	float32_t *out_f32[AUDIOSDPLAYER_MAX_CHAN];
+	for (int Ichan = 0; Ichan < n_out; Ichan++) {
+		blocks_f32[Ichan] = AudioStream_F32::allocate_f32();
+		if (blocks_f32[Ichan] == NULL) {
+			for (int J = 0; J < Ichan; J++) AudioStream_F32::release(blocks_f32[J]);
+			return;
+		}
+		out_f32[Ichan] = blocks_f32[Ichan]->data;
 	}
 
 	//fill the audio blocks from the buffered audio
-	const int n_filled = readFromBuffer(block_left_f32->data, block_right_f32->data, audio_block_samples);
+	const int n_filled = readFromBuffer(out_f32, audio_block_samples);
 
-	//fill any unfilled samples in he audio blocks with zeros
-	if (n_filled < audio_block_samples) {
-		for (int i = n_filled; i < audio_block_samples; i++) {
-			block_left_f32->data[i] = 0.0f;
-			block_right_f32->data[i] = 0.0f;
+	//fill any unfilled samples in he audio blocks with zeros (and send mono to both outputs)
+	for (int Ichan = 0; Ichan < n_out; Ichan++) {
+		int i = n_filled;
+		if (Ichan >= channels) {
+			if (channels == 1) { for (int j = 0; j < n_filled; j++) out_f32[Ichan][j] = out_f32[0][j]; } else { i = 0; }
 		}
+		for ( ; i < audio_block_samples; i++) out_f32[Ichan][i] = 0.0f;
 	}
   
-	//final updates to the audio data blocks
+	//final updates to the audio data blocks, then transmit and release
 	update_counter++;
-	block_left_f32->id = update_counter; //prepare to transmit by setting the update_counter (which helps tell if data is skipped or out-of-order)
-	block_right_f32->id = update_counter; //prepare to transmit by setting the update_counter (which helps tell if data is skipped or out-of-order)
-	block_left_f32->length = audio_block_samples; 
-	block_right_f32->length = audio_block_samples; 
-
-	//transmit and release
-	AudioStream_F32::transmit(block_left_f32, 0);   //send out as channel 0 (ie, left) of this audio class
-	AudioStream_F32::release(block_left_f32);
-	AudioStream_F32::transmit(block_right_f32, 1);  //send out as channel 1 (ie, right) of this audio class  
-	AudioStream_F32::release(block_right_f32);
-
-	//check to see if we're completely out of data
-	if ((data_length == 0) || ((state_read == READ_STATE_FILE_EMPTY) && (n_filled == 0)) ) {
+	for (int Ichan = 0; Ichan < n_out; Ichan++) {
+		blocks_f32[Ichan]->id = update_counter; //prepare to transmit by setting the update_counter (which helps tell if data is skipped or out-of-order)
+		blocks_f32[Ichan]->length = audio_block_samples; 
+		AudioStream_F32::transmit(blocks_f32[Ichan], Ichan);   //send out as channel Ichan of this audio class
+		AudioStream_F32::release(blocks_f32[Ichan]);
+	}
+
+	//check to see if we're completely out of data (including the files still to come from the playlist)
+	const bool more_files = (seg_read != seg_play) || (n_playlist > 0);
+	if ((!more_files) && ((data_length == 0) || ((state_read == READ_STATE_FILE_EMPTY) && (n_filled == 0))) ) {
 	  state = STATE_STOP;
 	}
 }
 
-uint32_t AudioSDPlayer_F32::readFromBuffer(float32_t *left_f32, float32_t *right_f32, int n_samps) {
+uint32_t AudioSDPlayer_F32::readFromBuffer(float32_t *out_f32[], int n_samps) {
 	//loop through the buffer and copy samples to the output arrays
 	uint32_t n_samples_read = 0;
 	switch (state_play) {
-		case STATE_DIRECT_16BIT_MONO: case STATE_DIRECT_16BIT_STEREO:
-			n_samples_read = readBuffer_16bit_to_f32(left_f32, right_f32, n_samps, channels); 		
+		case STATE_DIRECT_PCM:
+			n_samples_read = readBuffer_to_f32(out_f32, n_samps); 		
 			break;
 		default:
 			//file format not accounted for...so just do nothing and (later) code will auto-fill with zeros
@@ -282,67 +317,115 @@ uint32_t AudioSDPlayer_F32::readRawBytes(uint8_t *out_buffer, const uint32_t n_b
 	//return the number of bytes of real data
 	return n_bytes_filled;
 }
-uint32_t AudioSDPlayer_F32::readBuffer_16bit_to_f32(float32_t *left_f32, float32_t *right_f32, uint16_t n_samps_wanted, uint16_t n_chan) {
-	uint32_t n_samples_read = 0;
-	const uint32_t bytes_perSamp_allChans = 2 * (uint32_t)n_chan; //mono will need 2 bytes (16 bits) per sample and stereo will need 2*2 bytes (32 bits) per sample
-	const uint32_t bytes_desired = bytes_perSamp_allChans*n_samps_wanted;
-	uint8_t lsb, msb;
-	int16_t val_int16;
-	float32_t val_f32;
+//Fill the float32 outputs (one array per channel) from the circular buffer.  When the current file's audio runs out, carry
+//straight on with the next file from the playlist, whose audio is already in the buffer right behind it.  Returns the
+//number of samples (per channel) that were filled.
+uint32_t AudioSDPlayer_F32::readBuffer_to_f32(float32_t *out_f32[], const uint32_t n_samps_wanted) {
+	uint32_t n_filled = readSegment_to_f32(out_f32, 0, n_samps_wanted);
+	while ((n_filled < n_samps_wanted) && (data_length == 0) && (seg_read != seg_play)) {
+		const Segment_t &next = segments[(uint8_t)(seg_play + 1) % AUDIOSDPLAYER_MAX_SEGMENTS];
+		if ((n_filled > 0) && (next.channels != channels)) break;  //a different number of channels has to start a new block
+		seg_play = seg_play + 1;
+		startSegment(next);
+		n_filled += readSegment_to_f32(out_f32, n_filled, n_samps_wanted - n_filled);
+	}
+	return n_filled;
+}
+
+//Switch to playing the given file's audio
+void AudioSDPlayer_F32::startSegment(const Segment_t &seg) {
+	channels = seg.channels;
+	bits = seg.bits;
+	is_float = seg.is_float;
+	state_play = seg.state_play;
+	data_offset = seg.data_offset;
+	total_length = seg.total_length;
+	data_length = seg.total_length;
+	updateBytes2Millis();
+}
+
+//Convert whole sample frames of the current file from the circular buffer into the float32 outputs, starting at out_offset.
+//The frames that are contiguous in the buffer are converted in bulk, straight from the buffer; only a frame that straddles
+//the end of the buffer is gathered first.  Returns the number of samples (per channel) that were filled.
+uint32_t AudioSDPlayer_F32::readSegment_to_f32(float32_t *out_f32[], const uint32_t out_offset, const uint32_t n_samps_wanted) {
+	const uint32_t frame_bytes = (uint32_t)channels * (uint32_t)(bits/8);  //bytes for one sample of all channels
+	const uint32_t bytes_desired = frame_bytes * n_samps_wanted;
 	static unsigned long last_warning_millis = 0;
 
-	
-	//check to see if we have enough data in the main buffer.  If not, try to load one read-block of data
-	if ((state_read == READ_STATE_NORMAL) && ( (getNumBuffBytes() < bytes_desired) || (data_length < bytes_desired))) {
-		if (0) {  //do we allow ourselves to read from the SD during this high-speed update()-driven interrupt?
-			Serial.println("AudioSDPlayer_F32 :readBuffer_16bit_to_f32: reading from SD in the high-speed loop.  Danger!");
-			readFromSDtoBuffer(MIN_READ_SIZE_BYTES);
-		} else {
-			//just issue a warning
-			if ((bytes_desired > getNumBuffBytes()) && (bytes_desired < data_length)) {
-				if ((millis() < last_warning_millis) || (millis() > last_warning_millis+50)) { //limit to a warning every 50 msec
-					Serial.println("AudioSDPlayer_F32: readBuffer_16bit_to_f32: insufficient data in RAM buffer.");
-					last_warning_millis = millis();
-				}
-			}
+	//how many whole frames can we use?  Only use the *allowed* WAV data (there can be non-audio data at the end of a WAV file)
+	const uint32_t bytes_in_buffer = getNumBuffBytes();
+	const uint32_t n_frames = min(n_samps_wanted, min(bytes_in_buffer, data_length) / frame_bytes);
+	if ((bytes_desired > bytes_in_buffer) && (bytes_desired < data_length)) {
+		//we do not read the SD here in the high-speed update()-driven interrupt.  Just issue a warning.
+		if ((millis() < last_warning_millis) || (millis() > last_warning_millis+50)) { //limit to a warning every 50 msec
+			Serial.println("AudioSDPlayer_F32: readBuffer_to_f32: insufficient data in RAM buffer.");
+			last_warning_millis = millis();
 		}
 	}
-		
-	//loop through all desired samples, filing as many samples as possible, until we've hit our
-	//target number of samples are until there aren't any samples left
-	while ( (n_samples_read < n_samps_wanted) && (getNumBuffBytes() >= bytes_perSamp_allChans) ) { //do we have enough 
-		if (data_length >= bytes_perSamp_allChans) { //do we have enough bytes of *allowed* WAV data
-			for (int Ichan=0; Ichan < n_chan; Ichan++) {		
-				//get the lsb and msb, assuming they form a 16-bit value
-				lsb = buffer[buffer_read++]; if (buffer_read >= N_BUFFER) buffer_read=0;  //wrap around, if needed
-				msb = buffer[buffer_read++]; if (buffer_read >= N_BUFFER) buffer_read=0;  //wrap around, if needed
-
-				//keep track of using up the allowed audio data within the WAV file (there can be extraneous 
-				//non-audio data at the end of a WAV file).  We just used two bytes.
-				data_length -= 2;  
-				
-				//form the 16-bit value and convert to float
-				val_int16 = (msb << 8) | lsb;
-				val_f32 = ((float32_t)val_int16) / 32767.0;
-				
-				//push the value into the left or right output
-				if (Ichan==0) {
-					left_f32[n_samples_read]=val_f32;
-				} else {
-					right_f32[n_samples_read]=val_f32;
-				}
-			} //end loop over channels
-			n_samples_read++; //acknowledge that we just filled a sample slot (filling both left+right counts as 1 sample)
-			
+
+	uint32_t n_done = 0, read_ind = buffer_read;
+	while (n_done < n_frames) {
+		const uint32_t n_contiguous = min(n_frames - n_done, (N_BUFFER - read_ind) / frame_bytes);
+		if (n_contiguous > 0) {
+			convertToF32(buffer + read_ind, n_contiguous, out_f32, out_offset + n_done);
+			read_ind += n_contiguous * frame_bytes;
+			n_done += n_contiguous;
 		} else {
-			//we've used up all the allowed data that we've read.
-			//discard any fractional bytes remaining, just to be clear that we're done.
-			data_length = 0;
-			buffer_read = buffer_write;
+			//this frame wraps around the end of the buffer, so gather it first
+			uint8_t frame[AUDIOSDPLAYER_MAX_CHAN*4];
+			for (uint32_t i = 0; i < frame_bytes; i++) { frame[i] = buffer[read_ind++]; if (read_ind >= N_BUFFER) read_ind = 0; }
+			convertToF32(frame, 1, out_f32, out_offset + n_done);
+			n_done++;
+		}
+		if (read_ind >= N_BUFFER) read_ind = 0;  //wrap around, if needed
+	}
+	buffer_read = read_ind;
+	data_length -= n_frames * frame_bytes;
+
+	if ((data_length > 0) && (data_length < frame_bytes) && (getNumBuffBytes() >= data_length)) {
+		//we've used up all the whole frames.  Discard any fractional frame remaining (but not the next file's audio behind it).
+		buffer_read = (buffer_read + data_length) % N_BUFFER;
+		data_length = 0;
+	}
+	return n_frames;
+}
+
+//Convert interleaved WAV samples (n_frames of them, for all channels) into one float32 array per channel, scaled to -1.0 to +1.0.
+//This is blocked, like BufferedSDWriter::interleaveToBuffer(): for a chunk of frames at a time, each channel's integer samples
+//are gathered into an aligned array as left-justified q31 values, which CMSIS then converts in bulk (arm_q31_to_float()).  For
+//16 and 24 bits, arm_scale_f32() then makes full scale 2^15-1 or 2^23-1, the same scaling as AudioSDWriter_F32.
+void AudioSDPlayer_F32::convertToF32(const uint8_t *src, const uint32_t n_frames, float32_t *out_f32[], const uint32_t out_offset) {
+	const uint32_t CHUNK = 32;
+	q31_t q31[CHUNK] __attribute__ ((aligned (8)));
+	const uint32_t bytes = bits/8, frame_bytes = channels * bytes;
+	const float32_t scale = (bits == 16) ? (32768.0f/32767.0f) : ((bits == 24) ? (8388608.0f/8388607.0f) : 1.0f);
+	for (uint32_t Isamp = 0; Isamp < n_frames; Isamp += CHUNK) {
+		const uint32_t n = min(CHUNK, n_frames - Isamp);
+		for (int Ichan = 0; Ichan < channels; Ichan++) {
+			const uint8_t *p = src + Isamp * frame_bytes + Ichan * bytes;
+			float32_t *out = out_f32[Ichan] + out_offset + Isamp;
+			if (is_float) {  //already float32
+				for (uint32_t i = 0; i < n; i++) { memcpy(out + i, p, 4); p += frame_bytes; }
+				continue;
+			}
+			switch (bits) {
+				case 8: //unsigned, offset by 128
+					for (uint32_t i = 0; i < n; i++) { q31[i] = (q31_t)((uint32_t)(p[0] ^ 0x80) << 24); p += frame_bytes; }
+					break;
+				case 16:
+					for (uint32_t i = 0; i < n; i++) { q31[i] = (q31_t)(((uint32_t)p[0] << 16) | ((uint32_t)p[1] << 24)); p += frame_bytes; }
+					break;
+				case 24:
+					for (uint32_t i = 0; i < n; i++) { q31[i] = (q31_t)(((uint32_t)p[0] << 8) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 24)); p += frame_bytes; }
+					break;
+				default: //32-bit integer
+					for (uint32_t i = 0; i < n; i++) { memcpy(q31 + i, p, 4); p += frame_bytes; }
+					break;
+			}
+			arm_q31_to_float(q31, out, n);
+			if (scale != 1.0f) arm_scale_f32(out, scale, out, n);
 		}
 	}
-	
-	return n_samples_read;
 }
 
 //how many valid (waiting-to-be-used) bytes are already in the circular buffer
@@ -363,38 +446,40 @@ int AudioSDPlayer_F32::serviceSD(void) {
 	//return readFromSDtoBuffer(MAX_READ_SIZE_BYTES);
 }
 
-// Fill the circular buffer from the SD (should leave one block empty, however)
+// Fill the circular buffer from the SD (should leave one block empty, however).  This is the read-ahead scheduler.
+// Rather than topping up the buffer with many small reads, it waits until there is room for one large read
+// (read_size_bytes), unless the buffer holds less than urgent_read_msec of audio, when it reads whatever fits.
 int AudioSDPlayer_F32::fillBufferFromSD(void) {
 	//This function should be called from the Arduino loop() function.
 	//This function loads data from the SD card into a RAM buffer, as
 	//long as there's room in the buffer to do the read
 
-	//should we be reading?  If not, return.
-	if (state == STATE_STOP) return 0;
+	//should we be reading?  If not, return (and, if the playing has finished, let go of the file).
+	if (state == STATE_STOP) {
+		if (isFileOpen()) file.close();
+		return 0;
+	}
 
-	//keep reading until the buffer is full (or an error occurs)
+	//keep reading until the buffer is full enough (or an error occurs)
 	int error_code = 0; //assume no error at first
-	uint32_t actual_space_in_buffer = N_BUFFER - getNumBuffBytes();  //how much space is in the circular buffer
 	const uint32_t min_required_space_in_buffer_after_reads =  1;    //don't allow ourself to completely fill the buffer...we cannot have read and write pointers land together
-	uint32_t space_to_fill_in_buffer = actual_space_in_buffer - min_required_space_in_buffer_after_reads;
-
-	//if ((state_read != READ_STATE_FILE_EMPTY) && (file.available()) && (space_to_fill_in_buffer >= MIN_READ_SIZE_BYTES)) {
-	//	Serial.println("AudioSDPlayer_F32: fillBufferFromSD: space_to_fill_in_buffer = " + String(space_to_fill_in_buffer));
-	//}
-	
-	while ((error_code == 0) && (space_to_fill_in_buffer > MIN_READ_SIZE_BYTES)) { //only continue of there is space
-		//set the read size to the maximum allowed
-		uint16_t n_bytes_to_read = MAX_READ_SIZE_BYTES;
-		
-		//if this read size is larger than the space available, reduce read size to fit
-		while ((n_bytes_to_read > space_to_fill_in_buffer) && (n_bytes_to_read > MIN_READ_SIZE_BYTES)) n_bytes_to_read -= MIN_READ_SIZE_BYTES;
+	while (error_code == 0) {
+		//once this file has all been read, carry on with the next file from the playlist (if any)
+		if ((state_read == READ_STATE_FILE_EMPTY) && (!openNextInPlaylist())) { error_code = -1; break; }
+
+		const uint32_t bytes_before = getNumBuffBytes();
+		const uint32_t space_to_fill_in_buffer = N_BUFFER - bytes_before - min_required_space_in_buffer_after_reads;
+		uint32_t n_bytes_to_read = 0;
+		if (space_to_fill_in_buffer >= read_size_bytes) {
+			n_bytes_to_read = read_size_bytes;           //room for a full-size read
+		} else if (getNumBytesInBuffer_msec() < urgent_read_msec) {
+			n_bytes_to_read = space_to_fill_in_buffer;  //running low, so read whatever fits
+		}
+		if (n_bytes_to_read < MIN_READ_SIZE_BYTES) break;
 
 		//read the bytes from the SD into the circular buffer
 		error_code = readFromSDtoBuffer(n_bytes_to_read);
-		
-		//update our assessment of the fullness of the circular buffer...which prepares us to loop around for the test in the "while"
-		actual_space_in_buffer = N_BUFFER - getNumBuffBytes();
-		space_to_fill_in_buffer = actual_space_in_buffer - min_required_space_in_buffer_after_reads;
+		if (getNumBuffBytes() == bytes_before) break;  //nothing more could be read
 	}
 
 	return error_code;
@@ -424,12 +509,11 @@ int AudioSDPlayer_F32::fillBufferFromSD(void) {
 } */
 
 
-//Read bytes from the SD directly to the circular buffer.
-//Currently, I've limited it to only reading 2^16 (ie, 64K) bytes so that I can
-//return negative values as error codes.  This is a dumb reason, but it's what I did.
-int AudioSDPlayer_F32::readFromSDtoBuffer(const uint16_t n_bytes_requested) {
+//Read bytes from the SD directly to the circular buffer, stopping at the end of the file's audio data.  Each read
+//is trimmed to end on a sector boundary of the file so that the following read starts sector-aligned.
+int AudioSDPlayer_F32::readFromSDtoBuffer(const uint32_t n_bytes_requested) {
 	if (state_read == READ_STATE_FILE_EMPTY) return -1;
-	if (file.available() == false) return -1;
+	if ((read_remaining == 0) || (file.available() == false)) { finishReadingFile(); return -1; }
 	if (n_bytes_requested == 0) return 0;
 	
 	//initialize
@@ -445,20 +529,17 @@ int AudioSDPlayer_F32::readFromSDtoBuffer(const uint16_t n_bytes_requested) {
 		if (allowed_space_in_circular_buffer == 0) return 0; //not enough space!
 	}
 	
-	//choose how many bytes to actually read
-	uint16_t bytes_remaining = min(n_bytes_requested,allowed_space_in_circular_buffer); //here at the start, we have to read all the bytes
+	//choose how many bytes to actually read, ending on a sector boundary
+	uint32_t bytes_remaining = min(min(n_bytes_requested,allowed_space_in_circular_buffer), read_remaining);
 	if (bytes_remaining > MIN_READ_SIZE_BYTES) {
-		//make multiple of MIN_READ_SIZE_BYTES
-		uint16_t new_bytes_remaining = MIN_READ_SIZE_BYTES; //this should 
-		while ((new_bytes_remaining < bytes_remaining) && (new_bytes_remaining <= (65535-MIN_READ_SIZE_BYTES-1))) new_bytes_remaining += MIN_READ_SIZE_BYTES;
-		if (new_bytes_remaining > bytes_remaining) new_bytes_remaining -= MIN_READ_SIZE_BYTES;
-		bytes_remaining = new_bytes_remaining;
-	}		
+		const uint32_t n_past_boundary = (uint32_t)((file.curPosition() + bytes_remaining) % MIN_READ_SIZE_BYTES);
+		if (n_past_boundary < bytes_remaining) bytes_remaining -= n_past_boundary;
+	}
 			
-	//loop until all the data is read (or the file runs out)
+	//loop until all the data is read (or the file runs out).  At most two reads: to the end of the buffer and then from its start.
 	while ((bytes_remaining > 0) && (file_has_data)) { 
 		//how much to read
-		uint16_t n_bytes_to_read = min(MAX_READ_SIZE_BYTES,bytes_remaining);
+		uint32_t n_bytes_to_read = bytes_remaining;
 		if (buffer_write >= buffer_read) {
 			//we can read to the end of the circular buffer, if we want
 			uint32_t n_bytes_to_end_of_buffer = N_BUFFER - buffer_write;
@@ -469,20 +550,21 @@ int AudioSDPlayer_F32::readFromSDtoBuffer(const uint16_t n_bytes_requested) {
 			n_bytes_to_read = min(n_bytes_to_read,n_bytes_to_read_pointer);
 		}
 			
-		//read the bytes from the SD into a temporary linear buffer
+		//read the bytes from the SD straight into the circular buffer
 		uint8_t *start_ptr = buffer + buffer_write;
     unsigned long dT_millis = millis();  //for timing diagnotstics
-		int16_t bytes_read = file.read(start_ptr, n_bytes_to_read);
+		int32_t bytes_read = file.read(start_ptr, n_bytes_to_read);
     dT_millis = millis() - dT_millis;  //timing calculation
+		if (bytes_read < 0) bytes_read = 0;  //read error
 		buffer_write += bytes_read; if (buffer_write >= N_BUFFER) buffer_write = 0; //wrap around as needed
-		if (bytes_read != n_bytes_to_read) file_has_data = false;
+		if ((uint32_t)bytes_read != n_bytes_to_read) file_has_data = false;
 			
 			
 		//if slow, issue warning
 		const bool criteria1 = (dT_millis > 150);
 		const uint32_t bytes_filled = getNumBuffBytes();
 		const uint32_t buffer_len = getBufferLengthBytes();
-		const float bytes_per_second = channels * sample_rate_Hz * bits/8;  //2 bytes per sample for int16 data in the WAV
+		const float bytes_per_second = channels * sample_rate_Hz * bits/8;  //bytes per second for the data in the WAV
 		const float remaining_time_sec = ((float)bytes_filled) / bytes_per_second;
   	const float buffer_fill_frac = ((float)bytes_filled)/((float)buffer_len);
 		//bool criteria2 = (dT_millis > 20) && (buffer_fill_frac < 0.3f);
@@ -501,15 +583,140 @@ int AudioSDPlayer_F32::readFromSDtoBuffer(const uint16_t n_bytes_requested) {
 			
 		//prepare for next loop
 		bytes_remaining -= bytes_read;
+		read_remaining -= bytes_read;
 	}
 	
-	//did the file run out of data?
-	if (file_has_data == false) {
+	//did the file (or its audio data) run out?
+	if ((file_has_data == false) || (read_remaining == 0)) finishReadingFile();
+	
+	return 0;  //normal return
+}
+
+//All of the file's audio has been read.  If the file ran out early (such as from a read error), shorten the file's
+//audio to what actually got into the buffer, so that update() doesn't run on into the next file's audio.
+void AudioSDPlayer_F32::finishReadingFile(void) {
+	state_read = READ_STATE_FILE_EMPTY;
+	if ((read_remaining == 0) || (state >= STATE_PARSE1)) return;  //nothing missing, or the header is still being parsed
+
+	__disable_irq();
+	segments[seg_read % AUDIOSDPLAYER_MAX_SEGMENTS].total_length -= read_remaining;
+	if (seg_read == seg_play) {
+		total_length -= read_remaining;
+		data_length -= min(data_length, read_remaining);
+	}
+	__enable_irq();
+	read_remaining = 0;
+}
+
+//Open the next file from the playlist and point the SD reading at its audio, so that its audio goes into the buffer
+//right behind the audio of the file before it.  Files that cannot be played are skipped.  Returns false if there is
+//no file to open (or no room to keep track of another one yet).  The file is parsed into a local Segment_t, which is
+//copied into the ring together with advancing seg_read, so that update() never sees a partly-written segment.
+bool AudioSDPlayer_F32::openNextInPlaylist(void) {
+	while ((n_playlist > 0) && ((uint8_t)(seg_read - seg_play) < (AUDIOSDPLAYER_MAX_SEGMENTS-1))) {
+		Segment_t seg;
+		strcpy(seg.filename, playlist[playlist_head]);
+
+		__disable_irq();
 		file.close();
+		file.open(seg.filename,O_READ);   //open for reading
+		__enable_irq();
+		const bool is_ok = isFileOpen() && findAudioInFile(seg) && (seg.state_play == STATE_DIRECT_PCM) && file.seekSet(seg.data_offset);
+		if (!is_ok) Serial.println("AudioSDPlayer_F32: openNextInPlaylist: cannot play " + String(seg.filename) + ".  Skipping it.");
+
+		//take it off the playlist and, if it is OK, hand it to update() (together, so that update() never sees no more files)
+		__disable_irq();
+		playlist_head = (playlist_head + 1) % AUDIOSDPLAYER_MAX_PLAYLIST;
+		n_playlist = n_playlist - 1;
+		if (is_ok) {
+			segments[(uint8_t)(seg_read + 1) % AUDIOSDPLAYER_MAX_SEGMENTS] = seg;
+			seg_read = seg_read + 1;
+		}
+		__enable_irq();
+
+		if (is_ok) {
+			read_remaining = seg.total_length;
+			state_read = READ_STATE_NORMAL;
+			if (read_remaining == 0) finishReadingFile();
+			return true;
+		}
+	}
+	return false;
+}
+
+//Put any files whose audio is already in the buffer (behind the current file) back at the front of the playlist
+void AudioSDPlayer_F32::requeueBufferedFiles(void) {
+	__disable_irq();
+	while (seg_read != seg_play) {
+		playlist_head = (playlist_head + AUDIOSDPLAYER_MAX_PLAYLIST - 1) % AUDIOSDPLAYER_MAX_PLAYLIST;
+		strcpy(playlist[playlist_head], segments[seg_read % AUDIOSDPLAYER_MAX_SEGMENTS].filename);
+		n_playlist = n_playlist + 1;
+		seg_read = seg_read - 1;
+	}
+	__enable_irq();
+}
+
+bool AudioSDPlayer_F32::queue(const char *filename) {
+	if (strlen(filename) >= AUDIOSDPLAYER_MAX_FILENAME) {
+		Serial.println("AudioSDPlayer_F32: queue: *** ERROR ***: filename is too long: " + String(filename));
+		return false;
+	}
+	if (getNumQueued() >= AUDIOSDPLAYER_MAX_PLAYLIST) {
+		Serial.println("AudioSDPlayer_F32: queue: *** ERROR ***: playlist is full.  Cannot add " + String(filename));
+		return false;
+	}
+	strcpy(playlist[(playlist_head + n_playlist) % AUDIOSDPLAYER_MAX_PLAYLIST], filename);
+	n_playlist = n_playlist + 1;
+	return true;
+}
+
+void AudioSDPlayer_F32::clearQueue(void) {
+	__disable_irq();
+	n_playlist = 0;
+	if (seg_read != seg_play) {
+		//the current file has all been read, and the later files' audio follows it in the buffer, so drop that audio
+		seg_read = seg_play;
+		buffer_write = (buffer_read + data_length) % N_BUFFER;
+		__enable_irq();
+		file.close();  //it is one of the later files
+		read_remaining = 0;
 		state_read = READ_STATE_FILE_EMPTY;
+	} else {
+		__enable_irq();
 	}
-	
-	return 0;  //normal return
+}
+
+//Jump to sample_index (per channel) in the current file.  The file position comes straight from where the audio data
+//starts, so there is no searching.  The buffer is emptied and refilled from the new position.
+bool AudioSDPlayer_F32::seekSamples(uint32_t sample_index) {
+	if ((state != STATE_DIRECT_PCM) || (state_play != STATE_DIRECT_PCM)) return false;  //needs a file that is open and parsed
+	const uint32_t frame_bytes = (uint32_t)channels * (uint32_t)(bits/8);
+	const uint32_t byte_offset = min(sample_index, total_length / frame_bytes) * frame_bytes;
+
+	//if the SD reading has moved on to a later file, that file goes back onto the playlist and this file is re-opened
+	const bool reopen = (seg_read != seg_play) || (!isFileOpen());
+	requeueBufferedFiles();
+	__disable_irq();
+	buffer_read = 0;
+	buffer_write = 0;
+	data_length = total_length - byte_offset;
+	__enable_irq();
+	if (reopen) {
+		__disable_irq();
+		file.close();
+		file.open(segments[seg_play % AUDIOSDPLAYER_MAX_SEGMENTS].filename,O_READ);   //open for reading
+		__enable_irq();
+	}
+
+	read_remaining = data_length;
+	state_read = READ_STATE_NORMAL;
+	if ((!isFileOpen()) || (!file.seekSet(data_offset + byte_offset))) {
+		Serial.println("AudioSDPlayer_F32: seekSamples: *** ERROR ***: cannot seek in " + String(segments[seg_play % AUDIOSDPLAYER_MAX_SEGMENTS].filename));
+		finishReadingFile();  //nothing more can be played from this file
+		return false;
+	}
+	fillBufferFromSD();
+	return true;
 }
 		
 		
@@ -701,6 +908,7 @@ start:
 		  p += len;
 		  size -= len;
 		  data_length = header[4]; //how much more of the data is header?  (hopefully is still less than 
+		  if (state == STATE_PARSE5) data_length += (data_length & 1);  //chunks are padded to an even length
 		  goto start;  //jump back up to the beginning to go back through the big switch block
 		}
 		//Serial.println("AudioSDPlayer_F32: readHeader: unknown WAV header");
@@ -718,7 +926,7 @@ start:
 			Serial.println("AudioSDPlayer_F32: readHeader: *** ERROR ***: STATE_PARSE2: data_length should be zero but is " + String(data_length));
 			return false;  
 		}
-		if (parse_format()) { //here's the key operation
+		if (parse_format(segments[seg_play % AUDIOSDPLAYER_MAX_SEGMENTS])) { //here's the key operation
 		  p += len;
 		  size -= len;
 		  data_length = 8;
@@ -755,10 +963,16 @@ start:
 		  // as required by WAV format.  abort if odd.  Code
 		  // below will depend upon this and fail if not even.
 		  leftover_bytes = 0;
+		  {
+			Segment_t &seg = segments[seg_play % AUDIOSDPLAYER_MAX_SEGMENTS];
+			seg.data_offset = buffer_read;  //the header was read from the start of the file into the start of the buffer, so this is the file offset, too
+			seg.total_length = min(data_length, (uint32_t)(file.fileSize() - buffer_read));  //in case the file was cut short
+			startSegment(seg);
+		  }
 		  state = state_play;
 		  state_read = READ_STATE_NORMAL;
-		  total_length = data_length;
 		} else {
+		  data_length += (data_length & 1);  //chunks are padded to an even length
 		  state = STATE_PARSE4;
 		}
 		goto start;
@@ -797,7 +1011,7 @@ start:
 		state = STATE_PARSE1;
 		goto start;
 
-	case STATE_DIRECT_16BIT_MONO: case STATE_DIRECT_16BIT_STEREO:
+	case STATE_DIRECT_PCM:
 		//we could be here after parsing successfully, so let's assume it's good and simply break out of the switch block
 		break;
 
@@ -849,7 +1063,8 @@ start:
 //define B2M_11025 (uint32_t)((double)4294967296000.0 / AUDIO_SAMPLE_RATE_EXACT * 4.0)
 
 
-bool AudioSDPlayer_F32::parse_format(void)
+//Check the "fmt " chunk (in header[]) and fill in the format of seg
+bool AudioSDPlayer_F32::parse_format(Segment_t &seg)
 {
   uint8_t num = 0;
   uint16_t format;
@@ -858,10 +1073,12 @@ bool AudioSDPlayer_F32::parse_format(void)
   //uint16_t bits;
 
   format = header[0];
-  if (format != 1) {
-	Serial.println("AudioSDPlayer_F32: *** ERROR ***: parse_format: WAV format not equal to 1.  Format = " + String(format));
+  if (format == 0xFFFE) format = header[6];  //WAVE_FORMAT_EXTENSIBLE: the real format is at the start of the sub-format GUID
+  if ((format != 1) && (format != 3)) {  //PCM or IEEE float
+	Serial.println("AudioSDPlayer_F32: *** ERROR ***: parse_format: WAV format not PCM or float.  Format = " + String(format));
     return false;
   }
+  seg.is_float = (format == 3);
 
   rate = header[1];
   //Serial.println("AudioSDPlayer_F32::parse_format: rate = " + String(rate));
@@ -884,27 +1101,22 @@ bool AudioSDPlayer_F32::parse_format(void)
     return false;
   }
 
-  channels = header[0] >> 16;
-  //Serial.println("AudioSDPlayer_F32::parse_format: channels = " + String(channels));
-  if (channels == 1) {
-  } else if (channels == 2) {
-    //b2m >>= 1;
-    num |= 1;
-  } else {
+  seg.channels = header[0] >> 16;
+  //Serial.println("AudioSDPlayer_F32::parse_format: channels = " + String(seg.channels));
+  if ((seg.channels < 1) || (seg.channels > AUDIOSDPLAYER_MAX_CHAN)) {
+	Serial.println("AudioSDPlayer_F32: *** ERROR ***: parse_format: cannot play " + String(seg.channels) + " channels.");
     return false;
   }
+  if (seg.channels == 2) num |= 1;
 
-  bits = header[3] >> 16;
-  //Serial.println("AudioSDPlayer_F32::parse_format: bits = " + String(bits));
-  if (bits == 8) {
-  } else if (bits == 16) {
-    //b2m >>= 1;
-    num |= 2;
-  } else {
+  seg.bits = header[3] >> 16;
+  //Serial.println("AudioSDPlayer_F32::parse_format: bits = " + String(seg.bits));
+  if (seg.is_float) {
+    if (seg.bits != 32) return false;
+  } else if ((seg.bits != 8) && (seg.bits != 16) && (seg.bits != 24) && (seg.bits != 32)) {
     return false;
   }
-
-  updateBytes2Millis();
+  if (seg.bits == 16) num |= 2;
   
   //Serial.print("  bytes2millis = ");
   //Serial.println(b2m);
@@ -913,10 +1125,36 @@ bool AudioSDPlayer_F32::parse_format(void)
   // if they're not the expected values, all we could do is
   // return false.  Do any real wav files have unexpected
   // values in these other fields?
-  state_play = num;
+  seg.state_play = (num & 4) ? num : STATE_DIRECT_PCM;  //sample rate conversion is not supported (it plays silence)
   return true;
 }
 
+//Find the format and the audio data of the WAV file that is open.  This is for the files from the playlist, which are
+//parsed straight from the SD (rather than through the circular buffer, which is busy with the file that is playing).
+bool AudioSDPlayer_F32::findAudioInFile(Segment_t &seg) {
+	uint32_t chunk[3];
+	bool has_format = false;
+	if ((!file.seekSet(0)) || (file.read(chunk, 12) != 12)) return false;
+	if ((chunk[0] != 0x46464952) || (chunk[2] != 0x45564157)) return false;  //"RIFF" and "WAVE"
+	while (file.read(chunk, 8) == 8) {
+		const uint32_t len = chunk[1];
+		if (chunk[0] == 0x20746D66) {  //"fmt "
+			if ((len < 16) || (len > sizeof(header)) || (file.read(header, len) != (int)len)) return false;
+			if (!parse_format(seg)) return false;
+			has_format = true;
+			file.seekCur(len & 1);  //chunks are padded to an even length
+		} else if (chunk[0] == 0x61746164) {  //"data"
+			if (!has_format) return false;
+			seg.data_offset = file.curPosition();
+			seg.total_length = min(len, (uint32_t)(file.fileSize() - seg.data_offset));  //in case the file was cut short
+			return true;
+		} else {
+			file.seekCur(len + (len & 1));  //skip any other chunk
+		}
+	}
+	return false;
+}
+
 uint32_t AudioSDPlayer_F32::updateBytes2Millis(void)
 {
   double b2m;
@@ -927,12 +1165,8 @@ uint32_t AudioSDPlayer_F32::updateBytes2Millis(void)
   //account for channels
   b2m = b2m / ((double)channels);
 
-  //account for bits per second
-  if (bits == 16) {
-    b2m = b2m / 2;
-  } else if (bits == 24) {
-    b2m = b2m / 3;  //can we handle 24 bits?  I don't think that we can.
-  }
+  //account for bytes per sample
+  b2m = b2m / ((double)max(1, bits/8));
 
   return bytes2millis = ((uint32_t)b2m);
 }
@@ -951,7 +1185,7 @@ bool AudioSDPlayer_F32::isPlaying(void)
 uint32_t AudioSDPlayer_F32::positionMillis(void)
 {
   uint8_t s = *(volatile uint8_t *)&state;
-  if (s >= 8) return 0;
+  if (s >= STATE_PARSE1) return 0;
   uint32_t tlength = *(volatile uint32_t *)&total_length;
   uint32_t dlength = *(volatile uint32_t *)&data_length;
   uint32_t offset = tlength - dlength;
@@ -960,10 +1194,31 @@ uint32_t AudioSDPlayer_F32::positionMillis(void)
 }
 
 
+uint32_t AudioSDPlayer_F32::positionSamples(void)
+{
+  uint8_t s = *(volatile uint8_t *)&state;
+  if (s >= STATE_PARSE1) return 0;
+  uint32_t tlength = *(volatile uint32_t *)&total_length;
+  uint32_t dlength = *(volatile uint32_t *)&data_length;
+  uint32_t frame_bytes = (uint32_t)channels * (uint32_t)max(1, bits/8);
+  return (tlength - dlength) / frame_bytes;
+}
+
+
+uint32_t AudioSDPlayer_F32::lengthSamples(void)
+{
+  uint8_t s = *(volatile uint8_t *)&state;
+  if (s >= STATE_PARSE1) return 0;
+  uint32_t tlength = *(volatile uint32_t *)&total_length;
+  uint32_t frame_bytes = (uint32_t)channels * (uint32_t)max(1, bits/8);
+  return tlength / frame_bytes;
+}
+
+
 uint32_t AudioSDPlayer_F32::lengthMillis(void)
 {
   uint8_t s = *(volatile uint8_t *)&state;
-  if (s >= 8) return 0;
+  if (s >= STATE_PARSE1) return 0;
   uint32_t tlength = *(volatile uint32_t *)&total_length;
   uint32_t b2m = *(volatile uint32_t *)&bytes2millis;
   return ((uint64_t)tlength * b2m) >> 32;
@@ -45,9 +45,23 @@
 
 #include <SdFat.h>  //included in Teensy install as of Teensyduino 1.54-bete3
 
+//most channels that can be played from one WAV file (mono files are played on the first two outputs)
+#define AUDIOSDPLAYER_MAX_CHAN 8
+
+//the playlist: how many files can wait to be played, and the longest filename (including the terminating null)
+#define AUDIOSDPLAYER_MAX_PLAYLIST 32
+#define AUDIOSDPLAYER_MAX_FILENAME 64
+
+//how many files can have audio in the read buffer at once (the one playing, plus the ones pre-buffered behind it).  A power of two.
+#define AUDIOSDPLAYER_MAX_SEGMENTS 4
+
+//AudioSDPlayer_F32: plays WAV files from the SD card.  Plays 8, 16, 24, or 32-bit integer or 32-bit float data (including
+//WAVE_FORMAT_EXTENSIBLE files, such as from AudioSDWriter_F32) with up to AUDIOSDPLAYER_MAX_CHAN channels, at the
+//sample rate of the audio system.  The SD card is read only from loop() (see serviceSD()), never from update().
+//Files added with queue() play back-to-back without gaps, and seekSamples() jumps to any sample in the current file.
 class AudioSDPlayer_F32 : public AudioStream_F32
 {
-	//GUI: inputs:0, outputs:2  //this line used for automatic generation of GUI nodes  
+	//GUI: inputs:0, outputs:8  //this line used for automatic generation of GUI nodes  
 	public:
 		AudioSDPlayer_F32(void) : AudioStream_F32(0, NULL), sd_ptr(NULL) { 
 			init();
@@ -78,7 +92,24 @@ class AudioSDPlayer_F32 : public AudioStream_F32
 		virtual bool isPlaying(void);
 		virtual uint32_t positionMillis(void);
 		virtual uint32_t lengthMillis(void);
+		uint32_t positionSamples(void);  //per channel, in the current file
+		uint32_t lengthSamples(void);    //per channel, of the current file
 		virtual void update(void);
+
+		// Playlist.  Queued files play after the current one.  While a file plays, serviceSD() opens the next file and reads
+		// its audio into the buffer right behind the current file's audio, so update() goes from one file to the next in the
+		// middle of an audio block: no gap and no overlap.  (If the next file has a different number of channels, it starts
+		// with the next audio block instead.)  play(void) starts the first queued file if no file is open.
+		virtual bool queue(const String &filename) { return queue(filename.c_str()); }
+		virtual bool queue(const char *filename);  //returns false if the playlist is full or the name is too long
+		int getNumQueued(void) { return n_playlist + (uint8_t)(seg_read - seg_play); }  //files waiting, including any already pre-buffered
+		virtual void clearQueue(void);  //forget the waiting files (the current file keeps playing)
+
+		// Sample-accurate seek within the current file (call from loop(), not update()).  The file position is computed
+		// directly from where the audio data starts, so it costs one seek on the SD.  Playback resumes once serviceSD() has
+		// refilled the buffer, so for a seamless start, seek after open() and before play().
+		virtual bool seekSamples(uint32_t sample_index);  //sample_index is per channel
+		virtual bool seekMillis(uint32_t msec) { return seekSamples((uint32_t)(((uint64_t)msec * (uint64_t)(sample_rate_Hz + 0.5f)) / 1000)); }
 		float setSampleRate_Hz(float fs_Hz) { 
 			sample_rate_Hz = fs_Hz; 
 			updateBytes2Millis();
@@ -98,6 +129,7 @@ class AudioSDPlayer_F32 : public AudioStream_F32
 		//get some sizes
 		int16_t getNumChannels(void) { return channels; }
 		int16_t getBytesPerSample(void) { return bits/8; }
+		bool isFloat(void) { return is_float; }  //is the current file 32-bit float data?
 		uint32_t getBufferLengthBytes(void) { return N_BUFFER; }  //what is the full length of the buffer, regardless of how much data is in it
 		virtual uint32_t getNumBuffBytes(void);  //what is the number of bytes in the buffer, which will include any non-audio data that might be at end of WAV
 		uint32_t getNumberRemainingBytes(void) { return data_length; } //what is the number of audio bytes remaining to be returned (ie, what's in the buffer *plus* what is still on the SD)
@@ -108,12 +140,19 @@ class AudioSDPlayer_F32 : public AudioStream_F32
 			return (uint32_t)((float)bytes_in_buffer/bytes_per_msec + 0.5f); //the "+0.5"rounds to the nearest millisec
 		}
 
+		// Read-ahead scheduling for serviceSD() (see fillBufferFromSD()).  The buffer is refilled with large reads of
+		// getReadSizeBytes() each, unless it holds less than getUrgentReadMillis() of audio, when it reads whatever fits.
+		uint32_t setReadSizeBytes(uint32_t n_bytes) { return read_size_bytes = max(MIN_READ_SIZE_BYTES, min(N_BUFFER/2, (n_bytes / MIN_READ_SIZE_BYTES) * MIN_READ_SIZE_BYTES)); }
+		uint32_t getReadSizeBytes(void) { return read_size_bytes; }
+		uint32_t setUrgentReadMillis(uint32_t msec) { return urgent_read_msec = msec; }
+		uint32_t getUrgentReadMillis(void) { return urgent_read_msec; }
+
 		// copy some data from SD to a local buffer (RAM).  Because accessing
 		// the SD can be slow and unpredictable, don't do this in the high
 		// high priority interrupt-driven part of your code (ie, update()).
 		// Instead only call it from the low priority main-loop-driven part of
 		// your code.
-		int readFromSDtoBuffer(const uint16_t n_bytes_to_read);  //returns 0 if normal.  Can only read 2^16 bytes!! (64K)
+		int readFromSDtoBuffer(const uint32_t n_bytes_to_read);  //returns 0 if normal, or -1 if the file is done
 		int readFromSDtoBuffer_old(const uint16_t n_bytes_to_read);  //returns 0 if normal.  Can only read 2^16 bytes!! (64K)
   
 		// Use this to access the raw bytes in the WAV file (excluding the header).
@@ -133,12 +172,37 @@ class AudioSDPlayer_F32 : public AudioStream_F32
 		SdFile file;
 		//bool hasSdBegun = false;
 		bool consume(uint32_t size);
-		bool parse_format(void);
+		//one file's worth of audio in the read buffer
+		typedef struct {
+			char filename[AUDIOSDPLAYER_MAX_FILENAME];
+			uint16_t channels;
+			uint16_t bits;
+			bool is_float;
+			uint8_t state_play;
+			uint32_t data_offset;   //where the audio data starts in the file
+			uint32_t total_length;  //number of audio data bytes
+		} Segment_t;
+		Segment_t segments[AUDIOSDPLAYER_MAX_SEGMENTS];  //used as a ring, indexed by seg_play and seg_read (modulo AUDIOSDPLAYER_MAX_SEGMENTS)
+		volatile uint8_t seg_play = 0;  //the file that update() is playing
+		volatile uint8_t seg_read = 0;  //the file that serviceSD() is reading (the same as seg_play, or a later file)
+		uint32_t read_remaining = 0;    //audio bytes of seg_read's file that are still on the SD
+		char playlist[AUDIOSDPLAYER_MAX_PLAYLIST][AUDIOSDPLAYER_MAX_FILENAME];  //the files waiting to be opened (a ring)
+		uint8_t playlist_head = 0;
+		volatile uint8_t n_playlist = 0;
+
+		bool parse_format(Segment_t &seg);
+		bool findAudioInFile(Segment_t &seg);
+		bool openNextInPlaylist(void);
+		void startSegment(const Segment_t &seg);
+		void finishReadingFile(void);
+		void requeueBufferedFiles(void);
 		uint32_t header[10];    // temporary storage of wav header data
 		uint32_t data_length;   // number of bytes remaining in current section
 		uint32_t total_length;    // number of audio data bytes in file
+		uint32_t data_offset = 0; // where the audio data starts in the file
 		uint16_t channels = 1; //number of audio channels
 		uint16_t bits = 16;  // number of bits per sample
+		bool is_float = false; // is the data 32-bit float (rather than integer)?
 		uint32_t bytes2millis;
 		//audio_block_f32_t *block_left_f32 = NULL;
 		//audio_block_f32_t *block_right_f32 = NULL;
@@ -153,7 +217,9 @@ class AudioSDPlayer_F32 : public AudioStream_F32
 		#else
 			constexpr static uint32_t N_BUFFER = 256*MIN_READ_SIZE_BYTES;  //Newer Tympans have more RAM, so use a biffer buffer.  (originall was 32*READ_SIZE_BYTES)
 		#endif
-		uint8_t buffer[N_BUFFER];       // buffer X blocks of data
+		uint8_t buffer[N_BUFFER] __attribute__ ((aligned (4)));  // buffer X blocks of data.  Holds the header and audio of the first file, then only the audio of each queued file.
+		uint32_t read_size_bytes = N_BUFFER / 4;  //size of each read-ahead read
+		uint32_t urgent_read_msec = 30;           //if the buffer holds less audio than this, read whatever fits
 		uint32_t buffer_write = 0;
 		uint32_t buffer_read = 0;
 		//uint16_t buffer_offset;   // where we're at consuming "buffer"
@@ -169,9 +235,11 @@ class AudioSDPlayer_F32 : public AudioStream_F32
 
 		uint32_t updateBytes2Millis(void);
 
-		uint32_t readFromBuffer(float32_t *left_f32, float32_t *right_f32, int n_samps);
+		uint32_t readFromBuffer(float32_t *out_f32[], int n_samps);
 		//uint32_t readFromSDtoBuffer(float32_t *left_f32, float32_t *right_f32, int n);
-		uint32_t readBuffer_16bit_to_f32(float32_t *left_f32, float32_t *right_f32, uint16_t n_samps, uint16_t n_chan);
+		uint32_t readBuffer_to_f32(float32_t *out_f32[], const uint32_t n_samps);
+		uint32_t readSegment_to_f32(float32_t *out_f32[], const uint32_t out_offset, const uint32_t n_samps);
+		void convertToF32(const uint8_t *src, const uint32_t n_frames, float32_t *out_f32[], const uint32_t out_offset);
 		bool readHeader(void);
 };
 
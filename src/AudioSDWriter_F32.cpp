@@ -38,9 +38,30 @@ int AudioSDWriter_F32::setWriteDataType(WriteDataType type, Print* serial_ptr, c
 			Serial.print("AudioSDWriter_F32: setWriteDataType: *** ERROR *** Could not create buffered SD writer.");
 		}
 	}
+	if (buffSDWriter) {
+		switch (writeDataType) {
+			case WriteDataType::INT24:
+				buffSDWriter->setDataTypeWAV(24); break;
+			case WriteDataType::FLOAT32:
+				buffSDWriter->setDataTypeWAV(32, true); break;
+			default:
+				buffSDWriter->setDataTypeWAV(16); break;
+		}
+	}
 	if (buffSDWriter == NULL) { return -1; } else { return 0; };
 }
 
+bool AudioSDWriter_F32::setCompression(bool enable) {
+	flag__compress = enable;
+	if (enable && (writeDataType == WriteDataType::FLOAT32)) {
+		Serial.println("AudioSDWriter_F32: setCompression: *** WARNING ***: FLAC cannot hold FLOAT32 data.  Recording uncompressed WAV instead.");
+	}
+	if (enable && (numWriteChannels > FLAC_MAX_CHANNELS)) {
+		Serial.println("AudioSDWriter_F32: setCompression: *** WARNING ***: FLAC cannot hold more than 8 channels.  Recording uncompressed WAV instead.");
+	}
+	return flag__compress;
+}
+
 void AudioSDWriter_F32::prepareSDforRecording(void) {
 	if (current_SD_state == STATE::UNPREPARED) {
 		if (buffSDWriter) {
@@ -74,7 +95,7 @@ int AudioSDWriter_F32::deleteAllRecordings(void) {
 			recording_count++;
 	
 			//make file name
-			char fname[] = "AUDIOxxx.WAV";
+			char fname[] = "AUDIOxxx.FLAC";
 			int hundreds = recording_count / 100;
 			fname[5] = hundreds + '0';  //stupid way to convert the number to a character
 			int tens = (recording_count - (hundreds*100)) / 10;  //truncates
@@ -82,15 +103,19 @@ int AudioSDWriter_F32::deleteAllRecordings(void) {
 			int ones = recording_count - (tens * 10) - (hundreds*100);
 			fname[7] = ones + '0';  //stupid way to convert the number to a character
 
-			//does the file exist?
-			if (buffSDWriter->exists(fname)) {
-				//remove the file
-				if (serial_ptr) serial_ptr->print("AudioSDWriter: removing ");
-				if (serial_ptr) serial_ptr->println(fname);
-				buffSDWriter->remove(fname);
-			} else {
-				//do nothing
-				//done = true; //stop stepping through the files
+			for (int Iext = 0; Iext < 2; Iext++) {  //both WAV and FLAC recordings
+				strcpy(fname + 9, (Iext == 0) ? "WAV" : "FLAC");
+
+				//does the file exist?
+				if (buffSDWriter->exists(fname)) {
+					//remove the file
+					if (serial_ptr) serial_ptr->print("AudioSDWriter: removing ");
+					if (serial_ptr) serial_ptr->println(fname);
+					buffSDWriter->remove(fname);
+				} else {
+					//do nothing
+					//done = true; //stop stepping through the files
+				}
 			}
 		}
 			
@@ -123,13 +148,14 @@ int AudioSDWriter_F32::startRecording(void) {	  //make this the default "startRe
 			recording_count++;
 			if (recording_count < 1000) {
 				//make file name
-				char fname[] = "AUDIOxxx.WAV";
+				char fname[] = "AUDIOxxx.FLAC";  //a long file name (4-letter extension).  See setCompression().
 				int hundreds = recording_count / 100;
 				fname[5] = hundreds + '0';  //stupid way to convert the number to a character
 				int tens = (recording_count - (hundreds*100)) / 10;  //truncates
 				fname[6] = tens + '0';  //stupid way to convert the number to a character
 				int ones = recording_count - (tens * 10) - (hundreds*100);
 				fname[7] = ones + '0';  //stupid way to convert the number to a character
+				if (!isCompressing()) strcpy(fname + 9, "WAV");
 
 				//does the file exist?
 				if (buffSDWriter->exists(fname)) {
@@ -164,7 +190,8 @@ int AudioSDWriter_F32::startRecording(const char* fname) {
   
   if (current_SD_state == STATE::STOPPED) {
 	//try to open the file on the SD card
-	if (openAsWAV(fname)) { //returns TRUE if the file opened successfully
+	bool is_open = isCompressing() ? openAsFLAC(fname) : openAsWAV(fname); //returns TRUE if the file opened successfully
+	if (is_open) {
 	  if (serial_ptr) {
 		serial_ptr->print("AudioSDWriter: Opened ");
 		serial_ptr->println(fname);
@@ -199,8 +226,12 @@ void AudioSDWriter_F32::stopRecording(void) {
 	
 	//close the file
 	//if (serial_ptr) serial_ptr->println("stopRecording: Closing SD File...");
+	bool was_preallocated = (buffSDWriter && buffSDWriter->isPreallocated());
+	bool was_FLAC = (buffSDWriter && buffSDWriter->isFileFLAC());
 	close(); 
 	current_filename = String("Not Recording");
+	if (was_preallocated) printWriteTiming();
+	if (was_FLAC && serial_ptr) { serial_ptr->print("AudioSDWriter: FLAC compression ratio = "); serial_ptr->println(getCompressionRatio(), 2); }
 
 	//clear the buffer
 	if (buffSDWriter) buffSDWriter->resetBuffer();
@@ -356,6 +387,16 @@ int AudioSDWriter_F32::serviceSD_withWarnings(void) {
   return bytes_written;
 }     
 
+void AudioSDWriter_F32::printWriteTiming(void) {
+	if ((serial_ptr == NULL) || (buffSDWriter == NULL)) return;
+	serial_ptr->print("AudioSDWriter: SD writes: "); serial_ptr->print(buffSDWriter->getNumWrites());
+	serial_ptr->print(", mean = "); serial_ptr->print(buffSDWriter->getMeanWriteMicros());
+	serial_ptr->print(" usec, worst = "); serial_ptr->print(buffSDWriter->getMaxWriteMicros());
+	serial_ptr->print(" usec.  Buffer peak = "); serial_ptr->print(buffSDWriter->getMaxNumSampsInBuffer());
+	serial_ptr->print("/"); serial_ptr->print(buffSDWriter->getLengthOfBuffer());
+	serial_ptr->print(" samples, dropped blocks = "); serial_ptr->println(buffSDWriter->getNumDroppedBlocks());
+}
+
 void AudioSDWriter_F32::checkMemoryI2S(AudioInputI2SBase_F32 &i2s_in) {
 	//print a warning if there has been an SD writing hiccup
 
@@ -26,8 +26,18 @@
 //variables to control printing of warnings and timings and whatnot
 #define PRINT_FULL_SD_TIMING 0    //set to 1 to print timing information of *every* write operation.  Great for logging to file.  Bad for real-time human reading.
 
-//how many channels do we want to allow for?
-#define AUDIOSDWRITER_MAX_CHAN 4
+//how many channels do we want to allow for?  Each allowed channel is one input to the AudioSDWriter_F32 (but only the
+//channels set by setNumWriteChannels() are recorded).  To allow more (up to 16), this must be set as a global build flag
+//(-DAUDIOSDWRITER_MAX_CHAN=16, such as via "build_flags" in PlatformIO or "compiler.cpp.extra_flags" in the Arduino IDE's
+//platform.local.txt).  Do NOT #define it in your sketch before including Tympan_Library.h.  AudioSDWriter_F32.cpp is compiled
+//separately and would still see the default, so the class would have a different size in the sketch than in the library
+//(an ODR violation that corrupts memory).  Note that FLAC compression is limited to 8 channels.
+#ifndef AUDIOSDWRITER_MAX_CHAN
+#define AUDIOSDWRITER_MAX_CHAN 8
+#endif
+#if (AUDIOSDWRITER_MAX_CHAN < 1) || (AUDIOSDWRITER_MAX_CHAN > 16)
+#error "AudioSDWriter_F32: AUDIOSDWRITER_MAX_CHAN must be 1-16"
+#endif
 
 //AudioSDWriter: A class to write data from audio blocks as part of the 
 //   Teensy/Tympan audio processing paradigm.  The AudioSDWriter class is 
@@ -42,9 +52,9 @@ class AudioSDWriter {
     STATE getState(void) {
       return current_SD_state;
     };
-    enum class WriteDataType { INT16=0, INT24, FLOAT32 }; //not all of these are necessarily supported
+    enum class WriteDataType { INT16=0, INT24, FLOAT32 }; //INT24 and FLOAT32 are written with a WAVE_FORMAT_EXTENSIBLE header
     virtual int setNumWriteChannels(int n) {
-      return numWriteChannels = max(1, min(n, AUDIOSDWRITER_MAX_CHAN));  //can be 1, 2 or 4 (3 might work but its behavior is unknown)
+      return numWriteChannels = max(1, min(n, AUDIOSDWRITER_MAX_CHAN));  //can be any number up to AUDIOSDWRITER_MAX_CHAN
     }
     virtual int getNumWriteChannels(void) {
       return numWriteChannels;
@@ -71,9 +81,10 @@ class AudioSDWriter {
 
 //AudioSDWriter_F32: A class to write data from audio blocks as part
 //   of the Teensy/Tympan audio processing paradigm.  For this class, the
-//   audio is given as float32 and written as int16
+//   audio is given as float32 and written as int16 (default), int24, or float32.
+//   See setWriteDataType().
 class AudioSDWriter_F32 : public AudioSDWriter, public AudioStream_F32 {
-	//GUI: inputs:4, outputs:0 //this line used for automatic generation of GUI node
+	//GUI: inputs:8, outputs:0 //this line used for automatic generation of GUI node
 	public:
 		AudioSDWriter_F32(void) :
 		  AudioSDWriter(),
@@ -171,6 +182,34 @@ class AudioSDWriter_F32 : public AudioSDWriter, public AudioStream_F32 {
 		}
 
 
+		//Preallocated recording (call before startRecording()).  Give the expected length of the recording
+		//and each file is preallocated as one contiguous piece of the SD card, with every write aligned to the
+		//card's sectors.  This avoids the slow FAT updates during long recordings.  Set to zero to turn off.
+		float setPreallocateSeconds(float sec) {
+			if (buffSDWriter) return buffSDWriter->setPreallocateSeconds(sec);
+			return 0.0f;
+		}
+		float getPreallocateSeconds(void) { if (buffSDWriter) return buffSDWriter->getPreallocateSeconds(); return 0.0f; }
+
+		//Lossless compression (call before startRecording()).  When enabled, the recordings are written as FLAC
+		//files (AUDIOxxx.FLAC) instead of WAV, which typically needs half the SD bandwidth or less.  Only for
+		//INT16 and INT24 with up to 8 channels; other recordings are always written uncompressed.  Note that
+		//"AUDIOxxx.FLAC" is not an 8.3 name, so on a FAT16/FAT32 card it needs SdFat's long file names
+		//(USE_LONG_FILE_NAMES, which is on by default for Teensy).  exFAT cards always have long names.
+		bool setCompression(bool enable);
+		bool getCompression(void) { return flag__compress; }
+		bool isCompressing(void) {  //will the next recording be FLAC?
+			return flag__compress && (writeDataType != WriteDataType::FLOAT32) && (numWriteChannels <= FLAC_MAX_CHANNELS);
+		}
+		float getCompressionRatio(void) { if (buffSDWriter) return buffSDWriter->getCompressionRatio(); return 1.0f; } //for the current (or last) FLAC recording
+
+		//timing and buffer statistics for the current recording (printed automatically when a preallocated recording stops)
+		uint32_t getMaxWriteMicros(void) { if (buffSDWriter) return buffSDWriter->getMaxWriteMicros(); return 0; }   //worst-case time for one SD write
+		uint32_t getMeanWriteMicros(void) { if (buffSDWriter) return buffSDWriter->getMeanWriteMicros(); return 0; }
+		int32_t getMaxNumSampsInBuffer(void) { if (buffSDWriter) return buffSDWriter->getMaxNumSampsInBuffer(); return 0; } //most the buffer has held
+		uint32_t getNumDroppedBlocks(void) { if (buffSDWriter) return buffSDWriter->getNumDroppedBlocks(); return 0; }     //only for preallocated recording
+		void printWriteTiming(void);
+
 		//if you want to set the audio buffer size yourself, call this method before
 		//calling startRecording().
 		int allocateBuffer(const int nBytes) {
@@ -192,7 +231,7 @@ class AudioSDWriter_F32 : public AudioSDWriter, public AudioStream_F32 {
 		int startRecording(const char* fname) override; //or call this to specify your own filename.
 		//int startRecording_noOverwrite(void);
 		void stopRecording(void) override;    //call this to stop recording
-		int deleteAllRecordings(void);  //clears all AUDIOxxx.wav files from the SD card
+		int deleteAllRecordings(void);  //clears all AUDIOxxx.wav and AUDIOxxx.flac files from the SD card
 
 		//update is called by the Audio processing ISR.  This update function should
 		//only service the recording queues so as to buffer the audio data.
@@ -224,7 +263,8 @@ class AudioSDWriter_F32 : public AudioSDWriter, public AudioStream_F32 {
 			if (buffSDWriter) return buffSDWriter->isFileOpen();
 			return false;
 		}
-		int32_t getNumUnfilledSamplesInBuffer(void) { if (buffSDWriter) buffSDWriter->getNumUnfilledSamplesInBuffer(); return 0; }  //how much of the buffer is empty, in samples
+		int32_t getNumUnfilledSamplesInBuffer(void) { if (buffSDWriter) return buffSDWriter->getNumUnfilledSamplesInBuffer(); return 0; }  //how much of the buffer is empty, in samples (of the current data type)
+		float getBytesPerSecond(void) { if (buffSDWriter) return buffSDWriter->getBytesPerSecondWAV(); return 0.0f; }  //SD bandwidth needed for the current data type
 		uint32_t getNumUnfilledSamplesInBuffer_msec(void) { if (buffSDWriter) return buffSDWriter->getNumUnfilledSamplesInBuffer_msec(); return 0; }  //how much of the buffer is empty, in msec
 
 		unsigned long getStartTimeMillis(void) { return t_start_millis; };
@@ -237,15 +277,20 @@ class AudioSDWriter_F32 : public AudioSDWriter, public AudioStream_F32 {
 		//virtual int isSdCardPresent(void) {	if (buffSDWriter) return buffSDWriter->isSdCardPresent(); return -1; }
 
 	protected:
-		audio_block_f32_t *inputQueueArray[AUDIOSDWRITER_MAX_CHAN]; //up to four input channels
+		audio_block_f32_t *inputQueueArray[AUDIOSDWRITER_MAX_CHAN]; //one for each allowed input channel
 		BufferedSDWriter *buffSDWriter = 0;
 		Print *serial_ptr = &Serial;
 		unsigned long t_start_millis = 0;
+		bool flag__compress = false;
 
 		bool openAsWAV(const char *fname) {
 			if (buffSDWriter) return buffSDWriter->openAsWAV(fname);
 			return false;
 		}
+		bool openAsFLAC(const char *fname) {
+			if (buffSDWriter) return buffSDWriter->openAsFLAC(fname);
+			return false;
+		}
 		bool open(const char *fname) {
 			if (buffSDWriter) return buffSDWriter->open(fname);
 			return false;
@@ -274,7 +319,7 @@ class AudioSDWriter_F32 : public AudioSDWriter, public AudioStream_F32 {
 // Here's a class that wraps AudioSDWriter_F32 with some functions to interact
 // via a serial menu and via the Tympan_Remote App.
 class AudioSDWriter_F32_UI : public AudioSDWriter_F32, public SerialManager_UI {
-	//GUI: inputs:4, outputs:0 //this line used for automatic generation of GUI node
+	//GUI: inputs:8, outputs:0 //this line used for automatic generation of GUI node
 	public:
 		//copy all of the constructors from AudioSDWriter_F32...just pass through to the underlying constructors...nothing new being done here
 		AudioSDWriter_F32_UI(void) : 
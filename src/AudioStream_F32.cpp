@@ -19,6 +19,12 @@ bool AudioStream_F32::isAudioProcessing = false;
 
 uint32_t AudioStream_F32::update_counter = 0;
 
+float32_t *AudioScratchArena_F32::arena = NULL;
+int AudioScratchArena_F32::arena_size = 0;
+volatile int AudioScratchArena_F32::top = 0;
+int AudioScratchArena_F32::max_used = 0;
+unsigned long AudioScratchArena_F32::n_failures = 0;
+
 
 
 void AudioMemory_F32(const unsigned int num) {
@@ -157,6 +163,40 @@ void AudioStream_F32::release(audio_block_f32_t *block)
   __enable_irq();
 }
 
+// Grow the scratch arena.  Only does anything if the arena is not currently in use,
+// because growing it moves the memory out from under anyone using it.
+bool AudioScratchArena_F32::allocate(const int n_floats)
+{
+	if (n_floats <= arena_size) return true;  //already big enough
+	bool is_ok = false;
+	__disable_irq();
+	if (top == 0) {
+		float32_t *new_arena = new (std::nothrow) float32_t[n_floats];
+		if (new_arena != NULL) {
+			delete[] arena;
+			arena = new_arena;
+			arena_size = n_floats;
+			is_ok = true;
+		}
+	}
+	__enable_irq();
+	if (!is_ok) Serial.println("AudioScratchArena_F32: allocate: *** ERROR ***: could not grow the scratch memory to " + String(n_floats) + " floats.");
+	return is_ok;
+}
+
+// Take n floats off the top of the scratch arena.  They are given back via releaseToMark(),
+// which is normally called automatically by AudioScratch_F32 when it goes out of scope.
+float32_t* AudioScratchArena_F32::acquire(const int n)
+{
+	if (n <= 0) return NULL;
+	const int n_aligned = (n + 3) & (~0x03);  //round up to a multiple of 4 floats so that the arrays keep the arena's alignment
+	const int start = top;
+	if ((start + n_aligned) > arena_size) { n_failures++; return NULL; }
+	top = start + n_aligned;
+	if (top > max_used) max_used = top;
+	return &(arena[start]);
+}
+
 // Transmit an audio data block
 // to all streams that connect to an output.  The block
 // becomes owned by all the recepients, but also is still
@@ -199,4 +199,56 @@ void AudioMemory_F32(const unsigned int num, const AudioSettings_F32 &settings);
 #define AudioMemoryUsageMaxReset_F32() (AudioStream_F32::f32_memory_used_max = AudioStream_F32::f32_memory_used)
 
 
+// ///////////// Scratch memory for temporary arrays
+//
+// Many algorithms need temporary arrays inside of their update() (envelopes, gains, dB values, etc).  Using
+// allocate_f32() for these takes audio blocks away from the pool that passes audio between the nodes, and
+// the processing gets skipped if the pool runs dry.  Instead, use the scratch arena.  It is one stack of
+// floats that is shared by every node.  An AudioScratch_F32 object takes temporary arrays off the top of
+// the stack and gives them all back when it goes out of scope.  So, the arena only needs to be as big as
+// the deepest simultaneous use (not the sum over all nodes), and nothing is held between updates.
+//
+// Every user gives back exactly what it took before it returns.  So, if the audio interrupt uses the arena
+// while loop() is also using it, the interrupt leaves the arena exactly as it found it.
+//
+// The arena is only created when a node that uses it asks for it: each such node calls reserve() from its
+// constructor with its own deepest use, and the arena grows to the largest of those.  So, sketches without
+// any of these nodes do not pay for it.  Use AudioScratchMemory_F32() to make it bigger by hand.  If the
+// arena is too small, acquire() returns NULL, and the node either works without it or reports an error.
+class AudioScratchArena_F32 {
+	public:
+		static bool allocate(const int n_floats);  //grows the arena (it never shrinks).  Returns false if it failed.
+		static bool reserve(const int n_arrays, const int n) { return allocate(n_arrays * ((n + 3) & (~0x03))); } //room for n_arrays arrays of n floats each (see acquire)
+		static float32_t *acquire(const int n);    //returns NULL if there is not enough room left
+		static int getMark(void) { return top; }
+		static void releaseToMark(const int mark) { top = mark; }
+
+		static int getSize(void) { return arena_size; }              //number of floats
+		static int getMaxUsed(void) { return max_used; }             //number of floats
+		static void resetMaxUsed(void) { max_used = top; }
+		static unsigned long getNumFailures(void) { return n_failures; }  //number of times acquire() ran out of room
+	private:
+		//plain pointer (not a std::vector) so that it is valid before any constructor runs, since nodes
+		//reserve their scratch memory from their own constructors, which can run in any order
+		static float32_t *arena;
+		static int arena_size;
+		static volatile int top;
+		static int max_used;
+		static unsigned long n_failures;
+};
+
+//Scoped access to the scratch arena.  Create one at the top of your function and get() as many arrays as you need.
+class AudioScratch_F32 {
+	public:
+		AudioScratch_F32(void) : mark(AudioScratchArena_F32::getMark()) {}
+		~AudioScratch_F32(void) { AudioScratchArena_F32::releaseToMark(mark); }
+		float32_t *get(const int n) { return AudioScratchArena_F32::acquire(n); }
+	private:
+		const int mark;
+};
+
+#define AudioScratchMemory_F32(n_floats) (AudioScratchArena_F32::allocate(n_floats))
+#define AudioScratchMemoryUsageMax_F32() (AudioScratchArena_F32::getMaxUsed())
+
+
 #endif
\ No newline at end of file
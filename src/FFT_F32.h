@@ -31,7 +31,7 @@ class FFT_F32
     FFT_F32(const int _N_FFT, const int _is_IFFT) {
       setup(_N_FFT, _is_IFFT);
     }
-    ~FFT_F32(void) { delete window; };  //destructor
+    ~FFT_F32(void) { delete[] window; };  //destructor
 
     virtual int setup(const int _N_FFT) {
       int _is_IFFT = 0;
@@ -52,10 +52,11 @@ class FFT_F32
         is_rad4 = 1;
       } else {
         arm_cfft_radix2_init_f32(&fft_inst_r2, N_FFT, is_IFFT, 1); //setup up the FFT (or IFFT)
+        is_rad4 = 0;  //in case an earlier setup() used radix 4
       }
 	  
       //allocate window
-	  if (window != NULL) delete window;
+	  if (window != NULL) delete[] window;
       window = new float[N_FFT];
       if (is_IFFT) {
         useRectangularWindow(); //default to no windowing for IFFT
@@ -142,7 +143,7 @@ class FFT_F32
     int N_FFT=0;
     int is_IFFT=0;
     int is_rad4=0;
-    float *window;
+    float *window = NULL;
     int flag__useWindow=0;
     arm_cfft_radix4_instance_f32 fft_inst_r4;
     arm_cfft_radix2_instance_f32 fft_inst_r2;
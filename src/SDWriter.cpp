@@ -13,13 +13,32 @@ int SDWriter::isSdCardPresent(void) {
 
 bool SDWriter::openAsWAV(const char *fname) {
 	bool returnVal = open(fname);
+	flag__preallocated = false;
+	WAVheader_bytes = getMinHeaderBytesWAV();
 	if (isFileOpen()) { //true if file is open
 		flag__fileIsWAV = true;
-		file.write(wavHeaderInt16(0), WAVheader_bytes); //initialize assuming zero length
+		if (preallocate_sec > 0.0f) {
+			//The header is padded to a full sector so that the audio data starts on a sector boundary.
+			preallocateFile();
+			WAVheader_bytes = SDWRITER_SECTOR_BYTES;
+		}
+		file.write(wavHeader(0), WAVheader_bytes); //initialize assuming zero length
 	}
+	resetWriteTiming();
 	return returnVal;
 }
 
+//Reserve the whole recording (at the uncompressed size) as one contiguous piece of the card, plus one sector for the header
+void SDWriter::preallocateFile(void) {
+	uint64_t nbytes = (uint64_t)((double)preallocate_sec * (double)WAV_sampleRate_Hz * (double)WAV_nchan) * getBytesPerSampleWAV();
+	nbytes = ((nbytes + SDWRITER_SECTOR_BYTES - 1) / SDWRITER_SECTOR_BYTES) * SDWRITER_SECTOR_BYTES + SDWRITER_SECTOR_BYTES;
+	if (!file.preAllocate(nbytes)) {
+		Serial.print("SDWriter: preallocateFile: *** WARNING ***: could not preallocate "); Serial.print((uint32_t)(nbytes >> 10));
+		Serial.println(" kB (card full, or more than 4 GB on FAT32?).  Recording anyway.");
+	}
+	flag__preallocated = true;
+}
+
 bool SDWriter::open(const char *fname) {
 	if (sd->exists(fname)) {  //maybe this isn't necessary when using the O_TRUNC flag below
 		// The SD library writes new data to the end of the file, so to start
@@ -38,12 +57,18 @@ int SDWriter::close(void) {
 	if (flag__fileIsWAV) {
 		//re-write the header with the correct file size
 		uint32_t fileSize = file.fileSize();//SdFat_Gre_FatLib version of size();
+		if (flag__preallocated) {
+			//the preallocated size is not the recorded size.  Release the unused part of the preallocation.
+			fileSize = file.curPosition();
+			file.truncate(fileSize);
+		}
 		file.seekSet(0); //SdFat_Gre_FatLib version of seek();
-		file.write(wavHeaderInt16(fileSize), WAVheader_bytes); //write header with correct length
+		file.write(wavHeader(fileSize), WAVheader_bytes); //write header with correct length
 		file.seekSet(fileSize);
 	}
 	file.close();
 	flag__fileIsWAV = false;
+	flag__preallocated = false;
 	return 0;
 }
 		
@@ -69,8 +94,10 @@ size_t SDWriter::write(uint8_t foo)  {
 size_t SDWriter::write(const uint8_t *buff, int nbytes) {
 	size_t return_val = 0;
 	if (file.isOpen()) {
+		uint32_t start_usec = micros();
 		if (flagPrintElapsedWriteTime) { usec = 0; }
 		file.write((byte *)buff, nbytes); return_val = nbytes;
+		updateWriteTiming(micros() - start_usec);  //keep track of the worst-case write time
 
 		//write elapsed time only to USB serial (because only that is fast enough)
 		if (flagPrintElapsedWriteTime) { Serial.print("SD, us="); Serial.println(usec); }
@@ -78,29 +105,55 @@ size_t SDWriter::write(const uint8_t *buff, int nbytes) {
 	return return_val;
 }
 
- char* SDWriter::wavHeaderInt16(const float32_t sampleRate_Hz, const int nchan, const uint32_t fileSize) {
+//sub-format GUIDs for WAVE_FORMAT_EXTENSIBLE: KSDATAFORMAT_SUBTYPE_PCM and KSDATAFORMAT_SUBTYPE_IEEE_FLOAT
+static const uint8_t WAV_GUID_PCM[16] =   { 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0xAA, 0x00, 0x38, 0x9B, 0x71 };
+static const uint8_t WAV_GUID_FLOAT[16] = { 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0xAA, 0x00, 0x38, 0x9B, 0x71 };
+
+char* SDWriter::wavHeader(const float32_t sampleRate_Hz, const int nchan, const int nbits, const bool is_float, const uint32_t fileSize) {
 	//const int fileSize = bytesWritten+44;
 
 	int fsamp = (int) sampleRate_Hz;
-	int nbits = 16;   //assumes we're writing INT16 data
 	int nbytes = nbits / 8;
-	int nsamp = (fileSize - WAVheader_bytes) / (nbytes * nchan);
+	int nsamp = (fileSize > (uint32_t)WAVheader_bytes) ? (fileSize - WAVheader_bytes) / (nbytes * nchan) : 0;
+	bool is_extensible = (nbits != 16) || is_float;  //int16 keeps the plain PCM header
 
-	static char wheader[48]; // 44 for wav
+	static char wheader[SDWRITER_SECTOR_BYTES]; // 44 for int16 wav, or a full sector when padded for a preallocated file
+	int data_ind = WAVheader_bytes - 8;  //where the "data" chunk starts
+	int ind = 36; //where the chunk after "fmt " starts
 
 	strcpy(wheader, "RIFF");
 	strcpy(wheader + 8, "WAVE");
 	strcpy(wheader + 12, "fmt ");
-	strcpy(wheader + 36, "data");
-	*(int32_t*)(wheader + 16) = 16; // chunk_size   //is this related to assuming INT16 data type being written to file?
-	*(int16_t*)(wheader + 20) = 1; // PCM
+	*(int32_t*)(wheader + 16) = is_extensible ? 40 : 16; // chunk_size
+	*(uint16_t*)(wheader + 20) = is_extensible ? 0xFFFE : 1; // WAVE_FORMAT_EXTENSIBLE or PCM
 	*(int16_t*)(wheader + 22) = nchan; // numChannels
 	*(int32_t*)(wheader + 24) = fsamp; // sample rate
 	*(int32_t*)(wheader + 28) = fsamp * nchan * nbytes; // byte rate (updated 10/14/2024) 
 	*(int16_t*)(wheader + 32) = nchan * nbytes; // block align
 	*(int16_t*)(wheader + 34) = nbits; // bits per sample
-	*(int32_t*)(wheader + 40) = nsamp * nchan * nbytes;
-	*(int32_t*)(wheader + 4) = 36 + nsamp * nchan * nbytes;  //what is this?  Why 36???
+	if (is_extensible) {
+		*(int16_t*)(wheader + 36) = 22; // size of the extension
+		*(int16_t*)(wheader + 38) = nbits; // valid bits per sample
+		*(int32_t*)(wheader + 40) = (nchan == 1) ? 0x4 : ((nchan == 2) ? 0x3 : 0); // channel mask: front center, front left+right, or no speaker positions
+		memcpy(wheader + 44, is_float ? WAV_GUID_FLOAT : WAV_GUID_PCM, 16); // sub-format
+		ind = 60;
+		if (is_float) {
+			//non-PCM data also needs a "fact" chunk, giving the number of sample frames
+			strcpy(wheader + 60, "fact");
+			*(int32_t*)(wheader + 64) = 4;
+			*(int32_t*)(wheader + 68) = nsamp;
+			ind = 72;
+		}
+	}
+	if (data_ind > ind) {
+		//pad with a "JUNK" chunk (which WAV readers skip) so that the audio data starts at WAVheader_bytes
+		strcpy(wheader + ind, "JUNK");
+		*(int32_t*)(wheader + ind + 4) = data_ind - ind - 8;
+		memset(wheader + ind + 8, 0, data_ind - ind - 8);
+	}
+	strcpy(wheader + data_ind, "data");
+	*(int32_t*)(wheader + data_ind + 4) = nsamp * nchan * nbytes;
+	*(int32_t*)(wheader + 4) = (WAVheader_bytes - 8) + nsamp * nchan * nbytes;  //size of everything after this RIFF chunk header
 
 	return wheader;
 }
@@ -117,6 +170,64 @@ bool BufferedSDWriter::sync(void) {
 	}
 }
 
+void BufferedSDWriter::resetBuffer(void) {
+	bufferReadInd = 0; bufferWriteInd = 0; maxSampsInBuffer = 0; numDroppedBlocks = 0;
+
+	//how many samples fit in the buffer depends upon the data type
+	bufferLengthSamples = max(4, bufferLengthBytes / nBytesPerSample);
+	if (useFrameRing()) {
+		//for the preallocated (or FLAC) file, make the ring a whole number of sectors and of sample frames
+		int32_t unit = getNumSamplesPerAlignedWrite() * max(1, WAV_nchan);
+		if (bufferLengthSamples < unit) unit = max(1, WAV_nchan);  //too small to be aligned.  It will still work.
+		bufferLengthSamples = (bufferLengthSamples / unit) * unit;
+	}
+	bufferEndInd = bufferLengthSamples;
+}
+
+//convert the float32 audio (scaled -1.0 to +1.0) and interleave it into the buffer.  This is blocked: it works on a chunk
+//of sample frames at a time, going channel-by-channel within the chunk.  Each channel is read contiguously, the
+//writes for a chunk stay within a small piece of the buffer (even with many channels), and the choice of data type
+//and of dithering is made once per chunk rather than once per sample.
+void BufferedSDWriter::interleaveToBuffer(float32_t *ptr_audio[], const int start, const int nframes, const int numChan, const int32_t ind) {
+	const int CHUNK = 32;
+	for (int Isamp = 0; Isamp < nframes; Isamp += CHUNK) {
+		const int n = min(CHUNK, nframes - Isamp);
+		const int32_t chunk_ind = ind + Isamp*numChan;  //where this chunk starts in the buffer
+		for (int Ichan = 0; Ichan < numChan; Ichan++) {
+			const float32_t *src = ptr_audio[Ichan] + start + Isamp;
+			switch (nBytesPerSample) {
+				case 3: {
+					//packed int24, little-endian.  Scaled like int16 (and like the 24-bit I2S output): full scale is 2^23-1
+					uint8_t *dest = write_buffer + (chunk_ind + Ichan)*3;
+					for (int i = 0; i < n; i++) {
+						const float32_t val = max(-8388607.0f, min(8388607.0f, src[i]*8388607.0f));  //saturate
+						const uint32_t val_i32 = (uint32_t)((int32_t)val);  //truncate
+						dest[0] = (uint8_t)val_i32; dest[1] = (uint8_t)(val_i32 >> 8); dest[2] = (uint8_t)(val_i32 >> 16);
+						dest += 3*numChan;
+					}
+					break; }
+				case 4: {
+					//float32 is stored as-is (no clipping, no dither)
+					float32_t *dest = ((float32_t *)write_buffer) + chunk_ind + Ichan;
+					for (int i = 0; i < n; i++) { *dest = src[i]; dest += numChan; }
+					break; }
+				default: {
+					//int16
+					int16_t *dest = ((int16_t *)write_buffer) + chunk_ind + Ichan;
+					if (ditheringMethod > 0) {
+						for (int i = 0; i < n; i++) { *dest = convertToInt16(src[i], Ichan); dest += numChan; }
+					} else {
+						for (int i = 0; i < n; i++) {  //same as convertToInt16(), without the dither
+							const float32_t val = max(-32767.0f, min(32767.0f, src[i]*32767.0f));  //saturate
+							*dest = (int16_t)val; dest += numChan;  //truncate
+						}
+					}
+					break; }
+			}
+		}
+	}
+}
+
 //here is how you send data to this class.  this doesn't write any data, it just stores data
 void BufferedSDWriter::copyToWriteBuffer(float32_t *ptr_audio[], const int nsamps, const int numChan) {
 	if (!write_buffer) {  //try to allocate buffer, return if it doesn't work
@@ -127,6 +238,17 @@ void BufferedSDWriter::copyToWriteBuffer(float32_t *ptr_audio[], const int nsamp
 		}
 	}
 
+	//make sure no null arrays
+	for (int Ichan=0; Ichan < numChan; Ichan++) {
+		if (!(ptr_audio[Ichan])) {
+			if (ptr_zeros == NULL) { ptr_zeros = new float32_t[nsamps](); } //creates and initializes to zero
+			ptr_audio[Ichan] = ptr_zeros;
+		}
+	}
+
+	//preallocated and FLAC files use the frame ring instead
+	if (useFrameRing()) { copyToWriteBuffer_preallocated(ptr_audio, nsamps, numChan); return; }
+
 	//how much data will we write?
 	int estFinalWriteInd = bufferWriteInd + (numChan * nsamps);
 
@@ -151,37 +273,45 @@ void BufferedSDWriter::copyToWriteBuffer(float32_t *ptr_audio[], const int nsamp
 		}
 	}
 
-	//make sure no null arrays
-	for (int Ichan=0; Ichan < numChan; Ichan++) {
-		if (!(ptr_audio[Ichan])) {
-			if (ptr_zeros == NULL) { ptr_zeros = new float32_t[nsamps](); } //creates and initializes to zero
-			ptr_audio[Ichan] = ptr_zeros;
-		}
-	}
-
 	//now interleave the data into the buffer
-	for (int Isamp = 0; Isamp < nsamps; Isamp++) {
-		for (int Ichan = 0; Ichan < numChan; Ichan++) {
-			//convert the F32 to Int16 and interleave
-			float32_t val_f32 = ptr_audio[Ichan][Isamp];  //float value, scaled -1.0 to +1.0
-	
-			//add dithering, if desired
-			if (ditheringMethod > 0) val_f32 += generateDitherNoise(Ichan,ditheringMethod);
-	
-			//convert to INT16 datatype and put in the write buffer
-			write_buffer[bufferWriteInd++] = (int16_t) max(-32767.0,min(32767.0,(val_f32*32767.0f))); //truncation, with saturation
-			//write_buffer[bufferWriteInd++] = (int16_t) max(-32767.0,min(32767.0,(val_f32*32767.0f + 0.5f))); //round, with saturation
-		}
-	}
+	interleaveToBuffer(ptr_audio, 0, nsamps, numChan, bufferWriteInd);
+	bufferWriteInd += numChan * nsamps;
 
 	//handle the case where we just wrote past the read index.  Push the read index ahead.
 	if (flag_moveReadIndexToEndOfWrite) bufferReadInd = bufferWriteInd;
+	maxSampsInBuffer = max(maxSampsInBuffer, getNumSampsInBuffer());
+}
+
+//For preallocated files.  The buffer is a ring that is a whole number of sample frames long, so it only
+//ever wraps between frames (one frame is always left empty so that a full ring can be told from an empty one).  This is called from the audio interrupt while
+//writeBufferedData_preallocated() may be in the middle of writing from the ring in loop(), so a block that
+//does not fit is dropped (and counted) rather than overwriting data that might be getting written.
+void BufferedSDWriter::copyToWriteBuffer_preallocated(float32_t *ptr_audio[], const int nsamps, const int numChan) {
+	if (getNumUnfilledSamplesInBuffer() <= (numChan * nsamps)) {
+		numDroppedBlocks++;
+		return;
+	}
+
+	//interleave the data into the ring, in two pieces if it wraps around the end
+	int32_t ind = bufferWriteInd;
+	const int nframes1 = min(nsamps, (int)((bufferLengthSamples - ind) / numChan));
+	interleaveToBuffer(ptr_audio, 0, nframes1, numChan, ind);
+	ind += nframes1 * numChan;
+	if (ind >= bufferLengthSamples) ind = 0;
+	if (nframes1 < nsamps) {
+		interleaveToBuffer(ptr_audio, nframes1, nsamps - nframes1, numChan, ind);
+		ind += (nsamps - nframes1) * numChan;
+	}
+	bufferWriteInd = ind;  //only now does the new data become visible to writeBufferedData_preallocated()
+	maxSampsInBuffer = max(maxSampsInBuffer, getNumSampsInBuffer());
 }
 
 //write buffered data if enough has accumulated
 int BufferedSDWriter::writeBufferedData(void) {
 	const int max_writeSizeSamples = 8*writeSizeSamples;  //was 8
 	if (!write_buffer) return -1;
+	if (flag__fileIsFLAC) return writeBufferedData_flac(false);
+	if (flag__preallocated) return writeBufferedData_preallocated();
 	int return_val = 0;
 
 	//if the write pointer has wrapped around, write the data
@@ -202,7 +332,7 @@ int BufferedSDWriter::writeBufferedData(void) {
 			//  Serial.print(samplesAvail); Serial.print(", ");
 			//  Serial.println(samplesToWrite);
 			//}
-			return_val += write((byte *)(write_buffer + bufferReadInd), samplesToWrite * sizeof(write_buffer[0]));
+			return_val += write((byte *)(write_buffer + bufferReadInd*nBytesPerSample), samplesToWrite * nBytesPerSample);
 			//if (return_val == 0) {
 			//  Serial.print("SDWriter: writeBuff1: samps to write, bytes written: "); Serial.print(samplesToWrite);
 			//  Serial.print(", "); Serial.println(return_val);
@@ -232,7 +362,7 @@ int BufferedSDWriter::writeBufferedData(void) {
 				Serial.print(samplesAvail); Serial.print(", ");
 				Serial.println(samplesToWrite);
 			}
-			return_val += write((byte *)(write_buffer + bufferReadInd), samplesToWrite * sizeof(write_buffer[0]));
+			return_val += write((byte *)(write_buffer + bufferReadInd*nBytesPerSample), samplesToWrite * nBytesPerSample);
 			if (return_val == 0) {
 				Serial.print("SDWriter: writeBuff2: samps to write, bytes written: "); Serial.print(samplesToWrite);
 				Serial.print(", "); Serial.println(return_val);
@@ -243,6 +373,165 @@ int BufferedSDWriter::writeBufferedData(void) {
 	return return_val;
 }
 
+//For preallocated files.  Only whole sectors are written (except when closing the file), which keeps every
+//write aligned to the sectors of the file (the WAV header is one whole sector).  The ring is a whole number
+//of sectors long, so the part of the ring up to its end is always whole sectors, too.
+int BufferedSDWriter::writeBufferedData_preallocated(void) {
+	const int32_t align = getNumSamplesPerAlignedWrite();
+	const int32_t min_writeSizeSamples = ((writeSizeSamples + align - 1) / align) * align;
+	const int32_t write_ind = bufferWriteInd;  //the audio interrupt might change bufferWriteInd while we work
+	const int32_t read_ind = bufferReadInd;
+
+	//how much can be written in one piece?
+	int32_t samplesToWrite;
+	if (read_ind <= write_ind) {
+		samplesToWrite = write_ind - read_ind;
+		if (samplesToWrite < min_writeSizeSamples) return 0;  //wait until there is more data
+	} else {
+		samplesToWrite = bufferLengthSamples - read_ind;  //write up to the end of the ring
+	}
+	samplesToWrite = min(samplesToWrite, 8*min_writeSizeSamples);
+	samplesToWrite = (samplesToWrite / align) * align;  //whole sectors only
+	if (samplesToWrite == 0) return 0;
+
+	int return_val = write((byte *)(write_buffer + read_ind*nBytesPerSample), samplesToWrite * nBytesPerSample);
+	int32_t new_read_ind = read_ind + samplesToWrite;
+	if (new_read_ind >= bufferLengthSamples) new_read_ind = 0;
+	bufferReadInd = new_read_ind;
+	return return_val;
+}
+
+//write everything that is left in the buffer, even if it is not a whole sector (such as when closing the file)
+int BufferedSDWriter::writeAllBufferedData(void) {
+	int return_val = 0;
+	if (!write_buffer) return return_val;
+	if (bufferWriteInd < bufferReadInd) {  //the data wraps around the end of the ring
+		return_val += write((byte *)(write_buffer + bufferReadInd*nBytesPerSample), (bufferEndInd - bufferReadInd) * nBytesPerSample);
+		bufferReadInd = 0;
+	}
+	if (bufferWriteInd > bufferReadInd) {
+		return_val += write((byte *)(write_buffer + bufferReadInd*nBytesPerSample), (bufferWriteInd - bufferReadInd) * nBytesPerSample);
+		bufferReadInd = bufferWriteInd;
+	}
+	return return_val;
+}
+
+int BufferedSDWriter::close(void) {
+	//don't lose the last partial write.  The audio must already be stopped.
+	if (isFileOpen()) { if (flag__fileIsFLAC) { closeFLAC(); } else { writeAllBufferedData(); } }
+	flag__fileIsFLAC = false;
+	return SDWriter::close();
+}
+
+// ///////////////////////////////////////////////////////////////////// FLAC
+
+bool BufferedSDWriter::openAsFLAC(const char *fname) {
+	flag__fileIsFLAC = false;
+	flag__preallocated = false;
+	if (WAV_isFloat) {
+		Serial.println("BufferedSDWriter: openAsFLAC: *** ERROR ***: FLAC cannot hold FLOAT32 data.  Use INT16 or INT24.");
+		return false;
+	}
+
+	//set up the encoder and its buffers (these are kept for the next file)
+	if (flac == nullptr) flac = new (std::nothrow) FlacEncoder();
+	if ((flac == nullptr) || (flac->setup(WAV_nchan, (uint32_t)WAV_sampleRate_Hz, WAV_bitsPerSample, DEFAULT_FLAC_BLOCK_SIZE) != 0)) {
+		Serial.println("BufferedSDWriter: openAsFLAC: *** ERROR ***: could not set up the FLAC encoder (too many channels?).");
+		return false;
+	}
+	const uint32_t needed_out_size = flac->getMaxFrameBytes() + SDWRITER_SECTOR_BYTES;
+	if (flac_out_size < needed_out_size) {
+		delete[] flac_chan; delete[] flac_out;
+		flac_chan = new (std::nothrow) int32_t[DEFAULT_FLAC_BLOCK_SIZE];
+		flac_out = new (std::nothrow) uint8_t[needed_out_size];
+		flac_out_size = ((flac_chan != nullptr) && (flac_out != nullptr)) ? needed_out_size : 0;
+		if (flac_out_size == 0) {
+			Serial.println("BufferedSDWriter: openAsFLAC: *** ERROR ***: could not allocate the FLAC buffers.");
+			return false;
+		}
+	}
+	flac_out_len = 0;
+	if (bufferLengthBytes < 2 * DEFAULT_FLAC_BLOCK_SIZE * WAV_nchan * nBytesPerSample) {
+		Serial.println("BufferedSDWriter: openAsFLAC: *** WARNING ***: the buffer is too small to hold two FLAC frames.");
+	}
+
+	bool returnVal = open(fname);
+	if (isFileOpen()) {
+		flag__fileIsFLAC = true;
+		if (preallocate_sec > 0.0f) preallocateFile();
+
+		//the stream header is padded to one whole sector.  It gets re-written with the totals when the file is closed.
+		flac->writeStreamHeader(flac_out, SDWRITER_SECTOR_BYTES);
+		file.write(flac_out, SDWRITER_SECTOR_BYTES);
+	}
+	resetWriteTiming();
+	return returnVal;
+}
+
+float BufferedSDWriter::getCompressionRatio(void) {
+	if ((flac == nullptr) || (flac->getTotalBytes() == 0)) return 1.0f;
+	return (float)((double)(flac->getTotalSamples() * flac->getNumChannels() * nBytesPerSample) / (double)flac->getTotalBytes());
+}
+
+//Take one frame of audio from the ring (which only wraps between sample frames) and encode it into flac_out
+void BufferedSDWriter::encodeFrameFromBuffer(const int nframes) {
+	const int nchan = WAV_nchan;
+	flac->beginFrame(nframes, flac_out + flac_out_len);
+	for (int Ichan = 0; Ichan < nchan; Ichan++) {
+		int32_t ind = bufferReadInd + Ichan;
+		if (nBytesPerSample == 3) {
+			for (int i = 0; i < nframes; i++) {
+				if (ind >= bufferLengthSamples) ind -= bufferLengthSamples;
+				const uint8_t *p = write_buffer + 3*ind;
+				flac_chan[i] = ((int32_t)(((uint32_t)p[0] << 8) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 24))) >> 8;  //sign-extend the int24
+				ind += nchan;
+			}
+		} else {
+			const int16_t *buff = (const int16_t *)write_buffer;
+			for (int i = 0; i < nframes; i++) {
+				if (ind >= bufferLengthSamples) ind -= bufferLengthSamples;
+				flac_chan[i] = buff[ind];
+				ind += nchan;
+			}
+		}
+		flac->addChannel(flac_chan);
+	}
+	flac_out_len += flac->endFrame();
+
+	//release the audio back to the ring
+	int32_t new_read_ind = bufferReadInd + nframes * nchan;
+	if (new_read_ind >= bufferLengthSamples) new_read_ind -= bufferLengthSamples;
+	bufferReadInd = new_read_ind;
+}
+
+//For FLAC files.  Encode (at most) one frame, then write any whole sectors of encoded data.  Encoding one frame
+//per call keeps the time spent in each call bounded.  If flush_all, the last partial frame and sector are written, too.
+int BufferedSDWriter::writeBufferedData_flac(const bool flush_all) {
+	const int32_t nframes_avail = getNumSampsInBuffer() / WAV_nchan;
+	const int block_size = flac->getBlockSize();
+	if ((nframes_avail >= block_size) || (flush_all && (nframes_avail > 0))) encodeFrameFromBuffer(min((int32_t)block_size, nframes_avail));
+
+	uint32_t nbytes = flush_all ? flac_out_len : (flac_out_len / SDWRITER_SECTOR_BYTES) * SDWRITER_SECTOR_BYTES;
+	if (nbytes == 0) return 0;
+	int return_val = write(flac_out, nbytes);
+	flac_out_len -= nbytes;
+	if (flac_out_len > 0) memmove(flac_out, flac_out + nbytes, flac_out_len);
+	return return_val;
+}
+
+//encode and write everything that is left (the last frame can be short), then update the stream header
+void BufferedSDWriter::closeFLAC(void) {
+	if (write_buffer) { while (getNumSampsInBuffer() > 0) writeBufferedData_flac(true); }
+	if (flac_out_len > 0) { write(flac_out, flac_out_len); flac_out_len = 0; }
+
+	uint64_t fileSize = file.curPosition();
+	if (flag__preallocated) file.truncate(fileSize);  //release the unused part of the preallocation
+	flac->writeStreamHeader(flac_out, SDWRITER_SECTOR_BYTES);
+	file.seekSet(0);
+	file.write(flac_out, SDWRITER_SECTOR_BYTES);
+	file.seekSet(fileSize);
+}
+
 float32_t BufferedSDWriter::generateDitherNoise(const int &Ichan, const int &method) {
 	//see http://www.robertwannamaker.com/writings/rw_phd.pdf
 	
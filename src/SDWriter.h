@@ -25,12 +25,15 @@
 //#include "SD.h" // was using this but we should be using sdfat
 #include <SdFat.h>  //included in Teensy install as of Teensyduino 1.54-bete3
 #include <Print.h>
+#include "utility/flac_codec.h"
 
 //set some constants
 #define maxBufferLengthBytes 150000    //size of big memroy buffer to smooth out slow SD write operations
 #define SD_CONFIG SdioConfig(FIFO_SDIO)
 
 const int DEFAULT_SDWRITE_BYTES = 512; //target size for individual writes to the SD card.  Usually 512
+const int SDWRITER_SECTOR_BYTES = 512; //size of one SD sector
+const int DEFAULT_FLAC_BLOCK_SIZE = 1024; //samples per channel in each FLAC frame (when compressing)
 //const uint64_t PRE_ALLOCATE_SIZE = 40ULL << 20;// Preallocate 40MB file.  Not used.
 
 //SDWriter:  This is a class to write blocks of bytes, chars, ints or floats to
@@ -60,7 +63,7 @@ class SDWriter : public Print
 
     bool openAsWAV(const char *fname);
     bool open(const char *fname);
-    int close(void);
+    virtual int close(void);
 		bool exists(const char *fname) { return sd->exists(fname); }
 		bool remove(const char *fname) { return sd->remove(fname); }
 		
@@ -85,6 +88,21 @@ class SDWriter : public Print
     }
 
     void setPrintElapsedWriteTime(bool flag) { flagPrintElapsedWriteTime = flag; }
+
+    //Preallocated recording: if set to more than zero, openAsWAV() preallocates a contiguous file long
+    //enough for this many seconds of audio (so that the FAT does not need updating as the file grows)
+    //and pads the WAV header to a full sector so that every write of 512 bytes lands on a sector boundary.
+    //Recording past this length still works, but the extra data is no longer contiguous.
+    float setPreallocateSeconds(float sec) { return preallocate_sec = max(0.0f, sec); }
+    float getPreallocateSeconds(void) { return preallocate_sec; }
+    bool isPreallocated(void) { return flag__preallocated; }  //was the current file opened as preallocated?
+
+    //timing of the individual writes to the SD card (reset each time a file is opened)
+    uint32_t getMaxWriteMicros(void) { return write_usec_max; }  //worst-case time for one write
+    uint32_t getLastWriteMicros(void) { return write_usec_last; }
+    uint32_t getMeanWriteMicros(void) { return (n_writes > 0) ? (uint32_t)(write_usec_total / n_writes) : 0; }
+    uint32_t getNumWrites(void) { return n_writes; }
+    void resetWriteTiming(void) { write_usec_max = 0; write_usec_last = 0; write_usec_total = 0; n_writes = 0; }
     
     virtual void setSerial(Print *ptr) {  serial_ptr = ptr; }
     virtual Print* getSerial(void) { return serial_ptr;  }
@@ -95,11 +113,33 @@ class SDWriter : public Print
     float setSampleRateWAV(float sampleRate_Hz) { return WAV_sampleRate_Hz = sampleRate_Hz; }
 		float getSampleRateWAV(void) { return WAV_sampleRate_Hz; }
 
+		//data type in the WAV file: 16-bit or 24-bit (packed) integers, or 32-bit floats.  Set before opening the file.
+		virtual int setDataTypeWAV(int nbits, bool is_float = false) {
+			if ((nbits != 24) && (nbits != 32)) nbits = 16;
+			if (nbits == 32) is_float = true;  //32-bit integers are not supported, only 32-bit floats
+			WAV_isFloat = is_float && (nbits == 32);
+			return WAV_bitsPerSample = nbits;
+		}
+		int getBitsPerSampleWAV(void) { return WAV_bitsPerSample; }
+		bool isFloatWAV(void) { return WAV_isFloat; }
+		int getBytesPerSampleWAV(void) { return WAV_bitsPerSample / 8; }
+		float getBytesPerSecondWAV(void) { return WAV_sampleRate_Hz * (float)(WAV_nchan * getBytesPerSampleWAV()); } //the SD bandwidth needed
+
     //modified from Walter at https://github.com/WMXZ-EU/microSoundRecorder/blob/master/audio_logger_if.h
+    char * wavHeader(const uint32_t fsize) {  //for the current data type
+      return wavHeader(WAV_sampleRate_Hz, WAV_nchan, WAV_bitsPerSample, WAV_isFloat, fsize);
+    }
+    char* wavHeader(const float32_t sampleRate_Hz, const int nchan, const int nbits, const bool is_float, const uint32_t fileSize);
     char * wavHeaderInt16(const uint32_t fsize) {
       return wavHeaderInt16(WAV_sampleRate_Hz, WAV_nchan, fsize);
     }
-    char* wavHeaderInt16(const float32_t sampleRate_Hz, const int nchan, const uint32_t fileSize);
+    char* wavHeaderInt16(const float32_t sampleRate_Hz, const int nchan, const uint32_t fileSize) {
+      return wavHeader(sampleRate_Hz, nchan, 16, false, fileSize);
+    }
+    int getMinHeaderBytesWAV(void) { //44 for int16, or with WAVE_FORMAT_EXTENSIBLE: 68 for int24, 80 for float32 (with its "fact" chunk)
+      if (WAV_isFloat) return 80;
+      return (WAV_bitsPerSample == 16) ? 44 : 68;
+    }
     
 		SdFs * getSdPtr(void) { return sd; }
 
@@ -115,14 +155,26 @@ class SDWriter : public Print
     elapsedMicros usec;
     Print* serial_ptr = &Serial;
     bool flag__fileIsWAV = false;
-    const int WAVheader_bytes = 44;
+    int WAVheader_bytes = 44;  //becomes one full sector (512) when the file is preallocated
+    int WAV_bitsPerSample = 16;
+    bool WAV_isFloat = false;
+    float preallocate_sec = 0.0f;
+    bool flag__preallocated = false;
+    uint32_t write_usec_max = 0, write_usec_last = 0, n_writes = 0;
+    uint64_t write_usec_total = 0;
+    void preallocateFile(void);
+    void updateWriteTiming(uint32_t dt_usec) {
+      write_usec_last = dt_usec;
+      if (dt_usec > write_usec_max) write_usec_max = dt_usec;
+      write_usec_total += dt_usec;  n_writes++;
+    }
     float WAV_sampleRate_Hz = 44100.0;
     int WAV_nchan = 2;
 };
 
-//BufferedSDWriter:  This is a drived class from SDWriter.  This class assumes that
-//  you want to write Int16 data to the SD card.  You may give this class data that is
-//  either Int16 or Float32.  This class will also handle interleaving of several input
+//BufferedSDWriter:  This is a drived class from SDWriter.  This class writes Int16 data
+//  to the SD card by default, or Int24 or Float32 data (see setDataTypeWAV()).  You give
+//  this class data that is Float32.  This class will also handle interleaving of several input
 //  channels.  This class will also buffer the data until the optimal (or desired) number
 //  of samples have been accumulated, which makes the SD writing more efficient.
 //
@@ -143,9 +195,27 @@ class BufferedSDWriter : public SDWriter
     BufferedSDWriter(SdFs * _sd, Print* _serial_ptr, const int _writeSizeBytes) : SDWriter(_sd, _serial_ptr) {
       setWriteSizeBytes(_writeSizeBytes);
     };
-    ~BufferedSDWriter(void) { delete[] ptr_zeros; delete[] write_buffer; }
+    ~BufferedSDWriter(void) { delete[] ptr_zeros; delete[] write_buffer; delete flac; delete[] flac_chan; delete[] flac_out; }
 		
 		bool sync(void);
+		int close(void) override;  //writes any remaining buffered data before closing
+
+		//Lossless compression: open the file as FLAC instead of WAV (INT16 or INT24 only).  The audio is encoded
+		//in loop(), one frame per call to writeBufferedData(), and is written in whole sectors.  Preallocation
+		//(if set) reserves the uncompressed size, and the unused part is released when the file is closed.
+		bool openAsFLAC(const char *fname);
+		bool isFileFLAC(void) { return flag__fileIsFLAC; }
+		float getCompressionRatio(void);  //uncompressed size divided by the compressed size, for the current (or last) FLAC file
+
+		//changing the data type changes the bytes per sample.  The write size (in bytes) is kept.
+		int setDataTypeWAV(int nbits, bool is_float = false) override {
+			const int writeSizeBytes = getWriteSizeBytes();
+			SDWriter::setDataTypeWAV(nbits, is_float);
+			nBytesPerSample = getBytesPerSampleWAV();
+			setWriteSizeBytes(writeSizeBytes);
+			resetBuffer();
+			return WAV_bitsPerSample;
+		}
 
     //how many bytes should each write event be?  Set it here
     void setWriteSizeBytes(const int _writeSizeBytes) {
@@ -161,14 +231,14 @@ class BufferedSDWriter : public SDWriter
     //allocate the buffer for storing all the samples between write events
     int allocateBuffer(const int _nBytes = maxBufferLengthBytes) {
 			//bufferLengthSamples = max(4,min(_nBytes,maxBufferLengthBytes) / nBytesPerSample);
-			bufferLengthSamples = max(4, _nBytes / nBytesPerSample);
+			bufferLengthBytes = max(16, _nBytes);
 			if (write_buffer != 0) delete[] write_buffer;  //delete the old buffer
-      write_buffer = new (std::nothrow) int16_t[bufferLengthSamples];
+      write_buffer = new (std::nothrow) uint8_t[bufferLengthBytes];
 			resetBuffer();
       return (int)write_buffer;
     }
     void freeBuffer(void) { delete[] write_buffer; write_buffer = nullptr; resetBuffer(); }
-    void resetBuffer(void) { bufferReadInd = 0; bufferWriteInd = 0;  }
+    void resetBuffer(void);
  
     //here is how you send data to this class.  this doesn't write any data, it just stores data
     virtual void copyToWriteBuffer(float32_t *ptr_audio[], const int nsamps, const int numChan);
@@ -188,6 +258,8 @@ class BufferedSDWriter : public SDWriter
 			return getLengthOfBuffer() - bufferReadInd + bufferWriteInd;
 		}
 		int32_t getNumUnfilledSamplesInBuffer(void) { return getLengthOfBuffer() - getNumSampsInBuffer(); }  //how much of the buffer is empty, in samples
+		int32_t getMaxNumSampsInBuffer(void) { return maxSampsInBuffer; }  //most that the buffer has held since resetBuffer()
+		uint32_t getNumDroppedBlocks(void) { return numDroppedBlocks; }    //audio blocks that did not fit in the buffer (preallocated mode)
 		uint32_t getNumUnfilledSamplesInBuffer_msec(void) {
 			int32_t available_buffer_samples = getNumUnfilledSamplesInBuffer();
 			float samples_per_msec = (WAV_sampleRate_Hz*WAV_nchan) / 1000.0f;  //these data memersare in the SDWriter class
@@ -196,14 +268,49 @@ class BufferedSDWriter : public SDWriter
 	
   protected:
     int writeSizeSamples = 0;
-    int16_t* write_buffer = 0;
+    uint8_t* write_buffer = 0;  //holds int16, packed int24, or float32 samples, depending upon the data type
     int32_t bufferWriteInd = 0;
     int32_t bufferReadInd = 0;
-    const int nBytesPerSample = 2;
-    int32_t bufferLengthSamples = maxBufferLengthBytes / nBytesPerSample;
-    int32_t bufferEndInd = maxBufferLengthBytes / nBytesPerSample;
+    int nBytesPerSample = 2;
+    int32_t bufferLengthBytes = maxBufferLengthBytes;
+    int32_t bufferLengthSamples = maxBufferLengthBytes / 2;  //2 is nBytesPerSample
+    int32_t bufferEndInd = maxBufferLengthBytes / 2;
     float32_t *ptr_zeros = nullptr;
 		int ditheringMethod = 0;  //default 0 is off
+		int32_t maxSampsInBuffer = 0;
+		uint32_t numDroppedBlocks = 0;
+
+		//the fewest samples that make a whole number of sectors (256 int16, 512 int24, or 128 float32)
+		int getNumSamplesPerAlignedWrite(void) {
+			if ((nBytesPerSample % 4) == 0) return SDWRITER_SECTOR_BYTES / 4;
+			if ((nBytesPerSample % 2) == 0) return SDWRITER_SECTOR_BYTES / 2;
+			return SDWRITER_SECTOR_BYTES;
+		}
+
+		//convert and interleave the audio into the buffer (starting at sample index ind) in the current data type
+		void interleaveToBuffer(float32_t *ptr_audio[], const int start, const int nframes, const int numChan, const int32_t ind);
+
+		//for preallocated files, the buffer is a plain ring (wrapping frame-by-frame) that is written out
+		//only in whole sectors, so that every write stays aligned to the sectors of the file
+		int16_t convertToInt16(float32_t val_f32, const int Ichan) {
+			if (ditheringMethod > 0) val_f32 += generateDitherNoise(Ichan,ditheringMethod);  //add dithering, if desired
+			return (int16_t) max(-32767.0,min(32767.0,(val_f32*32767.0f))); //truncation, with saturation
+			//return (int16_t) max(-32767.0,min(32767.0,(val_f32*32767.0f + 0.5f))); //round, with saturation
+		}
+		void copyToWriteBuffer_preallocated(float32_t *ptr_audio[], const int nsamps, const int numChan);
+		int writeBufferedData_preallocated(void);
+		int writeAllBufferedData(void);
+		bool useFrameRing(void) { return flag__preallocated || flag__fileIsFLAC; }  //FLAC files use the same ring
+
+		//for FLAC files.  The encoded frames collect in flac_out until there are whole sectors to write.
+		bool flag__fileIsFLAC = false;
+		FlacEncoder *flac = nullptr;
+		int32_t *flac_chan = nullptr;  //one channel of one frame, taken from the ring
+		uint8_t *flac_out = nullptr;
+		uint32_t flac_out_len = 0, flac_out_size = 0;
+		int writeBufferedData_flac(const bool flush_all);
+		void encodeFrameFromBuffer(const int nframes);
+		void closeFLAC(void);
 };
 
 
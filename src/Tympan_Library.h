@@ -11,9 +11,11 @@
 #include "AudioCalcGainDecWDRC_F32.h"
 #include "AudioCalcLeq_F32.h"
 #include "AudioCalcLevel_F32.h"
+#include "AudioCalcSoundLevel_F32.h"
 #include "AudioConfigFIRFilter_F32.h"
 #include "AudioConfigFIRFilterBank_F32.h"
 #include "AudioConfigIIRFilterBank_F32.h"
+#include "AudioConfigFilterBankCache_F32.h"
 #include "AudioControlTester.h"
 #include "AudioConvert_F32.h"
 #include "AudioEffectCompWDRC_F32.h"
@@ -22,13 +24,16 @@
 #include "AudioEffectEmpty_F32.h"
 #include "AudioEffectFade_F32.h"
 #include "AudioEffectGain_F32.h"
+#include "AudioEffectLimiter_F32.h"
 #include "AudioEffectCompressor_F32.h"
 #include "AudioEffectDelay_F32.h"
 #include "AudioEffectFormantShift_FD_F32.h"
 #include "AudioEffectFreqShift_FD_F32.h"
 #include "AudioEffectMultiBandWDRC_F32.h"
 #include "AudioEffectPitchShift_FD_F32.h"
+#include "AudioFeedbackCancelTelemetry_F32.h"
 #include "AudioFeedbackCancelNLMS_F32.h"
+#include "AudioFeedbackCancelPBFDAF_F32.h"
 #include "AudioFeedbackCancelNFXLMS_F32.h"
 #include "AudioFilterbank_F32.h"
 #include "AudioFilterBiquad_F32.h"
@@ -39,6 +44,7 @@
 #include "AudioForwarder_F32.h"
 #include "AudioFreqDomainBase_FD_F32.h"
 #include "AudioLoopBack_F32.h"
+#include "AudioLoopBackHistory_F32.h"
 #include "AudioMixer_F32.h"
 #include "AudioMathAdd_F32.h"
 #include "AudioMathMultiply_F32.h"
@@ -47,6 +53,9 @@
 #include "AudioPlayMemory_F32.h"
 #include "AudioRateDecimator_F32.h"
 #include "AudioRateInterpolator_F32.h"
+#include "AudioRateConverter_F32.h"
+#include "AudioAsyncBridge_F32.h"
+#include "AudioRateHalfband_F32.h"
 #include "AudioSettings_F32.h"
 #include "AudioSummer_F32.h"
 #include "AudioSwitch_F32.h"
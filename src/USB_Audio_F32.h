@@ -4,6 +4,16 @@
 *	Created: Chip Audette (OpenAudio), Mar 2017
 *       Float32 wrapper for the Audio USB classes from the Teensy Audio Library
 *
+*	Modified: OpenAudio, Oct 2026
+*       The USB host and the Tympan's audio codec run from different clocks, so the audio crossing between
+*       them slowly gains or loses samples, which is heard as a click every so often.  Both classes now
+*       pass the audio through an AudioAsyncBridge_F32, which resamples it to follow the drift between the
+*       two clocks (and also lets the Tympan run at sample rates other than the USB's 44.1 kHz).  The
+*       USB side is paced by the USB frame counter (one frame per millisecond, from the host's clock), so
+*       that the Teensy's USB audio buffers are fed (or emptied) at exactly the rate the host uses them.
+*       The objects inside each class (including the core's Int16 USB objects) are kept out of the global
+*       update_all(), so that they are only updated on that pacing.
+*
 *	License: MIT License.  Use at your own risk.
 */
 
@@ -16,6 +26,37 @@
 #include "AudioStream_F32.h"
 #include <AudioStream.h>
 //include <Audio.h>
+#include "AudioAsyncBridge_F32.h"
+
+#define USB_AUDIO_F32_SAMPLE_RATE_HZ       44100.0f  //the sample rate of the Teensy's USB audio
+#define USB_AUDIO_F32_SAMPLES_PER_FRAME    (USB_AUDIO_F32_SAMPLE_RATE_HZ / 1000.0f)  //there is one USB frame per millisecond
+#define USB_AUDIO_F32_MAX_FRAME_GAP        100       //if the USB frames stall for longer than this (msec), start the bridge again
+
+//Count the USB frames (one per millisecond, timed by the host) since the last call.  The frame number is 11 bits.
+class USBFrameCounter_F32 {
+	public:
+		int getNewFrames(void) {
+			uint16_t frame = ((((uint16_t)USB0_FRMNUMH) & 0x07) << 8) | ((uint16_t)USB0_FRMNUML);
+			if (!is_started) { is_started = true; last_frame = frame; return 0; }
+			int n = (frame - last_frame) & 0x07FF;
+			last_frame = frame;
+			return n;
+		}
+	protected:
+		bool is_started = false;
+		uint16_t last_frame = 0;
+};
+
+//The Int16 USB classes from the Teensy core, with a way to take them out of the global update_all().  The AudioConnections
+//inside the F32 classes below mark them as active, but they must only be updated by those classes, on the host's clock.
+class AudioInputUSB_I16 : public AudioInputUSB {
+	public:
+		bool setActive(bool _active) { return active = _active; }
+};
+class AudioOutputUSB_I16 : public AudioOutputUSB {
+	public:
+		bool setActive(bool _active) { return active = _active; }
+};
 
 
 class AudioInputUSB_F32 : public AudioStream_F32
@@ -24,16 +65,14 @@ class AudioInputUSB_F32 : public AudioStream_F32
 //GUI: shortName:usbAudioIn  //this line used for automatic generation of GUI node
 public:
 	AudioInputUSB_F32() : AudioStream_F32(0, NULL) {
-		//i16_to_f32.disconnectFromUpdateAll(); //requires modification to AudioStream.h
-		//output_queue.disconnectFromUpdateAll(); //requires modification to AudioStream.h
-		
 		makeConnections();
+		beginBridge();
 	}
 	AudioInputUSB_F32(const AudioSettings_F32 &settings) : AudioStream_F32(0, NULL) {
-		//i16_to_f32.disconnectFromUpdateAll(); //requires modification to AudioStream.h
-		//output_queue.disconnectFromUpdateAll(); //requires modification to AudioStream.h
-		
+		sample_rate_Hz = settings.sample_rate_Hz;
+		audio_block_samples = settings.audio_block_samples;
 		makeConnections();
+		beginBridge();
 	}
 	
 	void makeConnections(void) {
@@ -42,12 +81,29 @@ public:
     	patchCord100_R = new AudioConnection(usb_in, 1, i16_to_f32_R, 0);  //usb_in is an Int16 audio object.  So, convert it!
     	patchCord101_L = new AudioConnection_F32(i16_to_f32_L, 0, output_queue_L, 0);
 		patchCord101_R = new AudioConnection_F32(i16_to_f32_R, 0, output_queue_R, 0);
+
+		//the connections made these active, but update() here is what updates them (when the USB frames say so), not update_all()
+		usb_in.setActive(false);
+		i16_to_f32_L.setActive(false); i16_to_f32_R.setActive(false);
+		output_queue_L.setActive(false); output_queue_R.setActive(false);
 	}
 	
+	//the bridge goes from the USB's sample rate to the Tympan's.  Keep enough in it to cover a USB block and a Tympan block.
+	bool beginBridge(void) {
+		int target_fill = AUDIO_BLOCK_SAMPLES + (int)(audio_block_samples * USB_AUDIO_F32_SAMPLE_RATE_HZ / sample_rate_Hz + 0.5f);
+		return bridge.begin(USB_AUDIO_F32_SAMPLE_RATE_HZ, sample_rate_Hz, 2, target_fill);
+	}
+
+	//telemetry.  The drift is how much faster the USB host's clock runs than the Tympan's, in ppm
+	float getDriftPPM(void) { return bridge.getDriftPPM(); }
+	unsigned long getNumUnderruns(void) { return bridge.getNumUnderruns(); }
+	unsigned long getNumOverruns(void) { return bridge.getNumOverruns(); }
+
 	//define audio processing blocks.
-    AudioInputUSB  	usb_in;  //from the original Teensy Audio Library, expects Int16 audio data
+    AudioInputUSB_I16  	usb_in;  //from the original Teensy Audio Library, expects Int16 audio data
     AudioConvert_I16toF32   i16_to_f32_L, i16_to_f32_R; 
     AudioRecordQueue_F32    output_queue_L,output_queue_R;    
+	AudioAsyncBridge_F32    bridge;  //from the USB's clock to the Tympan's clock
 	
 	//define the audio connections
     AudioConnection     *patchCord100_L, *patchCord100_R;
@@ -55,33 +111,59 @@ public:
 	
     void update(void) {
 		//Serial.println("AudioSynthNoiseWhite_F32: update().");
-		output_queue_L.begin();
-		output_queue_R.begin();
 		
-		//manually update audio blocks in the desired order
-		usb_in.update();  //the output should be routed directly via the AudioConnection
-		i16_to_f32_L.update();  // output is routed via the AudioConnection
-		i16_to_f32_R.update();  // output is routed via the AudioConnection
-		output_queue_L.update();
-		output_queue_R.update();
-
-		//handle the output for the left channel
-		audio_block_f32_t  *block;
-		block = output_queue_L.getAudioBlock();
-		if (block == NULL) return;
-		AudioStream_F32::transmit(block,0);
-		output_queue_L.freeAudioBlock();
-		output_queue_L.end();
+		//The USB side runs on the host's clock, which sends 44.1 samples per USB frame.  Each time that
+		//the host has sent another block's worth, take a block from the USB input and put it in the bridge.
+		int n_frames = usb_frames.getNewFrames();
+		if (n_frames > USB_AUDIO_F32_MAX_FRAME_GAP) { bridge.reset(); usb_samples_due = 0.0f; n_frames = 0; }  //the USB had stalled
+		usb_samples_due += n_frames * USB_AUDIO_F32_SAMPLES_PER_FRAME;
+		while (usb_samples_due >= AUDIO_BLOCK_SAMPLES) {
+			usb_samples_due -= AUDIO_BLOCK_SAMPLES;
+			output_queue_L.begin();
+			output_queue_R.begin();
+
+			//manually update audio blocks in the desired order
+			usb_in.update();  //the output should be routed directly via the AudioConnection
+			i16_to_f32_L.update();  // output is routed via the AudioConnection
+			i16_to_f32_R.update();  // output is routed via the AudioConnection
+			output_queue_L.update();
+			output_queue_R.update();
 		
-		//handle the output for the left channel
-		block = output_queue_R.getAudioBlock();
-		if (block == NULL) return;
-		AudioStream_F32::transmit(block,1);
-		output_queue_R.freeAudioBlock();
-		output_queue_R.end();
+			//put the audio into the bridge (using the left channel twice if there is no right channel)
+			audio_block_f32_t *block_L = output_queue_L.getAudioBlock();
+			audio_block_f32_t *block_R = output_queue_R.getAudioBlock();
+			if (block_L != NULL) {
+				float32_t *in[2] = {block_L->data, (block_R != NULL) ? block_R->data : block_L->data};
+				bridge.write(in, block_L->length);
+			}
+			if (block_L != NULL) output_queue_L.freeAudioBlock();
+			if (block_R != NULL) output_queue_R.freeAudioBlock();
+			output_queue_L.end();
+			output_queue_R.end();
+		}
+
+		//The Tympan side runs on the codec's clock.  Take one block of audio (at the Tympan's sample rate) from the
+		//bridge.  The host has already sent usb_samples_due samples that are not yet in the bridge, so tell it.
+		audio_block_f32_t *out_L = AudioStream_F32::allocate_f32();
+		if (out_L == NULL) return;
+		audio_block_f32_t *out_R = AudioStream_F32::allocate_f32();
+		if (out_R == NULL) { AudioStream_F32::release(out_L); return; }
+		float32_t *out[2] = {out_L->data, out_R->data};
+		bridge.read(out, audio_block_samples, usb_samples_due);
+		out_L->length = out_R->length = audio_block_samples;
+		out_L->fs_Hz = out_R->fs_Hz = sample_rate_Hz;
+		out_L->id = out_R->id = block_counter++;
+		AudioStream_F32::transmit(out_L,0);
+		AudioStream_F32::transmit(out_R,1);
+		AudioStream_F32::release(out_L);
+		AudioStream_F32::release(out_R);
     }
 private:    
-
+	float sample_rate_Hz = AUDIO_SAMPLE_RATE;
+	int audio_block_samples = AUDIO_BLOCK_SAMPLES;
+	USBFrameCounter_F32 usb_frames;
+	float usb_samples_due = 0.0f;  //samples sent by the host that have not yet been taken from the USB input
+	unsigned long block_counter = 0;
 };
 
 class AudioOutputUSB_F32 : public AudioStream_F32
@@ -91,10 +173,14 @@ class AudioOutputUSB_F32 : public AudioStream_F32
 public:
 	AudioOutputUSB_F32() : AudioStream_F32(2, inputQueueArray_f32) {
 		makeConnections();
+		beginBridge();
 	}
 	
 	AudioOutputUSB_F32(const AudioSettings_F32 &settings) : AudioStream_F32(2, inputQueueArray_f32) {
+		sample_rate_Hz = settings.sample_rate_Hz;
+		audio_block_samples = settings.audio_block_samples;
 		makeConnections();
+		beginBridge();
 	}
 	
 	void makeConnections(void) {
@@ -103,12 +189,29 @@ public:
     	patchCord100_R = new AudioConnection_F32(queue_R, 0, f32_to_i16_R, 0);  //noise is an Int16 audio object.  So, convert it!
     	patchCord101_L = new AudioConnection(f32_to_i16_L, 0, usb_out, 0); //Int16 audio connection
 		patchCord101_R = new AudioConnection(f32_to_i16_R, 0, usb_out, 1); //Int16 audio connection
+
+		//the connections made these active, but update() here is what updates them (when the USB frames say so), not update_all()
+		queue_L.setActive(false); queue_R.setActive(false);
+		f32_to_i16_L.setActive(false); f32_to_i16_R.setActive(false);
+		usb_out.setActive(false);
 	}
 	
+	//the bridge goes from the Tympan's sample rate to the USB's.  Keep enough in it to cover a Tympan block and a USB block.
+	bool beginBridge(void) {
+		int target_fill = audio_block_samples + (int)(AUDIO_BLOCK_SAMPLES * sample_rate_Hz / USB_AUDIO_F32_SAMPLE_RATE_HZ + 0.5f);
+		return bridge.begin(sample_rate_Hz, USB_AUDIO_F32_SAMPLE_RATE_HZ, 2, target_fill);
+	}
+
+	//telemetry.  The drift is how much faster the Tympan's clock runs than the USB host's, in ppm
+	float getDriftPPM(void) { return bridge.getDriftPPM(); }
+	unsigned long getNumUnderruns(void) { return bridge.getNumUnderruns(); }
+	unsigned long getNumOverruns(void) { return bridge.getNumOverruns(); }
+
 	//define audio processing blocks.
     AudioPlayQueue_F32    queue_L,queue_R;    
 	AudioConvert_F32toI16   f32_to_i16_L, f32_to_i16_R; 
-    AudioOutputUSB  	    usb_out; //from the original Teensy Audio Library, expects Int16 audio data
+    AudioOutputUSB_I16  	    usb_out; //from the original Teensy Audio Library, expects Int16 audio data
+	AudioAsyncBridge_F32    bridge;  //from the Tympan's clock to the USB's clock
     
 	//define the audio connections
     AudioConnection_F32     *patchCord100_L, *patchCord100_R;
@@ -119,35 +222,61 @@ public:
 		//queue_L.begin();
 		//queue_R.begin();
 		
-		//is there audio waiting for us for the left channel?
-		audio_block_f32_t *block;
-		block = receiveReadOnly_f32(0); 
-		if (!block) return; //if no audio, return now.
+		//The Tympan side runs on the codec's clock.  Put this block of audio into the bridge.  If there is no
+		//right channel, it is sent as silence.
+		audio_block_f32_t *block_L = receiveReadOnly_f32(0);
+		audio_block_f32_t *block_R = receiveReadOnly_f32(1);
+		if (block_L != NULL) {
+			float32_t *in[2] = {block_L->data, (block_R != NULL) ? block_R->data : zeros};
+			if (block_R == NULL) memset(zeros, 0, block_L->length*sizeof(float32_t));
+			bridge.write(in, block_L->length);
+		}
+		if (block_L != NULL) AudioStream_F32::release(block_L);
+		if (block_R != NULL) AudioStream_F32::release(block_R);
 		
-		//there is some audio, so execute the processing chain for the left channel
-		queue_L.playAudioBlock(block);
-		AudioStream_F32::release(block);
-		queue_L.update();
-		f32_to_i16_L.update();
+		//The USB side runs on the host's clock, which takes 44.1 samples per USB frame.  Each time that
+		//the host has used up another block's worth, give the USB output a new block from the bridge.
+		int n_frames = usb_frames.getNewFrames();
+		if (n_frames > USB_AUDIO_F32_MAX_FRAME_GAP) { bridge.reset(); usb_samples_due = 0.0f; n_frames = 0; }  //the USB had stalled
+		usb_samples_due += n_frames * USB_AUDIO_F32_SAMPLES_PER_FRAME;
+		while (usb_samples_due >= AUDIO_BLOCK_SAMPLES) {
+			audio_block_f32_t *out_L = AudioStream_F32::allocate_f32();
+			if (out_L == NULL) return;  //try again next time, still owing this block
+			audio_block_f32_t *out_R = AudioStream_F32::allocate_f32();
+			if (out_R == NULL) { AudioStream_F32::release(out_L); return; }
+			usb_samples_due -= AUDIO_BLOCK_SAMPLES;
 		
-		//see if there is a right channel
-		block = receiveReadOnly_f32(1); 
-		if (block) {
-			//there is a right channel.  process it now
-			queue_R.playAudioBlock(block);
-			AudioStream_F32::release(block);
+			//the host has already used up usb_samples_due samples that it has not yet been given (at the USB's
+			//rate), so tell the bridge (at the Tympan's rate)
+			float32_t *out[2] = {out_L->data, out_R->data};
+			bridge.read(out, AUDIO_BLOCK_SAMPLES, -usb_samples_due * sample_rate_Hz / USB_AUDIO_F32_SAMPLE_RATE_HZ);
+			out_L->length = out_R->length = AUDIO_BLOCK_SAMPLES;
+			out_L->fs_Hz = out_R->fs_Hz = USB_AUDIO_F32_SAMPLE_RATE_HZ;
+
+			//execute the processing chain for each channel
+			queue_L.playAudioBlock(out_L);
+			AudioStream_F32::release(out_L);
+			queue_L.update();
+			f32_to_i16_L.update();
+			queue_R.playAudioBlock(out_R);
+			AudioStream_F32::release(out_R);
 			queue_R.update();
 			f32_to_i16_R.update();
+
+			//update the usb_out
+			usb_out.update();
 		}
-		
-		//whether or not there was right-channel audio, update the usb_out
-		usb_out.update();
 		return;
     }
 private:    
 	audio_block_f32_t *inputQueueArray_f32[2];
+	float sample_rate_Hz = AUDIO_SAMPLE_RATE;
+	int audio_block_samples = AUDIO_BLOCK_SAMPLES;
+	USBFrameCounter_F32 usb_frames;
+	float usb_samples_due = 0.0f;  //samples used up by the host that have not yet been given to the USB output
+	float32_t zeros[MAX_AUDIO_BLOCK_SAMPLES_F32];
 };
 
 #endif
 
-#endif
\ No newline at end of file
+#endif
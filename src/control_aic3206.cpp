@@ -244,12 +244,37 @@ bool AudioControlAIC3206::enable(void) {
 
   aic_readPage(0, 27); // check a specific register - a register read test
 
+  is_enabled = true;
   if (debugToSerial) Serial.println("AIC3206 enable done");
 
   return true;
 
 }
 
+//Set the length of the audio words that the AIC sends and receives within each (32-bit) I2S slot.
+//The default is 16 bits.  To get the AIC's full resolution, set 32 bits and start the I2S classes with
+//begin(true) so that the Tympan moves whole 32-bit slots.  Can be called before or after enable().
+int AudioControlAIC3206::setI2SWordLength(int bits) {
+  if ((bits != 16) && (bits != 20) && (bits != 24) && (bits != 32)) {
+    Serial.print("AudioControlAIC3206: setI2SWordLength: *** WARNING ***: cannot do "); Serial.print(bits);
+    Serial.println(" bits.  Must be 16, 20, 24, or 32.");
+    return i2s_word_bits;
+  }
+  i2s_word_bits = bits;
+  if (is_enabled) aic_writePage(0, 27, 0x01 | AIC_CLK_DIR | i2sWordLengthCode(i2s_word_bits)); //Page 0, 0x1B
+  return i2s_word_bits;
+}
+
+uint8_t AudioControlAIC3206::i2sWordLengthCode(int bits) {
+  //Page 0, Register 27, bits D5-D4: 00 = 16 bits, 01 = 20 bits, 10 = 24 bits, 11 = 32 bits
+  switch (bits) {
+    case 20: return 0x10;
+    case 24: return 0x20;
+    case 32: return 0x30;
+  }
+  return 0x00;
+}
+
 bool AudioControlAIC3206::disable(void) {
   return true;
 }
@@ -873,7 +898,7 @@ void AudioControlAIC3206::aic_init() {
 
   // !!!!!!!!! The below writes are from WHF/CHA - probably don't need?
   // aic_writePage(1, 1, 10); // 10 = 0b00001010 // weakly connect AVDD to DVDD.  Activate charge pump
- aic_writePage(0, 27, 0x01 | AIC_CLK_DIR | (AIC_BITS == 32 ? 0x30 : 0)); //Page 0, 0x1B
+ aic_writePage(0, 27, 0x01 | AIC_CLK_DIR | i2sWordLengthCode(i2s_word_bits)); //Page 0, 0x1B
   // aic_writePage(0, 28, 0); // 0x1C
 }
 
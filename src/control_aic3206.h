@@ -118,6 +118,8 @@ public:
 	void muteLineOut(bool state);
 	bool enableDigitalMicInputs(void) { return enableDigitalMicInputs(true); }
 	bool enableDigitalMicInputs(bool desired_state);
+	int setI2SWordLength(int bits);  //16 (default), 20, 24, or 32.  Use 32 with the 32-bit I2S transfers (ie, begin(true) on the I2S classes, built with I2S_F32_ENABLE_32BIT_TRANSFERS)
+	int getI2SWordLength(void) { return i2s_word_bits; }
 
 protected:
   TwoWire *myWire = &Wire;  //from Wire.h
@@ -145,6 +147,9 @@ protected:
   void convertCoeff_f32_to_i32(float *coeff_f32, int32_t *coeff_i32, int ncoeff);
 
   bool outputSelect_firstTime = true;
+  int i2s_word_bits = 16;
+  bool is_enabled = false;
+  uint8_t i2sWordLengthCode(int bits);
 
 };
 
@@ -64,17 +64,19 @@ public:
 		audio_block_samples = MAX_AUDIO_BLOCK_SAMPLES_F32; //use the default size
 		begin(); 
 	} //uses default AUDIO_SAMPLE_RATE and BLOCK_SIZE_SAMPLES from AudioStream.h
-	AudioInputI2S_F32(const AudioSettings_F32 &settings) { 
+	AudioInputI2S_F32(const AudioSettings_F32 &settings) : AudioInputI2S_F32(settings, true) {}
+	AudioInputI2S_F32(const AudioSettings_F32 &settings, bool flag_callBegin) { 
 		//Serial.println("AudioInputI2S_F32: constructor 2...");
 		sample_rate_Hz = settings.sample_rate_Hz;
 		audio_block_samples = settings.audio_block_samples;
-		begin(); 
+		if (flag_callBegin) begin(); 
 	}
- 	AudioInputI2S_F32(const AudioSettings_F32 &settings, uint32_t *rx_buff) { 
+ 	AudioInputI2S_F32(const AudioSettings_F32 &settings, uint32_t *rx_buff) : AudioInputI2S_F32(settings, rx_buff, true) {}
+ 	AudioInputI2S_F32(const AudioSettings_F32 &settings, uint32_t *rx_buff, bool flag_callBegin) { 
 		sample_rate_Hz = settings.sample_rate_Hz;
 		audio_block_samples = settings.audio_block_samples;
 		i2s_rx_buffer = rx_buff;
-		begin(); 
+		if (flag_callBegin) begin(); 
 	} 	
 	
 	virtual void update(void);
@@ -82,14 +84,16 @@ public:
 	static void scale_i24_to_f32( float32_t *p_i24, float32_t *p_f32, int len) ;
 	static void scale_i32_to_f32( float32_t *p_i32, float32_t *p_f32, int len);
 	void begin(void);
-	void begin(bool);
+	void begin(bool);  //true for 32-bit DMA transfers (24-bit audio; needs the build flag I2S_F32_ENABLE_32BIT_TRANSFERS or a user-supplied buffer).  Construct with flag_callBegin = false, then call this.
 	void sub_begin_i32(void);
-	//void sub_begin_i16(void);
-	static uint32_t *i2s_rx_buffer; 
+	void sub_begin_i16(void);
+	static bool get_isTransferUsing32bit(void) { return transfer_32bit; }
+	static uint32_t *i2s_rx_buffer;  //for 32-bit transfers, any user-supplied buffer must be 2*audio_block_samples long
 	//friend class AudioOutputI2S_F32;
 protected:	
 	AudioInputI2S_F32(int dummy) {} // to be used only inside AudioInputI2Sslave !!
 	static bool update_responsibility;
+	static bool transfer_32bit;
 	static DMAChannel dma;
 	static void isr_32(void);
 	static void isr(void);
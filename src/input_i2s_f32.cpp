@@ -34,17 +34,19 @@
 #include "input_i2s_F32.h"
 #include "output_i2s_F32.h"
 #include <arm_math.h>
+#include "utility/i2s_convert_f32.h"  //for de-interleaving and scaling straight out of the DMA buffer
 
 
 //DMAMEM __attribute__((aligned(32))) static uint32_t i2s_rx_buffer[MAX_AUDIO_BLOCK_SAMPLES_F32]; //good for 16-bit audio samples coming in from teh AIC.  32-bit transfers will need this to be bigger.
 //DMAMEM __attribute__((aligned(32)))
 //static uint32_t i2s_rx_buffer[MAX_AUDIO_BLOCK_SAMPLES_F32]; //good for 16-bit audio samples coming in from teh AIC.  32-bit transfers will need this to be bigger.
-uint32_t i2s_default_rx_buffer[MAX_AUDIO_BLOCK_SAMPLES_F32];
+uint32_t i2s_default_rx_buffer[I2S_F32_DMA_BUFFER_SCALE*MAX_AUDIO_BLOCK_SAMPLES_F32];  //only big enough for 32-bit transfers if I2S_F32_ENABLE_32BIT_TRANSFERS
 uint32_t * AudioInputI2S_F32::i2s_rx_buffer = i2s_default_rx_buffer;
 audio_block_f32_t * AudioInputI2S_F32::block_left_f32 = NULL;
 audio_block_f32_t * AudioInputI2S_F32::block_right_f32 = NULL;
 uint16_t AudioInputI2S_F32::block_offset = 0;
 bool AudioInputI2S_F32::update_responsibility = false;
+bool AudioInputI2S_F32::transfer_32bit = false;
 DMAChannel AudioInputI2S_F32::dma(false);
 
 int AudioInputI2SBase_F32::flag_out_of_memory = 0;
@@ -54,11 +56,8 @@ float AudioInputI2SBase_F32::sample_rate_Hz = AUDIO_SAMPLE_RATE;
 int AudioInputI2SBase_F32::audio_block_samples = MAX_AUDIO_BLOCK_SAMPLES_F32; //set to default, gets set again later during initialization
 
 
-//#for 16-bit transfers
-#define I2S_BUFFER_TO_USE_BYTES (AudioOutputI2S_F32::audio_block_samples*sizeof(i2s_rx_buffer[0]))
-
-//#for 32-bit transfers
-//#define I2S_BUFFER_TO_USE_BYTES (AudioOutputI2S_F32::audio_block_samples*2*sizeof(i2s_rx_buffer[0]))
+//for 16-bit transfers, both channels are packed into one 32-bit word per frame.  For 32-bit transfers, it is one word per channel.
+#define I2S_BUFFER_TO_USE_BYTES (AudioOutputI2S_F32::audio_block_samples*(AudioInputI2S_F32::transfer_32bit ? 2 : 1)*sizeof(i2s_rx_buffer[0]))
 	
 
 void AudioInputI2S_F32::begin(void) {
@@ -66,11 +65,17 @@ void AudioInputI2S_F32::begin(void) {
 	begin(transferUsing32bit);
 }
 
+//See AudioOutputI2S_F32::begin(bool) for what the 32-bit transfers mean
 void AudioInputI2S_F32::begin(bool transferUsing32bit) {
 	dma.begin(true); // Allocate the DMA channel first
 
 	AudioOutputI2S_F32::sample_rate_Hz = sample_rate_Hz; //these were given in the AudioSettings in the contructor
 	AudioOutputI2S_F32::audio_block_samples = audio_block_samples;//these were given in the AudioSettings in the contructor
+	if (transferUsing32bit && !I2S_F32_ENABLE_32BIT_TRANSFERS && (i2s_rx_buffer == i2s_default_rx_buffer)) {
+		Serial.println("AudioInputI2S_F32: begin: *** WARNING ***: 32-bit transfers need I2S_F32_ENABLE_32BIT_TRANSFERS (or a user-supplied buffer).  Using 16-bit.");
+		transferUsing32bit = false;
+	}
+	transfer_32bit = transferUsing32bit;
 	
 	//block_left_1st = NULL;
 	//block_right_1st = NULL;
@@ -80,20 +85,7 @@ void AudioInputI2S_F32::begin(bool transferUsing32bit) {
 
 #if defined(KINETISK)
 	CORE_PIN13_CONFIG = PORT_PCR_MUX(4); // pin 13, PTC5, I2S0_RXD0
-	dma.TCD->SADDR = (void *)((uint32_t)&I2S0_RDR0 + 2);  //From Teensy Audio Library...but why "+ 2"  (Chip 2020-10-31)
-	dma.TCD->SOFF = 0;
-	dma.TCD->ATTR = DMA_TCD_ATTR_SSIZE(1) | DMA_TCD_ATTR_DSIZE(1);
-	dma.TCD->NBYTES_MLNO = 2;
-	dma.TCD->SLAST = 0;
-	dma.TCD->DADDR = i2s_rx_buffer;
-	dma.TCD->DOFF = 2;
-	//dma.TCD->CITER_ELINKNO = sizeof(i2s_rx_buffer) / 2;  //original from Teensy Audio Library
-	dma.TCD->CITER_ELINKNO = I2S_BUFFER_TO_USE_BYTES / 2;
-	//dma.TCD->DLASTSGA = -sizeof(i2s_rx_buffer);  //original from Teensy Audio Library
-	dma.TCD->DLASTSGA = -I2S_BUFFER_TO_USE_BYTES;
-	//dma.TCD->BITER_ELINKNO = sizeof(i2s_rx_buffer) / 2;  //original from Teensy Audio Library
-	dma.TCD->BITER_ELINKNO = I2S_BUFFER_TO_USE_BYTES / 2;
-	dma.TCD->CSR = DMA_TCD_CSR_INTHALF | DMA_TCD_CSR_INTMAJOR;
+	if (transfer_32bit) { sub_begin_i32(); } else { sub_begin_i16(); }
 	dma.triggerAtHardwareEvent(DMAMUX_SOURCE_I2S0_RX);
 
 	I2S0_RCSR |= I2S_RCSR_RE | I2S_RCSR_BCE | I2S_RCSR_FRDE | I2S_RCSR_FR;
@@ -103,20 +95,7 @@ void AudioInputI2S_F32::begin(bool transferUsing32bit) {
 	CORE_PIN8_CONFIG  = 3;  //1:RX_DATA0
 	IOMUXC_SAI1_RX_DATA0_SELECT_INPUT = 2;
 	
-	dma.TCD->SADDR = (void *)((uint32_t)&I2S1_RDR0 + 2);
-	dma.TCD->SOFF = 0;
-	dma.TCD->ATTR = DMA_TCD_ATTR_SSIZE(1) | DMA_TCD_ATTR_DSIZE(1);
-	dma.TCD->NBYTES_MLNO = 2;
-	dma.TCD->SLAST = 0;
-	dma.TCD->DADDR = i2s_rx_buffer;
-	dma.TCD->DOFF = 2;
-	//dma.TCD->CITER_ELINKNO = sizeof(i2s_rx_buffer) / 2; //original from Teensy Audio Library
-	dma.TCD->CITER_ELINKNO = I2S_BUFFER_TO_USE_BYTES / 2;
-	//dma.TCD->DLASTSGA = -sizeof(i2s_rx_buffer); //original from Teensy Audio Library
-	dma.TCD->DLASTSGA = -I2S_BUFFER_TO_USE_BYTES;
-	//dma.TCD->BITER_ELINKNO = sizeof(i2s_rx_buffer) / 2; //original from Teensy Audio Library
-	dma.TCD->BITER_ELINKNO = I2S_BUFFER_TO_USE_BYTES / 2;
-	dma.TCD->CSR = DMA_TCD_CSR_INTHALF | DMA_TCD_CSR_INTMAJOR;
+	if (transfer_32bit) { sub_begin_i32(); } else { sub_begin_i16(); }
 	dma.triggerAtHardwareEvent(DMAMUX_SOURCE_SAI1_RX);
 
 	I2S1_RCSR = I2S_RCSR_RE | I2S_RCSR_BCE | I2S_RCSR_FRDE | I2S_RCSR_FR;
@@ -128,94 +107,52 @@ void AudioInputI2S_F32::begin(bool transferUsing32bit) {
 	update_counter = 0;
 }
 
-/* void AudioInputI2S_F32::begin(bool transferUsing32bit) {
-	dma.begin(true); // Allocate the DMA channel first
-	
-	AudioOutputI2S_F32::sample_rate_Hz = sample_rate_Hz; //these were given in the AudioSettings in the contructor
-	AudioOutputI2S_F32::audio_block_samples = audio_block_samples;//these were given in the AudioSettings in the contructor
-	
-	//setup I2S parameters
-	AudioOutputI2S_F32::config_i2s(transferUsing32bit);
-		
-	// TODO: should we set & clear the I2S_RCSR_SR bit here?
-	CORE_PIN13_CONFIG = PORT_PCR_MUX(4); // pin 13, PTC5, I2S0_RXD0
-	
-	// setup DMA parameters
-	//if (transferUsing32bit) {
-		sub_begin_i32();
-	//} else {
-	//	sub_begin_i16();
-	//}
-	
-	// finish DMA setup
-	dma.triggerAtHardwareEvent(DMAMUX_SOURCE_I2S0_RX);
-	update_responsibility = update_setup();
-	dma.enable();
-
-	// finish I2S parameters
-	I2S0_RCSR |= I2S_RCSR_RE | I2S_RCSR_BCE | I2S_RCSR_FRDE | I2S_RCSR_FR;
-	I2S0_TCSR |= I2S_TCSR_TE | I2S_TCSR_BCE; // TX clock enable, because sync'd to TX
-	
-	//if (transferUsing32bit) {
-		dma.attachInterrupt(isr_32);
-	//} else {
-	//	dma.attachInterrupt(isr_16);
-	//}
-	
-	update_counter = 0;
-} */
-
-/* void AudioInputI2S_F32::sub_begin_i16(void)
+//DMA setup for 16-bit transfers: two bytes at a time, from the upper half of the receive data register
+void AudioInputI2S_F32::sub_begin_i16(void)
 {
-
-	dma.TCD->SADDR = &I2S0_RDR0;
+#if defined(KINETISK) || defined(__IMXRT1062__)
+	#if defined(KINETISK)
+	dma.TCD->SADDR = (void *)((uint32_t)&I2S0_RDR0 + 2);  //From Teensy Audio Library...but why "+ 2"  (Chip 2020-10-31)
+	#else
+	dma.TCD->SADDR = (void *)((uint32_t)&I2S1_RDR0 + 2);
+	#endif
 	dma.TCD->SOFF = 0;
 	dma.TCD->ATTR = DMA_TCD_ATTR_SSIZE(1) | DMA_TCD_ATTR_DSIZE(1);
 	dma.TCD->NBYTES_MLNO = 2;
 	dma.TCD->SLAST = 0;
 	dma.TCD->DADDR = i2s_rx_buffer;
 	dma.TCD->DOFF = 2;
-	
-	//dma.TCD->CITER_ELINKNO = sizeof(i2s_tx_buffer) / 2;	//original
+	//dma.TCD->CITER_ELINKNO = sizeof(i2s_rx_buffer) / 2;  //original from Teensy Audio Library
 	dma.TCD->CITER_ELINKNO = I2S_BUFFER_TO_USE_BYTES / 2;
-	//dma.TCD->DLASTSGA = -sizeof(i2s_rx_buffer); //original
+	//dma.TCD->DLASTSGA = -sizeof(i2s_rx_buffer);  //original from Teensy Audio Library
 	dma.TCD->DLASTSGA = -I2S_BUFFER_TO_USE_BYTES;
-	//dma.TCD->BITER_ELINKNO = sizeof(i2s_rx_buffer) / 2;	//original
+	//dma.TCD->BITER_ELINKNO = sizeof(i2s_rx_buffer) / 2;  //original from Teensy Audio Library
 	dma.TCD->BITER_ELINKNO = I2S_BUFFER_TO_USE_BYTES / 2;
-	
 	dma.TCD->CSR = DMA_TCD_CSR_INTHALF | DMA_TCD_CSR_INTMAJOR;
-}; */
+#endif
+}
 
-/* void AudioInputI2S_F32::sub_begin_i32(void)
+//DMA setup for 32-bit transfers: one whole slot (left or right) at a time, from the whole receive data register
+void AudioInputI2S_F32::sub_begin_i32(void)
 {
-
-	//let's assume that we'll transfer one sample (left or right) each call.  So, it'll transfer 4 bytes (32-bits)
-	dma.TCD->SADDR = (void *)((uint32_t)&I2S0_RDR0);
+#if defined(KINETISK) || defined(__IMXRT1062__)
+	#if defined(KINETISK)
+	dma.TCD->SADDR = &I2S0_RDR0;
+	#else
+	dma.TCD->SADDR = &I2S1_RDR0;
+	#endif
 	dma.TCD->SOFF = 0;  //do not increment the source memory pointer
-	dma.TCD->ATTR = DMA_TCD_ATTR_SSIZE(DMA_TCD_ATTR_SIZE_32BIT) | DMA_TCD_ATTR_DSIZE(DMA_TCD_ATTR_SIZE_32BIT);
-	dma.TCD->NBYTES_MLNO = 4;  //one sample (32bits = 4bytes).  should be 4 or 8?  https://forum.pjrc.com/threads/42233-I2S-Input-Question
+	dma.TCD->ATTR = DMA_TCD_ATTR_SSIZE(2) | DMA_TCD_ATTR_DSIZE(2);  //each read and write is 32 bits
+	dma.TCD->NBYTES_MLNO = 4;  //one slot (left or right) per minor loop
 	dma.TCD->SLAST = 0;
 	dma.TCD->DADDR = i2s_rx_buffer;
 	dma.TCD->DOFF = 4;  //increment one sample (32bits = 4bytes) in the destination memory
-	
-	//dma.TCD->CITER_ELINKNO = sizeof(i2s_tx_buffer) / 2;	//original, 16-bit 
-	//dma.TCD->CITER_ELINKNO = I2S_BUFFER_TO_USE_BYTES / 2;   //revised WEA 16-bit
-	//dma.TCD->CITER_ELINKNO = sizeof(i2s_rx_buffer_32) / 4;  //original, 32-bit
-	dma.TCD->CITER_ELINKNO = I2S_BUFFER_TO_USE_BYTES / 4;   //number of minor loops in a major loop.  I2S_BUFFER_TO_USE_BYTES/NBYTES_MLNO? ...should be 4 or 8?  https://forum.pjrc.com/threads/42233-I2S-Input-Question
-	
-	//dma.TCD->DLASTSGA = -sizeof(i2s_rx_buffer); //original, 16-bit 
-	//dma.TCD->DLASTSGA = -I2S_BUFFER_TO_USE_BYTES;//revised WEA 16-bit
-	//dma.TCD->DLASTSGA = -sizeof(i2s_rx_buffer_32);//original, 32-bit
-	dma.TCD->DLASTSGA = -I2S_BUFFER_TO_USE_BYTES;//revised WEA 32-bit
-	
-	//dma.TCD->BITER_ELINKNO = sizeof(i2s_rx_buffer) / 2;	//original, 16-bit 
-	//dma.TCD->BITER_ELINKNO = I2S_BUFFER_TO_USE_BYTES / 2;//revised WEA 16-bit
-	//dma.TCD->BITER_ELINKNO = sizeof(i2s_rx_buffer_32) / 4; //original, 32-bit
-	dma.TCD->BITER_ELINKNO = I2S_BUFFER_TO_USE_BYTES / 4;  //number of minor loops in a major loop.  I2S_BUFFER_TO_USE_BYTES/NBYTES_MLNO?..should be 4 or 8?   https://forum.pjrc.com/threads/42233-I2S-Input-Question
-	
+	dma.TCD->CITER_ELINKNO = I2S_BUFFER_TO_USE_BYTES / 4;   //number of minor loops in a major loop
+	dma.TCD->DLASTSGA = -I2S_BUFFER_TO_USE_BYTES;
+	dma.TCD->BITER_ELINKNO = I2S_BUFFER_TO_USE_BYTES / 4;
 	dma.TCD->CSR = DMA_TCD_CSR_INTHALF | DMA_TCD_CSR_INTMAJOR;
-}; */
-
+#endif
+}
 /* void AudioInputI2S_F32::isr_16(void)
 {
 	uint32_t daddr, offset;
@@ -272,7 +209,7 @@ void AudioInputI2S_F32::begin(bool transferUsing32bit) {
 void AudioInputI2S_F32::isr(void)
 {
 	uint32_t daddr, offset;
-	const int16_t *src, *end;
+	const uint32_t *src;
 	//int16_t *dest_left, *dest_right;
 	//audio_block_t *left, *right;
 	float32_t *dest_left_f32, *dest_right_f32;
@@ -290,16 +227,13 @@ void AudioInputI2S_F32::isr(void)
 		// need to remove data from the second half
 		//src = (int16_t *)&i2s_rx_buffer[AUDIO_BLOCK_SAMPLES/2]; //original Teensy Audio Library
 		//end = (int16_t *)&i2s_rx_buffer[AUDIO_BLOCK_SAMPLES]; //original Teensy Audio Library
-		src = (int16_t *)&i2s_rx_buffer[audio_block_samples/2];
-		end = (int16_t *)&i2s_rx_buffer[audio_block_samples];			
+		src = (const uint32_t *)((uint32_t)i2s_rx_buffer + I2S_BUFFER_TO_USE_BYTES / 2);
 		update_counter++; //let's increment the counter here to ensure that we get every ISR resulting in audio
 		if (AudioInputI2S_F32::update_responsibility) AudioStream_F32::update_all();
 	} else {
 		// DMA is receiving to the second half of the buffer
 		// need to remove data from the first half
-		src = (int16_t *)&i2s_rx_buffer[0];
-		//end = (int16_t *)&i2s_rx_buffer[AUDIO_BLOCK_SAMPLES/2]; //original Teensy Audio Library
-		end = (int16_t *)&i2s_rx_buffer[audio_block_samples/2];
+		src = (const uint32_t *)&i2s_rx_buffer[0];
 	}
 	left_f32 = AudioInputI2S_F32::block_left_f32;
 	right_f32 = AudioInputI2S_F32::block_right_f32;
@@ -311,84 +245,17 @@ void AudioInputI2S_F32::isr(void)
 			dest_right_f32 = &(right_f32->data[offset]);
 			//AudioInputI2S_F32::block_offset = offset + AUDIO_BLOCK_SAMPLES/2; //original Teensy Audio Library
 			AudioInputI2S_F32::block_offset = offset + audio_block_samples/2;
-			do {
-				//Serial.println(*src);
-				//n = *src++;
-				//*dest_left++ = (int16_t)n;
-				//*dest_right++ = (int16_t)(n >> 16);
-				*dest_left_f32++ = (float32_t) *src++;
-				*dest_right_f32++ = (float32_t) *src++;
-			} while (src < end);
+			
+			//de-interleave and scale (to +/-1.0) in one pass
+			if (transfer_32bit) {
+				i2s_i32_to_f32_deinterleave2(src, dest_left_f32, dest_right_f32, audio_block_samples/2);
+			} else {
+				i2s_i16_to_f32_deinterleave2(src, dest_left_f32, dest_right_f32, audio_block_samples/2);
+			}
 		}
 	}
 }
 
-
-
-/* void AudioInputI2S_F32::isr_32(void)
-{
-	static bool flag_beenSuccessfullOnce = false;
-	uint32_t daddr, offset;
-	const int32_t *src_i32, *end_i32;
-	//int16_t *dest_left, *dest_right;
-	float32_t *dest_left_f32, *dest_right_f32;
-	audio_block_f32_t *left_f32, *right_f32;
-
-	daddr = (uint32_t)(dma.TCD->DADDR);
-	
-	dma.clearInterrupt();
-
-	//if (daddr < (uint32_t)i2s_rx_buffer + sizeof(i2s_rx_buffer) / 2) {
-	if (daddr < (uint32_t)i2s_rx_buffer + I2S_BUFFER_TO_USE_BYTES / 2) {		
-		
-		// DMA is receiving to the first half of the buffer
-		// need to remove data from the second half
-		//src = (int32_t *)&i2s_rx_buffer_32[AUDIO_BLOCK_SAMPLES];
-		//end = (int32_t *)&i2s_rx_buffer_32[AUDIO_BLOCK_SAMPLES*2];
-		src_i32 = (int32_t *)&i2s_rx_buffer[audio_block_samples];	//WEA revised
-		end_i32 = (int32_t *)&i2s_rx_buffer[audio_block_samples*2];	//WEA revised
-		update_counter++; //let's increment the counter here to ensure that we get every ISR resulting in audio
-		if (AudioInputI2S_F32::update_responsibility) AudioStream_F32::update_all();
-		
-	} else {
-		// DMA is receiving to the second half of the buffer
-		// need to remove data from the first half
-		//src = (int32_t *)&i2s_rx_buffer_32[0];
-		//end = (int32_t *)&i2s_rx_buffer_32[AUDIO_BLOCK_SAMPLES];		
-		end_i32 = (int32_t *)&i2s_rx_buffer[audio_block_samples];		
-		src_i32 = (int32_t *)&i2s_rx_buffer[0];
-	}
-	
-	// OLD COMMENT: extract 16 but from 32 bit I2S buffer but shift to right first
-    // OLD COMMENT: there will be two buffers with each having "AUDIO_BLOCK_SAMPLES" samples
-	left_f32 = AudioInputI2S_F32::block_left_f32;
-	right_f32 = AudioInputI2S_F32::block_right_f32;
-	if ((left_f32 != NULL) && (right_f32 != NULL)) {
-		offset = AudioInputI2S_F32::block_offset;
-		//if (offset <= AUDIO_BLOCK_SAMPLES/2) {	//original
-		if (offset <= ((uint32_t) audio_block_samples/2)) {
-			dest_left_f32 = &(left_f32->data[offset]);
-			dest_right_f32 = &(right_f32->data[offset]);
-			//AudioInputI2S_F32::block_offset = offset + AUDIO_BLOCK_SAMPLES/2;	//original
-			AudioInputI2S_F32::block_offset = offset + audio_block_samples/2;
-			do {
-				//n = *src++;
-				// *dest_left++ = (int16_t)n;
-				// *dest_right++ = (int16_t)(n >> 16);
-				*dest_left_f32++ = (float32_t) *src_i32++; 
-				*dest_right_f32++ = (float32_t) *src_i32++;
-			} while (src_i32 < end_i32);
-		}
-		flag_beenSuccessfullOnce = true;
-	} else {
-		if (flag_beenSuccessfullOnce) {
-			//but we were not successful this time
-			Serial.println("Input I2S: isr_32: WARNING!!! Null memory block.");
-		}
-
-	}
-} */
-
 #define I16_TO_F32_NORM_FACTOR (3.051850947599719e-05)  //which is 1/32767 
 void AudioInputI2S_F32::scale_i16_to_f32( float32_t *p_i16, float32_t *p_f32, int len) {
 	for (int i=0; i<len; i++) { *p_f32++ = ((*p_i16++) * I16_TO_F32_NORM_FACTOR); }
@@ -492,9 +359,7 @@ void AudioInputI2S_F32::scale_i32_to_f32( float32_t *p_i32, float32_t *p_f32, in
  void AudioInputI2S_F32::update_1chan(int chan, audio_block_f32_t *&out_f32) {
 	 if (!out_f32) return;
 	 
-	//scale the float values so that the maximum possible audio values span -1.0 to + 1.0
-	//scale_i32_to_f32(out_f32->data, out_f32->data, audio_block_samples);
-	scale_i16_to_f32(out_f32->data, out_f32->data, audio_block_samples);
+	//the isr() already scaled the values so that the maximum possible audio values span -1.0 to + 1.0
 
 	//prepare to transmit by setting the update_counter (which helps tell if data is skipped or out-of-order)
 	out_f32->id = update_counter;
@@ -570,6 +435,7 @@ void AudioInputI2S_F32::update(void)
 void AudioInputI2Sslave_F32::begin(void)
 {
 	dma.begin(true); // Allocate the DMA channel first
+	transfer_32bit = false;  //the slave version only does 16-bit transfers
 
 	//block_left_1st = NULL;
 	//block_right_1st = NULL;
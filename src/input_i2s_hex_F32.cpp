@@ -34,10 +34,11 @@
 #include "input_i2s_hex_f32.h"
 #include "output_i2s_f32.h"
 #include "output_i2s_quad_f32.h"
+#include "utility/i2s_convert_f32.h"  //for de-interleaving and scaling straight out of the DMA buffer
 
 
 //DMAMEM __attribute__((aligned(32))) static uint32_t i2s_rx_buffer[AUDIO_BLOCK_SAMPLES*3]; //Teensy original
-DMAMEM __attribute__((aligned(32))) static uint32_t i2s_default_rx_buffer[MAX_AUDIO_BLOCK_SAMPLES_F32/2*6]; //The "divide by 2" is because we're fitting 16-bit samples into 32-bit slots
+DMAMEM __attribute__((aligned(32))) static uint32_t i2s_default_rx_buffer[MAX_AUDIO_BLOCK_SAMPLES_F32/2*6*I2S_F32_DMA_BUFFER_SCALE]; //16-bit transfers fit two samples into each 32-bit slot.  Only big enough for 32-bit transfers if I2S_F32_ENABLE_32BIT_TRANSFERS
 uint32_t *AudioInputI2SHex_F32::i2s_rx_buffer = i2s_default_rx_buffer;
 audio_block_f32_t * AudioInputI2SHex_F32::block_ch1 = NULL;
 audio_block_f32_t * AudioInputI2SHex_F32::block_ch2 = NULL;
@@ -47,22 +48,34 @@ audio_block_f32_t * AudioInputI2SHex_F32::block_ch5 = NULL;
 audio_block_f32_t * AudioInputI2SHex_F32::block_ch6 = NULL;
 uint32_t AudioInputI2SHex_F32::block_offset = 0;
 bool AudioInputI2SHex_F32::update_responsibility = false;
+bool AudioInputI2SHex_F32::transfer_32bit = false;
 DMAChannel AudioInputI2SHex_F32::dma(false);
 
 //int AudioInputI2SHex_F32::flag_out_of_memory = 0;
 //float AudioInputI2SHex_F32::sample_rate_Hz = AUDIO_SAMPLE_RATE;
 //int AudioInputI2SHex_F32::audio_block_samples = MAX_AUDIO_BLOCK_SAMPLES_F32;
 
-//for 16-bit transfers?
-#define I2S_BUFFER_TO_USE_BYTES ((AudioInputI2SHex_F32::audio_block_samples)*6*(sizeof(i2s_rx_buffer[0])/2))
+//for 16-bit transfers (two samples per 32-bit word) or for 32-bit transfers (one sample per 32-bit word)
+#define I2S_BUFFER_TO_USE_BYTES ((AudioInputI2SHex_F32::audio_block_samples)*6*(sizeof(i2s_rx_buffer[0])/(AudioInputI2SHex_F32::transfer_32bit ? 1 : 2)))
 
 
 #if defined(__IMXRT1062__)
 
 void AudioInputI2SHex_F32::begin(void)
+{
+	bool transferUsing32bit = false;
+	begin(transferUsing32bit);
+}
+
+void AudioInputI2SHex_F32::begin(bool transferUsing32bit)
 {
 	//Serial.println("AudioInputI2SHex_F32: begin: starting...");
 	dma.begin(true); // Allocate the DMA channel first
+	if (transferUsing32bit && !I2S_F32_ENABLE_32BIT_TRANSFERS && (i2s_rx_buffer == i2s_default_rx_buffer)) {
+		Serial.println("AudioInputI2SHex_F32: begin: *** WARNING ***: 32-bit transfers need I2S_F32_ENABLE_32BIT_TRANSFERS (or a user-supplied buffer).  Using 16-bit.");
+		transferUsing32bit = false;
+	}
+	transfer_32bit = transferUsing32bit;
 
 	//AudioOutputI2SHex_F32::sample_rate_Hz = sample_rate_Hz; //these were given in the AudioSettings in the contructor
 	//AudioOutputI2SHex_F32::audio_block_samples = audio_block_samples;//these were given in the AudioSettings in the contructor
@@ -74,7 +87,6 @@ void AudioInputI2SHex_F32::begin(void)
 
 	const int pinoffset = 0; // TODO: make this configurable...
 	//AudioOutputI2S_F32::config_i2s();
-	bool transferUsing32bit = false;
 	AudioOutputI2S_F32::config_i2s(transferUsing32bit, sample_rate_Hz);
 	I2S1_RCR3 = I2S_RCR3_RCE_3CH << pinoffset;
 	switch (pinoffset) {
@@ -95,15 +107,29 @@ void AudioInputI2SHex_F32::begin(void)
 			IOMUXC_SAI1_RX_DATA3_SELECT_INPUT = 1; // GPIO_B0_12_ALT3, pg 875
 			break;
 	}
-	dma.TCD->SADDR = (void *)((uint32_t)&I2S1_RDR0 + 2 + pinoffset * 4);
-	dma.TCD->SOFF = 4;
-	dma.TCD->ATTR = DMA_TCD_ATTR_SSIZE(1) | DMA_TCD_ATTR_DSIZE(1);
-	dma.TCD->NBYTES_MLOFFYES = DMA_TCD_NBYTES_SMLOE |
-		DMA_TCD_NBYTES_MLOFFYES_MLOFF(-12) |  // 4 samples @ 2 bytes each?
-		DMA_TCD_NBYTES_MLOFFYES_NBYTES(6);    
-	dma.TCD->SLAST = -12;  //6 samples @ 2 bytes each?
-	dma.TCD->DADDR = i2s_rx_buffer;
-	dma.TCD->DOFF = 2;
+	if (transfer_32bit) {
+		//each minor loop reads one whole 32-bit slot from each of the three data lines
+		dma.TCD->SADDR = (void *)((uint32_t)&I2S1_RDR0 + pinoffset * 4);
+		dma.TCD->SOFF = 4;
+		dma.TCD->ATTR = DMA_TCD_ATTR_SSIZE(2) | DMA_TCD_ATTR_DSIZE(2);
+		dma.TCD->NBYTES_MLOFFYES = DMA_TCD_NBYTES_SMLOE |
+			DMA_TCD_NBYTES_MLOFFYES_MLOFF(-12) |  // 3 data lines @ 4 bytes each
+			DMA_TCD_NBYTES_MLOFFYES_NBYTES(12);    
+		dma.TCD->SLAST = -12;  //3 data lines @ 4 bytes each
+		dma.TCD->DADDR = i2s_rx_buffer;
+		dma.TCD->DOFF = 4;
+	} else {
+		//each minor loop reads the upper 16 bits of the slot from each of the three data lines
+		dma.TCD->SADDR = (void *)((uint32_t)&I2S1_RDR0 + 2 + pinoffset * 4);
+		dma.TCD->SOFF = 4;
+		dma.TCD->ATTR = DMA_TCD_ATTR_SSIZE(1) | DMA_TCD_ATTR_DSIZE(1);
+		dma.TCD->NBYTES_MLOFFYES = DMA_TCD_NBYTES_SMLOE |
+			DMA_TCD_NBYTES_MLOFFYES_MLOFF(-12) |  // 4 samples @ 2 bytes each?
+			DMA_TCD_NBYTES_MLOFFYES_NBYTES(6);    
+		dma.TCD->SLAST = -12;  //6 samples @ 2 bytes each?
+		dma.TCD->DADDR = i2s_rx_buffer;
+		dma.TCD->DOFF = 2;
+	}
 	
 //	dma.TCD->CITER_ELINKNO = AUDIO_BLOCK_SAMPLES * 2;  //original from Teensy library (hex.  assumes 16 bit transfers?)
 //	dma.TCD->DLASTSGA = -sizeof(i2s_rx_buffer);        //original from Teensy library (hex)
@@ -126,7 +152,7 @@ void AudioInputI2SHex_F32::begin(void)
 void AudioInputI2SHex_F32::isr(void)
 {
 	uint32_t daddr, offset;
-	const int16_t *src;
+	const uint32_t *src;
 	float32_t *dest1, *dest2, *dest3, *dest4, *dest5, *dest6;
 
 	//digitalWriteFast(3, HIGH);
@@ -138,17 +164,16 @@ void AudioInputI2SHex_F32::isr(void)
 		// DMA is receiving to the first half of the buffer
 		// need to remove data from the second half
 		//src = (int16_t *)((uint32_t)i2s_rx_buffer + sizeof(i2s_rx_buffer) / 2);
-		src = (int16_t *)((uint32_t)i2s_rx_buffer + I2S_BUFFER_TO_USE_BYTES / 2); 
+		src = (const uint32_t *)((uint32_t)i2s_rx_buffer + I2S_BUFFER_TO_USE_BYTES / 2); 
 		//if (update_responsibility) update_all();
 		if (AudioInputI2SHex_F32::update_responsibility) AudioStream_F32::update_all();
 	} else {
 		// DMA is receiving to the second half of the buffer
 		// need to remove data from the first half
-		src = (int16_t *)&i2s_rx_buffer[0];
+		src = (const uint32_t *)&i2s_rx_buffer[0];
 	}
 	
-	//This block of code only copies the data into F32 buffers but leaves the scaling at +/-32767.0
-	//which will then be scaled in the update() method instead of here
+	//This block of code de-interleaves the data into the F32 buffers and scales it to +/-1.0, all in one pass
 	if (block_ch1 && block_ch2 && block_ch3 && block_ch4 && block_ch5 && block_ch6) {
 		offset = AudioInputI2SHex_F32::block_offset;
 		if (offset <= (uint32_t)(audio_block_samples/2)) {
@@ -163,13 +188,11 @@ void AudioInputI2SHex_F32::isr(void)
 			dest4 = &(block_ch4->data[offset]);
 			dest5 = &(block_ch5->data[offset]);
 			dest6 = &(block_ch6->data[offset]);
-			for (int i=0; i < audio_block_samples/2; i++) {
-				*dest1++ = ((float32_t) *src++); //chan 1
-				*dest3++ = ((float32_t) *src++); //chan 3!
-				*dest5++ = ((float32_t) *src++); //chan 5!
-				*dest2++ = ((float32_t) *src++); //chan 2
-				*dest4++ = ((float32_t) *src++); //chan 4!
-				*dest6++ = ((float32_t) *src++); //chan 6!
+			//the slot order is chan 1, 3, 5, 2, 4, 6 (note the order!)
+			if (transfer_32bit) {
+				i2s_i32_to_f32_deinterleave6(src, dest1, dest3, dest5, dest2, dest4, dest6, audio_block_samples/2);
+			} else {
+				i2s_i16_to_f32_deinterleave6(src, dest1, dest3, dest5, dest2, dest4, dest6, audio_block_samples/2);
 			}
 		}
 	}
@@ -179,9 +202,7 @@ void AudioInputI2SHex_F32::isr(void)
 void AudioInputI2SHex_F32::update_1chan(int chan, unsigned long counter, audio_block_f32_t *&out_block) {
 	if (!out_block) return;
 		
-	//incoming data is still scaled like int16 (so, +/-32767.).  Here we need to re-scale
-	//the values so that the maximum possible audio values spans the F32 stadard of +/-1.0
-	AudioInputI2S_F32::scale_i16_to_f32(out_block->data, out_block->data, audio_block_samples);
+	//the isr() already scaled the values so that the maximum possible audio values span the F32 standard of +/-1.0
 	
 	//prepare to transmit by setting the update_counter (which helps tell if data is skipped or out-of-order)
 	out_block->id = counter;
@@ -311,6 +332,10 @@ void AudioInputI2SHex_F32::begin(void)
 {
 }
 
+void AudioInputI2SHex_F32::begin(bool transferUsing32bit)
+{
+}
+
 
 
 #endif
\ No newline at end of file
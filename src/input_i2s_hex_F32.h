@@ -51,13 +51,23 @@ public:
 		audio_block_samples = settings.audio_block_samples;
 		if (flag_callBegin) begin(); 
 	}
+	AudioInputI2SHex_F32(const AudioSettings_F32 &settings, uint32_t *rx_buff) : AudioInputI2SHex_F32(settings, rx_buff, true) {}
+	AudioInputI2SHex_F32(const AudioSettings_F32 &settings, uint32_t *rx_buff, bool flag_callBegin) { 
+		sample_rate_Hz = settings.sample_rate_Hz;
+		audio_block_samples = settings.audio_block_samples;
+		i2s_rx_buffer = rx_buff;
+		if (flag_callBegin) begin(); 
+	}
 	virtual void update(void);
 	void begin(void);
+	void begin(bool);  //true for 32-bit DMA transfers (24-bit audio; needs the build flag I2S_F32_ENABLE_32BIT_TRANSFERS or a user-supplied buffer).  Construct with flag_callBegin = false, then call this.
+	static bool get_isTransferUsing32bit(void) { return transfer_32bit; }
 	int get_isOutOfMemory(void) { return flag_out_of_memory; }
 	void clear_isOutOfMemory(void) { flag_out_of_memory = 0; }
-	static uint32_t *i2s_rx_buffer; 
+	static uint32_t *i2s_rx_buffer;  //for 32-bit transfers, any user-supplied buffer must be 6*audio_block_samples long
 protected:
 	static bool update_responsibility;
+	static bool transfer_32bit;
 	static DMAChannel dma;
 	static void isr(void);
 	virtual void update_1chan(int, unsigned long, audio_block_f32_t *&);
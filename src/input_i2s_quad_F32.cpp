@@ -35,9 +35,10 @@
 #include "input_i2s_quad_F32.h"
 #include "output_i2s_quad_F32.h"
 #include "output_i2s_F32.h"
+#include "utility/i2s_convert_f32.h"  //for de-interleaving and scaling straight out of the DMA buffer
 
 //DMAMEM __attribute__((aligned(32))) static uint32_t i2s_rx_buffer[MAX_AUDIO_BLOCK_SAMPLES_F32*2]; //Teensy Audio original
-DMAMEM __attribute__((aligned(32))) static uint32_t i2s_default_rx_buffer[MAX_AUDIO_BLOCK_SAMPLES_F32/2*4]; //Teensy Audio original
+DMAMEM __attribute__((aligned(32))) static uint32_t i2s_default_rx_buffer[MAX_AUDIO_BLOCK_SAMPLES_F32/2*4*I2S_F32_DMA_BUFFER_SCALE]; //only big enough for 32-bit transfers if I2S_F32_ENABLE_32BIT_TRANSFERS
 uint32_t *AudioInputI2SQuad_F32::i2s_rx_buffer = i2s_default_rx_buffer;
 //DMAMEM static uint32_t i2s_rx_buffer[AUDIO_BLOCK_SAMPLES/2*4];
 audio_block_f32_t * AudioInputI2SQuad_F32::block_ch1 = NULL;
@@ -46,23 +47,41 @@ audio_block_f32_t * AudioInputI2SQuad_F32::block_ch3 = NULL;
 audio_block_f32_t * AudioInputI2SQuad_F32::block_ch4 = NULL;
 uint32_t AudioInputI2SQuad_F32::block_offset = 0;
 bool AudioInputI2SQuad_F32::update_responsibility = false;
+bool AudioInputI2SQuad_F32::transfer_32bit = false;
 DMAChannel AudioInputI2SQuad_F32::dma(false);
 //int AudioInputI2SQuad_F32::flag_out_of_memory = 0;
 
 //float AudioInputI2SQuad_F32::sample_rate_Hz = AUDIO_SAMPLE_RATE;
 //int AudioInputI2SQuad_F32::audio_block_samples = MAX_AUDIO_BLOCK_SAMPLES_F32;
 
-//for 16-bit transfers?
-#define I2S_BUFFER_TO_USE_BYTES ((AudioOutputI2SQuad_F32::audio_block_samples)*4*(sizeof(i2s_rx_buffer[0])/2))
+//for 16-bit transfers (two samples per 32-bit word) or for 32-bit transfers (one sample per 32-bit word)
+#define I2S_BUFFER_TO_USE_BYTES ((AudioOutputI2SQuad_F32::audio_block_samples)*4*(sizeof(i2s_rx_buffer[0])/(AudioInputI2SQuad_F32::transfer_32bit ? 1 : 2)))
 
 
 #if defined(__MK20DX256__) || defined(__MK64FX512__) || defined(__MK66FX1M0__) || defined(__IMXRT1062__)
 
 
 void AudioInputI2SQuad_F32::begin(void)
+{
+	bool transferUsing32bit = false;
+	begin(transferUsing32bit);
+}
+
+void AudioInputI2SQuad_F32::begin(bool transferUsing32bit)
 {
 	dma.begin(true); // Allocate the DMA channel first
 
+#if defined(KINETISK)
+	//the Teensy 3.x quad I2S uses 16-bit slots, so there is nothing more to carry
+	if (transferUsing32bit) Serial.println("AudioInputI2SQuad_F32: begin: *** WARNING ***: 32-bit transfers need Teensy 4.  Using 16-bit.");
+	transferUsing32bit = false;
+#endif
+	if (transferUsing32bit && !I2S_F32_ENABLE_32BIT_TRANSFERS && (i2s_rx_buffer == i2s_default_rx_buffer)) {
+		Serial.println("AudioInputI2SQuad_F32: begin: *** WARNING ***: 32-bit transfers need I2S_F32_ENABLE_32BIT_TRANSFERS (or a user-supplied buffer).  Using 16-bit.");
+		transferUsing32bit = false;
+	}
+	transfer_32bit = transferUsing32bit;
+
 	AudioOutputI2SQuad_F32::sample_rate_Hz = sample_rate_Hz;  //these were given in the AudioSettings in the Contructor
 	AudioOutputI2SQuad_F32::audio_block_samples = audio_block_samples;//these were given in the AudioSettings in the Contructor
 	
@@ -106,7 +125,6 @@ void AudioInputI2SQuad_F32::begin(void)
 
 #elif defined(__IMXRT1062__)
 	const int pinoffset = 0; // TODO: make this configurable...
-	bool transferUsing32bit = false;
 	AudioOutputI2S_F32::config_i2s(transferUsing32bit, sample_rate_Hz);
 	I2S1_RCR3 = I2S_RCR3_RCE_2CH << pinoffset;
 	switch (pinoffset) {
@@ -129,15 +147,29 @@ void AudioInputI2SQuad_F32::begin(void)
 		IOMUXC_SAI1_RX_DATA3_SELECT_INPUT = 1; // GPIO_B0_12_ALT3, pg 875
 		break;
 	}
-	dma.TCD->SADDR = (void *)((uint32_t)&I2S1_RDR0 + 2 + pinoffset * 4);
-	dma.TCD->SOFF = 4;
-	dma.TCD->ATTR = DMA_TCD_ATTR_SSIZE(1) | DMA_TCD_ATTR_DSIZE(1);
-	dma.TCD->NBYTES_MLOFFYES = DMA_TCD_NBYTES_SMLOE |
-		DMA_TCD_NBYTES_MLOFFYES_MLOFF(-8) |  // 4 samples @ 2 bytes each?
-		DMA_TCD_NBYTES_MLOFFYES_NBYTES(4);
-	dma.TCD->SLAST = -8;   //4 samples @ 2 bytes each?
-	dma.TCD->DADDR = i2s_rx_buffer;
-	dma.TCD->DOFF = 2;
+	if (transfer_32bit) {
+		//each minor loop reads one whole 32-bit slot from each of the two data lines
+		dma.TCD->SADDR = (void *)((uint32_t)&I2S1_RDR0 + pinoffset * 4);
+		dma.TCD->SOFF = 4;
+		dma.TCD->ATTR = DMA_TCD_ATTR_SSIZE(2) | DMA_TCD_ATTR_DSIZE(2);
+		dma.TCD->NBYTES_MLOFFYES = DMA_TCD_NBYTES_SMLOE |
+			DMA_TCD_NBYTES_MLOFFYES_MLOFF(-8) |  // 2 data lines @ 4 bytes each
+			DMA_TCD_NBYTES_MLOFFYES_NBYTES(8);
+		dma.TCD->SLAST = -8;   //2 data lines @ 4 bytes each
+		dma.TCD->DADDR = i2s_rx_buffer;
+		dma.TCD->DOFF = 4;
+	} else {
+		//each minor loop reads the upper 16 bits of the slot from each of the two data lines
+		dma.TCD->SADDR = (void *)((uint32_t)&I2S1_RDR0 + 2 + pinoffset * 4);
+		dma.TCD->SOFF = 4;
+		dma.TCD->ATTR = DMA_TCD_ATTR_SSIZE(1) | DMA_TCD_ATTR_DSIZE(1);
+		dma.TCD->NBYTES_MLOFFYES = DMA_TCD_NBYTES_SMLOE |
+			DMA_TCD_NBYTES_MLOFFYES_MLOFF(-8) |  // 4 samples @ 2 bytes each?
+			DMA_TCD_NBYTES_MLOFFYES_NBYTES(4);
+		dma.TCD->SLAST = -8;   //4 samples @ 2 bytes each?
+		dma.TCD->DADDR = i2s_rx_buffer;
+		dma.TCD->DOFF = 2;
+	}
 	//dma.TCD->CITER_ELINKNO = AUDIO_BLOCK_SAMPLES * 2; //original Teensy Audio Library
 	//dma.TCD->DLASTSGA = -sizeof(i2s_rx_buffer);  //original Teensy Audio Library
 	//dma.TCD->BITER_ELINKNO = AUDIO_BLOCK_SAMPLES * 2; //original Teensy Audio Library
@@ -161,7 +193,7 @@ void AudioInputI2SQuad_F32::begin(void)
 void AudioInputI2SQuad_F32::isr(void)
 {
 	uint32_t daddr, offset;
-	const int16_t *src;  //*end;
+	const uint32_t *src;  //*end;
 	float32_t *dest1_f32, *dest2_f32, *dest3_f32, *dest4_f32;
 
 	//digitalWriteFast(3, HIGH);
@@ -173,13 +205,13 @@ void AudioInputI2SQuad_F32::isr(void)
 		// DMA is receiving to the first half of the buffer
 		// need to remove data from the second half
 		//src = (int16_t *)&i2s_rx_buffer[AUDIO_BLOCK_SAMPLES];
-		src = (int16_t *)&i2s_rx_buffer[audio_block_samples];
+		src = (const uint32_t *)((uint32_t)i2s_rx_buffer + I2S_BUFFER_TO_USE_BYTES / 2);
 		//end = (int16_t *)&i2s_rx_buffer[audio_block_samples*2];
 		if (AudioInputI2SQuad_F32::update_responsibility) AudioStream_F32::update_all();
 	} else {
 		// DMA is receiving to the second half of the buffer
 		// need to remove data from the first half
-		src = (int16_t *)&i2s_rx_buffer[0];
+		src = (const uint32_t *)&i2s_rx_buffer[0];
 		//end = (int16_t *)&i2s_rx_buffer[audio_block_samples];
 	}
 	
@@ -210,8 +242,7 @@ void AudioInputI2SQuad_F32::isr(void)
 		} 
 	
 	#else
-		//This block of code only copies the data into F32 buffers but leaves the scaling at +/-32767.0
-		//which will then be scaled in the update() method instead of here
+		//This block of code de-interleaves the data into the F32 buffers and scales it to +/-1.0, all in one pass
 	
 		//De-interleave and copy to destination audio buffers.  
 		//Note the unexpected order!!! Chan 1, 3, 2, 4
@@ -226,11 +257,11 @@ void AudioInputI2SQuad_F32::isr(void)
 				dest2_f32 = &(block_ch2->data[offset]);
 				dest3_f32 = &(block_ch3->data[offset]);
 				dest4_f32 = &(block_ch4->data[offset]);
-				for (int i=0; i < audio_block_samples/2; i++) {
-					*dest1_f32++ = ((float32_t) *src++);  //left 1
-					*dest3_f32++ = ((float32_t) *src++);  //left 2 (note chan 3!!)
-					*dest2_f32++ = ((float32_t) *src++);  //right 1 (note chan 2!!)
-					*dest4_f32++ = ((float32_t) *src++);  //right 2
+				//the slot order is left 1, left 2, right 1, right 2, which is chan 1, 3, 2, 4 (note the order!!)
+				if (transfer_32bit) {
+					i2s_i32_to_f32_deinterleave4(src, dest1_f32, dest3_f32, dest2_f32, dest4_f32, audio_block_samples/2);
+				} else {
+					i2s_i16_to_f32_deinterleave4(src, dest1_f32, dest3_f32, dest2_f32, dest4_f32, audio_block_samples/2);
 				}
 			}
 		} 
@@ -253,9 +284,7 @@ void AudioInputI2SQuad_F32::scale_i32_to_f32( float32_t *p_i32, float32_t *p_f32
 void AudioInputI2SQuad_F32::update_1chan(int chan, unsigned long counter, audio_block_f32_t *&out_block) {
 	if (!out_block) return;
 		
-	//incoming data is still scaled like int16 (so, +/-32767.).  Here we need to re-scale
-	//the values so that the maximum possible audio values spans the F32 stadard of +/-1.0
-	AudioInputI2S_F32::scale_i16_to_f32(out_block->data, out_block->data, audio_block_samples);
+	//the isr() already scaled the values so that the maximum possible audio values span the F32 standard of +/-1.0
 	
 	//prepare to transmit by setting the update_counter (which helps tell if data is skipped or out-of-order)
 	out_block->id = counter;
@@ -353,5 +382,9 @@ void AudioInputI2SQuad_F32::begin(void)
 {
 }
 
+void AudioInputI2SQuad_F32::begin(bool transferUsing32bit)
+{
+}
+
 
 #endif
\ No newline at end of file
@@ -35,6 +35,7 @@
 //include "memcpy_audio.h"
 //#include "memcpy_interleave.h"
 #include <arm_math.h>
+#include "utility/i2s_convert_f32.h"  //for scaling, saturating, and interleaving straight into the DMA buffer
 //include <Audio.h> //to get access to Audio/utlity/imxrt_hw.h...do we really need this??? WEA 2020-10-31
 
 
@@ -193,9 +194,10 @@ audio_block_f32_t * AudioOutputI2S_F32::block_right_2nd = NULL;
 uint16_t  AudioOutputI2S_F32::block_left_offset = 0;
 uint16_t  AudioOutputI2S_F32::block_right_offset = 0;
 bool AudioOutputI2S_F32::update_responsibility = false;
+bool AudioOutputI2S_F32::transfer_32bit = false;
 DMAChannel AudioOutputI2S_F32::dma(false);
 //DMAMEM __attribute__((aligned(32))) static uint32_t i2s_tx_buffer[MAX_AUDIO_BLOCK_SAMPLES_F32];
-uint32_t i2s_default_tx_buffer[MAX_AUDIO_BLOCK_SAMPLES_F32];
+uint32_t i2s_default_tx_buffer[I2S_F32_DMA_BUFFER_SCALE*MAX_AUDIO_BLOCK_SAMPLES_F32];  //only big enough for 32-bit transfers if I2S_F32_ENABLE_32BIT_TRANSFERS
 uint32_t * AudioOutputI2S_F32::i2s_tx_buffer = i2s_default_tx_buffer;
 //static uint32_t i2s_tx_buffer[MAX_AUDIO_BLOCK_SAMPLES_F32];
 //DMAMEM static int32_t i2s_tx_buffer[2*AUDIO_BLOCK_SAMPLES]; //2 channels at 32-bits per sample.  Local "audio_block_samples" should be no larger than global "AUDIO_BLOCK_SAMPLES"
@@ -208,11 +210,8 @@ int AudioOutputI2S_F32::audio_block_samples = MAX_AUDIO_BLOCK_SAMPLES_F32;
 //#include <utility/imxrt_hw.h>   //from Teensy Audio library.  For set_audioClock()
 //#endif
 
-//#for 16-bit transfers
-#define I2S_BUFFER_TO_USE_BYTES (AudioOutputI2S_F32::audio_block_samples*sizeof(i2s_tx_buffer[0]))
-
-//#for 32-bit transfers
-//#define I2S_BUFFER_TO_USE_BYTES (AudioOutputI2S_F32::audio_block_samples*2*sizeof(i2s_tx_buffer[0]))
+//for 16-bit transfers, both channels are packed into one 32-bit word per frame.  For 32-bit transfers, it is one word per channel.
+#define I2S_BUFFER_TO_USE_BYTES (AudioOutputI2S_F32::audio_block_samples*(AudioOutputI2S_F32::transfer_32bit ? 2 : 1)*sizeof(i2s_tx_buffer[0]))
 
 
 void AudioOutputI2S_F32::begin(void)
@@ -221,32 +220,28 @@ void AudioOutputI2S_F32::begin(void)
 	begin(transferUsing32bit);
 }
 
+//The I2S frame is always two 32-bit slots.  For 16-bit transfers, the DMA writes just the upper half of each
+//slot (the lower half goes out as zeros).  For 32-bit transfers, the DMA writes the whole slot, which carries
+//24-bit audio.  For the codec to use the extra bits, its word length must be set, too (for example, see
+//AudioControlAIC3206::setI2SWordLength()).
 void AudioOutputI2S_F32::begin(bool transferUsing32bit) {
 
 	dma.begin(true); // Allocate the DMA channel first
 
 	block_left_1st = NULL;
 	block_right_1st = NULL;
+	if (transferUsing32bit && !I2S_F32_ENABLE_32BIT_TRANSFERS && (i2s_tx_buffer == i2s_default_tx_buffer)) {
+		Serial.println("AudioOutputI2S_F32: begin: *** WARNING ***: 32-bit transfers need I2S_F32_ENABLE_32BIT_TRANSFERS (or a user-supplied buffer).  Using 16-bit.");
+		transferUsing32bit = false;
+	}
+	transfer_32bit = transferUsing32bit;
 
 	AudioOutputI2S_F32::config_i2s(transferUsing32bit, sample_rate_Hz);
 
 #if defined(KINETISK)
 	CORE_PIN22_CONFIG = PORT_PCR_MUX(6); // pin 22, PTC1, I2S0_TXD0
 
-	dma.TCD->SADDR = i2s_tx_buffer;
-	dma.TCD->SOFF = 2;
-	dma.TCD->ATTR = DMA_TCD_ATTR_SSIZE(1) | DMA_TCD_ATTR_DSIZE(1);
-	dma.TCD->NBYTES_MLNO = 2;
-	//dma.TCD->SLAST = -sizeof(i2s_tx_buffer);//orig from Teensy Audio Library 2020-10-31
-	dma.TCD->SLAST = -I2S_BUFFER_TO_USE_BYTES;
-	dma.TCD->DADDR = (void *)((uint32_t)&I2S0_TDR0 + 2);
-	dma.TCD->DOFF = 0;
-	//dma.TCD->CITER_ELINKNO = sizeof(i2s_tx_buffer) / 2; //orig from Teensy Audio Library 2020-10-31
-	dma.TCD->CITER_ELINKNO = I2S_BUFFER_TO_USE_BYTES / 2;
-	dma.TCD->DLASTSGA = 0;
-	//dma.TCD->BITER_ELINKNO = sizeof(i2s_tx_buffer) / 2;//orig from Teensy Audio Library 2020-10-31
-	dma.TCD->BITER_ELINKNO = I2S_BUFFER_TO_USE_BYTES / 2;
-	dma.TCD->CSR = DMA_TCD_CSR_INTHALF | DMA_TCD_CSR_INTMAJOR;
+	if (transfer_32bit) { sub_begin_i32(); } else { sub_begin_i16(); }
 	dma.triggerAtHardwareEvent(DMAMUX_SOURCE_I2S0_TX);
 	dma.enable();  //newer location of this line in Teensy Audio library
 
@@ -256,12 +251,36 @@ void AudioOutputI2S_F32::begin(bool transferUsing32bit) {
 #elif defined(__IMXRT1062__)
 	CORE_PIN7_CONFIG  = 3;  //1:TX_DATA0
 
+	if (transfer_32bit) { sub_begin_i32(); } else { sub_begin_i16(); }
+	dma.triggerAtHardwareEvent(DMAMUX_SOURCE_SAI1_TX);
+	dma.enable();  //newer location of this line in Teensy Audio library
+
+	I2S1_RCSR |= I2S_RCSR_RE | I2S_RCSR_BCE;
+	I2S1_TCSR = I2S_TCSR_TE | I2S_TCSR_BCE | I2S_TCSR_FRDE;
+#endif
+	update_responsibility = update_setup();
+	dma.attachInterrupt(AudioOutputI2S_F32::isr);
+	//dma.enable(); //original location of this line in older Tympan_Library
+	
+	enabled = 1;
+	
+	//AudioInputI2S_F32::begin_guts();
+}
+
+//DMA setup for 16-bit transfers: two bytes at a time, into the upper half of the transmit data register
+void AudioOutputI2S_F32::sub_begin_i16(void) {
+#if defined(KINETISK) || defined(__IMXRT1062__)
 	dma.TCD->SADDR = i2s_tx_buffer;
 	dma.TCD->SOFF = 2;
 	dma.TCD->ATTR = DMA_TCD_ATTR_SSIZE(1) | DMA_TCD_ATTR_DSIZE(1);
 	dma.TCD->NBYTES_MLNO = 2;
 	//dma.TCD->SLAST = -sizeof(i2s_tx_buffer);//orig from Teensy Audio Library 2020-10-31
 	dma.TCD->SLAST = -I2S_BUFFER_TO_USE_BYTES;
+	#if defined(KINETISK)
+	dma.TCD->DADDR = (void *)((uint32_t)&I2S0_TDR0 + 2);
+	#else
+	dma.TCD->DADDR = (void *)((uint32_t)&I2S1_TDR0 + 2);
+	#endif
 	dma.TCD->DOFF = 0;
 	//dma.TCD->CITER_ELINKNO = sizeof(i2s_tx_buffer) / 2; //orig from Teensy Audio Library 2020-10-31
 	dma.TCD->CITER_ELINKNO = I2S_BUFFER_TO_USE_BYTES / 2;
@@ -269,26 +288,34 @@ void AudioOutputI2S_F32::begin(bool transferUsing32bit) {
 	//dma.TCD->BITER_ELINKNO = sizeof(i2s_tx_buffer) / 2;//orig from Teensy Audio Library 2020-10-31
 	dma.TCD->BITER_ELINKNO = I2S_BUFFER_TO_USE_BYTES / 2;
 	dma.TCD->CSR = DMA_TCD_CSR_INTHALF | DMA_TCD_CSR_INTMAJOR;
-	dma.TCD->DADDR = (void *)((uint32_t)&I2S1_TDR0 + 2);
-	dma.triggerAtHardwareEvent(DMAMUX_SOURCE_SAI1_TX);
-	dma.enable();  //newer location of this line in Teensy Audio library
+#endif
+}
 
-	I2S1_RCSR |= I2S_RCSR_RE | I2S_RCSR_BCE;
-	I2S1_TCSR = I2S_TCSR_TE | I2S_TCSR_BCE | I2S_TCSR_FRDE;
+//DMA setup for 32-bit transfers: one whole slot (left or right) at a time, into the whole transmit data register
+void AudioOutputI2S_F32::sub_begin_i32(void) {
+#if defined(KINETISK) || defined(__IMXRT1062__)
+	dma.TCD->SADDR = i2s_tx_buffer; //here's where to get the data from
+	dma.TCD->SOFF = 4;	   //step forward pointer for source data by 4 bytes (ie, 32 bits) after each read
+	dma.TCD->ATTR = DMA_TCD_ATTR_SSIZE(2) | DMA_TCD_ATTR_DSIZE(2); //each read and write is 32 bits
+	dma.TCD->NBYTES_MLNO = 4;   //one slot (left or right) per minor loop
+	dma.TCD->SLAST = -I2S_BUFFER_TO_USE_BYTES;  //jump back to beginning of source data when hit the end
+	#if defined(KINETISK)
+	dma.TCD->DADDR = &I2S0_TDR0;  //destination of DMA transfers
+	#else
+	dma.TCD->DADDR = &I2S1_TDR0;  //destination of DMA transfers
+	#endif
+	dma.TCD->DOFF = 0;  //do not increment the destination pointer
+	dma.TCD->CITER_ELINKNO = I2S_BUFFER_TO_USE_BYTES / 4;   //number of minor loops in a major loop
+	dma.TCD->DLASTSGA = 0;
+	dma.TCD->BITER_ELINKNO = I2S_BUFFER_TO_USE_BYTES / 4;
+	dma.TCD->CSR = DMA_TCD_CSR_INTHALF | DMA_TCD_CSR_INTMAJOR;
 #endif
-	update_responsibility = update_setup();
-	dma.attachInterrupt(AudioOutputI2S_F32::isr);
-	//dma.enable(); //original location of this line in older Tympan_Library
-	
-	enabled = 1;
-	
-	//AudioInputI2S_F32::begin_guts();
 }
 
 void AudioOutputI2S_F32::isr(void)
 {
 #if defined(KINETISK) || defined(__IMXRT1062__)
-	int16_t *dest;
+	uint32_t *dest;
 	audio_block_f32_t *blockL, *blockR;
 	uint32_t saddr, offsetL, offsetR;
 
@@ -299,12 +326,12 @@ void AudioOutputI2S_F32::isr(void)
 		// DMA is transmitting the first half of the buffer
 		// so we must fill the second half
 		//dest = (int16_t *)&i2s_tx_buffer[AUDIO_BLOCK_SAMPLES/2]; //original Teensy Audio
-		dest = (int16_t *)&i2s_tx_buffer[audio_block_samples/2]; //this will be diff if we were to do 32-bit samples
+		dest = (uint32_t *)((uint32_t)i2s_tx_buffer + I2S_BUFFER_TO_USE_BYTES / 2);
 		if (AudioOutputI2S_F32::update_responsibility) AudioStream_F32::update_all();
 	} else {
 		// DMA is transmitting the second half of the buffer
 		// so we must fill the first half
-		dest = (int16_t *)i2s_tx_buffer;
+		dest = i2s_tx_buffer;
 	}
 
 	blockL = AudioOutputI2S_F32::block_left_1st;
@@ -312,32 +339,39 @@ void AudioOutputI2S_F32::isr(void)
 	offsetL = AudioOutputI2S_F32::block_left_offset;
 	offsetR = AudioOutputI2S_F32::block_right_offset;
 
-	int16_t *d = dest;
+	//scale, saturate, and interleave the F32 audio (+/-1.0) straight into the DMA buffer, in one pass
+	const int n = audio_block_samples / 2;
 	if (blockL && blockR) {
 		//memcpy_tointerleaveLR(dest, blockL->data + offsetL, blockR->data + offsetR);
 		//memcpy_tointerleaveLRwLen(dest, blockL->data + offsetL, blockR->data + offsetR, audio_block_samples/2);
-		float32_t *pL = blockL->data + offsetL;
-		float32_t *pR = blockR->data + offsetR;
-		for (int i=0; i < audio_block_samples/2; i++) {	
-			*d++ = (int16_t) *pL++; 
-			*d++ = (int16_t) *pR++; //interleave
-			//*d++ = 0;
-			//*d++ = 0;
-		} 
-		offsetL += audio_block_samples / 2;
-		offsetR += audio_block_samples / 2;
+		if (transfer_32bit) {
+			i2s_f32_to_i32_interleave2(dest, blockL->data + offsetL, blockR->data + offsetR, n);
+		} else {
+			i2s_f32_to_i16_interleave2(dest, blockL->data + offsetL, blockR->data + offsetR, n);
+		}
+		offsetL += n;
+		offsetR += n;
 	} else if (blockL) {
-		//memcpy_tointerleaveLR(dest, blockL->data + offsetL, blockR->data + offsetR);
-		float32_t *pL = blockL->data + offsetL;
-		for (int i=0; i < audio_block_samples / 2 * 2; i+=2) { *(d+i) = (int16_t) *pL++; } //interleave
-		offsetL += audio_block_samples / 2;
+		if (transfer_32bit) {
+			i2s_f32_to_i32_slot(dest, blockL->data + offsetL, n, 2);  //left
+			i2s_f32_to_i32_slot(dest+1, NULL, n, 2);                 //right is silent
+		} else {
+			i2s_f32_to_i16_slot((int16_t *)dest, blockL->data + offsetL, n, 2);  //left
+			i2s_f32_to_i16_slot(((int16_t *)dest)+1, NULL, n, 2);               //right is silent
+		}
+		offsetL += n;
 	} else if (blockR) {
-		float32_t *pR = blockR->data + offsetR;
-		for (int i=0; i < audio_block_samples /2 * 2; i+=2) { *(d+i) = (int16_t) *pR++; } //interleave
-		offsetR += audio_block_samples / 2;
+		if (transfer_32bit) {
+			i2s_f32_to_i32_slot(dest, NULL, n, 2);                   //left is silent
+			i2s_f32_to_i32_slot(dest+1, blockR->data + offsetR, n, 2); //right
+		} else {
+			i2s_f32_to_i16_slot((int16_t *)dest, NULL, n, 2);                   //left is silent
+			i2s_f32_to_i16_slot(((int16_t *)dest)+1, blockR->data + offsetR, n, 2); //right
+		}
+		offsetR += n;
 	} else {
 		//memset(dest,0,AUDIO_BLOCK_SAMPLES * 2);
-		memset(dest,0,audio_block_samples * 2);
+		memset(dest,0,I2S_BUFFER_TO_USE_BYTES / 2);
 		return;
 	}
 	
@@ -367,82 +401,6 @@ void AudioOutputI2S_F32::isr(void)
 #endif
 }
 
-
-/* void AudioOutputI2S_F32::begin(bool transferUsing32bit) {
-
-	dma.begin(true); // Allocate the DMA channel first
-
-	block_left_1st = NULL;
-	block_right_1st = NULL;
-
-	// TODO: should we set & clear the I2S_TCSR_SR bit here?
-	config_i2s(transferUsing32bit);
-
-	CORE_PIN22_CONFIG = PORT_PCR_MUX(6); // pin 22, PTC1, I2S0_TXD0
-
-	//setup DMA parameters
-	//if (transferUsing32bit) {
-		sub_begin_i32();
-	//} else {
-	//	sub_begin_i16();
-	//}
-	
-	dma.triggerAtHardwareEvent(DMAMUX_SOURCE_I2S0_TX);
-	update_responsibility = update_setup();
-	dma.enable();
-
-	I2S0_TCSR = I2S_TCSR_SR;
-	I2S0_TCSR = I2S_TCSR_TE | I2S_TCSR_BCE | I2S_TCSR_FRDE;
-	dma.attachInterrupt(isr_32);
-	
-	// change the I2S frequencies to make the requested sample rate
-	setI2SFreq(AudioOutputI2S_F32::sample_rate_Hz);
-	
-	enabled = 1;
-	
-	//AudioInputI2S_F32::begin_guts();
-} */
-
-/* void AudioOutputI2S_F32::sub_begin_i16(void) {
-	dma.TCD->SADDR = i2s_tx_buffer;
-	dma.TCD->SOFF = 2;
-	dma.TCD->ATTR = DMA_TCD_ATTR_SSIZE(1) | DMA_TCD_ATTR_DSIZE(1);
-	dma.TCD->NBYTES_MLNO = 2;
-	//dma.TCD->SLAST = -sizeof(i2s_tx_buffer);	//original
-	dma.TCD->SLAST = -I2S_BUFFER_TO_USE_BYTES;
-	dma.TCD->DADDR = &I2S0_TDR0;
-	dma.TCD->DOFF = 0;
-	//dma.TCD->CITER_ELINKNO = sizeof(i2s_tx_buffer) / 2;	//original
-	dma.TCD->CITER_ELINKNO = I2S_BUFFER_TO_USE_BYTES / 2;
-	dma.TCD->DLASTSGA = 0;
-	//dma.TCD->BITER_ELINKNO = sizeof(i2s_tx_buffer) / 2;	//original
-	dma.TCD->BITER_ELINKNO = I2S_BUFFER_TO_USE_BYTES / 2;
-	dma.TCD->CSR = DMA_TCD_CSR_INTHALF | DMA_TCD_CSR_INTMAJOR;
-}
-
-void AudioOutputI2S_F32::sub_begin_i32(void) {
-	dma.TCD->SADDR = i2s_tx_buffer; //here's where to get the data from
-	
-	//let's assume that we'll transfer each sample (left or right) independently.  So 4-byte (32bit) transfers.
-	dma.TCD->SOFF = 4;	   //step forward pointer for source data by 4 bytes (ie, 32 bits) after each read
-	dma.TCD->ATTR = DMA_TCD_ATTR_SSIZE(DMA_TCD_ATTR_SIZE_32BIT) | DMA_TCD_ATTR_DSIZE(DMA_TCD_ATTR_SIZE_32BIT); //each read is 32 bits
-	dma.TCD->NBYTES_MLNO = 4;   //how many bytes to send per minor loop. Do each sample (left or right) independently.  So, 4 bytes?   Should be 4 or 8?
-	
-	//dma.TCD->SLAST = -sizeof(i2s_tx_buffer);	//original
-	dma.TCD->SLAST = -I2S_BUFFER_TO_USE_BYTES;  //jump back to beginning of source data when hit the end
-	dma.TCD->DADDR = &I2S0_TDR0;  //destination of DMA transfers
-	dma.TCD->DOFF = 0;  //do not increment the destination pointer
-	//dma.TCD->CITER_ELINKNO = sizeof(i2s_tx_buffer) / 2;	//original
-	dma.TCD->CITER_ELINKNO = I2S_BUFFER_TO_USE_BYTES / 4;   //number of minor loops in a major loop.  I2S_BUFFER_TO_USE_BYTES/NBYTES_MLNO?  Should be 4 or 8?
-	dma.TCD->DLASTSGA = 0;
-	//dma.TCD->BITER_ELINKNO = sizeof(i2s_tx_buffer) / 2;	//original
-	dma.TCD->BITER_ELINKNO = I2S_BUFFER_TO_USE_BYTES / 4;   //number of minor loops in a major loop.  I2S_BUFFER_TO_USE_BYTES/NBYTES_MLNO? should be 4 or 8?
-	dma.TCD->CSR = DMA_TCD_CSR_INTHALF | DMA_TCD_CSR_INTMAJOR;
-}
-
- */
-
-
 /* void AudioOutputI2S_F32::isr_16(void)
 {
 #if defined(KINETISK)
@@ -584,91 +542,6 @@ void AudioOutputI2S_F32::sub_begin_i32(void) {
 #endif
 } */
 
-/* void AudioOutputI2S_F32::isr_32(void)  //should be called every half of an audio block
-{
-	int32_t *dest;  //int32 is the data type being sent to the audio codec
-	audio_block_f32_t *blockL, *blockR;
-	uint32_t saddr; 
-	uint32_t offsetL, offsetR;
-	
-	saddr = (uint32_t)(dma.TCD->SADDR);
-	dma.clearInterrupt();
-	//if (saddr < (uint32_t)i2s_tx_buffer + sizeof(i2s_tx_buffer) / 2) {	//original 16-bit
-	if (saddr < (uint32_t)i2s_tx_buffer + I2S_BUFFER_TO_USE_BYTES / 2) {	//are we transmitting the first half or second half of the buffer?
-		// DMA is transmitting the first half of the buffer
-		// so we must fill the second half
-		//dest = (int16_t *)&i2s_tx_buffer[AUDIO_BLOCK_SAMPLES/2];	//original, half-way through buffer (buffer is 32-bit elements filled with 16-bit stereo samples)
-		dest = (int32_t *)&i2s_tx_buffer[2*(audio_block_samples/2)];  //half-way through the buffer..remember, buffer is 32-bit elements filled with 32-bit stereo samples)
-		if (AudioOutputI2S_F32::update_responsibility) AudioStream_F32::update_all();
-	} else {
-		// DMA is transmitting the second half of the buffer so we must fill the first half
-		dest = (int32_t *)i2s_tx_buffer;  //beginning of the buffer
-	}
-
-	blockL = AudioOutputI2S_F32::block_left_1st;
-	blockR = AudioOutputI2S_F32::block_right_1st;
-	offsetL = AudioOutputI2S_F32::block_left_offset;
-	offsetR = AudioOutputI2S_F32::block_right_offset;
-
-	
-	int32_t *d = dest;
-	if (blockL && blockR) {
-		//memcpy_tointerleaveLR(dest, blockL->data + offsetL, blockR->data + offsetR);
-		//memcpy_tointerleaveLRwLen(dest, blockL->data + offsetL, blockR->data + offsetR, audio_block_samples/2);
-		float32_t *pL = blockL->data + offsetL;
-		float32_t *pR = blockR->data + offsetR;
-		for (int i=0; i < audio_block_samples/2; i++) {	//loop over half of the audio block (this routine gets called every half an audio block)
-			*d++ = (int32_t) (*pL++); 	
-			*d++ = (int32_t) (*pR++); //cast and interleave
-		}
-		offsetL += (audio_block_samples / 2);
-		offsetR += (audio_block_samples / 2);
-	} else if (blockL) {
-		//memcpy_tointerleaveLR(dest, blockL->data + offsetL, blockR->data + offsetR);
-		float32_t *pL = blockL->data + offsetL;
-		for (int i=0; i < audio_block_samples /2; i++) { 
-			*d++ = (int32_t) *pL++;  //cast and interleave
-			*d++ = 0;
-		}
-		offsetL += (audio_block_samples / 2);
-	} else if (blockR) {
-		float32_t *pR = blockR->data + offsetR;
-		for (int i=0; i < audio_block_samples /2; i++) { 
-			*d++ = 0;
-			*d++ = (int32_t) *pR++;  //cast and interleave
-		} 
-		offsetR += (audio_block_samples / 2);
-	} else {
-		//memset(dest,0,AUDIO_BLOCK_SAMPLES * 2);  //half buffer (AUDIO_BLOCK_SAMPLES/2), 16-bits per sample (AUDIO_BLOCK_SAMPLES/2*2), stereo (AUDIO_BLOCK_SAMPLES/2*2*2)
-		//memset(dest,0,audio_block_samples * 2 * 4 / 2);//half buffer (AUDIO_BLOCK_SAMPLES/2), 32-bits per sample (AUDIO_BLOCK_SAMPLES/2*4), stereo (AUDIO_BLOCK_SAMPLES/2*4*2)
-		for (int i=0; i < audio_block_samples/2; i++) {	//loop over half of the audio block (this routine gets called every half an audio block)
-			*d++ = (int32_t) 0; 	
-			*d++ = (int32_t) 0; 
-		}
-		return;
-	}
-
-	//if (offsetL < AUDIO_BLOCK_SAMPLES) { //original
-	if (offsetL < (uint16_t)audio_block_samples) {
-		AudioOutputI2S_F32::block_left_offset = offsetL;
-	} else {
-		AudioOutputI2S_F32::block_left_offset = 0;
-		AudioStream_F32::release(blockL);
-		AudioOutputI2S_F32::block_left_1st = AudioOutputI2S_F32::block_left_2nd;
-		AudioOutputI2S_F32::block_left_2nd = NULL;
-	}
-	//if (offsetR < AUDIO_BLOCK_SAMPLES) {
-	if (offsetR < (uint16_t)audio_block_samples) {
-		AudioOutputI2S_F32::block_right_offset = offsetR;
-	} else {
-		AudioOutputI2S_F32::block_right_offset = 0;
-		AudioStream_F32::release(blockR);
-		AudioOutputI2S_F32::block_right_1st = AudioOutputI2S_F32::block_right_2nd;
-		AudioOutputI2S_F32::block_right_2nd = NULL;
-	}
-
-}
- */
 #define F32_TO_I16_NORM_FACTOR (32767)   //which is 2^15-1
 void AudioOutputI2S_F32::scale_f32_to_i16(float32_t *p_f32, float32_t *p_i16, int len) {
 	for (int i=0; i<len; i++) { *p_i16++ = max(-F32_TO_I16_NORM_FACTOR,min(F32_TO_I16_NORM_FACTOR,(*p_f32++) * F32_TO_I16_NORM_FACTOR)); }
@@ -685,25 +558,13 @@ void AudioOutputI2S_F32::scale_f32_to_i32( float32_t *p_f32, float32_t *p_i32, i
 
 //update has to be carefully coded so that, if audio_blocks are not available, the code exits
 //gracefully and won't hang.  That'll cause the whole system to hang, which would be very bad.
-//static int count = 0;
+//
+//The incoming F32 blocks are held onto (not copied) until isr() has scaled and interleaved them into the
+//DMA buffer, so no working memory is needed here.  isr() releases them when it is done with them.
 void AudioOutputI2S_F32::update(void)
 {
-	// null audio device: discard all incoming data
-	//if (!active) return;
-	//audio_block_t *block = receiveReadOnly();
-	//if (block) release(block);
-
 	audio_block_f32_t *block_f32;
-	audio_block_f32_t *block_f32_scaled = AudioStream_F32::allocate_f32();
-	audio_block_f32_t *block2_f32_scaled = AudioStream_F32::allocate_f32();
-	if ((block_f32_scaled==NULL) || (block2_f32_scaled==NULL)) {
-		//couldn't get some working memory.  Return.
-		if (block_f32_scaled) AudioStream_F32::release(block_f32_scaled);
-		if (block2_f32_scaled) AudioStream_F32::release(block2_f32_scaled);
-		return;
-	}
-	
-	//now that we have our working memory, proceed with getting the audio data and processing
+
 	block_f32 = receiveReadOnly_f32(0); // input 0 = left channel
 	if (block_f32 != NULL) {
 		if (block_f32->length != audio_block_samples) {
@@ -712,79 +573,48 @@ void AudioOutputI2S_F32::update(void)
 			Serial.print(", but I2S settings want it to be = ");
 			Serial.println(audio_block_samples);
 		}
-		//Serial.print("AudioOutputI2S_F32: audio_block_samples = ");
-		//Serial.println(audio_block_samples);
-	
-		//scale F32 to Int32
-		//block_f32_scaled = AudioStream_F32::allocate_f32();
-		//scale_f32_to_i32(block_f32->data, block_f32_scaled->data, audio_block_samples);
-		scale_f32_to_i16(block_f32->data, block_f32_scaled->data, audio_block_samples);
-		
-		//count++;
-		//if (count > 100) {
-		//	Serial.print("AudioOutputI2S_F32::update() orig, scaled = ");
-		//	Serial.print(block_f32->data[30]);
-		//	Serial.print(", ");
-		//	Serial.println(block_f32_scaled->data[30]);
-		//	count=0;
-		//}
 		AudioStream_F32::transmit(block_f32,0);//echo the incoming audio out the outputs
-	} else {
-		//fill with zeros
-		for (int i=0; i<audio_block_samples; i++) block_f32_scaled->data[i] = 0.0f;
-	}
-		
-	//now process the data blocks
-	__disable_irq();
-	if (block_left_1st == NULL) {
-		block_left_1st = block_f32_scaled;
-		block_left_offset = 0;
-		__enable_irq();
-	} else if (block_left_2nd == NULL) {
-		block_left_2nd = block_f32_scaled;
-		__enable_irq();
-	} else {
-		audio_block_f32_t *tmp = block_left_1st;
-		block_left_1st = block_left_2nd;
-		block_left_2nd = block_f32_scaled;
-		block_left_offset = 0;
-		__enable_irq();
-		AudioStream_F32::release(tmp);
+
+		//now queue the data block for the isr
+		__disable_irq();
+		if (block_left_1st == NULL) {
+			block_left_1st = block_f32;
+			block_left_offset = 0;
+			__enable_irq();
+		} else if (block_left_2nd == NULL) {
+			block_left_2nd = block_f32;
+			__enable_irq();
+		} else {
+			audio_block_f32_t *tmp = block_left_1st;
+			block_left_1st = block_left_2nd;
+			block_left_2nd = block_f32;
+			block_left_offset = 0;
+			__enable_irq();
+			AudioStream_F32::release(tmp);
+		}
 	}
-	AudioStream_F32::release(block_f32); 
 
-	
-	block_f32_scaled = block2_f32_scaled;  //this is simply renaming the pre-allocated buffer
 	block_f32 = receiveReadOnly_f32(1); // input 1 = right channel
 	if (block_f32 != NULL) {
-		//scale F32 to Int32
-		//block_f32_scaled = AudioStream_F32::allocate_f32();
-		//scale_f32_to_i32(block_f32->data, block_f32_scaled->data, audio_block_samples);
-		scale_f32_to_i16(block_f32->data, block_f32_scaled->data, audio_block_samples);
 		AudioStream_F32::transmit(block_f32,1);//echo the incoming audio out the outputs
-	} else {
-		//fill with zeros
-		for (int i=0; i<audio_block_samples; i++) block_f32_scaled->data[i] = 0.0f;
-	}
-		
-	__disable_irq();
-	if (block_right_1st == NULL) {
-		block_right_1st = block_f32_scaled;
-		block_right_offset = 0;
-		__enable_irq();
-	} else if (block_right_2nd == NULL) {
-		block_right_2nd = block_f32_scaled;
-		__enable_irq();
-	} else {
-		audio_block_f32_t *tmp = block_right_1st;
-		block_right_1st = block_right_2nd;
-		block_right_2nd = block_f32_scaled;
-		block_right_offset = 0;
-		__enable_irq();
-		AudioStream_F32::release(tmp);
-	}
-	AudioStream_F32::release(block_f32); 
 
+		__disable_irq();
+		if (block_right_1st == NULL) {
+			block_right_1st = block_f32;
+			block_right_offset = 0;
+			__enable_irq();
+		} else if (block_right_2nd == NULL) {
+			block_right_2nd = block_f32;
+			__enable_irq();
+		} else {
+			audio_block_f32_t *tmp = block_right_1st;
+			block_right_1st = block_right_2nd;
+			block_right_2nd = block_f32;
+			block_right_offset = 0;
+			__enable_irq();
+			AudioStream_F32::release(tmp);
+		}
+	}
 }
 
 #if defined(KINETISK) || defined(KINETISL)
@@ -996,6 +826,7 @@ void AudioOutputI2Sslave_F32::begin(void)
 	//pinMode(2, OUTPUT);
 	block_left_1st = NULL;
 	block_right_1st = NULL;
+	transfer_32bit = false;  //the slave version only does 16-bit transfers
 
 	AudioOutputI2Sslave_F32::config_i2s();
 
@@ -67,9 +67,10 @@ public:
 	
 	void update(void) override;
 	void begin(void);
-	void begin(bool);
+	void begin(bool);  //true for 32-bit DMA transfers (24-bit audio; needs the build flag I2S_F32_ENABLE_32BIT_TRANSFERS or a user-supplied buffer).  Construct with flag_callBegin = false, then call this.
 	void sub_begin_i32(void);
 	void sub_begin_i16(void);
+	static bool get_isTransferUsing32bit(void) { return transfer_32bit; }
 	friend class AudioInputI2S_F32;
 
 	#if defined(__IMXRT1062__)
@@ -86,7 +87,7 @@ public:
 	static void scale_f32_to_i24( float32_t *p_f32, float32_t *p_i16, int len) ;
 	static void scale_f32_to_i32( float32_t *p_f32, float32_t *p_i32, int len) ;
 	static float setI2SFreq_T3(const float);
-	static uint32_t *i2s_tx_buffer;
+	static uint32_t *i2s_tx_buffer;  //for 32-bit transfers, any user-supplied buffer must be 2*audio_block_samples long
 protected:
 	AudioOutputI2S_F32(int dummy): AudioStream_F32(2, inputQueueArray) {} // to be used only inside AudioOutputI2Sslave !!
 	static void config_i2s(void);
@@ -98,6 +99,7 @@ protected:
 	static audio_block_f32_t *block_left_1st;
 	static audio_block_f32_t *block_right_1st;
 	static bool update_responsibility;
+	static bool transfer_32bit;
 	static DMAChannel dma;
 	static void isr_16(void);
 	static void isr_32(void);
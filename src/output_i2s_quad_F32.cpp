@@ -34,6 +34,7 @@
 #include "output_i2s_quad_F32.h"
 //include "memcpy_audio.h"
 #include "utility/memcpy_audio_tympan.h"
+#include "utility/i2s_convert_f32.h"  //for scaling, saturating, and interleaving straight into the DMA buffer
 #include <arm_math.h>
 #include "output_i2s_F32.h"  //for config_i2s() and setI2Sfreq_T3()
 
@@ -63,9 +64,10 @@ uint32_t  AudioOutputI2SQuad_F32::ch4_offset = 0;
 //q15_t AudioOutputI2SQuad_F32::tmp_src4[AUDIO_BLOCK_SAMPLES/2];
 
 bool AudioOutputI2SQuad_F32::update_responsibility = false;
+bool AudioOutputI2SQuad_F32::transfer_32bit = false;
 //DMAMEM __attribute__((aligned(32))) static uint32_t i2s_tx_buffer[MAX_AUDIO_BLOCK_SAMPLES_F32/2*4];  //pack 2 int16s into 1 int32 to make dense, so that 4 channels = 4*(audio_block_samples/2)
 //DMAMEM static uint32_t i2s_tx_buffer[AUDIO_BLOCK_SAMPLES*4];  //pack 1 int32 into 1 int32 to make dense, so that 4 channels = 4*(audio_block_samples)
-DMAMEM __attribute__((aligned(32))) static uint32_t i2s_default_tx_buffer[MAX_AUDIO_BLOCK_SAMPLES_F32/2*4];  //pack 2 int16s into 1 int32 to make dense, so that 4 channels = 4*(audio_block_samples/2)
+DMAMEM __attribute__((aligned(32))) static uint32_t i2s_default_tx_buffer[MAX_AUDIO_BLOCK_SAMPLES_F32/2*4*I2S_F32_DMA_BUFFER_SCALE];  //16-bit transfers pack 2 int16s into 1 int32.  Only big enough for 32-bit transfers (one int32 per sample) if I2S_F32_ENABLE_32BIT_TRANSFERS
 uint32_t * AudioOutputI2SQuad_F32::i2s_tx_buffer = i2s_default_tx_buffer;
 DMAChannel AudioOutputI2SQuad_F32::dma(false);
 
@@ -78,18 +80,31 @@ float32_t * AudioOutputI2SQuad_F32::zerodata = default_zerodata;
 float AudioOutputI2SQuad_F32::sample_rate_Hz = AUDIO_SAMPLE_RATE;
 int AudioOutputI2SQuad_F32::audio_block_samples = MAX_AUDIO_BLOCK_SAMPLES_F32;
 
-//for 16-bit transfers (into a 32-bit data type) multiplied by 4 channels
-#define I2S_BUFFER_TO_USE_BYTES ((AudioOutputI2SQuad_F32::audio_block_samples)*4*sizeof(i2s_tx_buffer[0])/2)
-
-
-//for 32-bit transfers (into a 32-bit data type) multiplied by 4 channels
-//#define I2S_BUFFER_TO_USE_BYTES ((AudioOutputI2SQuad_F32::audio_block_samples)*4*sizeof(i2s_tx_buffer[0]))
+//for 16-bit transfers (into a 32-bit data type) multiplied by 4 channels, or for 32-bit transfers (one 32-bit data type per sample)
+#define I2S_BUFFER_TO_USE_BYTES ((AudioOutputI2SQuad_F32::audio_block_samples)*4*sizeof(i2s_tx_buffer[0])/(AudioOutputI2SQuad_F32::transfer_32bit ? 1 : 2))
 
 void AudioOutputI2SQuad_F32::begin(void)
+{
+	bool transferUsing32bit = false;
+	begin(transferUsing32bit);
+}
+
+void AudioOutputI2SQuad_F32::begin(bool transferUsing32bit)
 {
 	//Serial.println("AudioOutputI2SQuad_F32: begin: starting...");
 	dma.begin(true); // Allocate the DMA channel first
 
+	#if defined(KINETISK)
+		//the Teensy 3.x quad I2S uses 16-bit slots, so there is nothing more to carry
+		if (transferUsing32bit) Serial.println("AudioOutputI2SQuad_F32: begin: *** WARNING ***: 32-bit transfers need Teensy 4.  Using 16-bit.");
+		transferUsing32bit = false;
+	#endif
+	if (transferUsing32bit && !I2S_F32_ENABLE_32BIT_TRANSFERS && (i2s_tx_buffer == i2s_default_tx_buffer)) {
+		Serial.println("AudioOutputI2SQuad_F32: begin: *** WARNING ***: 32-bit transfers need I2S_F32_ENABLE_32BIT_TRANSFERS (or a user-supplied buffer).  Using 16-bit.");
+		transferUsing32bit = false;
+	}
+	transfer_32bit = transferUsing32bit;
+
 	block_ch1_1st = NULL;
 	block_ch2_1st = NULL;
 	block_ch3_1st = NULL;
@@ -130,7 +145,6 @@ void AudioOutputI2SQuad_F32::begin(void)
 	
 		const int pinoffset = 0; // TODO: make this configurable...
 		//memset(i2s_tx_buffer, 0, sizeof(i2s_tx_buffer)); //WEA 2023-09-28: commented out because we've already initialized the array to zero when we created the array 
-		bool transferUsing32bit = false;  //32 bit from AIC doesn't work with quad?  so don't change this?
 		AudioOutputI2S_F32::config_i2s(transferUsing32bit,AudioOutputI2SQuad_F32::sample_rate_Hz);
 		I2S1_TCR3 = I2S_TCR3_TCE_2CH << pinoffset;
 		switch (pinoffset) {
@@ -147,14 +161,25 @@ void AudioOutputI2SQuad_F32::begin(void)
 			CORE_PIN6_CONFIG  = 3;
 		}
 		dma.TCD->SADDR = i2s_tx_buffer;
-		dma.TCD->SOFF = 2;  //is 2 in Teensy 
-		dma.TCD->ATTR = DMA_TCD_ATTR_SSIZE(1) | DMA_TCD_ATTR_DSIZE(1);
-		dma.TCD->NBYTES_MLOFFYES = DMA_TCD_NBYTES_DMLOE |
-			DMA_TCD_NBYTES_MLOFFYES_MLOFF(-8) |
-			DMA_TCD_NBYTES_MLOFFYES_NBYTES(4);
+		if (transfer_32bit) {
+			//each minor loop writes one whole 32-bit slot to each of the two data lines
+			dma.TCD->SOFF = 4;
+			dma.TCD->ATTR = DMA_TCD_ATTR_SSIZE(2) | DMA_TCD_ATTR_DSIZE(2);
+			dma.TCD->NBYTES_MLOFFYES = DMA_TCD_NBYTES_DMLOE |
+				DMA_TCD_NBYTES_MLOFFYES_MLOFF(-8) |
+				DMA_TCD_NBYTES_MLOFFYES_NBYTES(8);
+			dma.TCD->DADDR = (void *)((uint32_t)&I2S1_TDR0 + pinoffset * 4);
+		} else {
+			//each minor loop writes the upper 16 bits of the slot on each of the two data lines
+			dma.TCD->SOFF = 2;  //is 2 in Teensy 
+			dma.TCD->ATTR = DMA_TCD_ATTR_SSIZE(1) | DMA_TCD_ATTR_DSIZE(1);
+			dma.TCD->NBYTES_MLOFFYES = DMA_TCD_NBYTES_DMLOE |
+				DMA_TCD_NBYTES_MLOFFYES_MLOFF(-8) |
+				DMA_TCD_NBYTES_MLOFFYES_NBYTES(4);
+			dma.TCD->DADDR = (void *)((uint32_t)&I2S1_TDR0 + 2 + pinoffset * 4);
+		}
 		//dma.TCD->SLAST = -sizeof(i2s_tx_buffer); //original from Teensy Audio Library
 		dma.TCD->SLAST = -I2S_BUFFER_TO_USE_BYTES; //allows for variable audio block length
-		dma.TCD->DADDR = (void *)((uint32_t)&I2S1_TDR0 + 2 + pinoffset * 4);
 		dma.TCD->DOFF = 4;
 		//dma.TCD->CITER_ELINKNO = AUDIO_BLOCK_SAMPLES * 2; //original from Teensy Audio Library (16-bit)
 		dma.TCD->CITER_ELINKNO = audio_block_samples * 2; //allows for variable audio block length (assumes 16-bit?)
@@ -200,7 +225,7 @@ void AudioOutputI2SQuad_F32::isr_shuffleDataBlocks(audio_block_f32_t *&block_1st
 	uint32_t saddr;
 	float32_t *src1, *src2, *src3, *src4;
 	float32_t *zeros = (float32_t *)zerodata;
-	int16_t *dest;
+	uint32_t *dest;
 	
 	//update the dma and get pointer for the destination tx buffer
 	saddr = (uint32_t)(dma.TCD->SADDR);
@@ -209,10 +234,10 @@ void AudioOutputI2SQuad_F32::isr_shuffleDataBlocks(audio_block_f32_t *&block_1st
 	if (saddr < (uint32_t)i2s_tx_buffer + I2S_BUFFER_TO_USE_BYTES / 2) { //variable audio block length
 		// DMA is transmitting the first half of the buffer so we must fill the second half
 		//dest = (int16_t *)&i2s_tx_buffer[AUDIO_BLOCK_SAMPLES]; //orig
-		dest = (int16_t *)&i2s_tx_buffer[audio_block_samples]; //new
+		dest = (uint32_t *)((uint32_t)i2s_tx_buffer + I2S_BUFFER_TO_USE_BYTES / 2); //new
 		if (AudioOutputI2SQuad_F32::update_responsibility) AudioStream_F32::update_all();
 	} else {
-		dest = (int16_t *)i2s_tx_buffer;  //start of the TX buffer
+		dest = i2s_tx_buffer;  //start of the TX buffer
 	}
 
 	//get pointers for source data that we will copy into the tx buffer
@@ -251,15 +276,13 @@ void AudioOutputI2SQuad_F32::isr_shuffleDataBlocks(audio_block_f32_t *&block_1st
 //		*d++ = (int16_t)((q15_t)(*src4++ * 32768)); //right 2...does the q15_t ensure saturating math?
 //	}
 	
-	//This block of code assumes that the audio data HAS ALREADY been scaled to +/-32767.0
-	//interleave the given source data into the output array
-	int16_t *d = dest;
-	for (int i=0; i < audio_block_samples / 2; i++) {
-		*d++ = (int16_t)(*src1++); //left 1
-		*d++ = (int16_t)(*src3++); //left 2  (note it is src3, not src2!!!)
-		*d++ = (int16_t)(*src2++); //right 1 (note it is src2, not src3!!!
-		*d++ = (int16_t)(*src4++); //right 2
-	}	
+	//The audio data is still F32 (+/-1.0).  Scale, saturate, and interleave it straight into the DMA buffer,
+	//in one pass.  The slot order is left 1, left 2, right 1, right 2, which is src1, src3, src2, src4!!!
+	if (transfer_32bit) {
+		i2s_f32_to_i32_interleave4(dest, src1, src3, src2, src4, audio_block_samples / 2);
+	} else {
+		i2s_f32_to_i16_interleave4(dest, src1, src3, src2, src4, audio_block_samples / 2);
+	}
 
 #endif
 	//arm_dcache_flush_delete(dest, sizeof(i2s_tx_buffer) / 2 );  //clear out this number of bytes..which should equal AUDIO_BLOCK_SAMPLES/2 * 4chan * 2bytes/samp
@@ -294,69 +317,49 @@ void AudioOutputI2SQuad_F32::scale_f32_to_i32( float32_t *p_f32, float32_t *p_i3
 void AudioOutputI2SQuad_F32::update_1chan(const int chan,  //this is not changed upon return
 		audio_block_f32_t *&block_1st, audio_block_f32_t *&block_2nd, uint32_t &ch_offset) //all three of these are changed upon return  
 {
-
-	//get some working memory
-	audio_block_f32_t *block_f32_scaled = AudioStream_F32::allocate_f32(); //allocate for scaled data (from F32 scale of +/- 1.0 to int16 scale of +/- 32767)
-	if (block_f32_scaled==NULL) return;  //fail
-	
 	//Receive the incoming audio blocks
 	audio_block_f32_t *block_f32 = receiveReadOnly_f32(chan); // get one channel
 
-	//Is there any data?
-	if (block_f32 == NULL) {
-		//Serial.print("Output_i2s_quad: update: did not receive chan " + String(chan));
-		
-		//fill with zeros
-		for (int i=0; i<audio_block_samples; i++) block_f32_scaled->data[i] = 0.0f;
+	//Is there any data?  If not, the isr() will send zeros for this channel
+	if (block_f32 == NULL) return;
 
-	} else {
-		//Process the given data	
-		if (chan == 0) {
-			if (block_f32->length != audio_block_samples) {
-				Serial.print("AudioOutputI2SQuad_F32: *** WARNING ***: audio_block says len = ");
-				Serial.print(block_f32->length);
-				Serial.print(", but I2S settings want it to be = ");
-				Serial.println(audio_block_samples);
-			}
-		} 
-		
-		//scale the F32 data (+/- 1.0) to fit within Int16 (+/- 32767.0), though we're still float32 data type
-		AudioOutputI2S_F32::scale_f32_to_i16(block_f32->data, block_f32_scaled->data, audio_block_samples);
-		block_f32_scaled->length = block_f32->length;
-		block_f32_scaled->id = block_f32->id;
-		block_f32_scaled->fs_Hz  = block_f32->fs_Hz;
-		
-		//transmit and release the original (not scaled) audio data
-		AudioStream_F32::transmit(block_f32, chan);
-		AudioStream_F32::release(block_f32);
-	}
+	if (chan == 0) {
+		if (block_f32->length != audio_block_samples) {
+			Serial.print("AudioOutputI2SQuad_F32: *** WARNING ***: audio_block says len = ");
+			Serial.print(block_f32->length);
+			Serial.print(", but I2S settings want it to be = ");
+			Serial.println(audio_block_samples);
+		}
+	} 
+	
+	//transmit the original audio data...but keep holding onto it (it is not copied or scaled here) for the isr()
+	AudioStream_F32::transmit(block_f32, chan);
 	
-	//shuffle the scaled data between the two buffers that the isr() routines looks for
+	//shuffle the data between the two buffers that the isr() routines looks for
 	__disable_irq();
 	if (block_1st == NULL) {
-		block_1st = block_f32_scaled; //here were are temporarily holding onto the working memory for use by the isr()
+		block_1st = block_f32; //here were are holding onto the audio data for use by the isr()
 		ch_offset = 0;
 		__enable_irq();
 	} else if (block_2nd == NULL) {
-		block_2nd = block_f32_scaled; //here were are temporarily holding onto the working memory for use by the isr()
+		block_2nd = block_f32; //here were are holding onto the audio data for use by the isr()
 		__enable_irq();
 	} else {
 		audio_block_f32_t *tmp = block_1st;
 		block_1st = block_2nd;
-		block_2nd = block_f32_scaled; //here were are temporarily holding onto the working memory for use by the isr()
+		block_2nd = block_f32; //here were are holding onto the audio data for use by the isr()
 		ch_offset = 0;
 		__enable_irq();
-		AudioStream_F32::release(tmp);  //here we are releaseing an older audio buffer used as working memory
+		AudioStream_F32::release(tmp);  //here we are releasing an older audio block that the isr() never got to
 	}
 
 }
 
 //This routine receives an audio block of F32 data from audio processing
 //routines.  This routine will receive one block from each audio channel.
-//This routine must receive that data, scale it (not convert it) to I16 fullscale
-//from F32 fullscale, and stage it (via the correct pointers) so that the isr
-// can find all four audio blocks, cast them to I16, interleave them, and put them
-//into the DMA that the I2S peripheral pulls from.
+//This routine must receive that data and stage it (via the correct pointers) so that
+//the isr can find all four audio blocks, scale and saturate them to I16, interleave
+//them, and put them into the DMA that the I2S peripheral pulls from.
 void AudioOutputI2SQuad_F32::update(void)
 {
 	update_1chan(0, block_ch1_1st, block_ch1_2nd, ch1_offset);
@@ -68,6 +68,8 @@ public:
 	}
 	virtual void update(void);
 	void begin(void);
+	void begin(bool);  //true for 32-bit DMA transfers (24-bit audio, Teensy 4 only; needs the build flag I2S_F32_ENABLE_32BIT_TRANSFERS or a user-supplied buffer).  Construct with flag_callBegin = false, then call this.
+	static bool get_isTransferUsing32bit(void) { return transfer_32bit; }
 	friend class AudioInputI2SBase_F32;
 	friend class AudioInputI2S_F32;
 	friend class AudioInputI2SQuad_F32;
@@ -75,7 +77,7 @@ public:
 	//static void scale_f32_to_i16( float32_t *p_f32, float32_t *p_i16, int len) ;
 	//static void scale_f32_to_i24( float32_t *p_f32, float32_t *p_i16, int len) ;
 	//static void scale_f32_to_i32( float32_t *p_f32, float32_t *p_i32, int len) ;
-	static uint32_t *i2s_tx_buffer;
+	static uint32_t *i2s_tx_buffer;  //for 32-bit transfers, any user-supplied buffer must be 4*audio_block_samples long
 protected: 
 	static void config_i2s(void);
 	static audio_block_f32_t *block_ch1_1st;
@@ -83,6 +85,7 @@ protected:
 	static audio_block_f32_t *block_ch3_1st;
 	static audio_block_f32_t *block_ch4_1st;
 	static bool update_responsibility;
+	static bool transfer_32bit;
 	static DMAChannel dma;
 	static void isr(void);
 	static void isr_shuffleDataBlocks(audio_block_f32_t *&, audio_block_f32_t *&, uint32_t &);
@@ -2,8 +2,18 @@
 #define _FreqWeighting_IEC1672_h
 //These filter coefficients were written by the Matlab code "make_A_C_weighting_sos.m
  
+#define Z_WEIGHT 0   //no weighting (ie, flat).  Not handled by this class, but used by AudioCalcSoundLevel_F32
 #define A_WEIGHT 1
 #define C_WEIGHT 3
+
+#include <math.h>
+
+//analog prototype (IEC 61672-1, Annex E).  Pole frequencies in Hz
+#define IEC1672_F1_HZ  (20.598997)
+#define IEC1672_F2_HZ  (107.65265)
+#define IEC1672_F3_HZ  (737.86223)
+#define IEC1672_F4_HZ  (12194.217)
+#define IEC1672_MAX_DESIGN_SOS (3)   //max number of second-order sections from designFilter_matlab_sos()
  
 class FreqWeighting_IEC1672 {
   public:
@@ -53,7 +63,104 @@ class FreqWeighting_IEC1672 {
 		}
 		return coeff;
 	}
- 
+
+	//Is there a pre-computed filter for this sample rate?  (the tables only cover a few sample rates)
+	bool hasTableForSampleRate(float32_t targ_fs_Hz, float32_t tol_frac = 0.001f) {
+		int ind = findIndexForSampleRate(targ_fs_Hz);
+		return (fabsf(all_fs_Hz[ind] - targ_fs_Hz) <= tol_frac*targ_fs_Hz);
+	}
+
+	// ///////////////////////// Runtime design for any sample rate
+
+	//Design the filter via the bilinear transform of the analog prototype.  Writes the coefficients
+	//into sos[] (Matlab convention, 6 values per section) and returns the number of sections.
+	//   * use_prewarp: pre-warp the low-frequency poles so that each corner lands at the right frequency
+	//   * use_shelf_fix: the bilinear transform maps the f4 poles' zeros-at-infinity onto Nyquist, which
+	//     pulls the top of the band down much too far at the lower sample rates.  Instead, the f4 section is
+	//     built from matched poles and zeros that are moved off of Nyquist so that its gain at DC and at
+	//     Nyquist equals the analog prototype's (making it a gentle high-frequency shelf rather than a notch).
+	//The response is then scaled to match the standard at 1 kHz.
+	static int designFilter_matlab_sos(int type, float32_t fs_Hz, float32_t *sos, bool use_prewarp = true, bool use_shelf_fix = true) {
+		double f1 = prewarp_Hz(IEC1672_F1_HZ, fs_Hz, use_prewarp);
+		double f2 = prewarp_Hz(IEC1672_F2_HZ, fs_Hz, use_prewarp);
+		double f3 = prewarp_Hz(IEC1672_F3_HZ, fs_Hz, use_prewarp);
+
+		//the high-pass parts of the response (zeros at DC), via the bilinear transform
+		int n_sos = 0;
+		makeHighpassSection(fs_Hz, f1, f1, sos + 6*(n_sos++));
+		if (type != C_WEIGHT) makeHighpassSection(fs_Hz, f2, f3, sos + 6*(n_sos++));
+
+		//the low-pass part of the response (the two poles at f4)
+		if (use_shelf_fix) {
+			makeMatchedLowpassSection(fs_Hz, IEC1672_F4_HZ, sos + 6*(n_sos++));
+		} else {
+			makeBilinearLowpassSection(fs_Hz, prewarp_Hz(IEC1672_F4_HZ, fs_Hz, use_prewarp), sos + 6*(n_sos++));
+		}
+
+		//scale the first section so that the gain at 1 kHz matches the standard
+		double scale = pow(10.0, (analogResponse_dB(type, 1000.0) - digitalResponse_dB(sos, n_sos, 1000.0, fs_Hz)) / 20.0);
+		for (int i = 0; i < 3; i++) sos[i] = (float32_t)(sos[i] * scale);
+		return n_sos;
+	}
+
+	//response of the analog prototype, including the normalization constants so that it is 0 dB at 1 kHz
+	static double analogResponse_dB(int type, double f_Hz) {
+		const double f1 = IEC1672_F1_HZ, f2 = IEC1672_F2_HZ, f3 = IEC1672_F3_HZ, f4 = IEC1672_F4_HZ;
+		double ff = f_Hz*f_Hz;
+		if (type == C_WEIGHT) {
+			double r = (f4*f4*ff) / ((ff + f1*f1) * (ff + f4*f4));
+			return 20.0*log10(r) + 0.0619;
+		}
+		double r = (f4*f4*ff*ff) / ((ff + f1*f1) * sqrt((ff + f2*f2)*(ff + f3*f3)) * (ff + f4*f4));
+		return 20.0*log10(r) + 1.9997;
+	}
+
+	//response of a cascade of second-order sections (Matlab convention)
+	static double digitalResponse_dB(const float32_t *sos, int n_sos, double f_Hz, double fs_Hz) {
+		const double w = 2.0*M_PI*f_Hz/fs_Hz, c1 = cos(w), s1 = sin(w), c2 = cos(2.0*w), s2 = sin(2.0*w);
+		double mag2 = 1.0;
+		for (int i = 0; i < n_sos; i++) {
+			const float32_t *c = sos + 6*i;
+			double br = c[0] + c[1]*c1 + c[2]*c2, bi = -(c[1]*s1 + c[2]*s2);
+			double ar = c[3] + c[4]*c1 + c[5]*c2, ai = -(c[4]*s1 + c[5]*s2);
+			mag2 *= (br*br + bi*bi) / (ar*ar + ai*ai);
+		}
+		return 10.0*log10(mag2);
+	}
+
+  protected:
+	static double prewarp_Hz(double f_Hz, double fs_Hz, bool use_prewarp) {
+		if ((!use_prewarp) || (f_Hz > 0.4*fs_Hz)) return f_Hz;  //too close to Nyquist (tan() blows up)
+		return (fs_Hz / M_PI) * tan(M_PI * f_Hz / fs_Hz);
+	}
+
+	//s^2 / ((s + 2*pi*fa)(s + 2*pi*fb)) via the bilinear transform.  Both zeros are at DC (z = 1).
+	static void makeHighpassSection(double fs_Hz, double fa_Hz, double fb_Hz, float32_t *c) {
+		const double k = 2.0*fs_Hz, wa = 2.0*M_PI*fa_Hz, wb = 2.0*M_PI*fb_Hz;
+		const double pa = (k - wa) / (k + wa), pb = (k - wb) / (k + wb);
+		c[0] = 1.0f; c[1] = -2.0f; c[2] = 1.0f;
+		c[3] = 1.0f; c[4] = (float32_t)(-(pa + pb)); c[5] = (float32_t)(pa*pb);
+	}
+
+	//w^2 / (s + w)^2 via the bilinear transform.  Both zeros end up at Nyquist (z = -1).
+	static void makeBilinearLowpassSection(double fs_Hz, double f_Hz, float32_t *c) {
+		const double k = 2.0*fs_Hz, w = 2.0*M_PI*f_Hz;
+		const double p = (k - w) / (k + w), g = (1.0 - p)*(1.0 - p) / 4.0;  //unity gain at DC
+		c[0] = (float32_t)g; c[1] = (float32_t)(2.0*g); c[2] = (float32_t)g;
+		c[3] = 1.0f; c[4] = (float32_t)(-2.0*p); c[5] = (float32_t)(p*p);
+	}
+
+	//w^2 / (s + w)^2 as the square of a first-order section g*(1 + b z^-1)/(1 - p z^-1).  The pole is
+	//matched (p = exp(-w/fs)) and the zero is placed so that the gain at DC and at Nyquist equal the analog values.
+	static void makeMatchedLowpassSection(double fs_Hz, double f_Hz, float32_t *c) {
+		const double w = 2.0*M_PI*f_Hz, w_nyq = M_PI*fs_Hz;
+		const double p = exp(-w / fs_Hz);
+		const double H_nyq = w / sqrt(w*w + w_nyq*w_nyq);  //analog gain of one first-order factor at Nyquist
+		const double g = 0.5*((1.0 - p) + (1.0 + p)*H_nyq);
+		const double b = 0.5*((1.0 - p) - (1.0 + p)*H_nyq) / g;
+		c[0] = (float32_t)(g*g); c[1] = (float32_t)(2.0*g*g*b); c[2] = (float32_t)(g*g*b*b);
+		c[3] = 1.0f; c[4] = (float32_t)(-2.0*p); c[5] = (float32_t)(p*p);
+	}
  
 };
  
@@ -0,0 +1,407 @@
+
+#include "flac_codec.h"
+#include <string.h>  //for memset
+
+// ///////////////////////////////////////////////////////////////////// CRCs
+
+static uint8_t crc8_table[256];
+static uint16_t crc16_table[256];
+static bool crc_tables_ready = false;
+
+static void flac_make_crc_tables(void) {
+	for (int i = 0; i < 256; i++) {
+		uint8_t c8 = (uint8_t)i;
+		for (int b = 0; b < 8; b++) c8 = (c8 & 0x80) ? (uint8_t)((c8 << 1) ^ 0x07) : (uint8_t)(c8 << 1);  //x^8 + x^2 + x + 1
+		crc8_table[i] = c8;
+		uint16_t c16 = (uint16_t)(i << 8);
+		for (int b = 0; b < 8; b++) c16 = (c16 & 0x8000) ? (uint16_t)((c16 << 1) ^ 0x8005) : (uint16_t)(c16 << 1);  //x^16 + x^15 + x^2 + 1
+		crc16_table[i] = c16;
+	}
+	crc_tables_ready = true;
+}
+
+uint8_t flac_crc8(const uint8_t *buf, uint32_t len) {
+	if (!crc_tables_ready) flac_make_crc_tables();
+	uint8_t crc = 0;
+	for (uint32_t i = 0; i < len; i++) crc = crc8_table[crc ^ buf[i]];
+	return crc;
+}
+
+uint16_t flac_crc16(const uint8_t *buf, uint32_t len) {
+	if (!crc_tables_ready) flac_make_crc_tables();
+	uint16_t crc = 0;
+	for (uint32_t i = 0; i < len; i++) crc = (uint16_t)((crc << 8) ^ crc16_table[(crc >> 8) ^ buf[i]]);
+	return crc;
+}
+
+// ///////////////////////////////////////////////////////////////////// Encoder
+
+int FlacEncoder::setup(int _nchan, uint32_t sampleRate_Hz, int bitsPerSample, int blockSize) {
+	if ((_nchan < 1) || (_nchan > FLAC_MAX_CHANNELS)) return -1;
+	if ((bitsPerSample != 16) && (bitsPerSample != 24)) return -1;
+	if ((blockSize < 16) || (blockSize > 65535) || (sampleRate_Hz == 0) || (sampleRate_Hz > 655350)) return -1;
+	if (blockSize != block_size) {
+		delete[] residual;
+		residual = new int32_t[blockSize];
+		if (residual == 0) { block_size = 0; return -1; }
+	}
+	nchan = _nchan; fs_Hz = sampleRate_Hz; bps = bitsPerSample; block_size = blockSize;
+	frame_number = 0; min_frame_bytes = 0; max_frame_bytes = 0; total_samples = 0; total_bytes = 0;
+	if (!crc_tables_ready) flac_make_crc_tables();  //do it now, rather than during the first frame
+	return 0;
+}
+
+int FlacEncoder::writeStreamHeader(uint8_t *dest, int total_bytes_header) {
+	FlacBitWriter w;
+	w.begin(dest);
+	w.put(0x664C6143, 32);  //"fLaC"
+	bool add_padding = (total_bytes_header >= FLAC_STREAMINFO_BYTES + 4);
+
+	//STREAMINFO
+	w.put(add_padding ? 0 : 1, 1);  //is this the last metadata block?
+	w.put(0, 7);                    //STREAMINFO
+	w.put(34, 24);                  //length
+	w.put(block_size, 16);          //min block size (the last frame does not count)
+	w.put(block_size, 16);          //max block size
+	w.put(min_frame_bytes, 24);     //zero means unknown
+	w.put(max_frame_bytes, 24);
+	w.put(fs_Hz, 20);
+	w.put(nchan - 1, 3);
+	w.put(bps - 1, 5);
+	w.put((uint32_t)(total_samples >> 32), 4);
+	w.put((uint32_t)total_samples, 32);
+	for (int i = 0; i < 4; i++) w.put(0, 32);  //MD5 is unknown
+
+	//PADDING, to fill out the header
+	if (add_padding) {
+		int n_pad = total_bytes_header - FLAC_STREAMINFO_BYTES - 4;
+		w.put(1, 1); w.put(1, 7); w.put(n_pad, 24);
+		memset(dest + FLAC_STREAMINFO_BYTES + 4, 0, n_pad);
+		return total_bytes_header;
+	}
+	return FLAC_STREAMINFO_BYTES;
+}
+
+void FlacEncoder::beginFrame(int nsamps, uint8_t *dest) {
+	frame_start = dest;
+	frame_nsamps = nsamps;
+	bw.begin(dest);
+
+	//block size code
+	int bs_code = 7, bs_extra_bits = 16;  //16-bit (blocksize-1) at the end of the header
+	for (int j = 0; j < 8; j++) if (nsamps == (256 << j)) { bs_code = 8 + j; bs_extra_bits = 0; }
+	if ((bs_code == 7) && (nsamps <= 256)) { bs_code = 6; bs_extra_bits = 8; }
+
+	bw.put(0x3FFE, 14);   //sync code
+	bw.put(0, 1);         //reserved
+	bw.put(0, 1);         //fixed block size
+	bw.put(bs_code, 4);
+	bw.put(0, 4);         //sample rate: see STREAMINFO
+	bw.put(nchan - 1, 4); //independent channels
+	bw.put((bps == 24) ? 6 : 4, 3);  //sample size
+	bw.put(0, 1);         //reserved
+
+	//the frame number, coded like UTF-8
+	uint32_t fn = frame_number;
+	if (fn < 0x80) {
+		bw.put(fn, 8);
+	} else {
+		int n_extra = 1;
+		while ((n_extra < 5) && (fn >= (1u << (6 + 5 * n_extra)))) n_extra++;  //how many continuation bytes?
+		bw.put(((1u << (n_extra + 1)) - 1) << 1, n_extra + 2);  //leading ones, then a zero
+		bw.put(fn >> (6 * n_extra), 8 - (n_extra + 2));
+		for (int i = n_extra - 1; i >= 0; i--) { bw.put(2, 2); bw.put(fn >> (6 * i), 6); }
+	}
+	if (bs_extra_bits) bw.put(nsamps - 1, bs_extra_bits);
+	bw.put(flac_crc8(frame_start, bw.getNumBytes()), 8);
+}
+
+void FlacEncoder::putVerbatim(const int32_t *x, int n) {
+	bw.put(0, 1); bw.put(1, 6); bw.put(0, 1);
+	for (int i = 0; i < n; i++) bw.put((uint32_t)x[i], bps);
+}
+
+void FlacEncoder::addChannel(const int32_t *x) {
+	const int n = frame_nsamps;
+
+	//constant (such as silence)?
+	bool is_const = true;
+	for (int i = 1; i < n; i++) if (x[i] != x[0]) { is_const = false; break; }
+	if (is_const) { bw.put(0, 1); bw.put(0, 6); bw.put(0, 1); bw.put((uint32_t)x[0], bps); return; }
+	if (n <= 4) { putVerbatim(x, n); return; }
+
+	//choose the fixed predictor order from the sum of the absolute residuals of each order (all in one pass)
+	uint64_t abs_sum[5] = {0, 0, 0, 0, 0};
+	{
+		int32_t last0 = x[3], last1 = x[3] - x[2], last2 = last1 - (x[2] - x[1]), last3 = last2 - (x[2] - 2 * x[1] + x[0]);
+		for (int i = 4; i < n; i++) {
+			int32_t e0 = x[i], e1 = e0 - last0, e2 = e1 - last1, e3 = e2 - last2, e4 = e3 - last3;
+			abs_sum[0] += (uint32_t)((e0 < 0) ? -e0 : e0); abs_sum[1] += (uint32_t)((e1 < 0) ? -e1 : e1);
+			abs_sum[2] += (uint32_t)((e2 < 0) ? -e2 : e2); abs_sum[3] += (uint32_t)((e3 < 0) ? -e3 : e3);
+			abs_sum[4] += (uint32_t)((e4 < 0) ? -e4 : e4);
+			last0 = e0; last1 = e1; last2 = e2; last3 = e3;
+		}
+	}
+	int order = 0;
+	for (int k = 1; k <= 4; k++) if (abs_sum[k] < abs_sum[order]) order = k;
+
+	//compute the residual (zigzagged to unsigned) for that order
+	uint32_t *u = (uint32_t *)residual;
+	for (int i = order; i < n; i++) {
+		int32_t r;
+		switch (order) {
+			case 0: r = x[i]; break;
+			case 1: r = x[i] - x[i-1]; break;
+			case 2: r = x[i] - 2*x[i-1] + x[i-2]; break;
+			case 3: r = x[i] - 3*x[i-1] + 3*x[i-2] - x[i-3]; break;
+			default: r = x[i] - 4*x[i-1] + 6*x[i-2] - 4*x[i-3] + x[i-4]; break;
+		}
+		u[i] = ((uint32_t)r << 1) ^ (uint32_t)(r >> 31);
+	}
+
+	//the finest partition order allowed for this block
+	int p_max = 0;
+	while ((p_max < FLAC_MAX_PARTITION_ORDER) && ((n % (2 << p_max)) == 0) && ((n >> (p_max + 1)) > order)) p_max++;
+
+	//sums of the residuals in each partition, for every partition order (finest first, then merging pairs)
+	uint64_t *sums[FLAC_MAX_PARTITION_ORDER + 1];
+	{
+		uint64_t *p = partition_sums;
+		for (int po = p_max; po >= 0; po--) { sums[po] = p; p += (1 << po); }
+		const int part_len = n >> p_max;
+		int i = order;
+		for (int part = 0; part < (1 << p_max); part++) {
+			uint64_t s = 0;
+			const int end = (part + 1) * part_len;
+			for (; i < end; i++) s += u[i];
+			sums[p_max][part] = s;
+		}
+		for (int po = p_max - 1; po >= 0; po--) for (int part = 0; part < (1 << po); part++) sums[po][part] = sums[po+1][2*part] + sums[po+1][2*part+1];
+	}
+
+	//pick the partition order (and the Rice parameters) with the fewest estimated bits
+	int best_po = 0; uint64_t best_bits = 0xFFFFFFFFFFFFFFFFull;
+	for (int po = p_max; po >= 0; po--) {
+		uint64_t bits = 0;
+		for (int part = 0; part < (1 << po); part++) {
+			const uint32_t cnt = (n >> po) - ((part == 0) ? order : 0);
+			int k = 0;
+			while ((k < 30) && (((uint64_t)cnt << (k + 1)) <= sums[po][part])) k++;
+			bits += 5 + (uint64_t)cnt * (k + 1) + (sums[po][part] >> k);
+		}
+		if (bits < best_bits) { best_bits = bits; best_po = po; }
+	}
+	int rice_k[1 << FLAC_MAX_PARTITION_ORDER];
+	int max_k = 0;
+	for (int part = 0; part < (1 << best_po); part++) {
+		const uint32_t cnt = (n >> best_po) - ((part == 0) ? order : 0);
+		int k = 0;
+		while ((k < 30) && (((uint64_t)cnt << (k + 1)) <= sums[best_po][part])) k++;
+		rice_k[part] = k;
+		if (k > max_k) max_k = k;
+	}
+	const int param_bits = (max_k > 14) ? 5 : 4;  //RICE2 has the longer parameter
+
+	//exact size.  If it is not smaller than verbatim, store it verbatim.  That bounds the size and the encoding time.
+	uint64_t exact_bits = 8 + (uint64_t)order * bps + 2 + 4;
+	{
+		const int part_len = n >> best_po;
+		int i = order;
+		for (int part = 0; part < (1 << best_po); part++) {
+			const int k = rice_k[part], end = (part + 1) * part_len;
+			exact_bits += param_bits + (uint64_t)(end - i) * (k + 1);
+			for (; i < end; i++) exact_bits += (u[i] >> k);
+		}
+	}
+	if (exact_bits >= 8 + (uint64_t)n * bps) { putVerbatim(x, n); return; }
+
+	//write the FIXED subframe
+	bw.put(0, 1); bw.put(8 + order, 6); bw.put(0, 1);
+	for (int i = 0; i < order; i++) bw.put((uint32_t)x[i], bps);  //warm-up samples
+	bw.put((param_bits == 5) ? 1 : 0, 2);  //RICE or RICE2
+	bw.put(best_po, 4);
+	const int part_len = n >> best_po;
+	int i = order;
+	for (int part = 0; part < (1 << best_po); part++) {
+		const int k = rice_k[part], end = (part + 1) * part_len;
+		bw.put(k, param_bits);
+		for (; i < end; i++) bw.putRice(u[i], k);
+	}
+}
+
+uint32_t FlacEncoder::endFrame(void) {
+	bw.alignToByte();
+	bw.put(flac_crc16(frame_start, bw.getNumBytes()), 16);
+	uint32_t nbytes = bw.getNumBytes();
+
+	//keep the stats for STREAMINFO
+	if ((min_frame_bytes == 0) || (nbytes < min_frame_bytes)) min_frame_bytes = nbytes;
+	if (nbytes > max_frame_bytes) max_frame_bytes = nbytes;
+	total_samples += frame_nsamps;
+	total_bytes += nbytes;
+	frame_number++;
+	return nbytes;
+}
+
+// ///////////////////////////////////////////////////////////////////// Decoder
+
+uint32_t FlacBitReader::get(int nbits) {
+	if (nbits == 0) return 0;
+	while (n_acc < nbits) {
+		if (pos >= len) { err = true; return 0; }
+		acc = (acc << 8) | buf[pos++];
+		n_acc += 8;
+	}
+	n_acc -= nbits;
+	return (uint32_t)((acc >> n_acc) & ((nbits == 32) ? 0xFFFFFFFFull : ((1ull << nbits) - 1)));
+}
+
+int FlacDecoder::readStreamHeader(const uint8_t *buf, uint32_t len) {
+	br.begin(buf, len);
+	if (br.get(32) != 0x664C6143) return -1;  //"fLaC"
+	bool is_last = false;
+	while (!is_last && !br.isError()) {
+		is_last = br.get(1);
+		uint32_t type = br.get(7), block_len = br.get(24);
+		if (type == 0) {
+			br.get(16); max_block_size = br.get(16);
+			br.get(24); br.get(24);
+			fs_Hz = br.get(20);
+			nchan = br.get(3) + 1;
+			bps = br.get(5) + 1;
+			total_samples = ((uint64_t)br.get(4) << 32) | br.get(32);
+			for (int i = 0; i < 4; i++) br.get(32);  //MD5
+		} else {
+			for (uint32_t i = 0; i < block_len; i++) br.get(8);
+		}
+	}
+	if (br.isError() || (nchan == 0)) return -1;
+	return br.getNumBytesUsed();
+}
+
+bool FlacDecoder::decodeResidual(int32_t *out, int stride, int n, int order) {
+	int method = br.get(2);
+	if (method > 1) return false;
+	const int param_bits = (method == 1) ? 5 : 4, escape = (1 << param_bits) - 1;
+	const int po = br.get(4);
+	const int part_len = n >> po;
+	if (((part_len << po) != n) || (part_len < order)) return false;
+	int i = order;
+	for (int part = 0; part < (1 << po); part++) {
+		const int k = br.get(param_bits), end = (part + 1) * part_len;
+		if (k == escape) {
+			const int nbits = br.get(5);
+			for (; i < end; i++) out[i * stride] = br.getSigned(nbits);
+		} else {
+			for (; i < end; i++) {
+				uint32_t uval = (br.getUnary() << k) | br.get(k);
+				out[i * stride] = (int32_t)(uval >> 1) ^ -(int32_t)(uval & 1);
+			}
+		}
+		if (br.isError()) return false;
+	}
+	return true;
+}
+
+bool FlacDecoder::decodeSubframe(int32_t *out, int stride, int n, int sub_bps) {
+	if (br.get(1) != 0) return false;
+	const uint32_t type = br.get(6);
+	int wasted = 0;
+	if (br.get(1)) { wasted = 1; while (!br.isError() && (br.get(1) == 0)) wasted++; }
+	sub_bps -= wasted;
+
+	if (type == 0) {  //CONSTANT
+		int32_t val = br.getSigned(sub_bps);
+		for (int i = 0; i < n; i++) out[i * stride] = val;
+	} else if (type == 1) {  //VERBATIM
+		for (int i = 0; i < n; i++) out[i * stride] = br.getSigned(sub_bps);
+	} else if ((type >= 8) && (type <= 12)) {  //FIXED
+		const int order = type - 8;
+		for (int i = 0; i < order; i++) out[i * stride] = br.getSigned(sub_bps);
+		if (!decodeResidual(out, stride, n, order)) return false;
+		for (int i = order; i < n; i++) {
+			int64_t pred = 0;
+			switch (order) {
+				case 1: pred = out[(i-1)*stride]; break;
+				case 2: pred = 2*(int64_t)out[(i-1)*stride] - out[(i-2)*stride]; break;
+				case 3: pred = 3*(int64_t)out[(i-1)*stride] - 3*(int64_t)out[(i-2)*stride] + out[(i-3)*stride]; break;
+				case 4: pred = 4*(int64_t)out[(i-1)*stride] - 6*(int64_t)out[(i-2)*stride] + 4*(int64_t)out[(i-3)*stride] - out[(i-4)*stride]; break;
+			}
+			out[i * stride] += (int32_t)pred;
+		}
+	} else if (type >= 32) {  //LPC
+		const int order = type - 31;
+		int32_t coeff[32];
+		for (int i = 0; i < order; i++) out[i * stride] = br.getSigned(sub_bps);
+		const int precision = br.get(4) + 1;
+		if (precision == 16) return false;
+		const int shift = br.getSigned(5);
+		if (shift < 0) return false;
+		for (int j = 0; j < order; j++) coeff[j] = br.getSigned(precision);
+		if (!decodeResidual(out, stride, n, order)) return false;
+		for (int i = order; i < n; i++) {
+			int64_t sum = 0;
+			for (int j = 0; j < order; j++) sum += (int64_t)coeff[j] * out[(i - 1 - j) * stride];
+			out[i * stride] += (int32_t)(sum >> shift);
+		}
+	} else {
+		return false;  //reserved
+	}
+	if (wasted) for (int i = 0; i < n; i++) out[i * stride] <<= wasted;
+	return !br.isError();
+}
+
+int FlacDecoder::decodeFrame(const uint8_t *buf, uint32_t len, int32_t *out, int max_samps) {
+	br.begin(buf, len);
+	if (br.get(15) != (0x3FFE << 1)) return -1;  //sync code (and the reserved bit)
+	br.get(1);  //blocking strategy (either is fine here)
+	const int bs_code = br.get(4), fs_code = br.get(4), chan_code = br.get(4), bps_code = br.get(3);
+	br.get(1);
+
+	//frame (or sample) number, coded like UTF-8
+	uint32_t first = br.get(8);
+	int n_extra = 0;
+	while ((n_extra < 7) && (first & (0x80 >> n_extra))) n_extra++;
+	if (n_extra == 1) return -1;
+	for (int i = 1; i < n_extra; i++) br.get(8);
+
+	int n;
+	if (bs_code == 1) n = 192;
+	else if ((bs_code >= 2) && (bs_code <= 5)) n = 576 << (bs_code - 2);
+	else if (bs_code == 6) n = br.get(8) + 1;
+	else if (bs_code == 7) n = br.get(16) + 1;
+	else if (bs_code >= 8) n = 256 << (bs_code - 8);
+	else return -1;
+	if (fs_code == 12) br.get(8); else if ((fs_code == 13) || (fs_code == 14)) br.get(16);
+	static const int bps_table[8] = { 0, 8, 12, 0, 16, 20, 24, 32 };
+	const int frame_bps = (bps_code == 0) ? bps : bps_table[bps_code];
+	if (frame_bps == 0) return -1;
+
+	const int hdr_bytes = br.getNumBytesUsed();
+	if (br.get(8) != flac_crc8(buf, hdr_bytes)) return -1;
+	if (n > max_samps) return -1;
+
+	//the subframes
+	const int frame_nchan = (chan_code < 8) ? (chan_code + 1) : 2;
+	if ((chan_code > 10) || (frame_nchan != nchan)) return -1;
+	for (int c = 0; c < frame_nchan; c++) {
+		int sub_bps = frame_bps;
+		if (((chan_code == 8) && (c == 1)) || ((chan_code == 9) && (c == 0)) || ((chan_code == 10) && (c == 1))) sub_bps++;  //the side channel
+		if (!decodeSubframe(out + c, frame_nchan, n, sub_bps)) return -1;
+	}
+	br.alignToByte();
+	const int body_bytes = br.getNumBytesUsed();
+	if (br.get(16) != flac_crc16(buf, body_bytes)) return -1;
+
+	//undo the stereo decorrelation
+	if (chan_code >= 8) {
+		for (int i = 0; i < n; i++) {
+			int32_t a = out[2*i], b = out[2*i+1];
+			if (chan_code == 8) { out[2*i+1] = a - b; }         //left, side
+			else if (chan_code == 9) { out[2*i] = a + b; }      //side, right
+			else { int32_t mid = (a << 1) | (b & 1); out[2*i] = (mid + b) >> 1; out[2*i+1] = (mid - b) >> 1; }  //mid, side
+		}
+	}
+	last_block_size = n;
+	return br.getNumBytesUsed();
+}
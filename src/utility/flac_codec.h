@@ -0,0 +1,146 @@
+/*
+ * flac_codec
+ *
+ * Created: OpenAudio, Oct 2026
+ * Purpose: A small, real-time FLAC encoder for recording multichannel audio to the SD card, plus a
+ *    matching decoder for checking the recordings (it builds on a PC, too).
+ *
+ *    The encoder is tuned to be cheap on a Cortex-M7.  It uses only FLAC's "fixed" predictors (orders
+ *    0-4, no LPC), independent channels, and partitioned Rice coding, all in integer math.  Each frame is
+ *    a fixed number of samples and the work per channel is a fixed number of passes over those samples,
+ *    so the worst-case CPU per frame is bounded.  A channel that would not compress is stored verbatim
+ *    instead, which bounds the size of each frame, too (see getMaxFrameBytes()).
+ *
+ *    The output is a standard FLAC stream (readable by the usual FLAC tools): "fLaC", a STREAMINFO block
+ *    (optionally followed by a PADDING block), and then the frames.  The MD5 signature in STREAMINFO is
+ *    left as zero, which means "unknown".
+ *
+ *    The decoder handles any fixed-blocksize FLAC stream: constant, verbatim, fixed, and LPC subframes,
+ *    wasted bits, and the stereo decorrelation modes.
+ *
+ *	MIT License.  Use at your own risk.
+ */
+
+#ifndef flac_codec_h_
+#define flac_codec_h_
+
+#include <stdint.h>
+
+#define FLAC_MAX_CHANNELS 8
+#define FLAC_STREAMINFO_BYTES 42    //"fLaC" plus the STREAMINFO metadata block
+#define FLAC_MAX_PARTITION_ORDER 6
+
+//write a stream of bits, MSB first, into a byte buffer
+class FlacBitWriter {
+	public:
+		void begin(uint8_t *_buf) { buf = _buf; n_bytes = 0; acc = 0; n_acc = 0; }
+		inline void put(uint32_t val, int nbits) {  //nbits is 0-32
+			if (nbits == 0) return;
+			acc = (acc << nbits) | (val & ((nbits == 32) ? 0xFFFFFFFFu : ((1u << nbits) - 1)));
+			n_acc += nbits;
+			while (n_acc >= 8) { n_acc -= 8; buf[n_bytes++] = (uint8_t)(acc >> n_acc); }
+		}
+		inline void putUnary(uint32_t q) { while (q >= 32) { put(0, 32); q -= 32; } put(1, q + 1); } //q zeros, then a one
+		inline void putRice(uint32_t u, int k) {
+			uint32_t q = u >> k;
+			if ((q + 1 + k) <= 32) { put((1u << k) | (u & ((1u << k) - 1)), q + 1 + k); return; } //the common case, in one go
+			putUnary(q); put(u, k);
+		}
+		void alignToByte(void) { if (n_acc > 0) put(0, 8 - n_acc); }
+		uint32_t getNumBytes(void) { return n_bytes; }  //whole bytes written so far
+	protected:
+		uint8_t *buf = 0;
+		uint32_t n_bytes = 0;
+		uint64_t acc = 0;
+		int n_acc = 0;
+};
+
+//read a stream of bits, MSB first, from a byte buffer
+class FlacBitReader {
+	public:
+		void begin(const uint8_t *_buf, uint32_t _len) { buf = _buf; len = _len; pos = 0; n_acc = 0; acc = 0; err = false; }
+		uint32_t get(int nbits);  //nbits is 0-32
+		int32_t getSigned(int nbits) { if (nbits == 0) return 0; return ((int32_t)(get(nbits) << (32 - nbits))) >> (32 - nbits); }
+		uint32_t getUnary(void) { uint32_t q = 0; while (!err && (get(1) == 0)) q++; return q; }
+		void alignToByte(void) { n_acc -= (n_acc % 8); }
+		uint32_t getNumBytesUsed(void) { return pos - n_acc / 8; }
+		bool isError(void) { return err; }
+	protected:
+		const uint8_t *buf = 0;
+		uint32_t len = 0, pos = 0;
+		uint64_t acc = 0;
+		int n_acc = 0;
+		bool err = false;
+};
+
+class FlacEncoder {
+	public:
+		FlacEncoder(void) {};
+		~FlacEncoder(void) { delete[] residual; }
+
+		//returns 0 if OK.  bitsPerSample can be 16 or 24.  Frames are blockSize samples (per channel) long.
+		int setup(int nchan, uint32_t sampleRate_Hz, int bitsPerSample, int blockSize = 1024);
+		int getBlockSize(void) { return block_size; }
+		int getNumChannels(void) { return nchan; }
+
+		//the largest that any one frame can be, in bytes
+		static uint32_t getMaxFrameBytes(int nchan, int bitsPerSample, int blockSize) { return 18 + nchan * (2 + (blockSize * bitsPerSample + 7) / 8); }
+		uint32_t getMaxFrameBytes(void) { return getMaxFrameBytes(nchan, bps, block_size); }
+
+		//"fLaC" and STREAMINFO (with the totals so far), padded to total_bytes with a PADDING block.  Returns the number of bytes.
+		int writeStreamHeader(uint8_t *dest, int total_bytes = FLAC_STREAMINFO_BYTES);
+
+		//Encode one frame: call beginFrame(), then addChannel() once for each channel, in order, then endFrame(), which
+		//returns the number of bytes in the frame.  nsamps must be the block size, except that the very last frame can be shorter.
+		void beginFrame(int nsamps, uint8_t *dest);
+		void addChannel(const int32_t *x);
+		uint32_t endFrame(void);
+
+		uint64_t getTotalSamples(void) { return total_samples; }  //per channel
+		uint64_t getTotalBytes(void) { return total_bytes; }      //in the frames
+		uint32_t getNumFrames(void) { return frame_number; }
+
+	protected:
+		int nchan = 0, bps = 16, block_size = 0;
+		uint32_t fs_Hz = 0;
+		uint32_t frame_number = 0, min_frame_bytes = 0, max_frame_bytes = 0;
+		uint64_t total_samples = 0, total_bytes = 0;
+		int32_t *residual = 0;
+		uint64_t partition_sums[(2 << FLAC_MAX_PARTITION_ORDER) - 1];  //for each partition order, the sum of the (zigzagged) residuals in each partition
+		FlacBitWriter bw;
+		uint8_t *frame_start = 0;
+		int frame_nsamps = 0;
+
+		void putVerbatim(const int32_t *x, int n);
+};
+
+class FlacDecoder {
+	public:
+		//Read "fLaC" and the metadata blocks.  Returns the number of bytes used (ie, where the first frame starts), or -1 if not FLAC.
+		int readStreamHeader(const uint8_t *buf, uint32_t len);
+
+		//Decode one frame into out (interleaved, max_samps per channel).  Returns the number of bytes used, or -1 if the frame is
+		//bad (including a bad CRC).  The number of samples (per channel) is in getLastBlockSize().
+		int decodeFrame(const uint8_t *buf, uint32_t len, int32_t *out, int max_samps);
+
+		int getNumChannels(void) { return nchan; }
+		int getBitsPerSample(void) { return bps; }
+		uint32_t getSampleRate_Hz(void) { return fs_Hz; }
+		uint64_t getTotalSamples(void) { return total_samples; }
+		int getMaxBlockSize(void) { return max_block_size; }
+		int getLastBlockSize(void) { return last_block_size; }
+
+	protected:
+		int nchan = 0, bps = 0, max_block_size = 0, last_block_size = 0;
+		uint32_t fs_Hz = 0;
+		uint64_t total_samples = 0;
+		FlacBitReader br;
+		bool decodeSubframe(int32_t *out, int stride, int n, int sub_bps);
+		bool decodeResidual(int32_t *out, int stride, int n, int order);
+};
+
+//CRCs used by FLAC
+uint8_t flac_crc8(const uint8_t *buf, uint32_t len);
+uint16_t flac_crc16(const uint8_t *buf, uint32_t len);
+
+#endif
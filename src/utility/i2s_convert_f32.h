@@ -0,0 +1,221 @@
+/*
+ * i2s_convert_f32
+ *
+ * Created: OpenAudio, Oct 2026
+ * Purpose: Convert between the float32 audio blocks (+/-1.0 full scale) and the interleaved int16 words
+ *    in the I2S DMA buffers, in one pass.  On the way out, each sample is scaled, saturated, and packed
+ *    directly into the DMA buffer (two int16 samples per 32-bit word).  On the way in, each 32-bit DMA word
+ *    is split into its two int16 samples, which are scaled straight into the float32 audio blocks.
+ *
+ *    On Cortex-M4/M7, the float-to-int conversion (VCVT) already saturates to the int32 range, so SSAT
+ *    finishes the saturation to int16 and PKHBT packs the pair of samples, all without any branches.
+ *
+ *    For the 32-bit DMA transfers (see begin(true) on the I2S classes, and I2S_F32_ENABLE_32BIT_TRANSFERS below), each slot is its own 32-bit DMA word
+ *    and carries 24-bit data, left-justified (ie, MSB first, with the low 8 bits zero on the way out).  On
+ *    the way in, all 32 bits are kept, scaled so that a full-scale 24-bit sample is +/-1.0.
+ *
+ *    The channel order is the order of the slots in the I2S frame (eg, for the quad I2S on the Tympan,
+ *    that is chan 1, chan 3, chan 2, chan 4), so the caller passes the pointers in that order.
+ *
+ *	MIT License.  Use at your own risk.
+ */
+
+#ifndef i2s_convert_f32_h_
+#define i2s_convert_f32_h_
+
+#include <stdint.h>
+#include <arm_math.h>  //for float32_t
+
+//The default DMA buffers of the I2S classes only have room for the 32-bit transfers if this is 1.  The buffers
+//are defined in the library's .cpp files, so this must be set as a global build flag (eg, -DI2S_F32_ENABLE_32BIT_TRANSFERS=1),
+//not by a #define in the sketch.  If it is 0, the buffers are sized for 16-bit transfers only (half the RAM), and
+//begin(true) prints a warning and uses 16-bit transfers, unless the class was constructed with its own buffer.
+//For 32-bit transfers, that buffer must be 2 (stereo), 4 (quad), or 6 (hex) times audio_block_samples long, and,
+//on Teensy 4, should be DMAMEM __attribute__((aligned(32))) like the default ones.
+#ifndef I2S_F32_ENABLE_32BIT_TRANSFERS
+#define I2S_F32_ENABLE_32BIT_TRANSFERS 0
+#endif
+#define I2S_F32_DMA_BUFFER_SCALE (I2S_F32_ENABLE_32BIT_TRANSFERS ? 2 : 1)  //size of the default DMA buffers, relative to 16-bit transfers
+
+#define I2S_F32_TO_I16_SCALE   (32767.0f)                 //which is 2^15-1
+#define I2S_I16_TO_F32_SCALE   (3.051850947599719e-05f)   //which is 1/32767
+#define I2S_F32_TO_I24_SCALE   (8388607.0f)               //which is 2^23-1
+#define I2S_I32_TO_F32_SCALE   (4.656613428188971e-10f)   //which is 1/((2^23-1)*256), for 24-bit data left-justified in 32 bits
+
+// computes saturate16(x * 32767)
+static inline int32_t i2s_f32_to_i16_sat(float32_t x) __attribute__((always_inline, unused));
+static inline int32_t i2s_f32_to_i16_sat(float32_t x)
+{
+#if defined (__ARM_ARCH_7EM__)
+	int32_t val = (int32_t)(x * I2S_F32_TO_I16_SCALE);  //VCVT saturates to the int32 range (and NaN goes to zero)
+	int32_t out;
+	asm volatile("ssat %0, #16, %1" : "=r" (out) : "r" (val));
+	return out;
+#else
+	float32_t val = x * I2S_F32_TO_I16_SCALE;
+	if (!(val > -32768.0f)) val = (val != val) ? 0.0f : -32768.0f;  //also catches NaN
+	if (val > 32767.0f) val = 32767.0f;
+	return (int32_t)val;
+#endif
+}
+
+// computes saturate24(x * 8388607) << 8, ie 24-bit data left-justified in a 32-bit slot
+static inline uint32_t i2s_f32_to_i32_sat(float32_t x) __attribute__((always_inline, unused));
+static inline uint32_t i2s_f32_to_i32_sat(float32_t x)
+{
+#if defined (__ARM_ARCH_7EM__)
+	int32_t val = (int32_t)(x * I2S_F32_TO_I24_SCALE);  //VCVT saturates to the int32 range (and NaN goes to zero)
+	int32_t out;
+	asm volatile("ssat %0, #24, %1" : "=r" (out) : "r" (val));
+	return ((uint32_t)out) << 8;
+#else
+	float32_t val = x * I2S_F32_TO_I24_SCALE;
+	if (!(val > -8388608.0f)) val = (val != val) ? 0.0f : -8388608.0f;  //also catches NaN
+	if (val > 8388607.0f) val = 8388607.0f;
+	return ((uint32_t)((int32_t)val)) << 8;
+#endif
+}
+
+// computes the 32-bit DMA word holding two samples: ((hi << 16) | (lo & 0xFFFF)), ie lo goes first in memory
+static inline uint32_t i2s_f32_to_i16x2(float32_t lo, float32_t hi) __attribute__((always_inline, unused));
+static inline uint32_t i2s_f32_to_i16x2(float32_t lo, float32_t hi)
+{
+#if defined (__ARM_ARCH_7EM__)
+	uint32_t out;
+	asm volatile("pkhbt %0, %1, %2, lsl #16" : "=r" (out) : "r" (i2s_f32_to_i16_sat(lo)), "r" (i2s_f32_to_i16_sat(hi)));
+	return out;
+#else
+	return (((uint32_t)i2s_f32_to_i16_sat(hi)) << 16) | (((uint32_t)i2s_f32_to_i16_sat(lo)) & 0x0000FFFF);
+#endif
+}
+
+// the two int16 samples in a 32-bit DMA word, as floats scaled to +/-1.0
+static inline float32_t i2s_i16lo_to_f32(uint32_t w) __attribute__((always_inline, unused));
+static inline float32_t i2s_i16lo_to_f32(uint32_t w) { return ((float32_t)((int16_t)(w & 0x0000FFFF))) * I2S_I16_TO_F32_SCALE; }
+static inline float32_t i2s_i16hi_to_f32(uint32_t w) __attribute__((always_inline, unused));
+static inline float32_t i2s_i16hi_to_f32(uint32_t w) { return ((float32_t)(((int32_t)w) >> 16)) * I2S_I16_TO_F32_SCALE; }
+
+// the sample in a 32-bit DMA word (one slot), as a float scaled to +/-1.0
+static inline float32_t i2s_i32_to_f32(uint32_t w) __attribute__((always_inline, unused));
+static inline float32_t i2s_i32_to_f32(uint32_t w) { return ((float32_t)((int32_t)w)) * I2S_I32_TO_F32_SCALE; }
+
+
+//////////// float32 audio to interleaved int16 DMA words.  n is the number of samples per channel.
+
+// two slots per frame (one 32-bit word per frame)
+static inline void i2s_f32_to_i16_interleave2(uint32_t *dest, const float32_t *src1, const float32_t *src2, int n)
+{
+	for (int i = 0; i < n; i++) *dest++ = i2s_f32_to_i16x2(*src1++, *src2++);
+}
+
+// four slots per frame (two 32-bit words per frame)
+static inline void i2s_f32_to_i16_interleave4(uint32_t *dest, const float32_t *src1, const float32_t *src2,
+	const float32_t *src3, const float32_t *src4, int n)
+{
+	for (int i = 0; i < n; i++) {
+		*dest++ = i2s_f32_to_i16x2(*src1++, *src2++);
+		*dest++ = i2s_f32_to_i16x2(*src3++, *src4++);
+	}
+}
+
+// fill just one of the slots (the other slots are left alone).  If src is NULL, the slot is filled with zeros.
+static inline void i2s_f32_to_i16_slot(int16_t *dest, const float32_t *src, int n, int n_slots)
+{
+	if (src == NULL) {
+		for (int i = 0; i < n; i++) { *dest = 0; dest += n_slots; }
+	} else {
+		for (int i = 0; i < n; i++) { *dest = (int16_t)i2s_f32_to_i16_sat(*src++); dest += n_slots; }
+	}
+}
+
+
+//////////// interleaved int16 DMA words to float32 audio.  n is the number of samples per channel.
+
+static inline void i2s_i16_to_f32_deinterleave2(const uint32_t *src, float32_t *dest1, float32_t *dest2, int n)
+{
+	for (int i = 0; i < n; i++) {
+		const uint32_t w = *src++;
+		*dest1++ = i2s_i16lo_to_f32(w);  *dest2++ = i2s_i16hi_to_f32(w);
+	}
+}
+
+static inline void i2s_i16_to_f32_deinterleave4(const uint32_t *src, float32_t *dest1, float32_t *dest2,
+	float32_t *dest3, float32_t *dest4, int n)
+{
+	for (int i = 0; i < n; i++) {
+		const uint32_t w1 = *src++, w2 = *src++;
+		*dest1++ = i2s_i16lo_to_f32(w1);  *dest2++ = i2s_i16hi_to_f32(w1);
+		*dest3++ = i2s_i16lo_to_f32(w2);  *dest4++ = i2s_i16hi_to_f32(w2);
+	}
+}
+
+static inline void i2s_i16_to_f32_deinterleave6(const uint32_t *src, float32_t *dest1, float32_t *dest2,
+	float32_t *dest3, float32_t *dest4, float32_t *dest5, float32_t *dest6, int n)
+{
+	for (int i = 0; i < n; i++) {
+		const uint32_t w1 = *src++, w2 = *src++, w3 = *src++;
+		*dest1++ = i2s_i16lo_to_f32(w1);  *dest2++ = i2s_i16hi_to_f32(w1);
+		*dest3++ = i2s_i16lo_to_f32(w2);  *dest4++ = i2s_i16hi_to_f32(w2);
+		*dest5++ = i2s_i16lo_to_f32(w3);  *dest6++ = i2s_i16hi_to_f32(w3);
+	}
+}
+
+//////////// float32 audio to interleaved 32-bit DMA words (one word per slot).  n is the number of samples per channel.
+
+static inline void i2s_f32_to_i32_interleave2(uint32_t *dest, const float32_t *src1, const float32_t *src2, int n)
+{
+	for (int i = 0; i < n; i++) {
+		*dest++ = i2s_f32_to_i32_sat(*src1++);
+		*dest++ = i2s_f32_to_i32_sat(*src2++);
+	}
+}
+
+static inline void i2s_f32_to_i32_interleave4(uint32_t *dest, const float32_t *src1, const float32_t *src2,
+	const float32_t *src3, const float32_t *src4, int n)
+{
+	for (int i = 0; i < n; i++) {
+		*dest++ = i2s_f32_to_i32_sat(*src1++);  *dest++ = i2s_f32_to_i32_sat(*src2++);
+		*dest++ = i2s_f32_to_i32_sat(*src3++);  *dest++ = i2s_f32_to_i32_sat(*src4++);
+	}
+}
+
+// fill just one of the slots (the other slots are left alone).  If src is NULL, the slot is filled with zeros.
+static inline void i2s_f32_to_i32_slot(uint32_t *dest, const float32_t *src, int n, int n_slots)
+{
+	if (src == NULL) {
+		for (int i = 0; i < n; i++) { *dest = 0; dest += n_slots; }
+	} else {
+		for (int i = 0; i < n; i++) { *dest = i2s_f32_to_i32_sat(*src++); dest += n_slots; }
+	}
+}
+
+
+//////////// interleaved 32-bit DMA words (one word per slot) to float32 audio.  n is the number of samples per channel.
+
+static inline void i2s_i32_to_f32_deinterleave2(const uint32_t *src, float32_t *dest1, float32_t *dest2, int n)
+{
+	for (int i = 0; i < n; i++) {
+		*dest1++ = i2s_i32_to_f32(*src++);  *dest2++ = i2s_i32_to_f32(*src++);
+	}
+}
+
+static inline void i2s_i32_to_f32_deinterleave4(const uint32_t *src, float32_t *dest1, float32_t *dest2,
+	float32_t *dest3, float32_t *dest4, int n)
+{
+	for (int i = 0; i < n; i++) {
+		*dest1++ = i2s_i32_to_f32(*src++);  *dest2++ = i2s_i32_to_f32(*src++);
+		*dest3++ = i2s_i32_to_f32(*src++);  *dest4++ = i2s_i32_to_f32(*src++);
+	}
+}
+
+static inline void i2s_i32_to_f32_deinterleave6(const uint32_t *src, float32_t *dest1, float32_t *dest2,
+	float32_t *dest3, float32_t *dest4, float32_t *dest5, float32_t *dest6, int n)
+{
+	for (int i = 0; i < n; i++) {
+		*dest1++ = i2s_i32_to_f32(*src++);  *dest2++ = i2s_i32_to_f32(*src++);
+		*dest3++ = i2s_i32_to_f32(*src++);  *dest4++ = i2s_i32_to_f32(*src++);
+		*dest5++ = i2s_i32_to_f32(*src++);  *dest6++ = i2s_i32_to_f32(*src++);
+	}
+}
+
+#endif